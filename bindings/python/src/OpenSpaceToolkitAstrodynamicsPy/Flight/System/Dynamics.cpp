@@ -7,6 +7,10 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/SphericalHarmonicGravity.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/GravitySurrogate.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModel.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/SatelliteDynamics.cpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -21,8 +25,14 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dy
     dynamics.attr("__path__") = "ostk.astrodynamics.flight.system.dynamics" ;
 
     // Add objects to "dynamics" submodule
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_SphericalHarmonicGravity(dynamics) ;
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_GravitySurrogate(dynamics) ;
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModel(dynamics) ;
     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_SatelliteDynamics(dynamics) ;
 
+    // Add "forcemodels" submodule
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels(dynamics) ;
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
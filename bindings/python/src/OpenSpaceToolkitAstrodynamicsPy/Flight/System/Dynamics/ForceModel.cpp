@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModel.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModel ( pybind11::module& aModule                                   )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Shared ;
+
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+
+    class_<ForceModel, Shared<ForceModel>>(aModule, "ForceModel")
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<ForceModel>))
+        .def("__repr__", &(shiftToString<ForceModel>))
+
+        .def("is_defined", &ForceModel::isDefined)
+
+        .def("get_name", &ForceModel::getName)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/AtmosphericDrag.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/CentralBodyGravity.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.cpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels ( pybind11::module& aModule                                  )
+{
+
+    // Create "forcemodels" python submodule
+    auto forcemodels = aModule.def_submodule("forcemodels") ;
+
+    // Add __path__ attribute for "forcemodels" submodule
+    forcemodels.attr("__path__") = "ostk.astrodynamics.flight.system.dynamics.forcemodels" ;
+
+    // Add objects to "forcemodels" submodule
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_CentralBodyGravity(forcemodels) ;
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_ThirdBodyGravity(forcemodels) ;
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_AtmosphericDrag(forcemodels) ;
+    OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_SolarRadiationPressure(forcemodels) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
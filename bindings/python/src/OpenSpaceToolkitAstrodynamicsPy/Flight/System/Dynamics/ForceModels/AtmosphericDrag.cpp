@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/AtmosphericDrag.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/AtmosphericDrag.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_AtmosphericDrag ( pybind11::module& aModule )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Shared ;
+
+    using ostk::physics::env::obj::Celestial ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::AtmosphericDrag ;
+
+    class_<AtmosphericDrag, ForceModel, Shared<AtmosphericDrag>>(aModule, "AtmosphericDrag")
+
+        .def
+        (
+            init
+            (
+                [] (const Shared<const Celestial>& aCelestialObjectSPtr, const SatelliteSystem& aSatelliteSystem) -> AtmosphericDrag
+                {
+                    return { aCelestialObjectSPtr, aSatelliteSystem } ;
+                }
+            ),
+            arg("celestial_object"),
+            arg("satellite_system")
+        )
+
+        .def("get_celestial_object", &AtmosphericDrag::getCelestialObject)
+        .def("get_ballistic_coefficient", &AtmosphericDrag::getBallisticCoefficient)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
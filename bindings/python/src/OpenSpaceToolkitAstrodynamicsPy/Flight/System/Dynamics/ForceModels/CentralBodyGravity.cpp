@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/CentralBodyGravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/CentralBodyGravity.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_CentralBodyGravity ( pybind11::module& aModule )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Shared ;
+
+    using ostk::physics::env::obj::Celestial ;
+
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+
+    class_<CentralBodyGravity, ForceModel, Shared<CentralBodyGravity>>(aModule, "CentralBodyGravity")
+
+        .def
+        (
+            init<const Shared<const Celestial>&>(),
+            arg("celestial_object")
+        )
+
+        .def
+        (
+            init<const Shared<const Celestial>&, const SphericalHarmonicGravity&>(),
+            arg("celestial_object"),
+            arg("spherical_harmonic_gravity")
+        )
+
+        .def
+        (
+            init<const Shared<const Celestial>&, const SphericalHarmonicGravity&, const Shared<const GravitySurrogate>&>(),
+            arg("celestial_object"),
+            arg("spherical_harmonic_gravity"),
+            arg("gravity_surrogate")
+        )
+
+        .def("get_celestial_object", &CentralBodyGravity::getCelestialObject)
+        .def("get_spherical_harmonic_gravity", &CentralBodyGravity::getSphericalHarmonicGravity)
+        .def("get_gravity_surrogate", &CentralBodyGravity::getGravitySurrogate)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_SolarRadiationPressure ( pybind11::module& aModule )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Shared ;
+
+    using ostk::physics::env::obj::Celestial ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::SolarRadiationPressure ;
+
+    {
+
+        class_<SolarRadiationPressure, ForceModel, Shared<SolarRadiationPressure>> solar_radiation_pressure_class(aModule, "SolarRadiationPressure") ;
+
+        enum_<SolarRadiationPressure::ShadowModel>(solar_radiation_pressure_class, "ShadowModel")
+
+            .value("NoShadow", SolarRadiationPressure::ShadowModel::NoShadow)
+            .value("Cylindrical", SolarRadiationPressure::ShadowModel::Cylindrical)
+            .value("Conical", SolarRadiationPressure::ShadowModel::Conical)
+
+        ;
+
+        solar_radiation_pressure_class
+
+            .def
+            (
+                init<const Shared<const Celestial>&, const Shared<const Celestial>&, const SatelliteSystem&, const SolarRadiationPressure::ShadowModel&>(),
+                arg("sun"),
+                arg("occulting_body"),
+                arg("satellite_system"),
+                arg("shadow_model") = SolarRadiationPressure::ShadowModel::Conical
+            )
+
+            .def("get_shadow_model", &SolarRadiationPressure::getShadowModel)
+
+            .def_static("shadow_function", &SolarRadiationPressure::ShadowFunction, arg("position"), arg("sun_position"), arg("occulting_body_radius"), arg("sun_radius"), arg("shadow_model"))
+            .def_static("shadow_functions", &SolarRadiationPressure::ShadowFunctions, arg("positions"), arg("sun_position"), arg("occulting_body_radius"), arg("sun_radius"), arg("shadow_model"))
+
+            .def_static("string_from_shadow_model", &SolarRadiationPressure::StringFromShadowModel, arg("shadow_model"))
+
+        ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
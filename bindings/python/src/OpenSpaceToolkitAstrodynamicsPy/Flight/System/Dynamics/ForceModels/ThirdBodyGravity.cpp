@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_ForceModels_ThirdBodyGravity ( pybind11::module& aModule )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Shared ;
+
+    using ostk::physics::env::obj::Celestial ;
+
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::ThirdBodyGravity ;
+
+    class_<ThirdBodyGravity, ForceModel, Shared<ThirdBodyGravity>>(aModule, "ThirdBodyGravity")
+
+        .def
+        (
+            init<const Shared<const Celestial>&>(),
+            arg("celestial_object")
+        )
+
+        .def("get_celestial_object", &ThirdBodyGravity::getCelestialObject)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/GravitySurrogate.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_GravitySurrogate ( pybind11::module& aModule                             )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Size ;
+    using ostk::core::types::Shared ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    class_<GravitySurrogate, Shared<GravitySurrogate>>(aModule, "GravitySurrogate")
+
+        .def
+        (
+            init<const SphericalHarmonicGravity&, const Size, const double, const double, const double, const double>(),
+            arg("spherical_harmonic_gravity"),
+            arg("reference_degree"),
+            arg("minimum_radius"),
+            arg("maximum_radius"),
+            arg("radial_step") = 25e3,
+            arg("angular_step") = 1.0
+        )
+
+        .def("is_defined", &GravitySurrogate::isDefined)
+        .def("is_compatible_with", &GravitySurrogate::isCompatibleWith, arg("spherical_harmonic_gravity"))
+        .def("contains", &GravitySurrogate::contains, arg("position"))
+
+        .def("get_reference_degree", &GravitySurrogate::getReferenceDegree)
+        .def("get_minimum_radius", &GravitySurrogate::getMinimumRadius)
+        .def("get_maximum_radius", &GravitySurrogate::getMaximumRadius)
+        .def("get_node_count", &GravitySurrogate::getNodeCount)
+        .def("get_maximum_error", &GravitySurrogate::getMaximumError)
+        .def("get_acceleration_at", &GravitySurrogate::getAccelerationAt, arg("position"))
+
+        .def("save", &GravitySurrogate::save, arg("file"))
+
+        .def_static("undefined", &GravitySurrogate::Undefined)
+        .def_static("load", &GravitySurrogate::Load, arg("file"), arg("spherical_harmonic_gravity"))
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
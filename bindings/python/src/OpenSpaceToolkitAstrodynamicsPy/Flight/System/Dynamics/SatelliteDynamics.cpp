@@ -16,12 +16,16 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dy
 
     using namespace pybind11 ;
 
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Array ;
+
     using ostk::physics::time::Instant ;
     using ostk::physics::Environment ;
 
     using ostk::astro::flight::system::SatelliteSystem ;
 
     using ostk::astro::flight::system::Dynamics ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
     using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
 
     {
@@ -35,6 +39,14 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dy
                 arg("satellite_system")
             )
 
+            .def
+            (
+                init<const Environment&, const SatelliteSystem&, const Array<Shared<ForceModel>>&>(),
+                arg("environment"),
+                arg("satellite_system"),
+                arg("force_models")
+            )
+
             .def(self == self)
             .def(self != self)
 
@@ -44,8 +56,12 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dy
             .def("is_defined", &SatelliteDynamics::isDefined)
 
             .def("get_instant", &SatelliteDynamics::getInstant)
+            .def("get_force_models", &SatelliteDynamics::getForceModels)
             .def("set_instant", &SatelliteDynamics::setInstant, arg("instant"))
             .def("get_dynamical_equations", &SatelliteDynamics::getDynamicalEquations)
+            .def("get_second_order_dynamical_equations", &SatelliteDynamics::getSecondOrderDynamicalEquations)
+
+            .def_static("undefined", &SatelliteDynamics::Undefined)
 
         ;
 
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Flight/System/Dynamics/SphericalHarmonicGravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Dynamics_SphericalHarmonicGravity ( pybind11::module& aModule                     )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Size ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    class_<SphericalHarmonicGravity>(aModule, "SphericalHarmonicGravity")
+
+        .def
+        (
+            init<const double, const double, const MatrixXd&, const MatrixXd&, const double>(),
+            arg("gravitational_parameter"),
+            arg("reference_radius"),
+            arg("cosine_coefficients"),
+            arg("sine_coefficients"),
+            arg("acceleration_tolerance") = 1e-10
+        )
+
+        .def("is_defined", &SphericalHarmonicGravity::isDefined)
+
+        .def("get_gravitational_parameter", &SphericalHarmonicGravity::getGravitationalParameter)
+        .def("get_reference_radius", &SphericalHarmonicGravity::getReferenceRadius)
+        .def("get_degree", &SphericalHarmonicGravity::getDegree)
+        .def("get_acceleration_tolerance", &SphericalHarmonicGravity::getAccelerationTolerance)
+        .def("get_truncation_degree_at", &SphericalHarmonicGravity::getTruncationDegreeAt, arg("distance"))
+        .def("get_acceleration_at", overload_cast<const Vector3d&>(&SphericalHarmonicGravity::getAccelerationAt, const_), arg("position"))
+        .def("get_acceleration_at", overload_cast<const Vector3d&, const Size, const Size>(&SphericalHarmonicGravity::getAccelerationAt, const_), arg("position"), arg("degree"), arg("order"))
+
+        .def_static("undefined", &SphericalHarmonicGravity::Undefined)
+
+        .def_static
+        (
+            "load",
+            &SphericalHarmonicGravity::Load,
+            arg("file"),
+            arg("maximum_degree"),
+            arg("acceleration_tolerance") = 1e-10
+        )
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,12 +32,13 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Sa
 
             .def
             (
-                init<const Mass&, const Composite&, const Matrix3d&, const Real&, const Real&>(),
+                init<const Mass&, const Composite&, const Matrix3d&, const Real&, const Real&, const Real&>(),
                 arg("mass"),
                 arg("satellite_geometry"),
                 arg("inertia_tensor"),
                 arg("cross_sectional_surface_area"),
-                arg("drag_coefficient")
+                arg("drag_coefficient"),
+                arg("reflectivity_coefficient") = Real::Undefined()
             )
 
             .def(self == self)
@@ -51,6 +52,7 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Flight_System_Sa
             .def("get_inertia_tensor", &SatelliteSystem::getInertiaTensor)
             .def("get_cross_sectional_surface_area", &SatelliteSystem::getCrossSectionalSurfaceArea)
             .def("get_drag_coefficient", &SatelliteSystem::getDragCoefficient)
+            .def("get_reflectivity_coefficient", &SatelliteSystem::getReflectivityCoefficient)
 
         ;
 
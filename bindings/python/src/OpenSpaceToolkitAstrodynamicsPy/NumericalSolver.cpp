@@ -24,6 +24,7 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_NumericalSolver
     using ostk::physics::time::Duration ;
 
     using ostk::astro::NumericalSolver ;
+    using ostk::astro::numericalsolver::Statistics ;
 
     typedef std::function<NumericalSolver::StateVector(const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t)> pythonSystemOfEquationsSignature ;
 
@@ -35,12 +36,13 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_NumericalSolver
 
             .def
             (
-                init<const NumericalSolver::LogType&, const NumericalSolver::StepperType&, const Real&, const Real&, const Real&>(),
+                init<const NumericalSolver::LogType&, const NumericalSolver::StepperType&, const Real&, const Real&, const Real&, const NumericalSolver::InitialStepType&>(),
                 arg("log_type"),
                 arg("stepper_type"),
                 arg("time_step"),
                 arg("relative_tolerance"),
-                arg("absolute_tolerance")
+                arg("absolute_tolerance"),
+                arg("initial_step_type") = NumericalSolver::InitialStepType::UserDefined
             )
             .def(init<const NumericalSolver&>())
 
@@ -51,12 +53,22 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_NumericalSolver
             .def("__repr__", &(shiftToString<NumericalSolver>))
 
             .def("is_defined", &NumericalSolver::isDefined)
+            .def("is_second_order", &NumericalSolver::isSecondOrder)
+            .def("has_dense_output", &NumericalSolver::hasDenseOutput)
+            .def("is_evaluation_timing_enabled", &NumericalSolver::isEvaluationTimingEnabled)
 
             .def("get_stepper_type", &NumericalSolver::getStepperType)
             .def("get_log_type", &NumericalSolver::getLogType)
             .def("get_time_step", &NumericalSolver::getTimeStep)
             .def("get_relative_tolerance", &NumericalSolver::getRelativeTolerance)
             .def("get_absolute_tolerance", &NumericalSolver::getAbsoluteTolerance)
+            .def("get_initial_step_type", &NumericalSolver::getInitialStepType)
+            .def("get_statistics", &NumericalSolver::getStatistics)
+
+            .def("set_evaluation_timing", &NumericalSolver::setEvaluationTiming, arg("is_enabled"))
+
+            .def("reset_statistics", &NumericalSolver::resetStatistics)
+            .def("reset_warm_start", &NumericalSolver::resetWarmStart)
 
             .def
             (
@@ -98,6 +110,7 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_NumericalSolver
 
             .def_static("string_from_stepper_type", &NumericalSolver::StringFromStepperType, arg("stepper_type"))
             .def_static("string_from_log_type", &NumericalSolver::StringFromLogType, arg("log_type"))
+            .def_static("string_from_initial_step_type", &NumericalSolver::StringFromInitialStepType, arg("initial_step_type"))
 
         ;
 
@@ -105,6 +118,14 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_NumericalSolver
 
             .value("RungeKuttaCashKarp54", NumericalSolver::StepperType::RungeKuttaCashKarp54)
             .value("RungeKuttaFehlberg78", NumericalSolver::StepperType::RungeKuttaFehlberg78)
+            .value("RungeKuttaDopri5", NumericalSolver::StepperType::RungeKuttaDopri5)
+            .value("AdamsBashforthMoulton", NumericalSolver::StepperType::AdamsBashforthMoulton)
+            .value("BulirschStoer", NumericalSolver::StepperType::BulirschStoer)
+            .value("BulirschStoerDenseOutput", NumericalSolver::StepperType::BulirschStoerDenseOutput)
+            .value("RungeKuttaNystrom64", NumericalSolver::StepperType::RungeKuttaNystrom64)
+            .value("StormerVerlet", NumericalSolver::StepperType::StormerVerlet)
+            .value("Yoshida4", NumericalSolver::StepperType::Yoshida4)
+            .value("Yoshida6", NumericalSolver::StepperType::Yoshida6)
 
         ;
 
@@ -116,6 +137,37 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_NumericalSolver
 
         ;
 
+        enum_<NumericalSolver::InitialStepType>(numericalSolver, "InitialStepType")
+
+            .value("UserDefined", NumericalSolver::InitialStepType::UserDefined)
+            .value("Automatic", NumericalSolver::InitialStepType::Automatic)
+            .value("WarmStart", NumericalSolver::InitialStepType::WarmStart)
+
+        ;
+
+        class_<Statistics>(numericalSolver, "Statistics")
+
+            .def(init<>())
+
+            .def(self == self)
+            .def(self != self)
+            .def(self + self)
+
+            .def("__str__", &(shiftToString<Statistics>))
+            .def("__repr__", &(shiftToString<Statistics>))
+
+            .def("get_evaluation_count", &Statistics::getEvaluationCount)
+            .def("get_accepted_step_count", &Statistics::getAcceptedStepCount)
+            .def("get_rejected_step_count", &Statistics::getRejectedStepCount)
+            .def("get_minimum_step_size", &Statistics::getMinimumStepSize)
+            .def("get_maximum_step_size", &Statistics::getMaximumStepSize)
+            .def("get_mean_step_size", &Statistics::getMeanStepSize)
+            .def("get_evaluation_wall_time", &Statistics::getEvaluationWallTime)
+
+            .def("reset", &Statistics::reset)
+
+        ;
+
     }
 
 }
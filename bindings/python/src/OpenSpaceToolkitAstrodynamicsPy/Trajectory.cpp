@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Model.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Models.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Propagator.cpp>
@@ -59,6 +60,7 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory  (
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(trajectory) ;
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(trajectory) ;
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model(trajectory) ;
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Models(trajectory) ;
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(trajectory) ;
 
 }
@@ -0,0 +1,28 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Trajectory/Models.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Models/Ephemeris.cpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Models (     pybind11::module&           aModule                                     )
+{
+
+    // Create "models" python submodule
+    auto models = aModule.def_submodule("models") ;
+
+    // Add __path__ attribute for "models" submodule
+    models.attr("__path__") = "ostk.astrodynamics.trajectory.models" ;
+
+    // add objects to "models" submodule
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Models_Ephemeris(models) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           bindings/python/src/OpenSpaceToolkitAstrodynamicsPy/Trajectory/Models/Ephemeris.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Models_Ephemeris (   pybind11::module&   aModule                                     )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+
+    using ostk::astro::trajectory::State ;
+    using ostk::astro::trajectory::models::Ephemeris ;
+
+    class_<Ephemeris, ostk::astro::trajectory::Model>(aModule, "Ephemeris")
+
+        .def
+        (
+            init<const Array<State>&, const Array<Vector3d>&>(),
+            arg("node_state_array"),
+            arg("node_acceleration_array")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<Ephemeris>))
+        .def("__repr__", &(shiftToString<Ephemeris>))
+
+        .def("is_defined", &Ephemeris::isDefined)
+
+        .def("get_interval", &Ephemeris::getInterval)
+        .def("get_step_count", &Ephemeris::getStepCount)
+        .def("get_node_state_array", &Ephemeris::getNodeStateArray)
+
+        .def("calculate_state_at", &Ephemeris::calculateStateAt, arg("instant"))
+
+        .def("add", &Ephemeris::add, arg("ephemeris"))
+
+        .def_static("undefined", &Ephemeris::Undefined)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,18 +33,20 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit
 
             .def
             (
-                init<const SatelliteDynamics&, const NumericalSolver&, const State&>(),
+                init<const SatelliteDynamics&, const NumericalSolver&, const State&, const bool>(),
                 arg("satellite_dynamics"),
                 arg("numerical_solver"),
-                arg("state")
+                arg("state"),
+                arg("retain_ephemeris") = false
             )
 
             .def
             (
-                init<const SatelliteDynamics&, const NumericalSolver&, const Array<State>&>(),
+                init<const SatelliteDynamics&, const NumericalSolver&, const Array<State>&, const bool>(),
                 arg("satellite_dynamics"),
                 arg("numerical_solver"),
-                arg("state_array")
+                arg("state_array"),
+                arg("retain_ephemeris") = false
             )
 
             .def(self == self)
@@ -54,9 +56,13 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit
             .def("__repr__", &(shiftToString<Propagated>))
 
             .def("is_defined", &Propagated::isDefined)
+            .def("is_ephemeris_retained", &Propagated::isEphemerisRetained)
 
             .def("get_epoch", &Propagated::getEpoch)
             .def("get_revolution_number_at_epoch", &Propagated::getRevolutionNumberAtEpoch)
+            .def("get_statistics", &Propagated::getStatistics)
+
+            .def("reset_statistics", &Propagated::resetStatistics)
 
             .def
             (
@@ -81,6 +87,7 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit
 
             .def("access_cached_state_array", &Propagated::accessCachedStateArray)
             .def("access_propagator", &Propagated::accessPropagator)
+            .def("get_ephemeris", &Propagated::getEphemeris)
 
             .def(
                 "set_cached_state_array",
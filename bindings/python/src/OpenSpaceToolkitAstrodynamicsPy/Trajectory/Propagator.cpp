@@ -16,6 +16,9 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propa
 
     using namespace pybind11 ;
 
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
     using ostk::physics::time::Instant ;
     using ostk::physics::coord::Position ;
     using ostk::physics::coord::Velocity ;
@@ -25,13 +28,16 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propa
     using ostk::astro::trajectory::Propagator ;
     using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
     
-    class_<Propagator>(aModule, "Propagator")
+    class_<Propagator> propagator(aModule, "Propagator") ;
+
+    propagator
 
         .def
         (
-            init<const SatelliteDynamics&, const NumericalSolver&>(),
+            init<const SatelliteDynamics&, const NumericalSolver&, const Propagator::FormulationType&>(),
             arg("satellite_dynamics"),
-            arg("numerical_solver")
+            arg("numerical_solver"),
+            arg("formulation_type") = Propagator::FormulationType::Cowell
         )
 
         .def("__str__", &(shiftToString<Propagator>))
@@ -39,6 +45,12 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propa
 
         .def("is_defined", &Propagator::isDefined)
 
+        .def("get_formulation_type", &Propagator::getFormulationType)
+
+        .def("get_statistics", &Propagator::getStatistics)
+
+        .def("reset_statistics", &Propagator::resetStatistics)
+
         .def
         (
             "calculate_state_at",
@@ -50,11 +62,37 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propa
         .def
         (
             "calculate_states_at",
-            &Propagator::calculateStatesAt,
+            overload_cast<const State&, const Array<Instant>&>(&Propagator::calculateStatesAt, const_),
             arg("state"),
             arg("instant_array")
         )
 
+        .def
+        (
+            "calculate_states_at",
+            overload_cast<const Array<State>&, const Array<Instant>&, const Size&>(&Propagator::calculateStatesAt, const_),
+            arg("state_array"),
+            arg("instant_array"),
+            arg("thread_count") = 0,
+            call_guard<gil_scoped_release>()
+        )
+
+        .def
+        (
+            "calculate_ephemeris",
+            &Propagator::calculateEphemeris,
+            arg("state"),
+            arg("interval")
+        )
+
+        .def
+        (
+            "calculate_state_and_state_transition_matrix_at",
+            &Propagator::calculateStateAndStateTransitionMatrixAt,
+            arg("state"),
+            arg("instant")
+        )
+
         .def_static
         (
             "medium_fidelity",
@@ -67,6 +105,26 @@ inline void                     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propa
             &Propagator::HighFidelity
         )
 
+        .def_static
+        (
+            "low_fidelity",
+            &Propagator::LowFidelity
+        )
+
+        .def_static("string_from_formulation_type", &Propagator::StringFromFormulationType, arg("formulation_type"))
+
+        .def_static("get_thread_count", &Propagator::GetThreadCount)
+
+        .def_static("set_thread_count", &Propagator::SetThreadCount, arg("thread_count"))
+
+    ;
+
+    enum_<Propagator::FormulationType>(propagator, "FormulationType")
+
+        .value("Cowell", Propagator::FormulationType::Cowell)
+        .value("Encke", Propagator::FormulationType::Encke)
+        .value("KustaanheimoStiefel", Propagator::FormulationType::KustaanheimoStiefel)
+
     ;
 
 }
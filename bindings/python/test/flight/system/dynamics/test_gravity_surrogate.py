@@ -0,0 +1,68 @@
+################################################################################################################################################################
+
+# @project        Open Space Toolkit ▸ Astrodynamics
+# @file           bindings/python/test/flight/system/dynamics/test_gravity_surrogate.py
+# @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+# @license        Apache License 2.0
+
+################################################################################################################################################################
+
+import pytest
+
+import numpy as np
+
+from ostk.astrodynamics.flight.system.dynamics import SphericalHarmonicGravity
+from ostk.astrodynamics.flight.system.dynamics import GravitySurrogate
+
+################################################################################################################################################################
+
+@pytest.fixture
+def spherical_harmonic_gravity () -> SphericalHarmonicGravity:
+
+    cosine_coefficients = np.zeros((4, 4))
+    sine_coefficients = np.zeros((4, 4))
+
+    cosine_coefficients[0, 0] = 1.0
+    cosine_coefficients[2, 0] = -4.84165143790815e-04
+    cosine_coefficients[3, 0] = 9.57161207093473e-07
+    cosine_coefficients[3, 1] = 2.03046201047864e-06
+    sine_coefficients[3, 1] = 2.48200415856872e-07
+
+    return SphericalHarmonicGravity(3.986004415e14, 6378136.3, cosine_coefficients, sine_coefficients)
+
+@pytest.fixture
+def gravity_surrogate (spherical_harmonic_gravity: SphericalHarmonicGravity) -> GravitySurrogate:
+
+    return GravitySurrogate(spherical_harmonic_gravity, 2, 6578e3, 8378e3, 100e3, 5.0)
+
+################################################################################################################################################################
+
+class TestGravitySurrogate:
+
+    def test_constructor_success (self, gravity_surrogate: GravitySurrogate):
+
+        assert isinstance(gravity_surrogate, GravitySurrogate)
+        assert gravity_surrogate.is_defined()
+        assert gravity_surrogate.get_reference_degree() == 2
+        assert gravity_surrogate.get_node_count() == 19 * 37 * 72
+
+        assert GravitySurrogate.undefined().is_defined() is False
+
+    def test_is_compatible_with_success (self, spherical_harmonic_gravity: SphericalHarmonicGravity, gravity_surrogate: GravitySurrogate):
+
+        assert gravity_surrogate.is_compatible_with(spherical_harmonic_gravity)
+
+        other_spherical_harmonic_gravity = SphericalHarmonicGravity(3.986004418e14, 6378136.3, np.eye(4), np.zeros((4, 4)))
+
+        assert gravity_surrogate.is_compatible_with(other_spherical_harmonic_gravity) is False
+
+    def test_get_acceleration_at_success (self, spherical_harmonic_gravity: SphericalHarmonicGravity, gravity_surrogate: GravitySurrogate):
+
+        position = np.array([4000e3, -3000e3, 4500e3])
+
+        reference_acceleration = spherical_harmonic_gravity.get_acceleration_at(position, 3, 3) - spherical_harmonic_gravity.get_acceleration_at(position, 2, 2)
+
+        assert gravity_surrogate.contains(position)
+        assert np.linalg.norm(gravity_surrogate.get_acceleration_at(position) - reference_acceleration) < 2.0 * gravity_surrogate.get_maximum_error()
+
+################################################################################################################################################################
@@ -27,6 +27,9 @@ from ostk.physics.coordinate import Frame
 from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.flight.system import SatelliteSystem
 from ostk.astrodynamics.flight.system.dynamics import SatelliteDynamics
+from ostk.astrodynamics.flight.system.dynamics.forcemodels import AtmosphericDrag
+from ostk.astrodynamics.flight.system.dynamics.forcemodels import CentralBodyGravity
+from ostk.astrodynamics.flight.system.dynamics.forcemodels import ThirdBodyGravity
 
 ################################################################################################################################################################
 
@@ -67,11 +70,30 @@ class TestSatelliteDynamics:
         assert isinstance(satellite_dynamics, SatelliteDynamics)
         assert satellite_dynamics.is_defined()
 
+    def test_constructor_force_models_success (self, satellite_dynamics_default_inputs):
+
+        (environment, satellite_system, _) = satellite_dynamics_default_inputs
+
+        force_models = [
+            CentralBodyGravity(environment.access_celestial_object_with_name('Earth')),
+            ThirdBodyGravity(environment.access_celestial_object_with_name('Moon')),
+            AtmosphericDrag(environment.access_celestial_object_with_name('Earth'), satellite_system),
+        ]
+
+        satellite_dynamics = SatelliteDynamics(environment, satellite_system, force_models)
+
+        assert satellite_dynamics.is_defined()
+        assert [force_model.get_name() for force_model in satellite_dynamics.get_force_models()] == ['Earth Gravity', 'Moon Gravity', 'Earth Atmospheric Drag']
+
     def test_comparators_success (self, satellite_dynamics: SatelliteDynamics):
 
         assert (satellite_dynamics == satellite_dynamics) is True
         assert (satellite_dynamics != satellite_dynamics) is False
 
+    def test_undefined_success (self):
+
+        assert SatelliteDynamics.undefined().is_defined() is False
+
     def test_getters_setters_success (self, satellite_dynamics_default_inputs, satellite_dynamics: SatelliteDynamics):
 
         (_, _, state) = satellite_dynamics_default_inputs
@@ -91,4 +113,13 @@ class TestSatelliteDynamics:
 
         assert satellite_dynamics.get_dynamical_equations() is not None  # Returns "<function PyCapsule.>" builtin_function_or_method
 
+    def test_get_second_order_dynamical_equations (self, satellite_dynamics: SatelliteDynamics):
+
+        with pytest.raises(RuntimeError):
+            satellite_dynamics.get_second_order_dynamical_equations()
+
+        satellite_dynamics.set_instant(Instant.J2000())
+
+        assert satellite_dynamics.get_second_order_dynamical_equations() is not None
+
 ################################################################################################################################################################
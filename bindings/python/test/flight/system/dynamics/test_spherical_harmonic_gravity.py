@@ -0,0 +1,57 @@
+################################################################################################################################################################
+
+# @project        Open Space Toolkit ▸ Astrodynamics
+# @file           bindings/python/test/flight/system/dynamics/test_spherical_harmonic_gravity.py
+# @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+# @license        Apache License 2.0
+
+################################################################################################################################################################
+
+import pytest
+
+import numpy as np
+
+from ostk.astrodynamics.flight.system.dynamics import SphericalHarmonicGravity
+
+################################################################################################################################################################
+
+@pytest.fixture
+def spherical_harmonic_gravity () -> SphericalHarmonicGravity:
+
+    cosine_coefficients = np.zeros((3, 3))
+    sine_coefficients = np.zeros((3, 3))
+
+    cosine_coefficients[0, 0] = 1.0
+    cosine_coefficients[2, 0] = -4.84165143790815e-04
+
+    return SphericalHarmonicGravity(3.986004415e14, 6378136.3, cosine_coefficients, sine_coefficients)
+
+################################################################################################################################################################
+
+class TestSphericalHarmonicGravity:
+
+    def test_constructor_success (self, spherical_harmonic_gravity: SphericalHarmonicGravity):
+
+        assert isinstance(spherical_harmonic_gravity, SphericalHarmonicGravity)
+        assert spherical_harmonic_gravity.is_defined()
+        assert spherical_harmonic_gravity.get_degree() == 2
+        assert spherical_harmonic_gravity.get_acceleration_tolerance() == 1e-10
+
+        assert SphericalHarmonicGravity.undefined().is_defined() is False
+
+    def test_get_acceleration_at_success (self, spherical_harmonic_gravity: SphericalHarmonicGravity):
+
+        position = np.array([7000e3, 0.0, 0.0])
+
+        point_mass_acceleration = spherical_harmonic_gravity.get_acceleration_at(position, 0, 0)
+        acceleration = spherical_harmonic_gravity.get_acceleration_at(position)
+
+        assert point_mass_acceleration == pytest.approx([-3.986004415e14 / 7000e3**2, 0.0, 0.0])
+        assert acceleration[0] < point_mass_acceleration[0]
+
+    def test_get_truncation_degree_at_success (self, spherical_harmonic_gravity: SphericalHarmonicGravity):
+
+        assert spherical_harmonic_gravity.get_truncation_degree_at(7000e3) == 2
+        assert spherical_harmonic_gravity.get_truncation_degree_at(1e12) == 0
+
+################################################################################################################################################################
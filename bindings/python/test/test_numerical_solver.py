@@ -59,6 +59,8 @@ class TestNumericalSolver:
         assert numericalsolver_2 is not None
         assert isinstance(numericalsolver_2, NumericalSolver)
         assert numericalsolver_2.is_defined()
+        assert numericalsolver_2.is_second_order() is False
+        assert numericalsolver_2.has_dense_output() is False
 
     def test_comparators (self, numerical_solver: NumericalSolver):
 
@@ -76,14 +78,26 @@ class TestNumericalSolver:
         assert numerical_solver.get_time_step() == initial_time_step
         assert numerical_solver.get_relative_tolerance() == relative_tolerance
         assert numerical_solver.get_absolute_tolerance() == absolute_tolerance
+        assert numerical_solver.get_initial_step_type() == NumericalSolver.InitialStepType.UserDefined
 
     def test_get_string_from_types (self):
 
         assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.RungeKuttaCashKarp54) == 'RungeKuttaCashKarp54'
         assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.RungeKuttaFehlberg78) == 'RungeKuttaFehlberg78'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.RungeKuttaDopri5) == 'RungeKuttaDopri5'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.AdamsBashforthMoulton) == 'AdamsBashforthMoulton'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.BulirschStoer) == 'BulirschStoer'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.BulirschStoerDenseOutput) == 'BulirschStoerDenseOutput'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.RungeKuttaNystrom64) == 'RungeKuttaNystrom64'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.StormerVerlet) == 'StormerVerlet'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.Yoshida4) == 'Yoshida4'
+        assert NumericalSolver.string_from_stepper_type(NumericalSolver.StepperType.Yoshida6) == 'Yoshida6'
         assert NumericalSolver.string_from_log_type(NumericalSolver.LogType.NoLog) == 'NoLog'
         assert NumericalSolver.string_from_log_type(NumericalSolver.LogType.LogConstant) == 'LogConstant'
         assert NumericalSolver.string_from_log_type(NumericalSolver.LogType.LogAdaptive) == 'LogAdaptive'
+        assert NumericalSolver.string_from_initial_step_type(NumericalSolver.InitialStepType.UserDefined) == 'UserDefined'
+        assert NumericalSolver.string_from_initial_step_type(NumericalSolver.InitialStepType.Automatic) == 'Automatic'
+        assert NumericalSolver.string_from_initial_step_type(NumericalSolver.InitialStepType.WarmStart) == 'WarmStart'
 
     def test_integrate_state_for_duration (self, numerical_solver: NumericalSolver):
 
@@ -118,4 +132,70 @@ class TestNumericalSolver:
         assert 5e-9 >= abs(prop_state_vector[0] - math.sin((end_instant - start_instant).in_seconds()))
         assert 5e-9 >= abs(prop_state_vector[1] - math.cos((end_instant - start_instant).in_seconds()))
 
+    def test_integrate_state_with_initial_step_type (self, numerical_solver_default_inputs):
+
+        def oscillator (x, dxdt, t):
+            dxdt[0] = x[1]
+            dxdt[1] = -x[0]
+            return dxdt
+
+        for initial_step_type in (NumericalSolver.InitialStepType.Automatic, NumericalSolver.InitialStepType.WarmStart):
+
+            numerical_solver = NumericalSolver(*numerical_solver_default_inputs, initial_step_type = initial_step_type)
+
+            for _ in range(2):
+
+                prop_state_vector = numerical_solver.integrate_state_for_duration(np.array([0., 1.]), Duration.seconds(100.0), oscillator)
+
+                assert 5e-9 >= abs(prop_state_vector[0] - math.sin(100.0))
+                assert 5e-9 >= abs(prop_state_vector[1] - math.cos(100.0))
+
+            numerical_solver.reset_warm_start()
+
+    def test_get_statistics (self, numerical_solver: NumericalSolver):
+
+        statistics: NumericalSolver.Statistics = numerical_solver.get_statistics()
+
+        assert statistics == NumericalSolver.Statistics()
+        assert statistics.get_evaluation_count() == 0
+
+        def oscillator (x, dxdt, t):
+            dxdt[0] = x[1]
+            dxdt[1] = -x[0]
+            return dxdt
+
+        numerical_solver.integrate_state_for_duration(np.array([0., 1.]), Duration.seconds(100.0), oscillator)
+
+        statistics = numerical_solver.get_statistics()
+
+        assert statistics.get_evaluation_count() > 0
+        assert statistics.get_accepted_step_count() > 0
+        assert statistics.get_mean_step_size().in_seconds() > 0.0
+        assert statistics.get_minimum_step_size() <= statistics.get_maximum_step_size()
+
+        numerical_solver.reset_statistics()
+
+        assert numerical_solver.get_statistics() == NumericalSolver.Statistics()
+
+    def test_evaluation_timing (self, numerical_solver: NumericalSolver):
+
+        assert numerical_solver.is_evaluation_timing_enabled() is False
+
+        def oscillator (x, dxdt, t):
+            dxdt[0] = x[1]
+            dxdt[1] = -x[0]
+            return dxdt
+
+        numerical_solver.integrate_state_for_duration(np.array([0., 1.]), Duration.seconds(100.0), oscillator)
+
+        assert numerical_solver.get_statistics().get_evaluation_wall_time().in_seconds() == 0.0
+
+        numerical_solver.set_evaluation_timing(True)
+
+        assert numerical_solver.is_evaluation_timing_enabled() is True
+
+        numerical_solver.integrate_state_for_duration(np.array([0., 1.]), Duration.seconds(100.0), oscillator)
+
+        assert numerical_solver.get_statistics().get_evaluation_wall_time().in_seconds() > 0.0
+
 ################################################################################################################################################################
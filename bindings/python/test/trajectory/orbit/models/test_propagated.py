@@ -18,6 +18,7 @@ from ostk.mathematics.geometry.d3.objects import Point
 from ostk.physics import Environment
 from ostk.physics.units import Mass
 from ostk.physics.time import Instant
+from ostk.physics.time import Interval
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
@@ -32,6 +33,7 @@ from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.trajectory import Orbit
 from ostk.astrodynamics.trajectory import Propagator
 from ostk.astrodynamics.trajectory.orbit.models import Propagated
+from ostk.astrodynamics.trajectory.models import Ephemeris
 
 ################################################################################################################################################################
 
@@ -200,4 +202,33 @@ class TestPropagated:
         with pytest.raises(Exception) as e:
             propagated.set_cached_state_array([])
 
+    def test_retain_ephemeris (self,
+                               propagated: Propagated,
+                               propagated_default_inputs):
+
+        (satellite_dynamics, numerical_solver, state, _) = propagated_default_inputs
+
+        retained_propagated = Propagated(satellite_dynamics, numerical_solver, state, retain_ephemeris = True)
+
+        assert propagated.is_ephemeris_retained() is False
+        assert retained_propagated.is_ephemeris_retained() is True
+
+        assert retained_propagated.get_ephemeris().is_defined() is False
+
+        instant_array = [Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC), Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC)]
+
+        retained_state_array = retained_propagated.calculate_states_at(instant_array)
+        state_array = propagated.calculate_states_at(instant_array)
+
+        for (retained_state, reference_state) in zip(retained_state_array, state_array):
+
+            assert retained_state.get_instant() == reference_state.get_instant()
+            assert np.allclose(retained_state.get_position().get_coordinates(), reference_state.get_position().get_coordinates(), rtol = 0.0, atol = 1e-3)
+            assert np.allclose(retained_state.get_velocity().get_coordinates(), reference_state.get_velocity().get_coordinates(), rtol = 0.0, atol = 1e-6)
+
+        ephemeris: Ephemeris = retained_propagated.get_ephemeris()
+
+        assert isinstance(ephemeris, Ephemeris)
+        assert ephemeris.get_interval() == Interval.closed(state.get_instant(), instant_array[-1])
+
 ################################################################################################################################################################
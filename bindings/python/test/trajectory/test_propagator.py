@@ -17,6 +17,8 @@ from ostk.mathematics.geometry.d3.objects import Point
 
 from ostk.physics.units import Mass
 from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.time import Duration
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
@@ -30,6 +32,7 @@ from ostk.astrodynamics.flight.system import SatelliteSystem
 from ostk.astrodynamics.flight.system.dynamics import SatelliteDynamics
 from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory.models import Ephemeris
 
 ################################################################################################################################################################
 
@@ -118,6 +121,144 @@ class TestPropagated:
             instant_array.reverse()
             propagator.calculate_states_at(state, instant_array)
 
+    def test_calculate_states_with_state_array (self,
+                                                propagator: Propagator,
+                                                propagator_default_inputs):
+
+        (_, _, state) = propagator_default_inputs
+
+        frame: Frame = Frame.GCRF()
+
+        state_array = [state] + [State(state.get_instant(), Position.meters([7500000.0 + 10000.0 * i, 0.0, 0.0], frame), state.get_velocity()) for i in range(1, 4)]
+        instant_array = [Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC), Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC)]
+
+        propagated_states = propagator.calculate_states_at(state_array, instant_array, 2)
+
+        assert len(propagated_states) == len(state_array) * len(instant_array)
+
+        for (i, state_i) in enumerate(state_array):
+
+            reference_states = propagator.calculate_states_at(state_i, instant_array)
+
+            for (k, reference_state) in enumerate(reference_states):
+
+                propagated_state = propagated_states[i * len(instant_array) + k]
+
+                assert propagated_state.get_instant() == instant_array[k]
+                assert np.allclose(propagated_state.get_position().get_coordinates(), reference_state.get_position().get_coordinates(), rtol = 0.0, atol = 1e-6)
+                assert np.allclose(propagated_state.get_velocity().get_coordinates(), reference_state.get_velocity().get_coordinates(), rtol = 0.0, atol = 1e-9)
+
+        assert len(propagator.calculate_states_at(state_array = state_array, instant_array = instant_array)) == len(state_array) * len(instant_array)
+
+        default_thread_count: int = Propagator.get_thread_count()
+
+        Propagator.set_thread_count(2)
+
+        assert Propagator.get_thread_count() == 2
+        assert len(propagator.calculate_states_at(state_array, instant_array, 4)) == len(state_array) * len(instant_array)
+
+        Propagator.set_thread_count(0)
+
+        assert Propagator.get_thread_count() == default_thread_count
+
+    def test_calculate_state_and_state_transition_matrix (self,
+                                                          propagator: Propagator,
+                                                          propagator_default_inputs):
+
+        (_, _, state) = propagator_default_inputs
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        (propagator_state, state_transition_matrix) = propagator.calculate_state_and_state_transition_matrix_at(state, instant)
+
+        reference_state = propagator.calculate_state_at(state, instant)
+
+        assert propagator_state.get_instant() == instant
+        assert np.allclose(propagator_state.get_position().get_coordinates(), reference_state.get_position().get_coordinates(), rtol = 0.0, atol = 1e-6)
+        assert np.allclose(propagator_state.get_velocity().get_coordinates(), reference_state.get_velocity().get_coordinates(), rtol = 0.0, atol = 1e-9)
+
+        assert state_transition_matrix.shape == (6, 6)
+
+    def test_encke_formulation (self,
+                                propagator: Propagator,
+                                propagator_default_inputs):
+
+        (satellite_dynamics, _, state) = propagator_default_inputs
+
+        assert propagator.get_formulation_type() == Propagator.FormulationType.Cowell
+
+        encke_numerical_solver = NumericalSolver(
+            NumericalSolver.LogType.NoLog,
+            NumericalSolver.StepperType.RungeKuttaFehlberg78,
+            5.0,
+            1.0e-10,
+            1.0e-10,
+        )
+
+        encke_propagator = Propagator(satellite_dynamics, encke_numerical_solver, Propagator.FormulationType.Encke)
+
+        assert encke_propagator.is_defined()
+        assert encke_propagator.get_formulation_type() == Propagator.FormulationType.Encke
+        assert Propagator.string_from_formulation_type(Propagator.FormulationType.Encke) == 'Encke'
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        encke_state = encke_propagator.calculate_state_at(state, instant)
+        reference_state = propagator.calculate_state_at(state, instant)
+
+        assert encke_state.get_instant() == instant
+        assert np.allclose(encke_state.get_position().get_coordinates(), reference_state.get_position().get_coordinates(), rtol = 0.0, atol = 1e-3)
+        assert np.allclose(encke_state.get_velocity().get_coordinates(), reference_state.get_velocity().get_coordinates(), rtol = 0.0, atol = 1e-6)
+
+    def test_kustaanheimo_stiefel_formulation (self,
+                                               propagator: Propagator,
+                                               propagator_default_inputs):
+
+        (satellite_dynamics, numerical_solver, state) = propagator_default_inputs
+
+        ks_propagator = Propagator(satellite_dynamics, numerical_solver, Propagator.FormulationType.KustaanheimoStiefel)
+
+        assert ks_propagator.is_defined()
+        assert ks_propagator.get_formulation_type() == Propagator.FormulationType.KustaanheimoStiefel
+        assert Propagator.string_from_formulation_type(Propagator.FormulationType.KustaanheimoStiefel) == 'KustaanheimoStiefel'
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        ks_state = ks_propagator.calculate_state_at(state, instant)
+        reference_state = propagator.calculate_state_at(state, instant)
+
+        assert ks_state.get_instant() == instant
+        assert np.allclose(ks_state.get_position().get_coordinates(), reference_state.get_position().get_coordinates(), rtol = 0.0, atol = 1e-3)
+        assert np.allclose(ks_state.get_velocity().get_coordinates(), reference_state.get_velocity().get_coordinates(), rtol = 0.0, atol = 1e-6)
+
+    def test_calculate_ephemeris (self,
+                                  propagator: Propagator,
+                                  propagator_default_inputs):
+
+        (_, _, state) = propagator_default_inputs
+
+        interval: Interval = Interval.closed(state.get_instant(), state.get_instant() + Duration.minutes(30.0))
+
+        ephemeris: Ephemeris = propagator.calculate_ephemeris(state, interval)
+
+        assert isinstance(ephemeris, Ephemeris)
+        assert ephemeris.is_defined()
+        assert ephemeris.get_interval() == interval
+        assert ephemeris.get_step_count() > 0
+        assert len(ephemeris.get_node_state_array()) == ephemeris.get_step_count() + 1
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        ephemeris_state = ephemeris.calculate_state_at(instant)
+        reference_state = propagator.calculate_state_at(state, instant)
+
+        assert ephemeris_state.get_instant() == instant
+        assert np.allclose(ephemeris_state.get_position().get_coordinates(), reference_state.get_position().get_coordinates(), rtol = 0.0, atol = 1e-3)
+        assert np.allclose(ephemeris_state.get_velocity().get_coordinates(), reference_state.get_velocity().get_coordinates(), rtol = 0.0, atol = 1e-6)
+
+        with pytest.raises(RuntimeError):
+            ephemeris.calculate_state_at(state.get_instant() + Duration.hours(1.0))
+
     def test_static_methods (self):
 
         propagator = Propagator.medium_fidelity()
@@ -132,4 +273,10 @@ class TestPropagated:
         assert isinstance(propagator, Propagator)
         assert propagator.is_defined()
 
+        propagator = Propagator.low_fidelity()
+
+        assert propagator is not None
+        assert isinstance(propagator, Propagator)
+        assert propagator.is_defined()
+
 ################################################################################################################################################################
@@ -72,6 +72,16 @@ class Dynamics
 
         virtual DynamicalEquationWrapper getDynamicalEquations              ( ) = 0 ;
 
+        /// @brief              Obtain second order dynamical equations function wrapper
+        ///
+        ///                     The state vector holds the positions, followed by the velocities. The equations only return the accelerations,
+        ///                     into the second half of the state vector derivative, to be integrated with a second order (Runge-Kutta-Nystrom or symplectic) stepper.
+        ///                     Dynamics not expressed as second order equations do not implement them.
+        ///
+        /// @return             std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+
+        virtual DynamicalEquationWrapper getSecondOrderDynamicalEquations   ( ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
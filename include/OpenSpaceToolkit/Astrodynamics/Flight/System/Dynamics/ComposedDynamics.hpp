@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/ExponentialDrag.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/J2Gravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/PointMassGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics.hpp>
+
+#include <functional>
+#include <vector>
+#include <tuple>
+#include <cstddef>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::astro::flight::system::Dynamics ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Dynamics composed at compile time from acceleration terms
+///
+///                             The terms are held by value and summed with a fold expression over raw double arrays, so that the compiler can
+///                             inline the whole right-hand side: no virtual call, no std::function, no frame or unit object per evaluation.
+///                             The state is the position [m] and velocity [m/s] in an inertial frame whose Z axis is the pole of the central body
+///                             (e.g. GCRF for Earth, neglecting precession and nutation), and the dynamics are autonomous.
+///
+///                             A term is a class providing:
+///                             - bool isDefined ( ) const
+///                             - void print ( std::ostream&, bool ) const
+///                             - void addAccelerationAt ( const double* x, const double r, double* a ) const
+///                             which adds the acceleration [m/s^2] at the 6-element state x, of position norm r [m], to a.
+///
+/// @code
+///                             ComposedDynamics<terms::PointMassGravity, terms::J2Gravity> dynamics = { pointMassGravity, j2Gravity } ;
+/// @endcode
+
+template <class... Terms>
+class ComposedDynamics : public Dynamics
+{
+
+    public:
+
+        static constexpr int    StateDimension = 6 ;
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aTerms Acceleration terms
+
+                                ComposedDynamics                            (   const   Terms&...                   aTerms                                      ) ;
+
+        /// @brief              Destructor
+
+        virtual                 ~ComposedDynamics                           ( ) override ;
+
+        /// @brief              Clone composed dynamics
+        ///
+        /// @return             Pointer to cloned composed dynamics
+
+        virtual ComposedDynamics* clone                                     ( ) const override ;
+
+        /// @brief              Check if composed dynamics is defined, i.e. all its terms are
+        ///
+        /// @return             True if composed dynamics is defined
+
+        virtual bool            isDefined                                   ( ) const override ;
+
+        /// @brief              Print composed dynamics
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const override ;
+
+        /// @brief              Access term
+        ///
+        /// @code
+        ///                     const terms::J2Gravity& j2Gravity = dynamics.accessTerm<1>() ;
+        /// @endcode
+        ///
+        /// @return             Reference to term
+
+        template <std::size_t Index>
+        const typename std::tuple_element<Index, std::tuple<Terms...>>::type& accessTerm ( ) const ;
+
+        /// @brief              Calculate acceleration, as the sum of the terms
+        ///
+        /// @param              [in] x A state (position [m], velocity [m/s])
+        /// @param              [out] anAcceleration An acceleration [m/s^2]
+
+        void                    calculateAccelerationAt                     (   const   double*                     x,
+                                                                                        double*                     anAcceleration                              ) const ;
+
+        /// @brief              Calculate state derivative
+        ///
+        /// @param              [in] x A state (position [m], velocity [m/s])
+        /// @param              [out] dxdt A state derivative (velocity [m/s], acceleration [m/s^2])
+
+        void                    calculateStateDerivativeAt                  (   const   double*                     x,
+                                                                                        double*                     dxdt                                        ) const ;
+
+        /// @brief              Calculate state derivative, with the signature of the fixed-size numerical solver path
+        ///
+        /// @code
+        ///                     numericalSolver.integrateStateForDuration<6>(stateVector, duration, dynamics) ;
+        /// @endcode
+
+        template <class StateType>
+        void                    operator ()                                 (   const   StateType&                  x,
+                                                                                        StateType&                  dxdt,
+                                                                                const   double                      t                                           ) const ;
+
+        /// @brief              Obtain dynamical equations function wrapper
+        ///
+        /// @return             std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+
+        virtual Dynamics::DynamicalEquationWrapper getDynamicalEquations    ( ) override ;
+
+        /// @brief              Obtain second order dynamical equations function wrapper
+        ///
+        ///                     Only the accelerations (last 3 elements of the state vector derivative) are returned.
+        ///
+        /// @return             std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+
+        virtual Dynamics::DynamicalEquationWrapper getSecondOrderDynamicalEquations ( ) override ;
+
+    private:
+
+        std::tuple<Terms...>    terms_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.tpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
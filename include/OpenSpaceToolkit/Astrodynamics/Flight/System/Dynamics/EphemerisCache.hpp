@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <cstdint>
+#include <map>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::Shared ;
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::MatrixXd ;
+
+using ostk::physics::time::Instant ;
+using ostk::physics::time::Duration ;
+using ostk::physics::coord::Frame ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Cache of the position of the origin of a frame (e.g. a celestial body) in a reference frame, over a propagation
+///
+///                             The position is fitted with Chebyshev polynomials over consecutive segments of fixed duration, starting at an epoch.
+///                             Each segment is fitted the first time it is queried, from the frame graph (ephemeris and frame transforms) evaluated
+///                             at its Chebyshev nodes: further queries within the segment only cost a polynomial evaluation.
+///                             At most a given number of segments is kept: beyond it, the segments farthest from the last queried time are dropped,
+///                             so that memory (and the cost of copying the cache) stays bounded over long propagations.
+///                             The cache is not thread safe.
+
+class EphemerisCache
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     EphemerisCache ephemerisCache = { sunSPtr->accessFrame(), Frame::GCRF(), anEpoch } ;
+        /// @endcode
+        ///
+        /// @param              [in] anOriginFrameSPtr A frame, whose origin position is cached
+        /// @param              [in] aReferenceFrameSPtr A reference frame, in which the position is expressed
+        /// @param              [in] anEpoch An epoch, at which the first segment starts
+        /// @param              [in] (optional) aSegmentDuration A segment duration
+        /// @param              [in] (optional) aDegree A degree of the Chebyshev polynomials fitted over each segment
+        /// @param              [in] (optional) aCapacity A maximum number of segments kept (at least 1)
+
+                                EphemerisCache                              (   const   Shared<const Frame>&        anOriginFrameSPtr,
+                                                                                const   Shared<const Frame>&        aReferenceFrameSPtr,
+                                                                                const   Instant&                    anEpoch,
+                                                                                const   Duration&                   aSegmentDuration                            =   Duration::Days(1.0),
+                                                                                const   Size                        aDegree                                     =   11,
+                                                                                const   Size                        aCapacity                                   =   32 ) ;
+
+        /// @brief              Check if ephemeris cache is defined
+        ///
+        /// @return             True if ephemeris cache is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get epoch
+        ///
+        /// @return             Epoch
+
+        Instant                 getEpoch                                    ( ) const ;
+
+        /// @brief              Get number of fitted segments
+        ///
+        /// @return             Number of fitted segments
+
+        Size                    getSegmentCount                             ( ) const ;
+
+        /// @brief              Get maximum number of segments kept
+        ///
+        /// @return             Maximum number of segments kept
+
+        Size                    getCapacity                                 ( ) const ;
+
+        /// @brief              Get position of the origin frame origin in the reference frame, at a time from the epoch
+        ///
+        /// @code
+        ///                     Vector3d position = ephemerisCache.getPositionAt(60.0) ;
+        /// @endcode
+        ///
+        /// @param              [in] aTime A time from the epoch [s]
+        /// @return             Position [m]
+
+        Vector3d                getPositionAt                               (   const   double                      aTime                                       ) ;
+
+        /// @brief              Get position of the origin frame origin in the reference frame, at an instant
+        ///
+        /// @param              [in] anInstant An instant
+        /// @return             Position [m]
+
+        Vector3d                getPositionAt                               (   const   Instant&                    anInstant                                   ) ;
+
+        /// @brief              Clear fitted segments
+
+        void                    clear                                       ( ) ;
+
+        /// @brief              Constructs an undefined ephemeris cache
+        ///
+        /// @return             Undefined ephemeris cache
+
+        static EphemerisCache   Undefined                                   ( ) ;
+
+    private:
+
+        Shared<const Frame>     originFrameSPtr_ ;
+        Shared<const Frame>     referenceFrameSPtr_ ;
+        Instant                 epoch_ ;
+        double                  segmentDuration_ ;
+        Size                    degree_ ;
+        Size                    capacity_ ;
+
+        // Chebyshev coefficients of each segment, one row per coordinate
+        std::map<std::int64_t, MatrixXd> segments_ ;
+
+        // Coefficients of the last queried segment, as consecutive queries mostly fall in the same segment
+        std::int64_t            lastSegmentIndex_ ;
+        MatrixXd                lastSegment_ ;
+
+        MatrixXd                fitSegment                                  (   const   std::int64_t                aSegmentIndex                               ) const ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
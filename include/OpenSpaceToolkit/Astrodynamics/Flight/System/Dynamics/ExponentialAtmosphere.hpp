@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <cstdint>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::ctnr::Array ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Piecewise exponential atmospheric density model
+///
+///                             The atmosphere is split in altitude bands, over which the density decays exponentially from a base density,
+///                             with a constant scale height. The band of an altitude is found from a lookup table over a regular altitude grid,
+///                             whose step is the thinnest band: the grid cell gives the band at its lower bound, and a single comparison
+///                             with the next band base altitude gives the band, without search.
+///
+/// @ref                        Vallado, Fundamentals of Astrodynamics and Applications, Table 8-4
+
+class ExponentialAtmosphere
+{
+
+    public:
+
+        /// @brief              Altitude band
+
+        struct Band
+        {
+
+            double              baseAltitude ;                                  // Base altitude [m]
+            double              baseDensity ;                                   // Density at the base altitude [kg/m^3]
+            double              scaleHeight ;                                   // Scale height [m]
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     ExponentialAtmosphere atmosphere = { { { 0.0, 1.225, 7249.0 }, { 25000.0, 3.899e-2, 6349.0 } } } ;
+        /// @endcode
+        ///
+        /// @param              [in] aBandArray An array of altitude bands, sorted by increasing base altitude
+
+                                ExponentialAtmosphere                       (   const   Array<ExponentialAtmosphere::Band>& aBandArray                          ) ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] anExponentialAtmosphere An exponential atmosphere
+        /// @return             True if atmospheres have the same bands
+
+        bool                    operator ==                                 (   const   ExponentialAtmosphere&      anExponentialAtmosphere                     ) const ;
+
+        /// @brief              Not equal to operator
+        ///
+        /// @param              [in] anExponentialAtmosphere An exponential atmosphere
+        /// @return             True if atmospheres are not equal
+
+        bool                    operator !=                                 (   const   ExponentialAtmosphere&      anExponentialAtmosphere                     ) const ;
+
+        /// @brief              Check if atmosphere is defined
+        ///
+        /// @return             True if atmosphere is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get number of altitude bands
+        ///
+        /// @return             Number of altitude bands
+
+        Size                    getBandCount                                ( ) const ;
+
+        /// @brief              Get density at altitude
+        ///
+        ///                     Below the first band, the first band is extrapolated; above the last band, the last band is extrapolated.
+        ///
+        /// @code
+        ///                     double density = ExponentialAtmosphere::Default().getDensityAt(500000.0) ; // [kg/m^3]
+        /// @endcode
+        ///
+        /// @param              [in] anAltitude An altitude [m]
+        /// @return             Density [kg/m^3]
+
+        double                  getDensityAt                                (   const   double                      anAltitude                                  ) const ;
+
+        /// @brief              Get scale height at altitude
+        ///
+        ///                     Relative decrease of the density with altitude: d(density)/d(altitude) = - density / scaleHeight
+        ///
+        /// @param              [in] anAltitude An altitude [m]
+        /// @return             Scale height [m]
+
+        double                  getScaleHeightAt                            (   const   double                      anAltitude                                  ) const ;
+
+        /// @brief              Constructs an undefined atmosphere
+        ///
+        /// @return             Undefined atmosphere
+
+        static ExponentialAtmosphere Undefined                              ( ) ;
+
+        /// @brief              Constructs the atmosphere of Earth, from 0 to 1000 km (Vallado, Table 8-4)
+        ///
+        /// @return             Atmosphere of Earth
+
+        static ExponentialAtmosphere Default                                ( ) ;
+
+    private:
+
+        std::vector<ExponentialAtmosphere::Band> bands_ ;
+
+        double                  lookupStep_ ;
+        std::vector<std::uint16_t> lookupBandIndices_ ;
+
+        std::size_t             accessBandIndex                             (   const   double                      anAltitude                                  ) const ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModel__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModel__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::String ;
+using ostk::core::types::Shared ;
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3d ;
+
+using ostk::physics::time::Instant ;
+using ostk::physics::coord::Frame ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Defines a force model acting on a satellite, as an acceleration
+///
+///                             Force models are evaluated by the satellite dynamics at each call of the dynamical equations, from a shared context
+///                             holding the quantities needed by several models, computed once per call.
+
+class ForceModel
+{
+
+    public:
+
+        /// @brief              Quantities shared by the force models, at one evaluation of the dynamical equations
+
+        struct Context
+        {
+
+            Instant             instant ;                                       // Evaluation instant
+            Vector3d            position ;                                      // Satellite position in GCRF [m]
+            Vector3d            velocity ;                                      // Satellite velocity in GCRF [m/s]
+            double              positionNorm ;                                  // Satellite distance to the origin of GCRF [m]
+            Shared<const Frame> bodyFrameSPtr ;                                 // Central body frame (nullptr without central body)
+            Matrix3d            dcm_GCRF_BODY ;                                 // Rotation from the central body frame to GCRF
+            Vector3d            bodyFixedPosition ;                             // Satellite position in the central body frame [m]
+            Vector3d            sunPosition ;                                   // Sun position in GCRF [m] (NaN without Sun)
+            double              density ;                                       // Atmospheric density [kg/m^3] (NaN unless a single atmospheric drag model)
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aName A name
+
+                                ForceModel                                  (   const   String&                     aName                                       ) ;
+
+        /// @brief              Destructor (pure virtual)
+
+        virtual                 ~ForceModel                                 ( ) = 0 ;
+
+        /// @brief              Clone force model (pure virtual)
+        ///
+        /// @return             Pointer to cloned force model
+
+        virtual ForceModel*     clone                                       ( ) const = 0 ;
+
+        /// @brief              Equal to operator (pure virtual)
+        ///
+        ///                     Force models are equal if they are of the same type, with the same configuration.
+        ///
+        /// @param              [in] aForceModel A force model
+        /// @return             True if force models are equal
+
+        virtual bool            operator ==                                 (   const   ForceModel&                 aForceModel                                 ) const = 0 ;
+
+        /// @brief              Not equal to operator
+        ///
+        /// @param              [in] aForceModel A force model
+        /// @return             True if force models are not equal
+
+        bool                    operator !=                                 (   const   ForceModel&                 aForceModel                                 ) const ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] aForceModel A force model
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   ForceModel&                 aForceModel                                 ) ;
+
+        /// @brief              Check if force model is defined (pure virtual)
+        ///
+        /// @return             True if force model is defined
+
+        virtual bool            isDefined                                   ( ) const = 0 ;
+
+        /// @brief              Get name
+        ///
+        /// @return             Name
+
+        String                  getName                                     ( ) const ;
+
+        /// @brief              Print force model
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+        /// @brief              Calculate acceleration (pure virtual)
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Acceleration in GCRF [m/s^2]
+
+        virtual Vector3d        calculateAccelerationAt                     (   const   ForceModel::Context&        aContext                                    ) = 0 ;
+
+        /// @brief              Calculate partial derivatives of the acceleration with respect to the position
+        ///
+        ///                     Force models without analytic partials do not contribute to the state transition matrix.
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Jacobian in GCRF [s^-2]
+
+        virtual Matrix3d        calculatePositionJacobianAt                 (   const   ForceModel::Context&        aContext                                    ) ;
+
+        /// @brief              Calculate partial derivatives of the acceleration with respect to the velocity
+        ///
+        ///                     Zero for the force models depending on the position only.
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Jacobian in GCRF [s^-1]
+
+        virtual Matrix3d        calculateVelocityJacobianAt                 (   const   ForceModel::Context&        aContext                                    ) ;
+
+    private:
+
+        String                  name_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/AtmosphericDrag.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_AtmosphericDrag__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_AtmosphericDrag__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <functional>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Shared ;
+
+using ostk::physics::time::Instant ;
+using ostk::physics::env::obj::Celestial ;
+
+using ostk::astro::flight::system::SatelliteSystem ;
+using ostk::astro::flight::system::dynamics::ForceModel ;
+using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Atmospheric drag of the central body, on a cannonball satellite
+///
+///                             The acceleration is -0.5 * rho * (Cd * A / m) * |v_rel| * v_rel, with v_rel the satellite velocity relative to the
+///                             atmosphere, which co-rotates with the central body frame. The density is taken, in order of precedence, from the
+///                             context (when finite), from a user density model, or from a piecewise exponential atmosphere (by default, the
+///                             tabulated atmosphere of Earth), at the altitude above the central body ellipsoid.
+
+class AtmosphericDrag : public ForceModel
+{
+
+    public:
+
+        /// @brief              Density model, returning the density [kg/m^3] at a body fixed position [m] and an instant
+
+        typedef std::function<double (const Vector3d&, const Instant&)> DensityModel ;
+
+        /// @brief              Constructor, with a piecewise exponential atmosphere
+        ///
+        /// @code
+        ///                     AtmosphericDrag atmosphericDrag = { environment.accessCelestialObjectWithName("Earth"), satelliteSystem } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCelestialObjectSPtr A central celestial body
+        /// @param              [in] aSatelliteSystem A satellite system, providing the drag coefficient, cross sectional area and mass
+        /// @param              [in] (optional) anAtmosphere A piecewise exponential atmosphere
+
+                                AtmosphericDrag                             (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   ExponentialAtmosphere&      anAtmosphere                                =   ExponentialAtmosphere::Default() ) ;
+
+        /// @brief              Constructor, with a density model
+        ///
+        /// @code
+        ///                     AtmosphericDrag atmosphericDrag = { earthSPtr, satelliteSystem, [] (const Vector3d& aPosition, const Instant& anInstant) -> double { ... } } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCelestialObjectSPtr A central celestial body
+        /// @param              [in] aSatelliteSystem A satellite system, providing the drag coefficient, cross sectional area and mass
+        /// @param              [in] aDensityModel A density model
+
+                                AtmosphericDrag                             (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   AtmosphericDrag::DensityModel& aDensityModel                            ) ;
+
+        /// @brief              Destructor
+
+        virtual                 ~AtmosphericDrag                            ( ) override ;
+
+        /// @brief              Clone atmospheric drag
+        ///
+        /// @return             Pointer to cloned atmospheric drag
+
+        virtual AtmosphericDrag* clone                                      ( ) const override ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] aForceModel A force model
+        /// @return             True if the force model is an atmospheric drag with the same configuration
+
+        virtual bool            operator ==                                 (   const   ForceModel&                 aForceModel                                 ) const override ;
+
+        /// @brief              Check if atmospheric drag is defined
+        ///
+        /// @return             True if atmospheric drag is defined
+
+        virtual bool            isDefined                                   ( ) const override ;
+
+        /// @brief              Get central celestial body
+        ///
+        /// @return             Central celestial body
+
+        Shared<const Celestial> getCelestialObject                          ( ) const ;
+
+        /// @brief              Get ballistic coefficient (drag coefficient times cross sectional area, over mass)
+        ///
+        /// @return             Ballistic coefficient [m^2/kg]
+
+        double                  getBallisticCoefficient                     ( ) const ;
+
+        /// @brief              Print atmospheric drag
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const override ;
+
+        /// @brief              Calculate atmospheric density
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Density [kg/m^3]
+
+        double                  calculateDensityAt                          (   const   ForceModel::Context&        aContext                                    ) ;
+
+        /// @brief              Calculate acceleration
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Acceleration in GCRF [m/s^2]
+
+        virtual Vector3d        calculateAccelerationAt                     (   const   ForceModel::Context&        aContext                                    ) override ;
+
+        /// @brief              Calculate partial derivatives of the acceleration with respect to the position
+        ///
+        ///                     Includes the rotation of the atmosphere and, for a piecewise exponential atmosphere, the radial density gradient.
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Jacobian in GCRF [s^-2]
+
+        virtual Matrix3d        calculatePositionJacobianAt                 (   const   ForceModel::Context&        aContext                                    ) override ;
+
+        /// @brief              Calculate partial derivatives of the acceleration with respect to the velocity
+        ///
+        ///                     -0.5 * rho * (Cd * A / m) * (|v_rel| I + v_rel v_rel^T / |v_rel|), the density depending on the position only.
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Jacobian in GCRF [s^-1]
+
+        virtual Matrix3d        calculateVelocityJacobianAt                 (   const   ForceModel::Context&        aContext                                    ) override ;
+
+    private:
+
+        Shared<const Celestial> celestialObjectSPtr_ ;
+        double                  ballisticCoefficient_ ;
+        double                  equatorialRadius_ ;
+        double                  flattening_ ;
+
+        ExponentialAtmosphere   atmosphere_ ;
+        AtmosphericDrag::DensityModel densityModel_ ;
+
+        // Quantities of the atmosphere at the satellite position
+        struct State
+        {
+            Vector3d            relativeVelocity ;                              // Velocity relative to the atmosphere, in GCRF [m/s]
+            Vector3d            angularVelocity ;                               // Angular velocity of the atmosphere, in GCRF [rad/s]
+            double              altitude ;                                      // Altitude above the ellipsoid [m]
+            double              density ;                                       // Density [kg/m^3]
+        } ;
+
+        AtmosphericDrag::State  calculateStateAt                            (   const   ForceModel::Context&        aContext                                    ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/CentralBodyGravity.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_CentralBodyGravity__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_CentralBodyGravity__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Shared ;
+
+using ostk::physics::env::obj::Celestial ;
+
+using ostk::astro::flight::system::dynamics::ForceModel ;
+using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Gravity of the central body, from its gravitational model
+///
+///                             The gravitational model is evaluated in the central body frame, at the body fixed position of the context,
+///                             and rotated to GCRF with the rotation of the context. The gravitational model of the body can be replaced by a
+///                             spherical harmonic gravity field, evaluated with its own truncation, whose terms beyond a reference degree can
+///                             be interpolated from a gravity surrogate within its shell.
+
+class CentralBodyGravity : public ForceModel
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     CentralBodyGravity centralBodyGravity = { environment.accessCelestialObjectWithName("Earth") } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCelestialObjectSPtr A central celestial body
+
+                                CentralBodyGravity                          (   const   Shared<const Celestial>&    aCelestialObjectSPtr                        ) ;
+
+        /// @brief              Constructor, with a spherical harmonic gravity field
+        ///
+        /// @code
+        ///                     CentralBodyGravity centralBodyGravity = { earthSPtr, SphericalHarmonicGravity::Load(File::Path(Path::Parse("EGM2008.gfc")), 100) } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCelestialObjectSPtr A central celestial body
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity field, in the central body frame
+
+                                CentralBodyGravity                          (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) ;
+
+        /// @brief              Constructor, with a spherical harmonic gravity field and a gravity surrogate of its terms beyond a reference degree
+        ///
+        ///                     Within the shell of the gravity surrogate, the field is evaluated up to the reference degree, and the higher
+        ///                     degree terms are interpolated. Outside the shell, the field is evaluated in full. The gravity surrogate is
+        ///                     shared (not copied) by the clones of the force model.
+        ///
+        /// @code
+        ///                     Shared<const GravitySurrogate> gravitySurrogateSPtr = std::make_shared<GravitySurrogate>(GravitySurrogate::Load(file, sphericalHarmonicGravity)) ;
+        ///                     CentralBodyGravity centralBodyGravity = { earthSPtr, sphericalHarmonicGravity, gravitySurrogateSPtr } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCelestialObjectSPtr A central celestial body
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity field, in the central body frame
+        /// @param              [in] aGravitySurrogateSPtr A gravity surrogate, generated from the spherical harmonic gravity field (checked)
+
+                                CentralBodyGravity                          (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SphericalHarmonicGravity&   aSphericalHarmonicGravity,
+                                                                                const   Shared<const GravitySurrogate>& aGravitySurrogateSPtr                   ) ;
+
+        /// @brief              Destructor
+
+        virtual                 ~CentralBodyGravity                         ( ) override ;
+
+        /// @brief              Clone central body gravity
+        ///
+        /// @return             Pointer to cloned central body gravity
+
+        virtual CentralBodyGravity* clone                                   ( ) const override ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] aForceModel A force model
+        /// @return             True if the force model is a central body gravity with the same configuration
+
+        virtual bool            operator ==                                 (   const   ForceModel&                 aForceModel                                 ) const override ;
+
+        /// @brief              Check if central body gravity is defined
+        ///
+        /// @return             True if central body gravity is defined
+
+        virtual bool            isDefined                                   ( ) const override ;
+
+        /// @brief              Get central celestial body
+        ///
+        /// @return             Central celestial body
+
+        Shared<const Celestial> getCelestialObject                          ( ) const ;
+
+        /// @brief              Get spherical harmonic gravity field
+        ///
+        /// @return             Spherical harmonic gravity field (undefined when the gravitational model of the body is used)
+
+        SphericalHarmonicGravity getSphericalHarmonicGravity                ( ) const ;
+
+        /// @brief              Get gravity surrogate
+        ///
+        /// @return             Gravity surrogate (nullptr without gravity surrogate)
+
+        Shared<const GravitySurrogate> getGravitySurrogate                  ( ) const ;
+
+        /// @brief              Print central body gravity
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const override ;
+
+        /// @brief              Calculate acceleration
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Acceleration in GCRF [m/s^2]
+
+        virtual Vector3d        calculateAccelerationAt                     (   const   ForceModel::Context&        aContext                                    ) override ;
+
+        /// @brief              Calculate partial derivatives of the acceleration with respect to the position
+        ///
+        ///                     Only the point mass and J2 terms of the gravitational model are differentiated.
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Jacobian in GCRF [s^-2]
+
+        virtual Matrix3d        calculatePositionJacobianAt                 (   const   ForceModel::Context&        aContext                                    ) override ;
+
+    private:
+
+        Shared<const Celestial> celestialObjectSPtr_ ;
+        SphericalHarmonicGravity sphericalHarmonicGravity_ ;
+        Shared<const GravitySurrogate> gravitySurrogateSPtr_ ;
+
+        Vector3d                calculateBodyFixedAccelerationAt            (   const   Vector3d&                   aBodyFixedPosition                          ) const ;
+
+        // Rotation from the central body frame to GCRF, from the context when it holds the central body frame
+        Matrix3d                calculateRotationMatrix                     (   const   ForceModel::Context&        aContext                                    ) const ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_SolarRadiationPressure__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_SolarRadiationPressure__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Shared ;
+
+using ostk::math::obj::VectorXd ;
+using ostk::math::obj::MatrixXd ;
+
+using ostk::physics::env::obj::Celestial ;
+
+using ostk::astro::flight::system::SatelliteSystem ;
+using ostk::astro::flight::system::dynamics::ForceModel ;
+using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Solar radiation pressure on a cannonball satellite, with the shadow of an occulting body
+///
+///                             The acceleration is -nu * P * Cr * (A / m) * (AU / |d|)^2 * d / |d|, with d the satellite to Sun vector, P the solar
+///                             radiation pressure at 1 AU, Cr the reflectivity coefficient and A the cross sectional area of the satellite system,
+///                             and nu the fraction of the solar disk visible from the satellite (shadow function).
+///                             The Sun position is taken from the context (cached ephemeris), or cached by the model when not in the context.
+///                             The shadow is evaluated relative to the occulting body at the current instant: the occulting body may be the
+///                             central body (at the GCRF origin) or another body (e.g. the Moon), whose position is then cached by the model.
+///
+/// @ref                        Montenbruck O., Gill E., Satellite Orbits, 3.4
+
+class SolarRadiationPressure : public ForceModel
+{
+
+    public:
+
+        enum class ShadowModel
+        {
+
+            NoShadow,                                                           ///< Always illuminated
+            Cylindrical,                                                        ///< Cylindrical umbra, no penumbra
+            Conical                                                             ///< Dual cone umbra and penumbra
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     SatelliteSystem satelliteSystem = { mass, geometry, inertiaTensor, 0.8, 2.2, 1.3 } ;
+        ///                     SolarRadiationPressure solarRadiationPressure = { environment.accessCelestialObjectWithName("Sun"), environment.accessCelestialObjectWithName("Earth"), satelliteSystem } ;
+        /// @endcode
+        ///
+        /// @param              [in] aSunSPtr The Sun
+        /// @param              [in] anOccultingBodySPtr A celestial body, casting the shadow
+        /// @param              [in] aSatelliteSystem A satellite system, providing the cross sectional area, reflectivity coefficient and mass
+        /// @param              [in] (optional) aShadowModel A shadow model
+
+                                SolarRadiationPressure                      (   const   Shared<const Celestial>&    aSunSPtr,
+                                                                                const   Shared<const Celestial>&    anOccultingBodySPtr,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       =   SolarRadiationPressure::ShadowModel::Conical ) ;
+
+        /// @brief              Destructor
+
+        virtual                 ~SolarRadiationPressure                     ( ) override ;
+
+        /// @brief              Clone solar radiation pressure
+        ///
+        /// @return             Pointer to cloned solar radiation pressure
+
+        virtual SolarRadiationPressure* clone                               ( ) const override ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] aForceModel A force model
+        /// @return             True if the force model is a solar radiation pressure with the same configuration
+
+        virtual bool            operator ==                                 (   const   ForceModel&                 aForceModel                                 ) const override ;
+
+        /// @brief              Check if solar radiation pressure is defined
+        ///
+        /// @return             True if solar radiation pressure is defined
+
+        virtual bool            isDefined                                   ( ) const override ;
+
+        /// @brief              Get shadow model
+        ///
+        /// @return             Shadow model
+
+        SolarRadiationPressure::ShadowModel getShadowModel                  ( ) const ;
+
+        /// @brief              Print solar radiation pressure
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const override ;
+
+        /// @brief              Calculate shadow function (fraction of the solar disk visible from the satellite)
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Shadow function, between 0 (umbra) and 1 (sunlight)
+
+        double                  calculateShadowFunctionAt                   (   const   ForceModel::Context&        aContext                                    ) ;
+
+        /// @brief              Calculate acceleration
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Acceleration in GCRF [m/s^2]
+
+        virtual Vector3d        calculateAccelerationAt                     (   const   ForceModel::Context&        aContext                                    ) override ;
+
+        /// @brief              Calculate shadow function, for a satellite and Sun position relative to the occulting body
+        ///
+        /// @param              [in] aPosition A satellite position, relative to the occulting body [m]
+        /// @param              [in] aSunPosition A Sun position, relative to the occulting body [m]
+        /// @param              [in] anOccultingBodyRadius An occulting body radius [m]
+        /// @param              [in] aSunRadius A Sun radius [m]
+        /// @param              [in] aShadowModel A shadow model
+        /// @return             Shadow function, between 0 (umbra) and 1 (sunlight)
+
+        static double           ShadowFunction                              (   const   Vector3d&                   aPosition,
+                                                                                const   Vector3d&                   aSunPosition,
+                                                                                const   double                      anOccultingBodyRadius,
+                                                                                const   double                      aSunRadius,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       ) ;
+
+        /// @brief              Calculate shadow functions, for a batch of satellite positions
+        ///
+        ///                     The batch is evaluated with array expressions over all positions at once, the shadow cases being selected
+        ///                     rather than branched on. Each shadow function matches the one of ShadowFunction.
+        ///
+        /// @param              [in] aPositionArray Satellite positions (3 x N, one per column), relative to the occulting body [m]
+        /// @param              [in] aSunPosition A Sun position, relative to the occulting body [m]
+        /// @param              [in] anOccultingBodyRadius An occulting body radius [m]
+        /// @param              [in] aSunRadius A Sun radius [m]
+        /// @param              [in] aShadowModel A shadow model
+        /// @return             Shadow functions, one per position
+
+        static VectorXd         ShadowFunctions                             (   const   MatrixXd&                   aPositionArray,
+                                                                                const   Vector3d&                   aSunPosition,
+                                                                                const   double                      anOccultingBodyRadius,
+                                                                                const   double                      aSunRadius,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       ) ;
+
+        /// @brief              Convert shadow model to string
+        ///
+        /// @param              [in] aShadowModel A shadow model
+        /// @return             String
+
+        static String           StringFromShadowModel                       (   const   SolarRadiationPressure::ShadowModel& aShadowModel                       ) ;
+
+    private:
+
+        Shared<const Celestial> sunSPtr_ ;
+        Shared<const Celestial> occultingBodySPtr_ ;
+        double                  reflectivityAreaToMassRatio_ ;                  // Cr * A / m [m^2/kg]
+        double                  sunRadius_ ;
+        double                  occultingBodyRadius_ ;
+        SolarRadiationPressure::ShadowModel shadowModel_ ;
+        EphemerisCache          sunEphemerisCache_ ;
+        bool                    occultingBodyAtOrigin_ ;                        // True once the occulting body is found at the GCRF origin
+        EphemerisCache          occultingBodyEphemerisCache_ ;
+
+        Vector3d                calculateSunPosition                        (   const   ForceModel::Context&        aContext                                    ) ;
+
+        Vector3d                calculateOccultingBodyPosition              (   const   ForceModel::Context&        aContext                                    ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_ThirdBodyGravity__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_ThirdBodyGravity__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Objects/Celestial.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Shared ;
+
+using ostk::physics::env::obj::Celestial ;
+
+using ostk::astro::flight::system::dynamics::ForceModel ;
+using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Point mass gravity of a third body, relative to the origin of GCRF
+///
+///                             The acceleration of the origin of GCRF by the third body (indirect term) is subtracted.
+///                             The third body position is cached from the first evaluated instant on (see EphemerisCache),
+///                             or taken from the context for the Sun.
+
+class ThirdBodyGravity : public ForceModel
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     ThirdBodyGravity thirdBodyGravity = { environment.accessCelestialObjectWithName("Moon") } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCelestialObjectSPtr A third celestial body
+
+                                ThirdBodyGravity                            (   const   Shared<const Celestial>&    aCelestialObjectSPtr                        ) ;
+
+        /// @brief              Destructor
+
+        virtual                 ~ThirdBodyGravity                           ( ) override ;
+
+        /// @brief              Clone third body gravity
+        ///
+        /// @return             Pointer to cloned third body gravity
+
+        virtual ThirdBodyGravity* clone                                     ( ) const override ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] aForceModel A force model
+        /// @return             True if the force model is a third body gravity with the same configuration
+
+        virtual bool            operator ==                                 (   const   ForceModel&                 aForceModel                                 ) const override ;
+
+        /// @brief              Check if third body gravity is defined
+        ///
+        /// @return             True if third body gravity is defined
+
+        virtual bool            isDefined                                   ( ) const override ;
+
+        /// @brief              Get third celestial body
+        ///
+        /// @return             Third celestial body
+
+        Shared<const Celestial> getCelestialObject                          ( ) const ;
+
+        /// @brief              Print third body gravity
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const override ;
+
+        /// @brief              Calculate acceleration
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Acceleration in GCRF [m/s^2]
+
+        virtual Vector3d        calculateAccelerationAt                     (   const   ForceModel::Context&        aContext                                    ) override ;
+
+        /// @brief              Calculate partial derivatives of the acceleration with respect to the position
+        ///
+        /// @param              [in] aContext A force model context
+        /// @return             Jacobian in GCRF [s^-2]
+
+        virtual Matrix3d        calculatePositionJacobianAt                 (   const   ForceModel::Context&        aContext                                    ) override ;
+
+    private:
+
+        Shared<const Celestial> celestialObjectSPtr_ ;
+        double                  gravitationalParameter_SI_ ;
+        bool                    isSun_ ;
+        EphemerisCache          ephemerisCache_ ;
+
+        Vector3d                calculateThirdBodyPosition                  (   const   ForceModel::Context&        aContext                                    ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
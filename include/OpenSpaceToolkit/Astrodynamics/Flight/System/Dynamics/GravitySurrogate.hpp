@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::Shared ;
+using ostk::core::fs::File ;
+
+using ostk::math::obj::Vector3d ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Precomputed table of the disturbing acceleration of a spherical harmonic gravity field, over a spherical shell
+///
+///                             The disturbing acceleration is the acceleration of the field beyond a reference degree (e.g. beyond J2), in the
+///                             body fixed frame. It is tabulated on a grid regular in radius, latitude and longitude, and interpolated
+///                             trilinearly, so that its evaluation costs 8 table lookups whatever the degree of the field. The interpolation
+///                             error is estimated at the cell centers when the table is generated.
+///
+///                             The table is immutable and shared between copies, so that it can be used read-only by several threads. It can be
+///                             saved to a binary file (in the native byte order), which is memory mapped when loaded. The file records the
+///                             parameters of the field it was generated from, so that it is only ever used along with that field.
+
+class GravitySurrogate
+{
+
+    public:
+
+        /// @brief              Constructor, generating the table
+        ///
+        ///                     The table is generated in parallel over the radial shells. The radial and angular steps are adjusted so
+        ///                     that the grid spans the shell exactly. An exception thrown while generating a shell is rethrown.
+        ///
+        /// @code
+        ///                     GravitySurrogate gravitySurrogate = { sphericalHarmonicGravity, 2, 6578e3, 8378e3 } ;
+        /// @endcode
+        ///
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity field
+        /// @param              [in] aReferenceDegree A reference degree, up to which the field is not tabulated
+        /// @param              [in] aMinimumRadius A minimum radius of the shell [m]
+        /// @param              [in] aMaximumRadius A maximum radius of the shell [m]
+        /// @param              [in] (optional) aRadialStep A radial step [m]
+        /// @param              [in] (optional) anAngularStep An angular step, in latitude and longitude [deg]
+
+                                GravitySurrogate                            (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity,
+                                                                                const   Size                        aReferenceDegree,
+                                                                                const   double                      aMinimumRadius,
+                                                                                const   double                      aMaximumRadius,
+                                                                                const   double                      aRadialStep                                 =   25e3,
+                                                                                const   double                      anAngularStep                               =   1.0 ) ;
+
+        /// @brief              Check if gravity surrogate is defined
+        ///
+        /// @return             True if gravity surrogate is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get reference degree, up to which the field is not tabulated
+        ///
+        /// @return             Reference degree
+
+        Size                    getReferenceDegree                          ( ) const ;
+
+        /// @brief              Get minimum radius of the shell
+        ///
+        /// @return             Minimum radius [m]
+
+        double                  getMinimumRadius                            ( ) const ;
+
+        /// @brief              Get maximum radius of the shell
+        ///
+        /// @return             Maximum radius [m]
+
+        double                  getMaximumRadius                            ( ) const ;
+
+        /// @brief              Get number of grid nodes
+        ///
+        /// @return             Number of grid nodes
+
+        Size                    getNodeCount                                ( ) const ;
+
+        /// @brief              Get maximum interpolation error, estimated at the cell centers when the table was generated
+        ///
+        /// @return             Maximum interpolation error [m/s^2]
+
+        double                  getMaximumError                             ( ) const ;
+
+        /// @brief              Check if gravity surrogate was generated from a spherical harmonic gravity field
+        ///
+        ///                     The gravitational parameter, reference radius, degree (and order) and acceleration tolerance of the
+        ///                     field must match the ones the table was generated from.
+        ///
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity field
+        /// @return             True if gravity surrogate was generated from the spherical harmonic gravity field
+
+        bool                    isCompatibleWith                            (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) const ;
+
+        /// @brief              Check if a position is within the shell
+        ///
+        /// @param              [in] aPosition A position in the body fixed frame [m]
+        /// @return             True if the position is within the shell
+
+        bool                    contains                                    (   const   Vector3d&                   aPosition                                   ) const ;
+
+        /// @brief              Get disturbing acceleration (beyond the reference degree)
+        ///
+        /// @code
+        ///                     Vector3d acceleration_ITRF = sphericalHarmonicGravity.getAccelerationAt(position_ITRF, 2, 2) + gravitySurrogate.getAccelerationAt(position_ITRF) ;
+        /// @endcode
+        ///
+        /// @param              [in] aPosition A position in the body fixed frame, within the shell [m]
+        /// @return             Disturbing acceleration in the body fixed frame [m/s^2]
+
+        Vector3d                getAccelerationAt                           (   const   Vector3d&                   aPosition                                   ) const ;
+
+        /// @brief              Save table to a binary file
+        ///
+        /// @param              [in] aFile A file
+
+        void                    save                                        (   const   File&                       aFile                                       ) const ;
+
+        /// @brief              Constructs an undefined gravity surrogate
+        ///
+        /// @return             Undefined gravity surrogate
+
+        static GravitySurrogate Undefined                                   ( ) ;
+
+        /// @brief              Load table from a binary file, memory mapped read-only
+        ///
+        /// @code
+        ///                     GravitySurrogate gravitySurrogate = GravitySurrogate::Load(File::Path(Path::Parse("/path/to/EGM2008_LEO.bin")), sphericalHarmonicGravity) ;
+        /// @endcode
+        ///
+        /// @param              [in] aFile A file, written by GravitySurrogate::save
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity field, which the table must have been generated from
+        /// @return             Gravity surrogate
+
+        static GravitySurrogate Load                                        (   const   File&                       aFile,
+                                                                                const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) ;
+
+    private:
+
+        // Parameters of the field the table was generated from
+        double                  gravitationalParameter_ ;
+        double                  referenceRadius_ ;
+        Size                    degree_ ;
+        double                  accelerationTolerance_ ;
+
+        Size                    referenceDegree_ ;
+        double                  minimumRadius_ ;
+        double                  maximumRadius_ ;
+        double                  radialStep_ ;
+        double                  angularStep_ ;
+        Size                    radialCount_ ;
+        Size                    latitudeCount_ ;
+        Size                    longitudeCount_ ;
+        double                  maximumError_ ;
+
+        // Accelerations (x, y, z) by radius, latitude and longitude, the longitude varying fastest
+        Shared<const float>     accelerations_ ;
+
+                                GravitySurrogate                            ( ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/OrientationCache.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <cstdint>
+#include <map>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::Shared ;
+
+using ostk::math::obj::Vector4d ;
+using ostk::math::obj::Matrix3d ;
+
+using ostk::physics::time::Instant ;
+using ostk::physics::time::Duration ;
+using ostk::physics::coord::Frame ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Cache of the orientation of a frame (e.g. ITRF) with respect to a reference frame (e.g. GCRF), over a propagation
+///
+///                             The orientation and angular velocity are sampled on a regular grid starting at an epoch, each sample being computed
+///                             from the frame graph the first time it is needed. In between two samples, the orientation quaternion is interpolated
+///                             with a cubic Hermite polynomial (whose end slopes follow from the angular velocities) and normalized.
+///                             At most a given number of samples is kept: beyond it, the samples farthest from the last queried time are dropped,
+///                             so that memory (and the cost of copying the cache) stays bounded over long propagations.
+///                             The cache is not thread safe.
+
+class OrientationCache
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     OrientationCache orientationCache = { earthSPtr->accessFrame(), Frame::GCRF(), anEpoch } ;
+        /// @endcode
+        ///
+        /// @param              [in] aFrameSPtr A frame, whose orientation is cached
+        /// @param              [in] aReferenceFrameSPtr A reference frame
+        /// @param              [in] anEpoch An epoch, at which the first sample is taken
+        /// @param              [in] (optional) aSampleStep A step between two samples
+        /// @param              [in] (optional) aCapacity A maximum number of samples kept (at least 2)
+
+                                OrientationCache                            (   const   Shared<const Frame>&        aFrameSPtr,
+                                                                                const   Shared<const Frame>&        aReferenceFrameSPtr,
+                                                                                const   Instant&                    anEpoch,
+                                                                                const   Duration&                   aSampleStep                                 =   Duration::Minutes(1.0),
+                                                                                const   Size                        aCapacity                                   =   1024 ) ;
+
+        /// @brief              Check if orientation cache is defined
+        ///
+        /// @return             True if orientation cache is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get epoch
+        ///
+        /// @return             Epoch
+
+        Instant                 getEpoch                                    ( ) const ;
+
+        /// @brief              Get number of computed samples
+        ///
+        /// @return             Number of computed samples
+
+        Size                    getSampleCount                              ( ) const ;
+
+        /// @brief              Get maximum number of samples kept
+        ///
+        /// @return             Maximum number of samples kept
+
+        Size                    getCapacity                                 ( ) const ;
+
+        /// @brief              Get rotation matrix from the frame to the reference frame, at a time from the epoch
+        ///
+        ///                     The columns of the matrix are the axes of the frame, expressed in the reference frame.
+        ///
+        /// @code
+        ///                     Matrix3d dcm_GCRF_ITRF = orientationCache.getRotationMatrixAt(60.0) ;
+        ///                     Vector3d x_GCRF = dcm_GCRF_ITRF * x_ITRF ;
+        /// @endcode
+        ///
+        /// @param              [in] aTime A time from the epoch [s]
+        /// @return             Rotation matrix
+
+        Matrix3d                getRotationMatrixAt                         (   const   double                      aTime                                       ) ;
+
+        /// @brief              Get rotation matrix from the frame to the reference frame, at an instant
+        ///
+        /// @param              [in] anInstant An instant
+        /// @return             Rotation matrix
+
+        Matrix3d                getRotationMatrixAt                         (   const   Instant&                    anInstant                                   ) ;
+
+        /// @brief              Clear computed samples
+
+        void                    clear                                       ( ) ;
+
+        /// @brief              Constructs an undefined orientation cache
+        ///
+        /// @return             Undefined orientation cache
+
+        static OrientationCache Undefined                                   ( ) ;
+
+    private:
+
+        // Orientation quaternion (x, y, z, w) of the frame in the reference frame, and its time derivative [s^-1]
+        struct Sample
+        {
+            Vector4d            orientation ;
+            Vector4d            orientationDerivative ;
+        } ;
+
+        Shared<const Frame>     frameSPtr_ ;
+        Shared<const Frame>     referenceFrameSPtr_ ;
+        Instant                 epoch_ ;
+        double                  sampleStep_ ;
+        Size                    capacity_ ;
+
+        std::map<std::int64_t, Sample> samples_ ;
+
+        // Samples bounding the last queried interval, as consecutive queries mostly fall in the same interval
+        std::int64_t            lastIntervalIndex_ ;
+        Sample                  lastIntervalStart_ ;
+        Sample                  lastIntervalEnd_ ;
+
+        const Sample&           accessSample                                (   const   std::int64_t                aSampleIndex                                ) ;
+
+        Sample                  computeSample                               (   const   std::int64_t                aSampleIndex                                ) const ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
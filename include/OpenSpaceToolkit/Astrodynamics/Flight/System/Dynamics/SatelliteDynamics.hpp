@@ -14,6 +14,13 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/AtmosphericDrag.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/OrientationCache.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Objects/CelestialBodies/Moon.hpp>
@@ -26,12 +33,14 @@
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,11 +60,13 @@ namespace dynamics
 
 using ostk::core::types::Integer ;
 using ostk::core::types::Real ;
+using ostk::core::types::Size ;
 using ostk::core::types::String ;
 using ostk::core::types::Shared ;
 using ostk::core::ctnr::Array ;
 
 using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3d ;
 
 using ostk::physics::Environment ;
 using ostk::physics::time::Instant ;
@@ -76,6 +87,13 @@ using ostk::astro::flight::system::Dynamics ;
 
 /// @brief                      Defines a satellite in orbit subject to forces of varying fidelity
 ///                             Represents a system of differential equations that can be solved by calling the NumericalSolver class
+///
+///                             The accelerations are the sum of those of a list of force models, evaluated from a context shared by the models
+///                             at each call of the dynamical equations (see ForceModel::Context).
+///
+///                             The environment is read-only during integration, and shared between copies. The integration state (epoch, caches
+///                             and force models) belongs to each copy: a satellite dynamics is not thread safe, but copies of it can be integrated
+///                             concurrently.
 
 class SatelliteDynamics : public Dynamics
 {
@@ -96,6 +114,25 @@ class SatelliteDynamics : public Dynamics
                                 SatelliteDynamics                           (   const   Environment&                anEnvironment,
                                                                                 const   SatelliteSystem&            aSatelliteSystem                            ) ;
 
+        /// @brief              Constructor, with a list of force models
+        ///
+        ///                     The default force models are the gravity of Earth (central body), and of the other celestial objects of the environment (third bodies).
+        ///
+        /// @code
+        ///                     Environment environment = { ... } ;
+        ///                     SatelliteSystem satelliteSystem = { ... } ;
+        ///                     Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")) } ;
+        ///                     SatelliteDynamics satelliteDynamics = { environment, satelliteSystem, forceModels } ;
+        /// @endcode
+        ///
+        /// @param              [in] anEnvironment An environment
+        /// @param              [in] aSatelliteSystem A satellite system
+        /// @param              [in] aForceModelArray An array of force models (cloned)
+
+                                SatelliteDynamics                           (   const   Environment&                anEnvironment,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   Array<Shared<ForceModel>>&  aForceModelArray                            ) ;
+
         /// @brief              Copy Constructor
         ///
         /// @param              [in] SatelliteDynamics A satellite dynamics
@@ -114,6 +151,8 @@ class SatelliteDynamics : public Dynamics
 
         /// @brief              Equal to operator
         ///
+        ///                     Force models are compared in order, by type and configuration.
+        ///
         /// @param              [in] aSatelliteDynamics A satellite dynamics
         /// @return             True if satellite dynamics are equal
 
@@ -157,8 +196,17 @@ class SatelliteDynamics : public Dynamics
 
         Instant                 getInstant                                    ( ) const ;
 
+        /// @brief              Get force models
+        ///
+        /// @return             Array of force models
+
+        Array<Shared<const ForceModel>> getForceModels                      ( ) const ;
+
         /// @brief              Set satellite dynamics initial epoch
         ///
+        ///                     The orientation of Earth and the position of the Sun are cached from the first epoch on,
+        ///                     and reused by the following propagations.
+        ///
         /// @code
         ///                     Instant instant = { ... } ;
         ///                     satelliteDynamics.setInstant(instant) ;
@@ -176,22 +224,83 @@ class SatelliteDynamics : public Dynamics
 
         virtual Dynamics::DynamicalEquationWrapper getDynamicalEquations    ( ) override ;
 
+        /// @brief              Obtain second order dynamical equations function wrapper
+        ///
+        ///                     Only the accelerations (last 3 elements of the state vector derivative) are returned,
+        ///                     to be integrated with the second order steppers of the numerical solver.
+        ///
+        /// @code
+        ///                     Dynamics::DynamicalEquationWrapper dyneq = satelliteDynamics.getSecondOrderDynamicalEquations() ;
+        /// @endcode
+        /// @return             std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+
+        virtual Dynamics::DynamicalEquationWrapper getSecondOrderDynamicalEquations ( ) override ;
+
+        /// @brief              Obtain variational equations function wrapper
+        ///
+        ///                     The augmented state holds the 6-element position and velocity vector, followed by the 36 elements of the
+        ///                     6x6 state transition matrix (stored column-major). The state transition matrix is propagated with the
+        ///                     analytic partials of the force models with respect to the position (ForceModel::calculatePositionJacobianAt):
+        ///                     central body point mass and J2 gravity, third body point mass gravity and atmospheric drag, and with respect to
+        ///                     the velocity (ForceModel::calculateVelocityJacobianAt): atmospheric drag. Higher order terms of the central body
+        ///                     gravity field are included in the state, but not in the partials.
+        ///
+        /// @code
+        ///                     Dynamics::DynamicalEquationWrapper dyneq = satelliteDynamics.getVariationalDynamicalEquations() ;
+        /// @endcode
+        /// @return             std::function<void(const std::vector<double>&, std::vector<double>&, const double)>
+
+        Dynamics::DynamicalEquationWrapper getVariationalDynamicalEquations ( ) ;
+
+        /// @brief              Constructs an undefined satellite dynamics
+        ///
+        /// @return             Undefined satellite dynamics
+
+        static SatelliteDynamics Undefined                                  ( ) ;
+
     private:
 
-        Environment             environment_ ;
+        Shared<const Environment> environmentSPtr_ ;
         Shared<const Frame>     gcrfSPtr_ ;
         SatelliteSystem         satelliteSystem_ ;
         Instant                 instant_ ;
 
-        // Only force model currently used that incorporates solely Earth's gravity
+        Array<Shared<ForceModel>> forceModels_ ;
+        Shared<forcemodels::AtmosphericDrag> atmosphericDragSPtr_ ; // Drag model providing the context density (nullptr if none or several)
+
+        Instant                 cacheEpoch_ ;
+        double                  cacheTimeOffset_ ; // Time from the cache epoch to the instant [s]
+        Shared<const Frame>     earthFrameSPtr_ ;
+        OrientationCache        earthOrientationCache_ ;
+        EphemerisCache          sunEphemerisCache_ ;
+
+        // Position and velocity derivatives
         void                    DynamicalEquations                          (   const   Dynamics::StateVector&      x,
                                                                                         Dynamics::StateVector&      dxdt,
                                                                                 const   double                      t                                           ) ;
 
-        // // Atmospheric perturbations only
-        // void                    Exponential_Dynamics                        (   const   SatelliteDynamics::StateVector&     x,
-        //                                                                                 SatelliteDynamics::StateVector&     dxdt,
-        //                                                                         const   double                                                                  ) const ;
+        // Accelerations only, the position derivatives are left untouched
+        void                    SecondOrderDynamicalEquations               (   const   Dynamics::StateVector&      x,
+                                                                                        Dynamics::StateVector&      dxdt,
+                                                                                const   double                      t                                           ) ;
+
+        // Position and velocity, augmented with the state transition matrix
+        void                    VariationalDynamicalEquations               (   const   Dynamics::StateVector&      x,
+                                                                                        Dynamics::StateVector&      dxdt,
+                                                                                const   double                      t                                           ) ;
+
+        // Quantities shared by the force models, computed once per call
+        ForceModel::Context     ContextAt                                   (   const   Dynamics::StateVector&      x,
+                                                                                const   double                      t                                           ) ;
+
+        // Sum of the accelerations of the force models, in GCRF [m/s^2]
+        Vector3d                AccelerationAt                              (   const   ForceModel::Context&        aContext                                    ) ;
+
+        // Partial derivatives of the acceleration with respect to the position, in GCRF [s^-2]
+        Matrix3d                AccelerationJacobianAt                      (   const   ForceModel::Context&        aContext                                    ) ;
+
+        // Partial derivatives of the acceleration with respect to the velocity, in GCRF [s^-1]
+        Matrix3d                AccelerationVelocityJacobianAt              (   const   ForceModel::Context&        aContext                                    ) ;
 
 } ;
 
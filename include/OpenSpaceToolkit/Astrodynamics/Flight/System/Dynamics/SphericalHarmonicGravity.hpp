@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::fs::File ;
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::VectorXd ;
+using ostk::math::obj::MatrixXd ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Spherical harmonic gravity field, evaluated with the Cunningham recursion on fully normalized coefficients
+///
+///                             The recursion is written in Cartesian coordinates of the body fixed frame, and has no singularity at the poles.
+///                             The coefficients, the recursion factors and the factors of the acceleration sums are stored with one column per
+///                             degree, so that the inner loops (over the orders of a degree, which are independent) run over contiguous memory
+///                             and are vectorized.
+///
+///                             The degree and order are truncated at each evaluation from the distance to the body center: the degree is the
+///                             lowest one for which the estimated magnitude of the remaining terms, from the degree variances of the coefficients,
+///                             is below a target acceleration error. At GEO, this discards most of a high degree field.
+///
+/// @ref                        Montenbruck O., Gill E., Satellite Orbits, 3.2.4
+/// @ref                        Eckman R., Brown A., Adamo D., Normalization of Gravitational Acceleration Models, NASA JSC-CN-23097, 2011
+
+class SphericalHarmonicGravity
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     SphericalHarmonicGravity gravity = { 3.986004415e14, 6378136.3, C, S } ;
+        /// @endcode
+        ///
+        /// @param              [in] aGravitationalParameter A gravitational parameter [m^3/s^2]
+        /// @param              [in] aReferenceRadius A reference radius [m]
+        /// @param              [in] aCosineCoefficients Fully normalized cosine coefficients C(n, m), square of size (degree + 1)
+        /// @param              [in] aSineCoefficients Fully normalized sine coefficients S(n, m), square of size (degree + 1)
+        /// @param              [in] (optional) anAccelerationTolerance A target acceleration error, driving the truncation [m/s^2]
+
+                                SphericalHarmonicGravity                    (   const   double                      aGravitationalParameter,
+                                                                                const   double                      aReferenceRadius,
+                                                                                const   MatrixXd&                   aCosineCoefficients,
+                                                                                const   MatrixXd&                   aSineCoefficients,
+                                                                                const   double                      anAccelerationTolerance                     =   1e-10 ) ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity
+        /// @return             True if spherical harmonic gravities have the same parameters, coefficients and tolerance
+
+        bool                    operator ==                                 (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) const ;
+
+        /// @brief              Not equal to operator
+        ///
+        /// @param              [in] aSphericalHarmonicGravity A spherical harmonic gravity
+        /// @return             True if spherical harmonic gravities are not equal
+
+        bool                    operator !=                                 (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) const ;
+
+        /// @brief              Check if spherical harmonic gravity is defined
+        ///
+        /// @return             True if spherical harmonic gravity is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get gravitational parameter
+        ///
+        /// @return             Gravitational parameter [m^3/s^2]
+
+        double                  getGravitationalParameter                   ( ) const ;
+
+        /// @brief              Get reference radius
+        ///
+        /// @return             Reference radius [m]
+
+        double                  getReferenceRadius                          ( ) const ;
+
+        /// @brief              Get maximum degree of the coefficients
+        ///
+        /// @return             Maximum degree
+
+        Size                    getDegree                                   ( ) const ;
+
+        /// @brief              Get target acceleration error
+        ///
+        /// @return             Target acceleration error [m/s^2]
+
+        double                  getAccelerationTolerance                    ( ) const ;
+
+        /// @brief              Get truncation degree at a distance from the body center
+        ///
+        ///                     The estimated magnitude of the terms of degree n is (GM / r^2) * (n + 1) * (R / r)^n * sigma_n, with sigma_n the
+        ///                     root sum square of the coefficients of degree n. The truncation degree is the lowest one for which the sum of the
+        ///                     estimates of the higher degrees is below the target acceleration error.
+        ///
+        /// @param              [in] aDistance A distance from the body center [m]
+        /// @return             Truncation degree
+
+        Size                    getTruncationDegreeAt                       (   const   double                      aDistance                                   ) const ;
+
+        /// @brief              Get acceleration, truncated at the target acceleration error
+        ///
+        /// @code
+        ///                     Vector3d acceleration_ITRF = gravity.getAccelerationAt(position_ITRF) ;
+        /// @endcode
+        ///
+        /// @param              [in] aPosition A position in the body fixed frame [m]
+        /// @return             Acceleration in the body fixed frame [m/s^2]
+
+        Vector3d                getAccelerationAt                           (   const   Vector3d&                   aPosition                                   ) const ;
+
+        /// @brief              Get acceleration, up to a degree and order
+        ///
+        /// @param              [in] aPosition A position in the body fixed frame [m]
+        /// @param              [in] aDegree A degree
+        /// @param              [in] anOrder An order
+        /// @return             Acceleration in the body fixed frame [m/s^2]
+
+        Vector3d                getAccelerationAt                           (   const   Vector3d&                   aPosition,
+                                                                                const   Size                        aDegree,
+                                                                                const   Size                        anOrder                                     ) const ;
+
+        /// @brief              Constructs an undefined spherical harmonic gravity
+        ///
+        /// @return             Undefined spherical harmonic gravity
+
+        static SphericalHarmonicGravity Undefined                           ( ) ;
+
+        /// @brief              Load spherical harmonic gravity from an ICGEM gravity field file (.gfc)
+        ///
+        ///                     Only the static (gfc) coefficients are read. The coefficients must be fully normalized.
+        ///
+        /// @code
+        ///                     SphericalHarmonicGravity gravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/path/to/EGM2008.gfc")), 100) ;
+        /// @endcode
+        ///
+        /// @param              [in] aFile An ICGEM gravity field file
+        /// @param              [in] aMaximumDegree A maximum degree, above which the coefficients are discarded
+        /// @param              [in] (optional) anAccelerationTolerance A target acceleration error, driving the truncation [m/s^2]
+        /// @return             Spherical harmonic gravity
+
+        static SphericalHarmonicGravity Load                                (   const   File&                       aFile,
+                                                                                const   Size                        aMaximumDegree,
+                                                                                const   double                      anAccelerationTolerance                     =   1e-10 ) ;
+
+    private:
+
+        double                  gravitationalParameter_ ;
+        double                  referenceRadius_ ;
+        double                  accelerationTolerance_ ;
+
+        Size                    degree_ ;
+
+        // Root sum square of the coefficients of each degree
+        VectorXd                degreeAmplitudes_ ;
+
+        // Recursion factors of V(n, m) and W(n, m), up to degree + 1: diagonal, and vertical (n - 1 and n - 2 terms) stored as (m, n)
+        VectorXd                diagonalFactors_ ;
+        MatrixXd                verticalFactorsA_ ;
+        MatrixXd                verticalFactorsB_ ;
+
+        // Coefficients C(n, m) and S(n, m) stored as (m, n), multiplied by the normalization factors of the acceleration terms against
+        // V(n + 1, m + 1), V(n + 1, m - 1) (stored as (m - 1, n)) and V(n + 1, m)
+        MatrixXd                upperOrderCosineCoefficients_ ;
+        MatrixXd                upperOrderSineCoefficients_ ;
+        MatrixXd                lowerOrderCosineCoefficients_ ;
+        MatrixXd                lowerOrderSineCoefficients_ ;
+        MatrixXd                sameOrderCosineCoefficients_ ;
+        MatrixXd                sameOrderSineCoefficients_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
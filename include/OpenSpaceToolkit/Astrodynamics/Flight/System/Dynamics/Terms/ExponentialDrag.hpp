@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/ExponentialDrag.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_Terms_ExponentialDrag__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_Terms_ExponentialDrag__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <iostream>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace terms
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Atmospheric drag in a piecewise exponential atmosphere, as a composed dynamics term
+///
+///                             The atmosphere co-rotates with the central body, around the Z axis of the frame of the state, and the altitude
+///                             is taken above the ellipsoid to first order in the flattening. Below the minimum altitude, the satellite is
+///                             considered re-entered and an error is thrown.
+
+class ExponentialDrag
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     ExponentialDrag exponentialDrag = { 0.022, 6378137.0, 1.0 / 298.257223563, 7.2921159e-5, ExponentialAtmosphere::Default() } ;
+        /// @endcode
+        ///
+        /// @param              [in] aBallisticCoefficient A ballistic coefficient (drag coefficient * cross sectional area / mass) [m^2/kg]
+        /// @param              [in] anEquatorialRadius An equatorial radius of the central body [m]
+        /// @param              [in] aFlattening A flattening of the central body
+        /// @param              [in] aRotationRate A rotation rate of the central body [rad/s]
+        /// @param              [in] anAtmosphere An atmosphere
+        /// @param              [in] (optional) aMinimumAltitude A minimum altitude [m]
+
+                                ExponentialDrag                             (   const   double                      aBallisticCoefficient,
+                                                                                const   double                      anEquatorialRadius,
+                                                                                const   double                      aFlattening,
+                                                                                const   double                      aRotationRate,
+                                                                                const   ExponentialAtmosphere&      anAtmosphere,
+                                                                                const   double                      aMinimumAltitude                            =   70000.0 ) ;
+
+        /// @brief              Check if term is defined
+        ///
+        /// @return             True if term is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get ballistic coefficient
+        ///
+        /// @return             Ballistic coefficient [m^2/kg]
+
+        double                  getBallisticCoefficient                     ( ) const ;
+
+        /// @brief              Get altitude above the ellipsoid
+        ///
+        /// @param              [in] x A state (position [m], velocity [m/s])
+        /// @param              [in] r A position norm [m]
+        /// @return             Altitude [m]
+
+        double                  getAltitudeAt                               (   const   double*                     x,
+                                                                                const   double                      r                                           ) const ;
+
+        /// @brief              Print term
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+        /// @brief              Add acceleration
+        ///
+        /// @param              [in] x A state (position [m], velocity [m/s])
+        /// @param              [in] r A position norm [m]
+        /// @param              [in, out] anAcceleration An acceleration [m/s^2]
+
+        void                    addAccelerationAt                           (   const   double*                     x,
+                                                                                const   double                      r,
+                                                                                        double*                     anAcceleration                              ) const ;
+
+    private:
+
+        double                  ballisticCoefficient_ ;
+        double                  equatorialRadius_ ;
+        double                  flattening_ ;
+        double                  rotationRate_ ;
+        ExponentialAtmosphere   atmosphere_ ;
+        double                  minimumAltitude_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Defined in the header, to be inlined in the composed dynamics
+
+inline double                   ExponentialDrag::getAltitudeAt              (   const   double*                     x,
+                                                                                const   double                      r                                           ) const
+{
+
+    const double sinLatitude = x[2] / r ;
+
+    return r - (equatorialRadius_ * (1.0 - (flattening_ * sinLatitude * sinLatitude))) ;
+
+}
+
+inline void                     ExponentialDrag::addAccelerationAt          (   const   double*                     x,
+                                                                                const   double                      r,
+                                                                                        double*                     anAcceleration                              ) const
+{
+
+    const double altitude = this->getAltitudeAt(x, r) ;
+
+    if (altitude < minimumAltitude_)
+    {
+        throw ostk::core::error::RuntimeError("Satellite altitude too low, has re-entered.") ;
+    }
+
+    // Velocity relative to the atmosphere: v - w x r, with w = [0, 0, rotationRate]
+
+    const double relativeVelocityX = x[3] + (rotationRate_ * x[1]) ;
+    const double relativeVelocityY = x[4] - (rotationRate_ * x[0]) ;
+    const double relativeVelocityZ = x[5] ;
+
+    const double relativeVelocityNorm = std::sqrt((relativeVelocityX * relativeVelocityX) + (relativeVelocityY * relativeVelocityY) + (relativeVelocityZ * relativeVelocityZ)) ;
+
+    const double factor = -0.5 * ballisticCoefficient_ * atmosphere_.getDensityAt(altitude) * relativeVelocityNorm ;
+
+    anAcceleration[0] += factor * relativeVelocityX ;
+    anAcceleration[1] += factor * relativeVelocityY ;
+    anAcceleration[2] += factor * relativeVelocityZ ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
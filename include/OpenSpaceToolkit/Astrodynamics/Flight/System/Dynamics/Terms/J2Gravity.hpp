@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/J2Gravity.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_Terms_J2Gravity__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_Terms_J2Gravity__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace terms
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      J2 (oblateness) gravity of the central body, as a composed dynamics term
+///
+///                             The pole of the central body is the Z axis of the frame of the state.
+
+class J2Gravity
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     J2Gravity j2Gravity = { 3.986004418e14, 6378137.0, 1.08262668e-3 } ;
+        /// @endcode
+        ///
+        /// @param              [in] aGravitationalParameter A gravitational parameter [m^3/s^2]
+        /// @param              [in] anEquatorialRadius An equatorial radius [m]
+        /// @param              [in] aJ2 A J2 coefficient (unnormalized, i.e. -C20)
+
+                                J2Gravity                                   (   const   double                      aGravitationalParameter,
+                                                                                const   double                      anEquatorialRadius,
+                                                                                const   double                      aJ2                                         ) ;
+
+        /// @brief              Check if term is defined
+        ///
+        /// @return             True if term is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get gravitational parameter
+        ///
+        /// @return             Gravitational parameter [m^3/s^2]
+
+        double                  getGravitationalParameter                   ( ) const ;
+
+        /// @brief              Get equatorial radius
+        ///
+        /// @return             Equatorial radius [m]
+
+        double                  getEquatorialRadius                         ( ) const ;
+
+        /// @brief              Get J2 coefficient
+        ///
+        /// @return             J2 coefficient
+
+        double                  getJ2                                       ( ) const ;
+
+        /// @brief              Print term
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+        /// @brief              Add acceleration
+        ///
+        /// @param              [in] x A state (position [m], velocity [m/s])
+        /// @param              [in] r A position norm [m]
+        /// @param              [in, out] anAcceleration An acceleration [m/s^2]
+
+        void                    addAccelerationAt                           (   const   double*                     x,
+                                                                                const   double                      r,
+                                                                                        double*                     anAcceleration                              ) const ;
+
+    private:
+
+        double                  gravitationalParameter_ ;
+        double                  equatorialRadius_ ;
+        double                  j2_ ;
+
+        // Constant factor of the acceleration: -3/2 * GM * J2 * R^2
+        double                  factor_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Defined in the header, to be inlined in the composed dynamics
+
+inline void                     J2Gravity::addAccelerationAt                (   const   double*                     x,
+                                                                                const   double                      r,
+                                                                                        double*                     anAcceleration                              ) const
+{
+
+    const double r2 = r * r ;
+    const double factor = factor_ / (r2 * r2 * r) ;
+    const double zRatio = 5.0 * x[2] * x[2] / r2 ;
+
+    anAcceleration[0] += factor * x[0] * (1.0 - zRatio) ;
+    anAcceleration[1] += factor * x[1] * (1.0 - zRatio) ;
+    anAcceleration[2] += factor * x[2] * (3.0 - zRatio) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
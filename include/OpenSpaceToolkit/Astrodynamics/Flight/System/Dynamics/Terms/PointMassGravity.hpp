@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/PointMassGravity.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_Terms_PointMassGravity__
+#define __OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_Terms_PointMassGravity__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace terms
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Point mass gravity of the central body, as a composed dynamics term
+
+class PointMassGravity
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     PointMassGravity pointMassGravity = { 3.986004418e14 } ;
+        /// @endcode
+        ///
+        /// @param              [in] aGravitationalParameter A gravitational parameter [m^3/s^2]
+
+                                PointMassGravity                            (   const   double                      aGravitationalParameter                     ) ;
+
+        /// @brief              Check if term is defined
+        ///
+        /// @return             True if term is defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get gravitational parameter
+        ///
+        /// @return             Gravitational parameter [m^3/s^2]
+
+        double                  getGravitationalParameter                   ( ) const ;
+
+        /// @brief              Print term
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+        /// @brief              Add acceleration
+        ///
+        /// @param              [in] x A state (position [m], velocity [m/s])
+        /// @param              [in] r A position norm [m]
+        /// @param              [in, out] anAcceleration An acceleration [m/s^2]
+
+        void                    addAccelerationAt                           (   const   double*                     x,
+                                                                                const   double                      r,
+                                                                                        double*                     anAcceleration                              ) const ;
+
+    private:
+
+        double                  gravitationalParameter_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Defined in the header, to be inlined in the composed dynamics
+
+inline void                     PointMassGravity::addAccelerationAt         (   const   double*                     x,
+                                                                                const   double                      r,
+                                                                                        double*                     anAcceleration                              ) const
+{
+
+    const double factor = -gravitationalParameter_ / (r * r * r) ;
+
+    anAcceleration[0] += factor * x[0] ;
+    anAcceleration[1] += factor * x[1] ;
+    anAcceleration[2] += factor * x[2] ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
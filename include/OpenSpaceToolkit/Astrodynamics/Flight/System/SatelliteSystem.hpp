@@ -65,7 +65,8 @@ class SatelliteSystem : public System
         ///                     Matrix3d intertiaTensor ( ... ) ;
         ///                     Real crossSectionalSurfaceArea = 0.8 ;
         ///                     Real dragCoefficient = 2.2 ;
-        ///                     System system = { mass, composite, intertiaTensor, crossSectionalSurfaceArea, dragCoefficient } ;
+        ///                     Real reflectivityCoefficient = 1.3 ;
+        ///                     System system = { mass, composite, intertiaTensor, crossSectionalSurfaceArea, dragCoefficient, reflectivityCoefficient } ;
         /// @endcode
         ///
         /// @param              [in] aMass A mass
@@ -73,12 +74,14 @@ class SatelliteSystem : public System
         /// @param              [in] anInertiaTensor An inertia tensor
         /// @param              [in] aCrossSectionalSurfaceArea A cross sectional surface area
         /// @param              [in] aDragCoefficient A drag coefficient
+        /// @param              [in] (optional) aReflectivityCoefficient A reflectivity coefficient (solar radiation pressure), between 1 (absorbed) and 2 (specularly reflected)
 
                                 SatelliteSystem                             (   const   Mass&                       aMass,
                                                                                 const   Composite&                  aSatelliteGeometry,
                                                                                 const   Matrix3d&                   anInertiaTensor,
                                                                                 const   Real&                       aCrossSectionalSurfaceArea,
-                                                                                const   Real&                       aDragCoefficient                            ) ;
+                                                                                const   Real&                       aDragCoefficient,
+                                                                                const   Real&                       aReflectivityCoefficient                    =   Real::Undefined() ) ;
 
         /// @brief              Copy Constructor
         ///
@@ -163,11 +166,24 @@ class SatelliteSystem : public System
 
         Real                    getDragCoefficient                          ( ) const ;
 
+        /// @brief              Get satellite system's reflectivity coefficient
+        ///
+        ///                     Undefined when not provided at construction.
+        ///
+        /// @code
+        ///                     Real reflectivityCoefficient = satelliteSystem.getReflectivityCoefficient() ;
+        /// @endcode
+        ///
+        /// @return             Real
+
+        Real                    getReflectivityCoefficient                  ( ) const ;
+
     private:
 
         Matrix3d                inertiaTensor_ ;
         Real                    crossSectionalSurfaceArea_ ;
         Real                    dragCoefficient_ ;
+        Real                    reflectivityCoefficient_ ;
 
 } ;
 
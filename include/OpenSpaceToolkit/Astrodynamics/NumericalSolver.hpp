@@ -12,13 +12,23 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Event.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Statistics.hpp>
+
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <mutex>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -33,14 +43,49 @@ using ostk::core::types::Integer ;
 using ostk::core::types::Real ;
 using ostk::core::types::String ;
 using ostk::core::types::Size ;
+using ostk::core::types::Shared ;
+using ostk::core::ctnr::Pair ;
 using ostk::core::ctnr::Array ;
 
 using ostk::physics::time::Instant ;
 using ostk::physics::time::Duration ;
 
+using ostk::astro::numericalsolver::Observer ;
+using ostk::astro::numericalsolver::Event ;
+using ostk::astro::numericalsolver::Statistics ;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @brief                      Defines a numerical ODE solver that use the Boost Odeint libraries. This class will be moved into OSTk-math in the future.
+///
+///                             The solver does not retain intermediate states: they can be streamed to an optional Observer
+///                             (callback, ring buffer, binary file...) passed to the integration methods.
+///                             Zero crossings of event functions (node crossings, altitude thresholds...) can be located during the same pass.
+///                             Integration statistics (evaluations, accepted and rejected steps, step sizes) are accumulated over all integrations
+///                             until reset. Timing the evaluations of the dynamics reads the clock twice per evaluation, it is enabled on request.
+///
+///                             By default, each integration starts with the provided time step and grows it from there.
+///                             The initial time step can instead be estimated from the system of equations (Hairer, Norsett & Wanner, II.4),
+///                             or carried over from the previous integration, which saves the step ramp-up when integrating repeatedly over nearby arcs.
+///
+///                             The AdamsBashforthMoulton stepper is a variable-step, variable-order (up to 12) predictor-corrector multistep method:
+///                             once started, it evaluates the system of equations only twice per step, which pays off for long arcs with expensive dynamics.
+///
+///                             The BulirschStoer stepper extrapolates Gragg's modified midpoint rule to a vanishing step size, adapting both its order and its step:
+///                             at very tight tolerances (down to 1e-15), it takes much longer steps than embedded Runge-Kutta pairs, for fewer evaluations.
+///                             The BulirschStoerDenseOutput stepper is its dense output variant: the states at output times are interpolated within its
+///                             long steps, instead of cutting the steps at every output time.
+///
+///                             The RungeKuttaNystrom64 stepper integrates second order systems x'' = f(x, x', t) directly, with the embedded 6(4) pair
+///                             of Dormand, El-Mikkawy & Prince: it evaluates the system of equations five times per step, against thirteen for RungeKuttaFehlberg78.
+///                             The state must hold the positions, followed by the velocities: the system of equations only needs to return the accelerations,
+///                             into the second half of the state derivative (the solver fills in the velocities). Accelerations depending on the velocity
+///                             (e.g. drag) are supported, but integrated to a lower order than the position dependent ones.
+///
+///                             The StormerVerlet, Yoshida4 and Yoshida6 steppers are fixed-step symplectic methods of order 2, 4 and 6, for the same second order systems:
+///                             every step has the provided time step (shortened only to land on an end or output time), and the tolerances are not used.
+///                             They evaluate the system of equations 1, 3 and 7 times per step, and keep the energy of conservative systems bounded
+///                             (instead of drifting secularly) over arbitrarily long arcs. They are only symplectic for accelerations depending on the positions.
 
 class NumericalSolver
 {
@@ -50,7 +95,15 @@ class NumericalSolver
         enum class StepperType
         {
             RungeKuttaCashKarp54,
-            RungeKuttaFehlberg78
+            RungeKuttaFehlberg78,
+            RungeKuttaDopri5,
+            AdamsBashforthMoulton,
+            BulirschStoer,
+            BulirschStoerDenseOutput,
+            RungeKuttaNystrom64,
+            StormerVerlet,
+            Yoshida4,
+            Yoshida6
         } ;
 
         enum class LogType
@@ -60,9 +113,33 @@ class NumericalSolver
             LogAdaptive
         } ;
 
+        enum class InitialStepType
+        {
+            UserDefined,                                                        // Start each integration with the provided time step
+            Automatic,                                                          // Estimate the initial time step from the system of equations at the initial state
+            WarmStart                                                           // Start from the step size reached by the previous integration (estimated for the first one)
+        } ;
+
         typedef std::vector<double> StateVector ; // Container used to hold the state vector
         typedef std::function<void(const StateVector&, StateVector&, const double)> SystemOfEquationsWrapper ; // Function pointer type for returning dynamical equation's pointers
 
+        template <int N>
+        using FixedStateVector = Eigen::Matrix<double, N, 1> ; // Container used to hold a state vector of compile-time dimension, without heap allocation
+
+        typedef Eigen::ArrayXXd EnsembleStateArray ; // Container used to hold the states of an ensemble, one sample per row: each column holds a state component for all samples, contiguously
+        typedef std::function<void(const EnsembleStateArray&, EnsembleStateArray&, const double)> EnsembleSystemOfEquationsWrapper ; // Function pointer type for returning the dynamical equations of all samples at once
+
+        /// @brief              Continuous extension of an accepted step
+        ///
+        ///                     The state over the step is a polynomial of the normalized time s = (t - startTime) / (endTime - startTime), in [0, 1].
+
+        struct DenseOutputStep
+        {
+            double              startTime ;                                     ///< Time at the start of the step [s]
+            double              endTime ;                                       ///< Time at the end of the step [s]
+            Array<StateVector>  coefficientArray ;                              ///< State coefficients, by increasing power of s
+        } ;
+
         /// @brief              Constructor
         ///
         /// @code
@@ -74,12 +151,14 @@ class NumericalSolver
         /// @param              [in] aTimeStep A number indicating the initial guess time step the numerical solver will take
         /// @param              [in] aRelativeTolerance A number indicating the relative integration tolerance
         /// @param              [in] anAbsoluteTolerance A number indicating the absolute integration tolerance
+        /// @param              [in] (optional) anInitialStepType An enum indicating how the initial time step of each integration is chosen
 
                                 NumericalSolver                             (   const   NumericalSolver::LogType&   aLogType,
                                                                                 const   NumericalSolver::StepperType& aStepperType,
                                                                                 const   Real&                       aTimeStep,
                                                                                 const   Real&                       aRelativeTolerance,
-                                                                                const   Real&                       anAbsoluteTolerance                         ) ;
+                                                                                const   Real&                       anAbsoluteTolerance,
+                                                                                const   NumericalSolver::InitialStepType& anInitialStepType     =   NumericalSolver::InitialStepType::UserDefined ) ;
 
         /// @brief              Copy Constructor
         ///
@@ -87,6 +166,13 @@ class NumericalSolver
 
                                 NumericalSolver                             (   const   NumericalSolver&            aNumericalSolver                            ) ;
 
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aNumericalSolver A numerical solver
+        /// @return             Reference to numerical solver
+
+        NumericalSolver&        operator =                                  (   const   NumericalSolver&            aNumericalSolver                            ) ;
+
         /// @brief              Clone numerical solver
         ///
         /// @return             Pointer to cloned numerical solver
@@ -122,6 +208,31 @@ class NumericalSolver
 
         bool                    isDefined                                   ( ) const ;
 
+        /// @brief              Check if the stepper integrates second order systems
+        ///
+        ///                     The state of a second order system holds the positions, followed by the velocities,
+        ///                     and its system of equations only needs to return the accelerations.
+        ///
+        /// @code
+        ///                     numericalSolver.isSecondOrder() ;
+        /// @endcode
+        ///
+        /// @return             True if the stepper integrates second order systems
+
+        bool                    isSecondOrder                               ( ) const ;
+
+        /// @brief              Check if the stepper has a continuous extension
+        ///
+        ///                     The state can then be interpolated anywhere within an accepted step, without evaluating the system of equations.
+        ///
+        /// @code
+        ///                     numericalSolver.hasDenseOutput() ;
+        /// @endcode
+        ///
+        /// @return             True if the stepper has a continuous extension
+
+        bool                    hasDenseOutput                              ( ) const ;
+
         /// @brief              Print numerical solver
         ///
         /// @param              [in] anOutputStream An output stream
@@ -180,8 +291,69 @@ class NumericalSolver
 
         Real                    getAbsoluteTolerance                        ( ) const ;
 
+        /// @brief              Get initial time step enum
+        ///
+        /// @code
+        ///                     numericalSolver.getInitialStepType() ;
+        /// @endcode
+        ///
+        /// @return             InitialStepType
+
+        NumericalSolver::InitialStepType getInitialStepType                 ( ) const ;
+
+        /// @brief              Get integration statistics, accumulated over all integrations since construction or last reset
+        ///
+        /// @code
+        ///                     numericalSolver.getStatistics() ;
+        /// @endcode
+        ///
+        /// @return             Statistics
+
+        Statistics              getStatistics                               ( ) const ;
+
+        /// @brief              Check if the wall time spent evaluating the system of equations is recorded into the statistics
+        ///
+        /// @code
+        ///                     numericalSolver.isEvaluationTimingEnabled() ;
+        /// @endcode
+        ///
+        /// @return             True if evaluation timing is enabled
+
+        bool                    isEvaluationTimingEnabled                   ( ) const ;
+
+        /// @brief              Enable or disable the recording of the evaluation wall time (disabled by default)
+        ///
+        /// @code
+        ///                     numericalSolver.setEvaluationTiming(true) ;
+        /// @endcode
+        ///
+        /// @param              [in] isEnabled True to record the evaluation wall time
+
+        void                    setEvaluationTiming                         (   const   bool                        isEnabled                                   ) ;
+
+        /// @brief              Reset integration statistics
+        ///
+        /// @code
+        ///                     numericalSolver.resetStatistics() ;
+        /// @endcode
+
+        void                    resetStatistics                             ( ) ;
+
+        /// @brief              Forget the step size reached by the previous integration
+        ///
+        ///                     With the WarmStart initial step type, the next integration then estimates its initial time step.
+        ///
+        /// @code
+        ///                     numericalSolver.resetWarmStart() ;
+        /// @endcode
+
+        void                    resetWarmStart                              ( ) ;
+
         /// @brief              Perform numerical integration from a starting instant to an array of states
         ///
+        ///                     With a dense output stepper (RungeKuttaDopri5, BulirschStoerDenseOutput), the states are interpolated at the
+        ///                     requested instants, and the step size is not constrained by the output grid.
+        ///
         /// @code
         ///                     Array<StateVector> stateVectorArray = numericalSolver.integrateStatesAtSortedInstants(stateVector, instant, instantArray, systemOfEquations) ;
         /// @endcode
@@ -190,12 +362,14 @@ class NumericalSolver
         /// @param              [in] aStartInstant An instant to begin integrating from
         /// @param              [in] anInstantArray An instant array to integrate to
         /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
         /// @return             std::vector<std::vector<double>>
 
         Array<StateVector>      integrateStatesAtSortedInstants             (   const   StateVector&                anInitialStateVector,
                                                                                 const   Instant&                    aStartInstant,
                                                                                 const   Array<Instant>&             anInstantArray,
-                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations                          ) ;
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
 
         /// @brief              Perform numerical integration from an instant to another instant
         ///
@@ -206,12 +380,14 @@ class NumericalSolver
         /// @param              [in] aStartInstant An instant to begin integrating from
         /// @param              [in] anEndInstant An instant to finish integrating at
         /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
         /// @return             std::vector<double>
 
         StateVector             integrateStateFromInstantToInstant          (   const   StateVector&                anInitialStateVector,
                                                                                 const   Instant&                    aStartInstant,
                                                                                 const   Instant&                    anEndInstant,
-                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations                          ) ;
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
 
         /// @brief              Perform numerical integration for a certain duration
         ///
@@ -221,11 +397,203 @@ class NumericalSolver
         /// @param              [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
         /// @param              [in] anIntegrationDuration A duration over which to integration
         /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
         /// @return             std::vector<double>
 
         StateVector             integrateStateForDuration                   (   const   StateVector&                anInitialStateVector,
                                                                                 const   Duration&                   anIntegrationDuration,
-                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations                          ) ;
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration from an instant to another instant, locating events along the way
+        ///
+        /// @code
+        ///                     Pair<StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsFromInstantToInstant(stateVector, instant, otherInstant, systemOfEquations, eventArray) ;
+        /// @endcode
+        /// @param              [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+        /// @param              [in] aStartInstant An instant to begin integrating from
+        /// @param              [in] anEndInstant An instant to finish integrating at, unless a terminal event occurs first
+        /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] anEventArray An array of events
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             Final state vector (at the terminal event if any), and event occurrences sorted in integration order
+
+        Pair<StateVector, Array<Event::Occurrence>> integrateStateWithEventsFromInstantToInstant ( const StateVector& anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration for a certain duration, locating events along the way
+        ///
+        ///                     Event crossings are bracketed at every accepted step, and located on the step interpolant: the dense output
+        ///                     of RungeKuttaDopri5 and BulirschStoerDenseOutput, or a cubic Hermite interpolant built from the step end points
+        ///                     for the other steppers.
+        ///                     In the latter case, the state at each occurrence is then recomputed by integrating up to the located time.
+        ///
+        /// @code
+        ///                     Pair<StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsForDuration(stateVector, duration, systemOfEquations, eventArray) ;
+        /// @endcode
+        /// @param              [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+        /// @param              [in] anIntegrationDuration A duration over which to integration, unless a terminal event occurs first
+        /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] anEventArray An array of events
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             Final state vector (at the terminal event if any), and event occurrences sorted in integration order
+
+        Pair<StateVector, Array<Event::Occurrence>> integrateStateWithEventsForDuration ( const StateVector&     anInitialStateVector,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration from an instant to another instant, retaining the continuous extension of each accepted step
+        ///
+        ///                     Only available with the RungeKuttaDopri5 stepper, whose continuous extension is a quintic polynomial. The last
+        ///                     step is cut at the end instant.
+        ///
+        /// @code
+        ///                     Array<DenseOutputStep> denseOutputSteps = numericalSolver.integrateDenseOutputFromInstantToInstant(stateVector, instant, otherInstant, systemOfEquations) ;
+        /// @endcode
+        /// @param              [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+        /// @param              [in] aStartInstant An instant to begin integrating from
+        /// @param              [in] anEndInstant An instant to finish integrating at
+        /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             Dense output steps in integration order, with times relative to the start instant
+
+        Array<DenseOutputStep>  integrateDenseOutputFromInstantToInstant    (   const   StateVector&                anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration for a certain duration, retaining the continuous extension of each accepted step
+        ///
+        /// @code
+        ///                     Array<DenseOutputStep> denseOutputSteps = numericalSolver.integrateDenseOutputForDuration(stateVector, duration, systemOfEquations) ;
+        /// @endcode
+        /// @param              [in] anInitialStateVector An initial n-dimensional state vector to begin integrating at
+        /// @param              [in] anIntegrationDuration A duration over which to integration
+        /// @param              [in] aSystemOfEquations An std::function wrapper with a particular signature that boost::odeint accepts to perform numerical integration
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             Dense output steps in integration order
+
+        Array<DenseOutputStep>  integrateDenseOutputForDuration             (   const   StateVector&                anInitialStateVector,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration from a starting instant to an array of states, using a fixed-size state vector
+        ///
+        ///                     The system of equations is taken by type (not wrapped in an std::function) so that it can be inlined,
+        ///                     and neither the steppers nor the integration loop allocate memory.
+        ///
+        /// @code
+        ///                     Array<FixedStateVector<6>> stateVectorArray = numericalSolver.integrateStatesAtSortedInstants(stateVector, instant, instantArray, systemOfEquations) ;
+        /// @endcode
+        ///
+        /// @param              [in] anInitialStateVector An initial N-dimensional state vector to begin integrating at
+        /// @param              [in] aStartInstant An instant to begin integrating from
+        /// @param              [in] anInstantArray An instant array to integrate to
+        /// @param              [in] aSystemOfEquations A callable with signature void(const FixedStateVector<N>&, FixedStateVector<N>&, const double)
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             Array<FixedStateVector<N>>
+
+        template <int N, class SystemOfEquations>
+        Array<FixedStateVector<N>> integrateStatesAtSortedInstants          (   const   FixedStateVector<N>&        anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray,
+                                                                                const   SystemOfEquations&          aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration from an instant to another instant, using a fixed-size state vector
+        ///
+        /// @code
+        ///                     FixedStateVector<6> stateVector = numericalSolver.integrateStateFromInstantToInstant(stateVector, instant, otherInstant, systemOfEquations) ;
+        /// @endcode
+        /// @param              [in] anInitialStateVector An initial N-dimensional state vector to begin integrating at
+        /// @param              [in] aStartInstant An instant to begin integrating from
+        /// @param              [in] anEndInstant An instant to finish integrating at
+        /// @param              [in] aSystemOfEquations A callable with signature void(const FixedStateVector<N>&, FixedStateVector<N>&, const double)
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             FixedStateVector<N>
+
+        template <int N, class SystemOfEquations>
+        FixedStateVector<N>     integrateStateFromInstantToInstant          (   const   FixedStateVector<N>&        anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   SystemOfEquations&          aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration for a certain duration, using a fixed-size state vector
+        ///
+        /// @code
+        ///                     FixedStateVector<6> stateVector = numericalSolver.integrateStateForDuration(stateVector, duration, systemOfEquations) ;
+        /// @endcode
+        /// @param              [in] anInitialStateVector An initial N-dimensional state vector to begin integrating at
+        /// @param              [in] anIntegrationDuration A duration over which to integration
+        /// @param              [in] aSystemOfEquations A callable with signature void(const FixedStateVector<N>&, FixedStateVector<N>&, const double)
+        /// @param              [in] (optional) anObserver An observer notified with the states produced during integration
+        /// @return             FixedStateVector<N>
+
+        template <int N, class SystemOfEquations>
+        FixedStateVector<N>     integrateStateForDuration                   (   const   FixedStateVector<N>&        anInitialStateVector,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   SystemOfEquations&          aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  =   nullptr ) const ;
+
+        /// @brief              Perform numerical integration of an ensemble of states from a starting instant to an array of instants
+        ///
+        ///                     All samples are advanced together, with a step size shared by the ensemble (driven by the sample with the largest error).
+        ///                     The system of equations operates on whole columns (one state component for all samples), so that it can be vectorized.
+        ///                     Logging is not performed for ensembles.
+        ///
+        /// @code
+        ///                     Array<EnsembleStateArray> ensembleStateArrays = numericalSolver.integrateEnsembleAtSortedInstants(ensembleStateArray, instant, instantArray, systemOfEquations) ;
+        /// @endcode
+        ///
+        /// @param              [in] anInitialEnsembleStateArray An initial (sample count x state dimension) ensemble state array
+        /// @param              [in] aStartInstant An instant to begin integrating from
+        /// @param              [in] anInstantArray An instant array to integrate to
+        /// @param              [in] aSystemOfEquations An std::function wrapper computing the derivatives of all samples
+        /// @return             Array<EnsembleStateArray>
+
+        Array<EnsembleStateArray> integrateEnsembleAtSortedInstants         (   const   EnsembleStateArray&         anInitialEnsembleStateArray,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray,
+                                                                                const   EnsembleSystemOfEquationsWrapper& aSystemOfEquations                    ) const ;
+
+        /// @brief              Perform numerical integration of an ensemble of states from an instant to another instant
+        ///
+        /// @code
+        ///                     EnsembleStateArray ensembleStateArray = numericalSolver.integrateEnsembleFromInstantToInstant(ensembleStateArray, instant, otherInstant, systemOfEquations) ;
+        /// @endcode
+        /// @param              [in] anInitialEnsembleStateArray An initial (sample count x state dimension) ensemble state array
+        /// @param              [in] aStartInstant An instant to begin integrating from
+        /// @param              [in] anEndInstant An instant to finish integrating at
+        /// @param              [in] aSystemOfEquations An std::function wrapper computing the derivatives of all samples
+        /// @return             EnsembleStateArray
+
+        EnsembleStateArray      integrateEnsembleFromInstantToInstant       (   const   EnsembleStateArray&         anInitialEnsembleStateArray,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   EnsembleSystemOfEquationsWrapper& aSystemOfEquations                    ) const ;
+
+        /// @brief              Perform numerical integration of an ensemble of states for a certain duration
+        ///
+        /// @code
+        ///                     EnsembleStateArray ensembleStateArray = numericalSolver.integrateEnsembleForDuration(ensembleStateArray, duration, systemOfEquations) ;
+        /// @endcode
+        /// @param              [in] anInitialEnsembleStateArray An initial (sample count x state dimension) ensemble state array
+        /// @param              [in] anIntegrationDuration A duration over which to integration
+        /// @param              [in] aSystemOfEquations An std::function wrapper computing the derivatives of all samples
+        /// @return             EnsembleStateArray
+
+        EnsembleStateArray      integrateEnsembleForDuration                (   const   EnsembleStateArray&         anInitialEnsembleStateArray,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   EnsembleSystemOfEquationsWrapper& aSystemOfEquations                    ) const ;
 
         /// @brief              Get string from the integration stepper type
         ///
@@ -247,6 +615,16 @@ class NumericalSolver
 
         static String           StringFromLogType                           (   const   NumericalSolver::LogType&   aLogType                                    ) ;
 
+        /// @brief              Get string from the initial time step type
+        ///
+        /// @code
+        ///                     NumericalSolver::StringFromInitialStepType(anInitialStepType) ;
+        /// @endcode
+        /// @param              [in] anInitialStepType An initial time step type enum
+        /// @return             InitialStepType
+
+        static String           StringFromInitialStepType                   (   const   NumericalSolver::InitialStepType& anInitialStepType                     ) ;
+
     private:
 
         NumericalSolver::LogType logType_ ;
@@ -254,12 +632,156 @@ class NumericalSolver
         Real timeStep_ ;
         Real relativeTolerance_ ;
         Real absoluteTolerance_ ;
-        std::vector<StateVector> states_ ;
-        std::vector<double> instants_ ;
-
-        void                    observeNumericalIntegration                 (   const   StateVector&                x,
+        NumericalSolver::InitialStepType initialStepType_ ;
+
+        bool evaluationTiming_ ;
+
+        // Integrations run on const solvers, possibly from several threads: each one records into its own IntegrationRecord, merged in under the mutex
+        mutable std::mutex mutex_ ;
+        mutable Statistics statistics_ ;
+        mutable double warmStartTimeStep_ ; // Magnitude of the last step sized by the controller and accepted, NaN if none
+
+        void                    observeState                                (   const   StateVector&                x,
+                                                                                const   double                      t,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const ;
+
+        template <int N>
+        void                    observeFixedState                           (   const   FixedStateVector<N>&        x,
+                                                                                const   double                      t,
+                                                                                const   Shared<Observer>&           anObserver,
+                                                                                        StateVector&                anObservedStateVector                       ) const ;
+
+        // Integrate a state of any odeint-compatible type from a start time to an end time (in seconds)
+        template <class StateType, class SystemType, class ObserverType>
+        void                    integrateState                              (           StateType&                  aStateVector,
+                                                                                const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemType&                 aSystemOfEquations,
+                                                                                        ObserverType                anObserver                                  ) const ;
+
+        // Integrate a state of any odeint-compatible type through a sorted array of times (in seconds), observing it at each time
+        template <class StateType, class SystemType, class ObserverType>
+        void                    integrateStateAtTimes                       (           StateType&                  aStateVector,
+                                                                                const   Array<double>&              aTimeArray,
+                                                                                const   SystemType&                 aSystemOfEquations,
+                                                                                        ObserverType                anObserver                                  ) const ;
+
+        // Odeint algebra applying operations coefficient by coefficient, for any contiguous state container
+        struct CoefficientWiseAlgebra ;
+
+        // Signed time step to start an integration from a start time to an end time with, according to the initial step type
+        template <class StateType, class SystemType>
+        double                  initialTimeStep                             (   const   StateType&                  aStateVector,
+                                                                                const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemType&                 aSystemOfEquations                          ) const ;
+
+        // Estimate of the initial time step magnitude, from the magnitudes of the state, of its derivative and of its second derivative
+        template <class StateType, class SystemType>
+        double                  estimateInitialTimeStep                     (   const   StateType&                  aStateVector,
+                                                                                const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemType&                 aSystemOfEquations                          ) const ;
+
+        // Controlled Bulirsch-Stoer stepper, taking backward steps in reversed time
+        template <class StateType>
+        class BulirschStoerStepper ;
+
+        // Dense output Bulirsch-Stoer stepper, taking backward steps in reversed time and recording its steps into an integration record
+        template <class StateType>
+        class BulirschStoerDenseOutputStepper ;
+
+        // Controlled Runge-Kutta-Nystrom stepper, for states holding positions followed by velocities
+        template <class StateType>
+        class RungeKuttaNystromStepper ;
+
+        // Fixed-step symplectic stepper composing Stormer-Verlet steps, for states holding positions followed by velocities
+        template <class StateType>
+        class SymplecticStepper ;
+
+        // Statistics and warm start step size of a single integration, merged into the solver when the integration ends
+        class IntegrationRecord ;
+
+        // Controlled stepper recording accepted and rejected steps into an integration record, and the step size to warm start from
+        template <class ControlledStepperType>
+        class StepperWithStatistics ;
+
+        template <class ControlledStepperType>
+        StepperWithStatistics<ControlledStepperType> stepperWithStatistics  (   const   ControlledStepperType&      aStepper,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         ) const ;
+
+        // Dense output stepper whose underlying controlled stepper records its steps into an integration record
+        template <class ControlledStepperType>
+        auto                    denseOutputWithStatistics                   (   const   ControlledStepperType&      aStepper,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         ) const ;
+
+        // System of equations recording its evaluations into an integration record
+        // With second order steppers, the derivatives of the positions are filled in with the velocities
+        template <class SystemType>
+        auto                    systemWithStatistics                        (   const   SystemType&                 aSystemOfEquations,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         ) const ;
+
+        // Controlled Adams-Bashforth-Moulton stepper, without the default cap on the step size
+        template <class StateType>
+        auto                    makeAdamsBashforthMoultonStepper            ( ) const ;
+
+        // Symplectic stepper with the composition weights of the stepper type
+        template <class StateType>
+        SymplecticStepper<StateType> makeSymplecticStepper                  ( ) const ;
+
+        // Integrate with a controlled stepper, locating events on a cubic Hermite interpolant of each step
+        // The refinement stepper integrates from the start of a step to an occurrence: it must not depend on the stepper history
+        template <class ControlledStepperType, class RefinementStepperType>
+        void                    integrateStateWithEvents                    (           ControlledStepperType       aStepper,
+                                                                                        RefinementStepperType       aRefinementStepper,
+                                                                                        StateVector&                aStateVector,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<Event::Occurrence>&   anEventOccurrenceArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const ;
+
+        // Integrate with a dense output stepper, locating events on its interpolant
+        template <class DenseOutputStepperType>
+        void                    integrateStateWithEventsUsingDenseOutput    (           DenseOutputStepperType      aStepper,
+                                                                                        StateVector&                aStateVector,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<Event::Occurrence>&   anEventOccurrenceArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const ;
+
+        // Integrate with a dense output stepper, recovering the polynomial of each accepted step from its interpolant
+        template <class DenseOutputStepperType>
+        void                    integrateDenseOutput                        (           DenseOutputStepperType      aStepper,
+                                                                                        StateVector&                aStateVector,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemOfEquationsWrapper&   aSystemOfEquations,
+                                                                                        Array<DenseOutputStep>&     aDenseOutputStepArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const ;
+
+        // Locate the events occurring over a step, given the step interpolant and the event values at the start of the step (updated to the end of the step)
+        static Array<Event::Occurrence> LocateEvents                        (   const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<double>&              anEventValueArray,
+                                                                                const   double                      aStepStartTime,
+                                                                                const   double                      aStepEndTime,
+                                                                                const   StateVector&                aStepEndStateVector,
+                                                                                const   std::function<void(const double, StateVector&)>& anInterpolant ) ;
+
+        // Add the event occurrences of a step in chronological order, up to the first terminal one
+        // Returns true if a terminal event occurred, in which case it is the last occurrence
+        static bool             AddEventOccurrences                         (   const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<Event::Occurrence>    aStepEventOccurrenceArray,
+                                                                                const   bool                        isBackward,
+                                                                                        Array<Event::Occurrence>&   anEventOccurrenceArray                      ) ;
+
+        template <class StateType>
+        static void             LogState                                    (   const   StateType&                  x,
                                                                                 const   double                      t                                           ) ;
 
+        static Array<double>    IntegrationTimesFromInstants                (   const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +791,10 @@ class NumericalSolver
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver.tpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
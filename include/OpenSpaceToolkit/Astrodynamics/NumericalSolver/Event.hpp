@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Event.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event__
+#define __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <functional>
+#include <vector>
+#include <ostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::String ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Zero crossing of a scalar function of the state, detected by a numerical solver during integration
+///
+///                             The event occurs when its function changes sign in the selected direction (with respect to time).
+///                             A terminal event stops the integration at the crossing, a non-terminal one is only recorded.
+///                             Crossings are located on the step interpolant, so the solver does not need to take extra steps to find them.
+///                             Only one crossing per step and per event can be detected: events must not oscillate faster than the step size.
+
+class Event
+{
+
+    public:
+
+        enum class Direction
+        {
+            Increasing,                                                         ///< Function crosses zero from negative to positive
+            Decreasing,                                                         ///< Function crosses zero from positive to negative
+            Any                                                                 ///< Function crosses zero in either direction
+        } ;
+
+        typedef std::vector<double> StateVector ; // Container used to hold the state vector
+        typedef std::function<double(const StateVector&, const double)> Function ; // Event function, of the state vector and of the time in seconds since the start of integration
+
+        /// @brief              Event occurrence, as located by the numerical solver
+
+        struct Occurrence
+        {
+
+            Size                eventIndex ;                                    ///< Index of the event in the array given to the solver
+            double              time ;                                          ///< Time of the crossing, in seconds since the start of integration
+            StateVector         stateVector ;                                   ///< State vector at the crossing
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     Event event = { "Ascending Node", [] (const Event::StateVector& x, const double) -> double { return x[2] ; }, Event::Direction::Increasing } ;
+        /// @endcode
+        ///
+        /// @param              [in] aName An event name
+        /// @param              [in] aFunction An event function
+        /// @param              [in] (optional) aDirection A crossing direction
+        /// @param              [in] (optional) isTerminal If true, integration stops at the first occurrence
+
+                                Event                                       (   const   String&                     aName,
+                                                                                const   Function&                   aFunction,
+                                                                                const   Event::Direction&           aDirection                                  =   Event::Direction::Any,
+                                                                                const   bool                        isTerminal                                  =   false ) ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] anEvent An event
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Event&                      anEvent                                     ) ;
+
+        /// @brief              Get name
+        ///
+        /// @return             Name
+
+        String                  getName                                     ( ) const ;
+
+        /// @brief              Get crossing direction
+        ///
+        /// @return             Direction
+
+        Event::Direction        getDirection                                ( ) const ;
+
+        /// @brief              Check if event is terminal
+        ///
+        /// @return             True if integration stops at the first occurrence
+
+        bool                    isTerminal                                  ( ) const ;
+
+        /// @brief              Evaluate event function
+        ///
+        /// @param              [in] aStateVector A state vector
+        /// @param              [in] aTime A time, in seconds since the start of integration
+        /// @return             Event function value
+
+        double                  evaluate                                    (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) const ;
+
+        /// @brief              Check if the event function crossed zero in the event direction between two successive values
+        ///
+        /// @param              [in] aPreviousValue An event function value
+        /// @param              [in] aValue The next event function value, in the order of integration
+        /// @param              [in] (optional) isBackward If true, integration goes backward in time
+        /// @return             True if the event occurred
+
+        bool                    isCrossing                                  (   const   double                      aPreviousValue,
+                                                                                const   double                      aValue,
+                                                                                const   bool                        isBackward                                  =   false ) const ;
+
+        /// @brief              Print event
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+        /// @brief              Get string from crossing direction
+        ///
+        /// @param              [in] aDirection A crossing direction
+        /// @return             String
+
+        static String           StringFromDirection                         (   const   Event::Direction&           aDirection                                  ) ;
+
+    private:
+
+        String name_ ;
+        Function function_ ;
+        Event::Direction direction_ ;
+        bool terminal_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
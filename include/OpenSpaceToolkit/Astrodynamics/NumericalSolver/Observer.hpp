@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observer__
+#define __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observer__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <vector>
+#include <ostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Receives the states produced by a numerical solver during integration
+///
+///                             Observers are notified with every state the solver produces (every accepted step, or every requested
+///                             output time), and forward one in every N of them to observe(). Nothing is retained by the solver itself,
+///                             so memory usage only depends on what the observer decides to keep.
+///                             An observer holds per-integration state and should not be shared between concurrent integrations.
+
+class Observer
+{
+
+    public:
+
+        typedef std::vector<double> StateVector ; // Container used to hold the state vector
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] (optional) aDecimation Forward one in every aDecimation states to observe() (1 forwards all of them)
+
+                                Observer                                    (   const   Size&                       aDecimation                                 =   1 ) ;
+
+        /// @brief              Destructor (pure virtual)
+
+        virtual                 ~Observer                                   ( ) = 0 ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] anObserver An observer
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Observer&                   anObserver                                  ) ;
+
+        /// @brief              Get decimation
+        ///
+        /// @return             Decimation
+
+        Size                    getDecimation                               ( ) const ;
+
+        /// @brief              Get number of states the observer was notified with since the last reset
+        ///
+        /// @return             Number of notified states
+
+        Size                    getNotificationCount                        ( ) const ;
+
+        /// @brief              Notify observer with a state, called by the numerical solver
+        ///
+        /// @param              [in] aStateVector A state vector
+        /// @param              [in] aTime A time, in seconds since the start of integration
+
+        void                    notify                                      (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) ;
+
+        /// @brief              Reset notification count
+        ///
+        ///                     Called by the numerical solver at the start of each integration.
+
+        virtual void            reset                                       ( ) ;
+
+        /// @brief              Print observer
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+    protected:
+
+        /// @brief              Observe a state (pure virtual)
+        ///
+        /// @param              [in] aStateVector A state vector
+        /// @param              [in] aTime A time, in seconds since the start of integration
+
+        virtual void            observe                                     (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) = 0 ;
+
+    private:
+
+        Size decimation_ ;
+        Size notificationCount_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/BinaryFile.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile__
+#define __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+
+#include <fstream>
+#include <future>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+namespace observers
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::fs::File ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Streams observed states to a binary file
+///
+///                             Each record is written as (1 + n) native-endian doubles: the time, followed by the n state components.
+///                             Records are accumulated in memory and, when the buffer is full, handed over to a background write so
+///                             that the integration loop never waits on formatting or disk I/O (unless the previous write is still pending).
+///                             Remaining records are written on flush() and on destruction.
+
+class BinaryFile : public Observer
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     BinaryFile binaryFile = { File::Path(Path::Parse("/tmp/states.bin")), 10 } ;
+        /// @endcode
+        ///
+        /// @param              [in] aFile A file, created or truncated
+        /// @param              [in] (optional) aDecimation Write one in every aDecimation states
+        /// @param              [in] (optional) aBufferSize Number of doubles accumulated before each write
+
+                                BinaryFile                                  (   const   File&                       aFile,
+                                                                                const   Size&                       aDecimation                                 =   1,
+                                                                                const   Size&                       aBufferSize                                 =   65536 ) ;
+
+                                BinaryFile                                  (   const   BinaryFile&                 aBinaryFile                                 ) = delete ;
+
+        BinaryFile&             operator =                                  (   const   BinaryFile&                 aBinaryFile                                 ) = delete ;
+
+        virtual                 ~BinaryFile                                 ( ) override ;
+
+        /// @brief              Get file
+        ///
+        /// @return             File
+
+        File                    getFile                                     ( ) const ;
+
+        /// @brief              Write all buffered records to the file
+
+        void                    flush                                       ( ) ;
+
+    protected:
+
+        virtual void            observe                                     (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) override ;
+
+    private:
+
+        File file_ ;
+        Size bufferSize_ ;
+
+        std::ofstream stream_ ;
+
+        std::vector<double> buffer_ ;
+        std::vector<double> pendingBuffer_ ;
+        std::future<void> pendingWrite_ ;
+
+        void                    waitForPendingWrite                         ( ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
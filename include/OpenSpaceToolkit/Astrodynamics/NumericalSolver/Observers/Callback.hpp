@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/Callback.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_Callback__
+#define __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_Callback__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.hpp>
+
+#include <functional>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+namespace observers
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Forwards observed states to a user-provided function
+
+class Callback : public Observer
+{
+
+    public:
+
+        typedef std::function<void(const StateVector&, const double)> Function ;
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     Callback callback = { [] (const Callback::StateVector& x, const double t) -> void { ... }, 10 } ;
+        /// @endcode
+        ///
+        /// @param              [in] aFunction A function called with each observed state and time
+        /// @param              [in] (optional) aDecimation Forward one in every aDecimation states to the function
+
+                                Callback                                    (   const   Function&                   aFunction,
+                                                                                const   Size&                       aDecimation                                 =   1 ) ;
+
+        virtual                 ~Callback                                   ( ) override ;
+
+    protected:
+
+        virtual void            observe                                     (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) override ;
+
+    private:
+
+        Function function_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/RingBuffer.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_RingBuffer__
+#define __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_RingBuffer__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+namespace observers
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::ctnr::Array ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Keeps the most recent observed states in a fixed-capacity buffer
+///
+///                             Storage is allocated once, on the first observed state, and older states are overwritten when the
+///                             buffer is full. The buffer is not cleared between integrations.
+
+class RingBuffer : public Observer
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     RingBuffer ringBuffer = { 1000, 10 } ;
+        /// @endcode
+        ///
+        /// @param              [in] aCapacity Maximum number of states kept
+        /// @param              [in] (optional) aDecimation Keep one in every aDecimation states
+
+                                RingBuffer                                  (   const   Size&                       aCapacity,
+                                                                                const   Size&                       aDecimation                                 =   1 ) ;
+
+        virtual                 ~RingBuffer                                 ( ) override ;
+
+        /// @brief              Get capacity
+        ///
+        /// @return             Maximum number of states kept
+
+        Size                    getCapacity                                 ( ) const ;
+
+        /// @brief              Get number of states currently kept
+        ///
+        /// @return             Number of states
+
+        Size                    getSize                                     ( ) const ;
+
+        /// @brief              Get kept state vectors, from oldest to most recent
+        ///
+        /// @return             Array of state vectors
+
+        Array<StateVector>      getStateVectors                             ( ) const ;
+
+        /// @brief              Get kept times, from oldest to most recent
+        ///
+        /// @return             Array of times, in seconds since the start of integration
+
+        Array<double>           getTimes                                    ( ) const ;
+
+        /// @brief              Clear buffer
+
+        void                    clear                                       ( ) ;
+
+    protected:
+
+        virtual void            observe                                     (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) override ;
+
+    private:
+
+        Size capacity_ ;
+        Size dimension_ ;
+        Size head_ ;
+        Size size_ ;
+
+        std::vector<double> stateData_ ; // capacity_ x dimension_, row-major
+        std::vector<double> times_ ;
+
+        Size                    indexOf                                     (   const   Size&                       anAge                                       ) const ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Statistics.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics__
+#define __OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <ostream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::String ;
+
+using ostk::physics::time::Duration ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Integration statistics, accumulated by a numerical solver over its integrations
+///
+///                             Step sizes are counted for the steps accepted by the adaptive stepper, regardless of the integration direction.
+///                             The evaluation wall time is spent in the system of equations only, excluding the stepper arithmetic. It is only recorded
+///                             when the numerical solver has evaluation timing enabled.
+
+class Statistics
+{
+
+    public:
+
+        /// @brief              Default constructor, with all counters set to zero
+        ///
+        /// @code
+        ///                     Statistics statistics ;
+        /// @endcode
+
+                                Statistics                                  ( ) ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] aStatistics Integration statistics
+        /// @return             True if integration statistics are equal
+
+        bool                    operator ==                                 (   const   Statistics&                 aStatistics                                 ) const ;
+
+        /// @brief              Not equal to operator
+        ///
+        /// @param              [in] aStatistics Integration statistics
+        /// @return             True if integration statistics are not equal
+
+        bool                    operator !=                                 (   const   Statistics&                 aStatistics                                 ) const ;
+
+        /// @brief              Addition assignment operator, aggregating other integration statistics
+        ///
+        /// @param              [in] aStatistics Integration statistics
+        /// @return             Reference to aggregated integration statistics
+
+        Statistics&             operator +=                                 (   const   Statistics&                 aStatistics                                 ) ;
+
+        /// @brief              Addition operator
+        ///
+        /// @param              [in] aStatistics Integration statistics
+        /// @return             Aggregated integration statistics
+
+        Statistics              operator +                                  (   const   Statistics&                 aStatistics                                 ) const ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] aStatistics Integration statistics
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Statistics&                 aStatistics                                 ) ;
+
+        /// @brief              Get number of evaluations of the system of equations
+        ///
+        /// @return             Number of evaluations
+
+        Size                    getEvaluationCount                          ( ) const ;
+
+        /// @brief              Get number of accepted steps
+        ///
+        /// @return             Number of accepted steps
+
+        Size                    getAcceptedStepCount                        ( ) const ;
+
+        /// @brief              Get number of rejected steps
+        ///
+        /// @return             Number of rejected steps
+
+        Size                    getRejectedStepCount                        ( ) const ;
+
+        /// @brief              Get smallest accepted step size
+        ///
+        /// @return             Step size (undefined if no step was accepted)
+
+        Duration                getMinimumStepSize                          ( ) const ;
+
+        /// @brief              Get largest accepted step size
+        ///
+        /// @return             Step size (undefined if no step was accepted)
+
+        Duration                getMaximumStepSize                          ( ) const ;
+
+        /// @brief              Get mean accepted step size
+        ///
+        /// @return             Step size (undefined if no step was accepted)
+
+        Duration                getMeanStepSize                             ( ) const ;
+
+        /// @brief              Get cumulative wall time spent evaluating the system of equations
+        ///
+        /// @return             Wall time (zero if evaluation timing is disabled)
+
+        Duration                getEvaluationWallTime                       ( ) const ;
+
+        /// @brief              Record an evaluation of the system of equations
+        ///
+        /// @param              [in] aWallTimeInSeconds Wall time spent in the evaluation, in seconds
+
+        void                    addEvaluation                               (   const   double                      aWallTimeInSeconds                          ) ;
+
+        /// @brief              Record an accepted step
+        ///
+        /// @param              [in] aStepSizeInSeconds Signed step size, in seconds
+
+        void                    addAcceptedStep                             (   const   double                      aStepSizeInSeconds                          ) ;
+
+        /// @brief              Record a rejected step
+
+        void                    addRejectedStep                             ( ) ;
+
+        /// @brief              Reset all counters to zero
+
+        void                    reset                                       ( ) ;
+
+        /// @brief              Print integration statistics
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const ;
+
+    private:
+
+        Size evaluationCount_ ;
+        Size acceptedStepCount_ ;
+        Size rejectedStepCount_ ;
+        double minimumStepSize_ ;
+        double maximumStepSize_ ;
+        double cumulativeStepSize_ ;
+        double evaluationWallTime_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
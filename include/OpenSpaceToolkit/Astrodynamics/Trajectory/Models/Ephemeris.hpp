@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris__
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace models
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::Shared ;
+using ostk::core::ctnr::Array ;
+
+using ostk::math::obj::Vector3d ;
+
+using ostk::physics::time::Instant ;
+using ostk::physics::time::Interval ;
+using ostk::physics::coord::Frame ;
+
+using ostk::astro::trajectory::Model ;
+using ostk::astro::trajectory::State ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Continuous ephemeris, retained from the steps of a numerical integration
+///
+///                             The ephemeris holds the states at the end points (nodes) of each integration step, and the interpolation
+///                             polynomials of the position and of the velocity over each step: the continuous extension of the stepper, or
+///                             the quintic Hermite polynomial matching the position, velocity and acceleration at both nodes.
+///                             The step holding an instant is found by bisection, in O(log n) for n steps.
+
+class Ephemeris : public virtual Model
+{
+
+    public:
+
+        /// @brief              Interpolation polynomials of a step, in the normalized time s = (t - t0) / (t1 - t0) over the step [t0, t1]
+
+        struct StepPolynomial
+        {
+
+            Array<Vector3d>     positionCoefficientArray ;                      ///< Position coefficients, by increasing power of s [m]
+            Array<Vector3d>     velocityCoefficientArray ;                      ///< Velocity coefficients, by increasing power of s [m/s]
+
+        } ;
+
+        /// @brief              Constructor, interpolating each step with the quintic Hermite polynomial matching the nodes
+        ///
+        ///                     The interpolation error is of order 6 in the step size.
+        ///
+        /// @code
+        ///                     Ephemeris ephemeris = { aNodeStateArray, aNodeAccelerationArray } ;
+        /// @endcode
+        ///
+        /// @param              [in] aNodeStateArray An array of node states, sorted by strictly increasing instant, in a common frame
+        /// @param              [in] aNodeAccelerationArray An array of node accelerations, in the frame of the states [m/s^2]
+
+                                Ephemeris                                   (   const   Array<State>&               aNodeStateArray,
+                                                                                const   Array<Vector3d>&            aNodeAccelerationArray                      ) ;
+
+        /// @brief              Constructor, from the interpolation polynomials of the steps between the nodes
+        ///
+        /// @code
+        ///                     Ephemeris ephemeris = { aNodeStateArray, aStepPolynomialArray } ;
+        /// @endcode
+        ///
+        /// @param              [in] aNodeStateArray An array of node states, sorted by strictly increasing instant, in a common frame
+        /// @param              [in] aStepPolynomialArray An array of step polynomials, one per pair of consecutive nodes, in the frame of the states
+
+                                Ephemeris                                   (   const   Array<State>&               aNodeStateArray,
+                                                                                const   Array<Ephemeris::StepPolynomial>& aStepPolynomialArray                  ) ;
+
+        virtual Ephemeris*      clone                                       ( ) const override ;
+
+        bool                    operator ==                                 (   const   Ephemeris&                  anEphemeris                                 ) const ;
+
+        bool                    operator !=                                 (   const   Ephemeris&                  anEphemeris                                 ) const ;
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Ephemeris&                  anEphemeris                                 ) ;
+
+        virtual bool            isDefined                                   ( ) const override ;
+
+        /// @brief              Get interval covered by the ephemeris
+        ///
+        /// @return             Interval
+
+        Interval                getInterval                                 ( ) const ;
+
+        /// @brief              Get number of integration steps
+        ///
+        /// @return             Number of steps
+
+        Size                    getStepCount                                ( ) const ;
+
+        /// @brief              Get node states
+        ///
+        /// @return             Array of node states
+
+        Array<State>            getNodeStateArray                           ( ) const ;
+
+        /// @brief              Calculate the state at an instant, within the interval of the ephemeris
+        ///
+        /// @code
+        ///                     State state = ephemeris.calculateStateAt(anInstant) ;
+        /// @endcode
+        ///
+        /// @param              [in] anInstant An instant
+        /// @return             State
+
+        virtual State           calculateStateAt                            (   const   Instant&                    anInstant                                   ) const override ;
+
+        /// @brief              Add an adjacent ephemeris
+        ///
+        ///                     The ephemeris to add must start at the end of this one, or end at its start, in the same frame.
+        ///
+        /// @code
+        ///                     ephemeris.add(anotherEphemeris) ;
+        /// @endcode
+        ///
+        /// @param              [in] anEphemeris An ephemeris
+
+        void                    add                                         (   const   Ephemeris&                  anEphemeris                                 ) ;
+
+        virtual void            print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            =   true ) const override ;
+
+        /// @brief              Constructs an undefined ephemeris
+        ///
+        /// @code
+        ///                     Ephemeris ephemeris = Ephemeris::Undefined() ;
+        /// @endcode
+        ///
+        /// @return             Undefined ephemeris
+
+        static Ephemeris        Undefined                                   ( ) ;
+
+    protected:
+
+        virtual bool            operator ==                                 (   const   Model&                      aModel                                      ) const override ;
+
+        virtual bool            operator !=                                 (   const   Model&                      aModel                                      ) const override ;
+
+    private:
+
+        Instant                 epoch_ ;
+        Shared<const Frame>     frameSPtr_ ;
+
+        Array<double>           times_ ;                                        // Node times, in seconds since the epoch (the first node)
+        Array<Vector3d>         positions_ ;                                    // [m]
+        Array<Vector3d>         velocities_ ;                                   // [m/s]
+        Array<Ephemeris::StepPolynomial> stepPolynomials_ ;                     // One per step, between consecutive nodes
+
+        // Set the epoch, the frame and the nodes
+        void                    setNodes                                    (   const   Array<State>&               aNodeStateArray                             ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SatelliteDynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/NumericalSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
@@ -27,6 +28,7 @@
 #include <OpenSpaceToolkit/Physics/Units/Length.hpp>
 #include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
@@ -40,6 +42,9 @@
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <mutex>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,19 +64,23 @@ namespace models
 using ostk::core::types::Integer ;
 using ostk::core::types::Real ;
 using ostk::core::types::String ;
+using ostk::core::types::Shared ;
 using ostk::core::ctnr::Array ;
 using ostk::core::ctnr::Pair ;
 
 using ostk::math::obj::Vector3d ;
 
 using ostk::physics::time::Instant ;
+using ostk::physics::time::Interval ;
 using ostk::physics::time::Duration ;
 using ostk::physics::coord::Position ;
 using ostk::physics::coord::Velocity ;
 
 using ostk::astro::NumericalSolver ;
 using ostk::astro::trajectory::Propagator ;
+using ostk::astro::numericalsolver::Statistics ;
 using ostk::astro::trajectory::State ;
+using ostk::astro::trajectory::models::Ephemeris ;
 using ostk::astro::trajectory::orbit::Model ;
 using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
 
@@ -86,17 +95,24 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
 
         /// @brief              Constructor
         ///
+        ///                     When the ephemeris is retained, the states are interpolated from a continuous ephemeris, grown from the epoch
+        ///                     state as needed to cover the requested instants: any instant within the span already propagated is then
+        ///                     obtained without integrating again. The other cached states are not used.
+        ///
         /// @code
         ///                     Propagated propagated = { aSatelliteDynamics, aNumericalSolver, aState } ;
+        ///                     Propagated propagated = { aSatelliteDynamics, aNumericalSolver, aState, true } ;
         /// @endcode
         ///
         /// @param              [in] aSatelliteDynamics A satellite dynamics object
         /// @param              [in] aNumericalSolver A numerical solver
         /// @param              [in] aState A state
+        /// @param              [in] (optional) isEphemerisRetained If true, retain the ephemeris of the propagations
 
                                 Propagated                                  (   const   SatelliteDynamics&          aSatelliteDynamics,
                                                                                 const   NumericalSolver&            aNumericalSolver,
-                                                                                const   State&                      aState                                      ) ;
+                                                                                const   State&                      aState,
+                                                                                const   bool                        isEphemerisRetained                         =   false ) ;
 
         /// @brief              Constructor with additional option of passing in an existing array of states
         ///
@@ -107,10 +123,27 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
         /// @param              [in] aSatelliteDynamics A satellite dynamics object
         /// @param              [in] aNumericalSolver A numerical solver
         /// @param              [in] aCachedStateArray A state array
+        /// @param              [in] (optional) isEphemerisRetained If true, retain the ephemeris of the propagations
 
                                 Propagated                                  (   const   SatelliteDynamics&          aSatelliteDynamics,
                                                                                 const   NumericalSolver&            aNumericalSolver,
-                                                                                const   Array<State>&               aCachedStateArray                           ) ;
+                                                                                const   Array<State>&               aCachedStateArray,
+                                                                                const   bool                        isEphemerisRetained                         =   false ) ;
+
+        /// @brief              Copy constructor
+        ///
+        ///                     The retained ephemeris is shared with the copy until either one grows it.
+        ///
+        /// @param              [in] aPropagatedModel A propagated
+
+                                Propagated                                  (   const   Propagated&                 aPropagatedModel                            ) ;
+
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aPropagatedModel A propagated
+        /// @return             Reference to propagated
+
+        Propagated&             operator =                                  (   const   Propagated&                 aPropagatedModel                            ) ;
 
         /// @brief              Clone propagated
         ///
@@ -217,6 +250,42 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
 
         const Propagator&       accessPropagator                            ( ) const ;
 
+        /// @brief              Check if the ephemeris of the propagations is retained
+        ///
+        /// @return             True if the ephemeris is retained
+
+        bool                    isEphemerisRetained                         ( ) const ;
+
+        /// @brief              Get the ephemeris retained from the propagations so far
+        ///
+        ///                     The ephemeris may be grown concurrently by other threads: a copy is returned.
+        ///
+        /// @code
+        ///                     Ephemeris ephemeris = propagated.getEphemeris() ;
+        /// @endcode
+        ///
+        /// @return             Ephemeris, undefined if nothing was propagated yet
+
+        Ephemeris               getEphemeris                                ( ) const ;
+
+        /// @brief              Get integration statistics of the propagator, accumulated over all propagations of this model
+        ///
+        /// @code
+        ///                     Statistics statistics = propagated.getStatistics() ;
+        /// @endcode
+        ///
+        /// @return             Statistics
+
+        Statistics              getStatistics                               ( ) const ;
+
+        /// @brief              Reset integration statistics of the propagator
+        ///
+        /// @code
+        ///                     propagated.resetStatistics() ;
+        /// @endcode
+
+        void                    resetStatistics                             ( ) ;
+
         /// @brief              Set internal cached state array manually
         ///
         /// @code
@@ -256,7 +325,17 @@ class Propagated : public ostk::astro::trajectory::orbit::Model
         Propagator              propagator_ ;
         mutable Array<State>    cachedStateArray_ ;
 
+        bool                    ephemerisRetained_ ;
+
+        // Guards the retained ephemeris (not its growth, propagated outside of the lock). A grown ephemeris replaces the previous one,
+        // which stays valid for the threads sampling it.
+        mutable std::mutex      ephemerisMutex_ ;
+        mutable Shared<const Ephemeris> ephemerisSPtr_ ;
+
         void                    sanitizeCachedArray                         ( ) const ;
+
+        // Grow the retained ephemeris to cover an interval, and return it
+        Shared<const Ephemeris> extendEphemeris                             (   const   Interval&                   anInterval                                  ) const ;
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -11,8 +11,11 @@
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Propagator__
 
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SatelliteDynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/NumericalSolver.hpp>
 
@@ -24,6 +27,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
@@ -31,12 +35,20 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
 
+#include <OpenSpaceToolkit/Core/Containers/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Unique.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <functional>
+#include <mutex>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -50,41 +62,111 @@ namespace trajectory
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 using ostk::core::types::Integer ;
+using ostk::core::types::Size ;
 using ostk::core::types::Real ;
+using ostk::core::types::Unique ;
+using ostk::core::types::Shared ;
+using ostk::core::types::String ;
+using ostk::core::ctnr::Pair ;
 using ostk::core::ctnr::Array ;
 
 using ostk::math::obj::Vector3d ;
+using ostk::math::obj::MatrixXd ;
 
 using ostk::physics::time::Instant ;
+using ostk::physics::time::Interval ;
 using ostk::physics::time::Duration ;
 using ostk::physics::coord::Position ;
 using ostk::physics::coord::Velocity ;
 
 using ostk::astro::NumericalSolver ;
+using ostk::astro::numericalsolver::Statistics ;
 using ostk::astro::trajectory::State ;
+using ostk::astro::trajectory::models::Ephemeris ;
+using ostk::astro::flight::system::Dynamics ;
 using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+using ostk::astro::flight::system::dynamics::ComposedDynamics ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @brief                      Defines a propagator to be used for numerical integration
+///
+///                             The configuration of a propagator is immutable, and its const methods are thread safe: each propagation runs on
+///                             its own working copies of the dynamics and of the numerical solver, taken from a pool kept by the propagator and
+///                             returned to it afterwards, so that their caches are reused by the following propagations. A single propagator
+///                             can be shared by several threads.
 
 class Propagator
 {
 
     public:
 
+        enum class FormulationType
+        {
+            Cowell,                                                             // Integrate the full acceleration
+            Encke,                                                              // Integrate the deviation from a rectified osculating Kepler reference orbit
+            KustaanheimoStiefel                                                 // Integrate the regularized Kustaanheimo-Stiefel state, in Sundman fictitious time
+        } ;
+
         /// @brief              Constructor
         ///
+        ///                     With the Encke formulation, the numerical solver integrates the deviation from an osculating Kepler orbit
+        ///                     about the central body of the dynamics (its central body gravity model, which must be unique), rectified when
+        ///                     the deviation grows too large: the solver tolerances apply to the deviation. It allows larger steps for weakly
+        ///                     perturbed orbits.
+        ///
+        ///                     With the Kustaanheimo-Stiefel formulation, the numerical solver integrates the regularized state (KS position
+        ///                     and velocity, Kepler energy and time) in a fictitious time s, with dt = (r / r0) ds (Sundman transformation,
+        ///                     scaled by the initial radius r0), and the output instants are reached by Newton iterations on s. Steps are
+        ///                     near-uniform in eccentric anomaly, which suits highly eccentric orbits. The Kepler energy is taken about the
+        ///                     central body of the dynamics, as with the Encke formulation. It requires a first order stepper.
+        ///
+        ///                     States are expected in GCRF with both formulations.
+        ///
         /// @code
         ///                     Propagator propagator = { aSatelliteDynamics, aNumericalSolver } ;
+        ///                     Propagator propagator = { aSatelliteDynamics, aNumericalSolver, Propagator::FormulationType::Encke } ;
         /// @endcode
         ///
         /// @param              [in] aSatelliteDynamics A satellite dynamics object
         /// @param              [in] aNumericalSolver A numerical solver
+        /// @param              [in] (optional) aFormulationType A formulation type
 
                                 Propagator                                  (   const   SatelliteDynamics&          aSatelliteDynamics,
+                                                                                const   NumericalSolver&            aNumericalSolver,
+                                                                                const   Propagator::FormulationType& aFormulationType                           =   Propagator::FormulationType::Cowell ) ;
+
+        /// @brief              Constructor, from dynamics composed at compile time
+        ///
+        ///                     The composed dynamics are integrated with the fixed-size solver path, so that their right-hand side is inlined
+        ///                     in the steppers. States are expected in GCRF. The state transition matrix is not supported.
+        ///
+        /// @code
+        ///                     Propagator propagator = { ComposedDynamics<PointMassGravity, J2Gravity>(pointMassGravity, j2Gravity), aNumericalSolver } ;
+        /// @endcode
+        ///
+        /// @param              [in] aComposedDynamics A composed dynamics object
+        /// @param              [in] aNumericalSolver A numerical solver
+
+        template <class... Terms>
+                                Propagator                                  (   const   ComposedDynamics<Terms...>& aComposedDynamics,
                                                                                 const   NumericalSolver&            aNumericalSolver                            ) ;
 
+        /// @brief              Copy constructor
+        ///
+        ///                     The configuration and the statistics are copied, the working copies of the dynamics and of the solver are not.
+        ///
+        /// @param              [in] aPropagator A propagator
+
+                                Propagator                                  (   const   Propagator&                 aPropagator                                 ) ;
+
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aPropagator A propagator
+        /// @return             Reference to propagator
+
+        Propagator&             operator =                                  (   const   Propagator&                 aPropagator                                 ) ;
+
         /// @brief              Clone propagator
         ///
         /// @return             Pointer to cloned propagator
@@ -120,6 +202,16 @@ class Propagator
 
         bool                    isDefined                                   ( ) const ;
 
+        /// @brief              Get formulation type
+        ///
+        /// @code
+        ///                     Propagator::FormulationType formulationType = propagator.getFormulationType() ;
+        /// @endcode
+        ///
+        /// @return             Formulation type
+
+        Propagator::FormulationType getFormulationType                      ( ) const ;
+
         /// @brief              Calculate the state at an instant, given initial state
         /// @code
         ///                     State state = propagator.calculateStateAt(aState, anInstant) ;
@@ -142,6 +234,79 @@ class Propagator
         Array<State>            calculateStatesAt                           (   const   State&                      aState,
                                                                                 const   Array<Instant>&             anInstantArray                              ) const ;
 
+        /// @brief              Calculate the states at an array of instants, given an array of initial states
+        ///
+        ///                     The initial states are propagated in parallel by the persistent pool of threads (see SetThreadCount). The trajectories are split
+        ///                     evenly between the threads, and a thread that runs out of work steals trajectories from the others, since their integration
+        ///                     costs differ. The calling thread takes part. The states are returned in a contiguous block, ordered by initial state, then by
+        ///                     instant: the state of the i-th trajectory at the k-th instant is at index i * anInstantArray.getSize() + k. The first error
+        ///                     thrown by a propagation is rethrown.
+        /// @code
+        ///                     Array<State> states = propagator.calculateStatesAt(aStateArray, anInstantArray) ;
+        /// @endcode
+        /// @param              [in] aStateArray An array of initial states
+        /// @param              [in] anInstantArray A sorted instant array
+        /// @param              [in] (optional) aThreadCount A maximum number of threads (the configured number of threads if zero)
+        /// @return             Array<State>
+
+        Array<State>            calculateStatesAt                           (   const   Array<State>&               aStateArray,
+                                                                                const   Array<Instant>&             anInstantArray,
+                                                                                const   Size&                       aThreadCount                                =   0 ) const ;
+
+        /// @brief              Calculate a continuous ephemeris over an interval, given an initial state
+        ///
+        ///                     The state at the end of each accepted integration step is retained, along with the interpolation polynomial
+        ///                     of the step: propagate once, then sample any instant of the interval in O(log n). With the RungeKuttaDopri5
+        ///                     stepper, the polynomial is its quintic continuous extension, at no extra evaluation of the dynamics.
+        ///                     Otherwise, it is the quintic Hermite polynomial matching the states and accelerations at both ends of the
+        ///                     step (one more evaluation of the dynamics per step), and steps too long for it to stay within the solver
+        ///                     tolerance are split at intermediate states. The ephemeris covers the interval and the instant of the
+        ///                     initial state. It is only available with the Cowell formulation.
+        /// @code
+        ///                     Ephemeris ephemeris = propagator.calculateEphemeris(aState, anInterval) ;
+        /// @endcode
+        /// @param              [in] aState An initial state
+        /// @param              [in] anInterval An interval
+        /// @return             Ephemeris
+
+        Ephemeris               calculateEphemeris                          (   const   State&                      aState,
+                                                                                const   Interval&                   anInterval                                  ) const ;
+
+        /// @brief              Calculate the state and the state transition matrix at an instant, given initial state
+        ///
+        ///                     The 6x6 state transition matrix d(x(t))/d(x(t0)), with x = [position, velocity] in GCRF (SI units),
+        ///                     is obtained by integrating the variational equations alongside the state.
+        ///                     The augmented state is not integrable with the second order steppers.
+        /// @code
+        ///                     Pair<State, MatrixXd> stateAndStm = propagator.calculateStateAndStateTransitionMatrixAt(aState, anInstant) ;
+        /// @endcode
+        /// @param              [in] aState An initial state
+        /// @param              [in] anInstant An instant
+        /// @return             Pair of state and 6x6 state transition matrix
+
+        Pair<State, MatrixXd>   calculateStateAndStateTransitionMatrixAt    (   const   State&                      aState,
+                                                                                const   Instant&                    anInstant                                   ) const ;
+
+        /// @brief              Get integration statistics, accumulated over all propagations since construction or last reset
+        ///
+        ///                     The statistics of concurrent propagations are accumulated once they are complete.
+        ///
+        /// @code
+        ///                     Statistics statistics = propagator.getStatistics() ;
+        /// @endcode
+        ///
+        /// @return             Statistics
+
+        Statistics              getStatistics                               ( ) const ;
+
+        /// @brief              Reset integration statistics
+        ///
+        /// @code
+        ///                     propagator.resetStatistics() ;
+        /// @endcode
+
+        void                    resetStatistics                             ( ) ;
+
         /// @brief              Print propagator
         ///
         /// @param              [in] anOutputStream An output stream
@@ -152,6 +317,8 @@ class Propagator
 
         /// @brief              Create a medium fidelity Propagator object with recommended settings
         ///
+        ///                     Gravity of Earth (EGM2008, degree and order 35), and drag in the piecewise exponential atmosphere of Earth.
+        ///
         /// @code
         ///                     Propagator propagator = Propagator::MediumFidelity(aState) ;
         /// @endcode
@@ -162,6 +329,9 @@ class Propagator
 
         /// @brief              Create a high fidelity Propagator object with recommended settings
         ///
+        ///                     Gravity of Earth (EGM2008, degree and order 100), of the Sun and of the Moon, and drag in the piecewise exponential
+        ///                     atmosphere of Earth.
+        ///
         /// @code
         ///                     Propagator propagator = Propagator::HighFidelity(aState) ;
         /// @endcode
@@ -170,10 +340,101 @@ class Propagator
 
         static Propagator       HighFidelity                                (   ) ;
 
+        /// @brief              Create a low fidelity Propagator object with recommended settings
+        ///
+        ///                     Point mass and J2 gravity of the Earth, and drag in an exponential atmosphere, composed at compile time.
+        ///
+        /// @code
+        ///                     Propagator propagator = Propagator::LowFidelity() ;
+        /// @endcode
+        /// @return             Propagator
+
+        static Propagator       LowFidelity                                 (   ) ;
+
+        /// @brief              Get string from formulation type
+        ///
+        /// @code
+        ///                     Propagator::StringFromFormulationType(aFormulationType) ;
+        /// @endcode
+        /// @param              [in] aFormulationType A formulation type
+        /// @return             String
+
+        static String           StringFromFormulationType                   (   const   Propagator::FormulationType& aFormulationType                           ) ;
+
+        /// @brief              Get the number of threads propagating an array of initial states, the calling one included
+        ///
+        /// @code
+        ///                     Size threadCount = Propagator::GetThreadCount() ;
+        /// @endcode
+        /// @return             Number of threads
+
+        static Size             GetThreadCount                              ( ) ;
+
+        /// @brief              Set the number of threads propagating an array of initial states, the calling one included
+        ///
+        ///                     The threads are kept in a pool shared by all the propagators, and reused across calls. It is resized once the
+        ///                     propagations in progress are done.
+        ///
+        /// @code
+        ///                     Propagator::SetThreadCount(4) ;
+        /// @endcode
+        /// @param              [in] aThreadCount A number of threads (hardware concurrency if zero)
+
+        static void             SetThreadCount                              (   const   Size&                       aThreadCount                                ) ;
+
     private:
 
-        mutable SatelliteDynamics satelliteDynamics_ ;
-        mutable NumericalSolver numericalSolver_ ;
+        typedef std::function<Array<NumericalSolver::FixedStateVector<6>>(const NumericalSolver&, const NumericalSolver::FixedStateVector<6>&, const Instant&, const Array<Instant>&)> ComposedDynamicsIntegrator ;
+        typedef std::function<void(const double*, double*)> ComposedDynamicsStateDerivative ;
+
+        // Mutable state of one propagation: working copies of the satellite dynamics (epoch, caches) and of the solver (statistics, warm start)
+        struct IntegrationContext
+        {
+            SatelliteDynamics   satelliteDynamics ;
+            NumericalSolver     numericalSolver ;
+        } ;
+
+        SatelliteDynamics       satelliteDynamics_ ;
+        NumericalSolver         numericalSolver_ ;
+        FormulationType         formulationType_ ;
+
+        // Set when constructed from composed dynamics, in which case the satellite dynamics are undefined
+        Shared<const Dynamics> composedDynamicsSPtr_ ;
+        ComposedDynamicsIntegrator composedDynamicsIntegrator_ ;
+        ComposedDynamicsStateDerivative composedDynamicsStateDerivative_ ;
+
+        // Guards the statistics and the idle integration contexts
+        mutable std::mutex      mutex_ ;
+        mutable Statistics      statistics_ ;
+        mutable Array<Unique<IntegrationContext>> idleIntegrationContexts_ ;
+
+        // Integration context for the duration of a propagation: an idle one, or a new one copied from the configuration. It is returned
+        // to the idle contexts, and its statistics accumulated, when released.
+        Shared<IntegrationContext> acquireIntegrationContext                ( ) const ;
+
+        // Second order dynamical equations for second order steppers, first order ones otherwise
+        SatelliteDynamics::DynamicalEquationWrapper getDynamicalEquations   (           IntegrationContext&         anIntegrationContext                        ) const ;
+
+        Array<SatelliteDynamics::StateVector> integrateStatesAtSortedInstants ( IntegrationContext&                 anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const ;
+
+        // Ephemeris from a start instant to an end instant, in either direction
+        Ephemeris               integrateEphemeris                          (           IntegrationContext&         anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant                                ) const ;
+
+        Array<SatelliteDynamics::StateVector> integrateEnckeStatesAtSortedInstants ( IntegrationContext&            anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const ;
+
+        Array<SatelliteDynamics::StateVector> integrateKustaanheimoStiefelStatesAtSortedInstants ( IntegrationContext& anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const ;
 
 } ;
 
@@ -185,6 +446,10 @@ class Propagator
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.tpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
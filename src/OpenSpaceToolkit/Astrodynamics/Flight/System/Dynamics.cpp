@@ -32,6 +32,11 @@ namespace system
 
 }
 
+Dynamics::DynamicalEquationWrapper Dynamics::getSecondOrderDynamicalEquations ( )
+{
+    throw ostk::core::error::runtime::ToBeImplemented("Dynamics::getSecondOrderDynamicalEquations") ;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
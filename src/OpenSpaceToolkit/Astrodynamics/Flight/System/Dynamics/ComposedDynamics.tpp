@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.tpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class... Terms>
+                                ComposedDynamics<Terms...>::ComposedDynamics (  const   Terms&...                   aTerms                                      )
+                                :   Dynamics(),
+                                    terms_(aTerms...)
+{
+
+}
+
+template <class... Terms>
+                                ComposedDynamics<Terms...>::~ComposedDynamics ( )
+{
+
+}
+
+template <class... Terms>
+ComposedDynamics<Terms...>*     ComposedDynamics<Terms...>::clone           ( ) const
+{
+    return new ComposedDynamics<Terms...>(*this) ;
+}
+
+template <class... Terms>
+bool                            ComposedDynamics<Terms...>::isDefined       ( ) const
+{
+    return std::apply([] (const Terms&... aTerms) -> bool { return (true && ... && aTerms.isDefined()) ; }, terms_) ;
+}
+
+template <class... Terms>
+void                            ComposedDynamics<Terms...>::print           (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Composed Dynamics") : void () ;
+
+    std::apply([&anOutputStream] (const Terms&... aTerms) -> void { (aTerms.print(anOutputStream, false), ...) ; }, terms_) ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+template <class... Terms>
+template <std::size_t Index>
+const typename std::tuple_element<Index, std::tuple<Terms...>>::type& ComposedDynamics<Terms...>::accessTerm ( ) const
+{
+    return std::get<Index>(terms_) ;
+}
+
+template <class... Terms>
+inline void                     ComposedDynamics<Terms...>::calculateAccelerationAt ( const double*                 x,
+                                                                                        double*                     anAcceleration                              ) const
+{
+
+    const double r = std::sqrt((x[0] * x[0]) + (x[1] * x[1]) + (x[2] * x[2])) ;
+
+    anAcceleration[0] = 0.0 ;
+    anAcceleration[1] = 0.0 ;
+    anAcceleration[2] = 0.0 ;
+
+    std::apply([x, r, anAcceleration] (const Terms&... aTerms) -> void { (aTerms.addAccelerationAt(x, r, anAcceleration), ...) ; }, terms_) ;
+
+}
+
+template <class... Terms>
+inline void                     ComposedDynamics<Terms...>::calculateStateDerivativeAt ( const double*              x,
+                                                                                        double*                     dxdt                                        ) const
+{
+
+    this->calculateAccelerationAt(x, dxdt + 3) ;
+
+    dxdt[0] = x[3] ;
+    dxdt[1] = x[4] ;
+    dxdt[2] = x[5] ;
+
+}
+
+template <class... Terms>
+template <class StateType>
+inline void                     ComposedDynamics<Terms...>::operator ()     (   const   StateType&                  x,
+                                                                                        StateType&                  dxdt,
+                                                                                const   double                      t                                           ) const
+{
+
+    (void) t ;
+
+    this->calculateStateDerivativeAt(x.data(), dxdt.data()) ;
+
+}
+
+template <class... Terms>
+Dynamics::DynamicalEquationWrapper ComposedDynamics<Terms...>::getDynamicalEquations ( )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composed dynamics") ;
+    }
+
+    return [this] (const Dynamics::StateVector& x, Dynamics::StateVector& dxdt, const double) -> void
+    {
+        this->calculateStateDerivativeAt(x.data(), dxdt.data()) ;
+    } ;
+
+}
+
+template <class... Terms>
+Dynamics::DynamicalEquationWrapper ComposedDynamics<Terms...>::getSecondOrderDynamicalEquations ( )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composed dynamics") ;
+    }
+
+    return [this] (const Dynamics::StateVector& x, Dynamics::StateVector& dxdt, const double) -> void
+    {
+        this->calculateAccelerationAt(x.data(), dxdt.data() + 3) ;
+    } ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <cmath>
+#include <limits>
+#include <iterator>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                EphemerisCache::EphemerisCache              (   const   Shared<const Frame>&        anOriginFrameSPtr,
+                                                                                const   Shared<const Frame>&        aReferenceFrameSPtr,
+                                                                                const   Instant&                    anEpoch,
+                                                                                const   Duration&                   aSegmentDuration,
+                                                                                const   Size                        aDegree,
+                                                                                const   Size                        aCapacity                                   )
+                                :   originFrameSPtr_(anOriginFrameSPtr),
+                                    referenceFrameSPtr_(aReferenceFrameSPtr),
+                                    epoch_(anEpoch),
+                                    segmentDuration_(aSegmentDuration.isDefined() ? static_cast<double>(aSegmentDuration.inSeconds()) : std::numeric_limits<double>::quiet_NaN()),
+                                    degree_(aDegree),
+                                    capacity_(aCapacity),
+                                    segments_(),
+                                    lastSegmentIndex_(std::numeric_limits<std::int64_t>::min()),
+                                    lastSegment_()
+{
+
+    if (aSegmentDuration.isDefined() && (!(segmentDuration_ > 0.0)))
+    {
+        throw ostk::core::error::runtime::Wrong("Segment duration") ;
+    }
+
+    if (capacity_ < 1)
+    {
+        throw ostk::core::error::runtime::Wrong("Capacity") ;
+    }
+
+}
+
+bool                            EphemerisCache::isDefined                   ( ) const
+{
+    return (originFrameSPtr_ != nullptr) && (referenceFrameSPtr_ != nullptr) && epoch_.isDefined() && (segmentDuration_ > 0.0) ;
+}
+
+Instant                         EphemerisCache::getEpoch                    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris cache") ;
+    }
+
+    return epoch_ ;
+
+}
+
+Size                            EphemerisCache::getSegmentCount             ( ) const
+{
+    return segments_.size() ;
+}
+
+Size                            EphemerisCache::getCapacity                 ( ) const
+{
+    return capacity_ ;
+}
+
+Vector3d                        EphemerisCache::getPositionAt               (   const   double                      aTime                                       )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris cache") ;
+    }
+
+    const std::int64_t segmentIndex = static_cast<std::int64_t>(std::floor(aTime / segmentDuration_)) ;
+
+    if (segmentIndex != lastSegmentIndex_)
+    {
+
+        auto segmentIt = segments_.find(segmentIndex) ;
+
+        if (segmentIt == segments_.end())
+        {
+
+            segmentIt = segments_.emplace(segmentIndex, this->fitSegment(segmentIndex)).first ;
+
+            // Drop the segment farthest from the new one, which lies at either end of the map
+
+            if (segments_.size() > capacity_)
+            {
+
+                if ((segmentIndex - segments_.begin()->first) > (segments_.rbegin()->first - segmentIndex))
+                {
+                    segments_.erase(segments_.begin()) ;
+                }
+                else
+                {
+                    segments_.erase(std::prev(segments_.end())) ;
+                }
+
+            }
+
+        }
+
+        lastSegment_ = segmentIt->second ;
+        lastSegmentIndex_ = segmentIndex ;
+
+    }
+
+    // Clenshaw recurrence, on the time normalized to [-1, 1] over the segment
+
+    const double x = (2.0 * ((aTime / segmentDuration_) - static_cast<double>(segmentIndex))) - 1.0 ;
+
+    Vector3d b1 = Vector3d::Zero() ;
+    Vector3d b2 = Vector3d::Zero() ;
+
+    for (Eigen::Index j = lastSegment_.cols() - 1 ; j > 0 ; --j)
+    {
+
+        const Vector3d b0 = (2.0 * x * b1) - b2 + lastSegment_.col(j) ;
+
+        b2 = b1 ;
+        b1 = b0 ;
+
+    }
+
+    return (x * b1) - b2 + (0.5 * lastSegment_.col(0)) ;
+
+}
+
+Vector3d                        EphemerisCache::getPositionAt               (   const   Instant&                    anInstant                                   )
+{
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris cache") ;
+    }
+
+    return this->getPositionAt((anInstant - epoch_).inSeconds()) ;
+
+}
+
+void                            EphemerisCache::clear                       ( )
+{
+
+    segments_.clear() ;
+
+    lastSegmentIndex_ = std::numeric_limits<std::int64_t>::min() ;
+    lastSegment_.resize(0, 0) ;
+
+}
+
+EphemerisCache                  EphemerisCache::Undefined                   ( )
+{
+    return { nullptr, nullptr, Instant::Undefined(), Duration::Undefined() } ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MatrixXd                        EphemerisCache::fitSegment                  (   const   std::int64_t                aSegmentIndex                               ) const
+{
+
+    // Interpolation at the Chebyshev nodes (roots of T_n), whose coefficients follow from the discrete orthogonality of the Chebyshev polynomials
+
+    const Size nodeCount = degree_ + 1 ;
+
+    MatrixXd positions(3, nodeCount) ;
+
+    for (Size k = 0 ; k < nodeCount ; ++k)
+    {
+
+        const double node = std::cos(M_PI * (static_cast<double>(k) + 0.5) / static_cast<double>(nodeCount)) ;
+        const double time = (static_cast<double>(aSegmentIndex) + (0.5 * (node + 1.0))) * segmentDuration_ ;
+
+        positions.col(k) = originFrameSPtr_->getOriginIn(referenceFrameSPtr_, epoch_ + Duration::Seconds(time)).inMeters().getCoordinates() ;
+
+    }
+
+    MatrixXd coefficients = MatrixXd::Zero(3, nodeCount) ;
+
+    for (Size j = 0 ; j < nodeCount ; ++j)
+    {
+
+        for (Size k = 0 ; k < nodeCount ; ++k)
+        {
+            coefficients.col(j) += positions.col(k) * std::cos(M_PI * static_cast<double>(j) * (static_cast<double>(k) + 0.5) / static_cast<double>(nodeCount)) ;
+        }
+
+        coefficients.col(j) *= 2.0 / static_cast<double>(nodeCount) ;
+
+    }
+
+    return coefficients ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                ExponentialAtmosphere::ExponentialAtmosphere (  const   Array<ExponentialAtmosphere::Band>& aBandArray                          )
+                                :   bands_(aBandArray.begin(), aBandArray.end()),
+                                    lookupStep_(std::numeric_limits<double>::quiet_NaN()),
+                                    lookupBandIndices_()
+{
+
+    if (bands_.empty())
+    {
+        return ;
+    }
+
+    if (bands_.size() > std::numeric_limits<std::uint16_t>::max())
+    {
+        throw ostk::core::error::runtime::Wrong("Band count") ;
+    }
+
+    for (std::size_t bandIndex = 0 ; bandIndex < bands_.size() ; ++bandIndex)
+    {
+
+        const ExponentialAtmosphere::Band& band = bands_[bandIndex] ;
+
+        if ((!std::isfinite(band.baseAltitude)) || (!(band.baseDensity > 0.0)) || (!(band.scaleHeight > 0.0)) || (!std::isfinite(band.scaleHeight)))
+        {
+            throw ostk::core::error::runtime::Wrong("Band") ;
+        }
+
+        if ((bandIndex > 0) && (!(band.baseAltitude > bands_[bandIndex - 1].baseAltitude)))
+        {
+            throw ostk::core::error::runtime::Wrong("Band base altitude") ;
+        }
+
+    }
+
+    if (bands_.size() == 1)
+    {
+        return ;
+    }
+
+    // Lookup grid over the bands, with a step no larger than the thinnest band, so that each cell spans at most two bands
+
+    lookupStep_ = std::numeric_limits<double>::infinity() ;
+
+    for (std::size_t bandIndex = 1 ; bandIndex < bands_.size() ; ++bandIndex)
+    {
+        lookupStep_ = std::min(lookupStep_, bands_[bandIndex].baseAltitude - bands_[bandIndex - 1].baseAltitude) ;
+    }
+
+    const double firstBaseAltitude = bands_.front().baseAltitude ;
+    const std::size_t cellCount = static_cast<std::size_t>(std::ceil((bands_.back().baseAltitude - firstBaseAltitude) / lookupStep_)) + 1 ;
+
+    lookupBandIndices_.resize(cellCount) ;
+
+    std::size_t bandIndex = 0 ;
+
+    for (std::size_t cellIndex = 0 ; cellIndex < cellCount ; ++cellIndex)
+    {
+
+        const double cellAltitude = firstBaseAltitude + (static_cast<double>(cellIndex) * lookupStep_) ;
+
+        while (((bandIndex + 1) < bands_.size()) && (bands_[bandIndex + 1].baseAltitude <= cellAltitude))
+        {
+            ++bandIndex ;
+        }
+
+        lookupBandIndices_[cellIndex] = static_cast<std::uint16_t>(bandIndex) ;
+
+    }
+
+}
+
+bool                            ExponentialAtmosphere::operator ==          (   const   ExponentialAtmosphere&      anExponentialAtmosphere                     ) const
+{
+
+    if ((!this->isDefined()) || (!anExponentialAtmosphere.isDefined()))
+    {
+        return false ;
+    }
+
+    return std::equal(bands_.begin(), bands_.end(), anExponentialAtmosphere.bands_.begin(), anExponentialAtmosphere.bands_.end(),
+        [] (const ExponentialAtmosphere::Band& aBand, const ExponentialAtmosphere::Band& anotherBand) -> bool
+        {
+            return (aBand.baseAltitude == anotherBand.baseAltitude) && (aBand.baseDensity == anotherBand.baseDensity) && (aBand.scaleHeight == anotherBand.scaleHeight) ;
+        }) ;
+
+}
+
+bool                            ExponentialAtmosphere::operator !=          (   const   ExponentialAtmosphere&      anExponentialAtmosphere                     ) const
+{
+    return !((*this) == anExponentialAtmosphere) ;
+}
+
+bool                            ExponentialAtmosphere::isDefined            ( ) const
+{
+    return !bands_.empty() ;
+}
+
+Size                            ExponentialAtmosphere::getBandCount         ( ) const
+{
+    return bands_.size() ;
+}
+
+double                          ExponentialAtmosphere::getDensityAt         (   const   double                      anAltitude                                  ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Exponential atmosphere") ;
+    }
+
+    const ExponentialAtmosphere::Band& band = bands_[this->accessBandIndex(anAltitude)] ;
+
+    return band.baseDensity * std::exp(-(anAltitude - band.baseAltitude) / band.scaleHeight) ;
+
+}
+
+double                          ExponentialAtmosphere::getScaleHeightAt     (   const   double                      anAltitude                                  ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Exponential atmosphere") ;
+    }
+
+    return bands_[this->accessBandIndex(anAltitude)].scaleHeight ;
+
+}
+
+ExponentialAtmosphere           ExponentialAtmosphere::Undefined            ( )
+{
+    return { Array<ExponentialAtmosphere::Band>::Empty() } ;
+}
+
+ExponentialAtmosphere           ExponentialAtmosphere::Default              ( )
+{
+
+    // Base altitude [km], nominal density [kg/m^3], scale height [km]
+
+    static const double table[][3] =
+    {
+        {    0.0, 1.225,    7.249 },
+        {   25.0, 3.899e-2, 6.349 },
+        {   30.0, 1.774e-2, 6.682 },
+        {   40.0, 3.972e-3, 7.554 },
+        {   50.0, 1.057e-3, 8.382 },
+        {   60.0, 3.206e-4, 7.714 },
+        {   70.0, 8.770e-5, 6.549 },
+        {   80.0, 1.905e-5, 5.799 },
+        {   90.0, 3.396e-6, 5.382 },
+        {  100.0, 5.297e-7, 5.877 },
+        {  110.0, 9.661e-8, 7.263 },
+        {  120.0, 2.438e-8, 9.473 },
+        {  130.0, 8.484e-9, 12.636 },
+        {  140.0, 3.845e-9, 16.149 },
+        {  150.0, 2.070e-9, 22.523 },
+        {  180.0, 5.464e-10, 29.740 },
+        {  200.0, 2.789e-10, 37.105 },
+        {  250.0, 7.248e-11, 45.546 },
+        {  300.0, 2.418e-11, 53.628 },
+        {  350.0, 9.518e-12, 53.298 },
+        {  400.0, 3.725e-12, 58.515 },
+        {  450.0, 1.585e-12, 60.828 },
+        {  500.0, 6.967e-13, 63.822 },
+        {  600.0, 1.454e-13, 71.835 },
+        {  700.0, 3.614e-14, 88.667 },
+        {  800.0, 1.170e-14, 124.64 },
+        {  900.0, 5.245e-15, 181.05 },
+        { 1000.0, 3.019e-15, 268.00 }
+    } ;
+
+    Array<ExponentialAtmosphere::Band> bands = Array<ExponentialAtmosphere::Band>::Empty() ;
+
+    for (const auto& row : table)
+    {
+        bands.add({ row[0] * 1e3, row[1], row[2] * 1e3 }) ;
+    }
+
+    return { bands } ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t                     ExponentialAtmosphere::accessBandIndex      (   const   double                      anAltitude                                  ) const
+{
+
+    if (lookupBandIndices_.empty())
+    {
+        return 0 ;
+    }
+
+    const double cellPosition = (anAltitude - bands_.front().baseAltitude) / lookupStep_ ;
+
+    if (!(cellPosition > 0.0))
+    {
+        return 0 ;
+    }
+
+    if (cellPosition >= static_cast<double>(lookupBandIndices_.size() - 1))
+    {
+        return bands_.size() - 1 ;
+    }
+
+    std::size_t bandIndex = lookupBandIndices_[static_cast<std::size_t>(cellPosition)] ;
+
+    if (((bandIndex + 1) < bands_.size()) && (anAltitude >= bands_[bandIndex + 1].baseAltitude))
+    {
+        ++bandIndex ;
+    }
+
+    return bandIndex ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModel.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                ForceModel::ForceModel                      (   const   String&                     aName                                       )
+                                :   name_(aName)
+{
+
+}
+
+                                ForceModel::~ForceModel                     ( )
+{
+
+}
+
+bool                            ForceModel::operator !=                     (   const   ForceModel&                 aForceModel                                 ) const
+{
+    return !((*this) == aForceModel) ;
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   ForceModel&                 aForceModel                                 )
+{
+
+    aForceModel.print(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+String                          ForceModel::getName                         ( ) const
+{
+    return name_ ;
+}
+
+void                            ForceModel::print                           (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Force Model") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Name:" << name_ ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+Matrix3d                        ForceModel::calculatePositionJacobianAt     (   const   ForceModel::Context&        aContext                                    )
+{
+
+    (void) aContext ;
+
+    return Matrix3d::Zero() ;
+
+}
+
+Matrix3d                        ForceModel::calculateVelocityJacobianAt     (   const   ForceModel::Context&        aContext                                    )
+{
+
+    (void) aContext ;
+
+    return Matrix3d::Zero() ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
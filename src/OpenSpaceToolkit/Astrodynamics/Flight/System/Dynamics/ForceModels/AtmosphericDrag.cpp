@@ -0,0 +1,332 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/AtmosphericDrag.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/AtmosphericDrag.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <cmath>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Rotation rate of the atmosphere about the pole of the central body frame, when the rotation is taken from the context [rad/s]
+static const double EarthRotationRate = 7.2921159e-5 ;
+
+static double                   BallisticCoefficientOf                      (   const   SatelliteSystem&            aSatelliteSystem                            )
+{
+
+    if (!aSatelliteSystem.isDefined())
+    {
+        return std::numeric_limits<double>::quiet_NaN() ;
+    }
+
+    return static_cast<double>(aSatelliteSystem.getDragCoefficient() * aSatelliteSystem.getCrossSectionalSurfaceArea() / aSatelliteSystem.getMass().inKilograms()) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                AtmosphericDrag::AtmosphericDrag            (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   ExponentialAtmosphere&      anAtmosphere                                )
+                                :   ForceModel((aCelestialObjectSPtr != nullptr) ? (aCelestialObjectSPtr->getName() + " Atmospheric Drag") : "Atmospheric Drag"),
+                                    celestialObjectSPtr_(aCelestialObjectSPtr),
+                                    ballisticCoefficient_(BallisticCoefficientOf(aSatelliteSystem)),
+                                    equatorialRadius_(((aCelestialObjectSPtr != nullptr) && aCelestialObjectSPtr->isDefined()) ? static_cast<double>(aCelestialObjectSPtr->getEquatorialRadius().inMeters()) : std::numeric_limits<double>::quiet_NaN()),
+                                    flattening_(((aCelestialObjectSPtr != nullptr) && aCelestialObjectSPtr->isDefined()) ? static_cast<double>(aCelestialObjectSPtr->getFlattening()) : std::numeric_limits<double>::quiet_NaN()),
+                                    atmosphere_(anAtmosphere),
+                                    densityModel_()
+{
+
+}
+
+                                AtmosphericDrag::AtmosphericDrag            (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   AtmosphericDrag::DensityModel& aDensityModel                            )
+                                :   AtmosphericDrag(aCelestialObjectSPtr, aSatelliteSystem, ExponentialAtmosphere::Undefined())
+{
+
+    if (!aDensityModel)
+    {
+        throw ostk::core::error::runtime::Undefined("Density model") ;
+    }
+
+    densityModel_ = aDensityModel ;
+
+}
+
+                                AtmosphericDrag::~AtmosphericDrag           ( )
+{
+
+}
+
+AtmosphericDrag*                AtmosphericDrag::clone                      ( ) const
+{
+    return new AtmosphericDrag(*this) ;
+}
+
+bool                            AtmosphericDrag::operator ==                (   const   ForceModel&                 aForceModel                                 ) const
+{
+
+    const AtmosphericDrag* atmosphericDragPtr = dynamic_cast<const AtmosphericDrag*>(&aForceModel) ;
+
+    if ((atmosphericDragPtr == nullptr) || (!this->isDefined()) || (!atmosphericDragPtr->isDefined()))
+    {
+        return false ;
+    }
+
+    // Celestial objects are compared by name, as each environment holds its own instances.
+    // User density models are compared by type, functions not being comparable.
+
+    return (this->getName() == atmosphericDragPtr->getName())
+        && (celestialObjectSPtr_->getName() == atmosphericDragPtr->celestialObjectSPtr_->getName())
+        && (ballisticCoefficient_ == atmosphericDragPtr->ballisticCoefficient_)
+        && (static_cast<bool>(densityModel_) == static_cast<bool>(atmosphericDragPtr->densityModel_))
+        && (densityModel_ ? (densityModel_.target_type() == atmosphericDragPtr->densityModel_.target_type()) : (atmosphere_ == atmosphericDragPtr->atmosphere_)) ;
+
+}
+
+bool                            AtmosphericDrag::isDefined                  ( ) const
+{
+    return (celestialObjectSPtr_ != nullptr)
+        && celestialObjectSPtr_->isDefined()
+        && std::isfinite(ballisticCoefficient_)
+        && (atmosphere_.isDefined() || static_cast<bool>(densityModel_)) ;
+}
+
+Shared<const Celestial>         AtmosphericDrag::getCelestialObject         ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric drag") ;
+    }
+
+    return celestialObjectSPtr_ ;
+
+}
+
+double                          AtmosphericDrag::getBallisticCoefficient    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric drag") ;
+    }
+
+    return ballisticCoefficient_ ;
+
+}
+
+void                            AtmosphericDrag::print                      (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Atmospheric Drag") : void () ;
+
+    ForceModel::print(anOutputStream, false) ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Celestial Object:" << ((celestialObjectSPtr_ != nullptr) ? celestialObjectSPtr_->getName() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Ballistic Coefficient [m^2/kg]:" << ballisticCoefficient_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Density Model:" << (densityModel_ ? "User" : "Piecewise Exponential") ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+double                          AtmosphericDrag::calculateDensityAt         (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric drag") ;
+    }
+
+    return this->calculateStateAt(aContext).density ;
+
+}
+
+Vector3d                        AtmosphericDrag::calculateAccelerationAt    (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric drag") ;
+    }
+
+    const AtmosphericDrag::State state = this->calculateStateAt(aContext) ;
+
+    return (-0.5 * ballisticCoefficient_ * state.density * state.relativeVelocity.norm()) * state.relativeVelocity ;
+
+}
+
+Matrix3d                        AtmosphericDrag::calculatePositionJacobianAt (  const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric drag") ;
+    }
+
+    const AtmosphericDrag::State state = this->calculateStateAt(aContext) ;
+
+    const Vector3d& v = state.relativeVelocity ;
+    const double vNorm = v.norm() ;
+
+    if ((!(state.density > 0.0)) || (!(vNorm > 0.0)))
+    {
+        return Matrix3d::Zero() ;
+    }
+
+    // d(|v| v)/dv * dv/dr, with dv/dr = -[w x]
+
+    Matrix3d angularVelocityCrossMatrix ;
+    angularVelocityCrossMatrix <<                        0.0, -state.angularVelocity.z(),  state.angularVelocity.y(),
+                                   state.angularVelocity.z(),                        0.0, -state.angularVelocity.x(),
+                                  -state.angularVelocity.y(),  state.angularVelocity.x(),                        0.0 ;
+
+    const Matrix3d velocityTermJacobian = -((vNorm * Matrix3d::Identity()) + ((v * v.transpose()) / vNorm)) * angularVelocityCrossMatrix ;
+
+    Matrix3d jacobian = (-0.5 * ballisticCoefficient_ * state.density) * velocityTermJacobian ;
+
+    // Density gradient, radial for a piecewise exponential atmosphere: d(rho)/dr = -rho / H * r / |r|
+    // The density shared by the context is evaluated by this model, the gradient holds for it as well
+
+    if (!densityModel_)
+    {
+
+        const Vector3d densityGradient = (-state.density / atmosphere_.getScaleHeightAt(state.altitude) / aContext.positionNorm) * aContext.position ;
+
+        jacobian += (-0.5 * ballisticCoefficient_ * vNorm) * (v * densityGradient.transpose()) ;
+
+    }
+
+    return jacobian ;
+
+}
+
+Matrix3d                        AtmosphericDrag::calculateVelocityJacobianAt (  const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric drag") ;
+    }
+
+    const AtmosphericDrag::State state = this->calculateStateAt(aContext) ;
+
+    const Vector3d& v = state.relativeVelocity ;
+    const double vNorm = v.norm() ;
+
+    if ((!(state.density > 0.0)) || (!(vNorm > 0.0)))
+    {
+        return Matrix3d::Zero() ;
+    }
+
+    // d(|v| v)/dv, with dv_rel/dv = I
+
+    return (-0.5 * ballisticCoefficient_ * state.density) * ((vNorm * Matrix3d::Identity()) + ((v * v.transpose()) / vNorm)) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+AtmosphericDrag::State          AtmosphericDrag::calculateStateAt           (   const   ForceModel::Context&        aContext                                    )
+{
+
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    using ostk::physics::coord::Transform ;
+
+    const Shared<const Frame> bodyFrameSPtr = celestialObjectSPtr_->accessFrame() ;
+
+    AtmosphericDrag::State state ;
+
+    Vector3d bodyFixedPosition ;
+
+    if ((aContext.bodyFrameSPtr != nullptr) && ((*aContext.bodyFrameSPtr) == (*bodyFrameSPtr)))
+    {
+
+        bodyFixedPosition = aContext.bodyFixedPosition ;
+        state.angularVelocity = EarthRotationRate * aContext.dcm_GCRF_BODY.col(2) ;
+
+    }
+    else
+    {
+
+        const Transform transform_GCRF_BODY = bodyFrameSPtr->getTransformTo(Frame::GCRF(), aContext.instant) ;
+        const Quaternion q_GCRF_BODY = transform_GCRF_BODY.getOrientation() ;
+
+        Matrix3d dcm_GCRF_BODY ;
+        dcm_GCRF_BODY.col(0) = q_GCRF_BODY * Vector3d::UnitX() ;
+        dcm_GCRF_BODY.col(1) = q_GCRF_BODY * Vector3d::UnitY() ;
+        dcm_GCRF_BODY.col(2) = q_GCRF_BODY * Vector3d::UnitZ() ;
+
+        bodyFixedPosition = dcm_GCRF_BODY.transpose() * (aContext.position - bodyFrameSPtr->getOriginIn(Frame::GCRF(), aContext.instant).inMeters().getCoordinates()) ;
+        state.angularVelocity = -transform_GCRF_BODY.getAngularVelocity() ;
+
+    }
+
+    state.relativeVelocity = aContext.velocity - state.angularVelocity.cross(aContext.position) ;
+
+    // Altitude above the ellipsoid, to first order in the flattening
+
+    const double bodyFixedPositionNorm = bodyFixedPosition.norm() ;
+    const double sinLatitude = bodyFixedPosition.z() / bodyFixedPositionNorm ;
+
+    state.altitude = bodyFixedPositionNorm - (equatorialRadius_ * (1.0 - (flattening_ * sinLatitude * sinLatitude))) ;
+
+    if (std::isfinite(aContext.density))
+    {
+        state.density = aContext.density ;
+    }
+    else if (densityModel_)
+    {
+        state.density = densityModel_(bodyFixedPosition, aContext.instant) ;
+    }
+    else
+    {
+        state.density = atmosphere_.getDensityAt(state.altitude) ;
+    }
+
+    return state ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
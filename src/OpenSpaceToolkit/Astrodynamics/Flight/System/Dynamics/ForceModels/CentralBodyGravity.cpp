@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/CentralBodyGravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/CentralBodyGravity.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Vector.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <string>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::physics::units::Length ;
+using ostk::physics::units::Time ;
+using ostk::physics::units::Derived ;
+
+static const Derived::Unit GravitationalParameterSIUnit = Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                CentralBodyGravity::CentralBodyGravity      (   const   Shared<const Celestial>&    aCelestialObjectSPtr                        )
+                                :   ForceModel((aCelestialObjectSPtr != nullptr) ? (aCelestialObjectSPtr->getName() + " Gravity") : "Central Body Gravity"),
+                                    celestialObjectSPtr_(aCelestialObjectSPtr),
+                                    sphericalHarmonicGravity_(SphericalHarmonicGravity::Undefined()),
+                                    gravitySurrogateSPtr_(nullptr)
+{
+
+}
+
+                                CentralBodyGravity::CentralBodyGravity      (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   )
+                                :   ForceModel((aCelestialObjectSPtr != nullptr) ? (aCelestialObjectSPtr->getName() + " Gravity") : "Central Body Gravity"),
+                                    celestialObjectSPtr_(aCelestialObjectSPtr),
+                                    sphericalHarmonicGravity_(aSphericalHarmonicGravity),
+                                    gravitySurrogateSPtr_(nullptr)
+{
+
+    if (!aSphericalHarmonicGravity.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+}
+
+                                CentralBodyGravity::CentralBodyGravity      (   const   Shared<const Celestial>&    aCelestialObjectSPtr,
+                                                                                const   SphericalHarmonicGravity&   aSphericalHarmonicGravity,
+                                                                                const   Shared<const GravitySurrogate>& aGravitySurrogateSPtr                   )
+                                :   CentralBodyGravity(aCelestialObjectSPtr, aSphericalHarmonicGravity)
+{
+
+    if ((aGravitySurrogateSPtr == nullptr) || (!aGravitySurrogateSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    if (!aGravitySurrogateSPtr->isCompatibleWith(aSphericalHarmonicGravity))
+    {
+        throw ostk::core::error::runtime::Wrong("Gravity surrogate") ;
+    }
+
+    gravitySurrogateSPtr_ = aGravitySurrogateSPtr ;
+
+}
+
+                                CentralBodyGravity::~CentralBodyGravity     ( )
+{
+
+}
+
+CentralBodyGravity*             CentralBodyGravity::clone                   ( ) const
+{
+    return new CentralBodyGravity(*this) ;
+}
+
+bool                            CentralBodyGravity::operator ==             (   const   ForceModel&                 aForceModel                                 ) const
+{
+
+    const CentralBodyGravity* centralBodyGravityPtr = dynamic_cast<const CentralBodyGravity*>(&aForceModel) ;
+
+    if ((centralBodyGravityPtr == nullptr) || (!this->isDefined()) || (!centralBodyGravityPtr->isDefined()))
+    {
+        return false ;
+    }
+
+    // Gravity surrogates are immutable and shared between clones, they are compared by identity
+
+    const bool hasSphericalHarmonicGravity = sphericalHarmonicGravity_.isDefined() ;
+
+    return (this->getName() == centralBodyGravityPtr->getName())
+        && (celestialObjectSPtr_->getName() == centralBodyGravityPtr->celestialObjectSPtr_->getName())
+        && (hasSphericalHarmonicGravity == centralBodyGravityPtr->sphericalHarmonicGravity_.isDefined())
+        && ((!hasSphericalHarmonicGravity) || (sphericalHarmonicGravity_ == centralBodyGravityPtr->sphericalHarmonicGravity_))
+        && (gravitySurrogateSPtr_ == centralBodyGravityPtr->gravitySurrogateSPtr_) ;
+
+}
+
+bool                            CentralBodyGravity::isDefined               ( ) const
+{
+    return (celestialObjectSPtr_ != nullptr) && celestialObjectSPtr_->isDefined() ;
+}
+
+Shared<const Celestial>         CentralBodyGravity::getCelestialObject      ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Central body gravity") ;
+    }
+
+    return celestialObjectSPtr_ ;
+
+}
+
+SphericalHarmonicGravity        CentralBodyGravity::getSphericalHarmonicGravity ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Central body gravity") ;
+    }
+
+    return sphericalHarmonicGravity_ ;
+
+}
+
+Shared<const GravitySurrogate>  CentralBodyGravity::getGravitySurrogate     ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Central body gravity") ;
+    }
+
+    return gravitySurrogateSPtr_ ;
+
+}
+
+void                            CentralBodyGravity::print                   (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Central Body Gravity") : void () ;
+
+    ForceModel::print(anOutputStream, false) ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Celestial Object:" << ((celestialObjectSPtr_ != nullptr) ? celestialObjectSPtr_->getName() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Spherical Harmonic Degree:" << (sphericalHarmonicGravity_.isDefined() ? std::to_string(sphericalHarmonicGravity_.getDegree()) : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Gravity Surrogate Reference Degree:" << ((gravitySurrogateSPtr_ != nullptr) ? std::to_string(gravitySurrogateSPtr_->getReferenceDegree()) : "Undefined") ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+Vector3d                        CentralBodyGravity::calculateAccelerationAt (   const   ForceModel::Context&        aContext                                    )
+{
+
+    using ostk::physics::coord::Position ;
+    using ostk::physics::data::Vector ;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Central body gravity") ;
+    }
+
+    const Shared<const Frame> bodyFrameSPtr = celestialObjectSPtr_->accessFrame() ;
+
+    // Body fixed position and rotation from the context when it holds this body frame, computed at the instant of the context otherwise
+
+    const Matrix3d dcm_GCRF_BODY = this->calculateRotationMatrix(aContext) ;
+
+    const Vector3d bodyFixedPosition = ((aContext.bodyFrameSPtr != nullptr) && ((*aContext.bodyFrameSPtr) == (*bodyFrameSPtr)))
+                                     ? aContext.bodyFixedPosition
+                                     : Vector3d(dcm_GCRF_BODY.transpose() * (aContext.position - bodyFrameSPtr->getOriginIn(Frame::GCRF(), aContext.instant).inMeters().getCoordinates())) ;
+
+    if (sphericalHarmonicGravity_.isDefined())
+    {
+        return dcm_GCRF_BODY * this->calculateBodyFixedAccelerationAt(bodyFixedPosition) ;
+    }
+
+    // The field is evaluated at a body fixed position, so that it does not depend on the instant held by the celestial object, which
+    // is not updated during propagation
+
+    const Vector gravitationalAcceleration = celestialObjectSPtr_->getGravitationalFieldAt(Position::Meters(bodyFixedPosition, bodyFrameSPtr)) ;
+
+    if ((*gravitationalAcceleration.getFrame()) == (*bodyFrameSPtr))
+    {
+        return dcm_GCRF_BODY * gravitationalAcceleration.getValue() ;
+    }
+
+    return gravitationalAcceleration.inFrame(Frame::GCRF(), aContext.instant).getValue() ;
+
+}
+
+Matrix3d                        CentralBodyGravity::calculatePositionJacobianAt (   const   ForceModel::Context&        aContext                                    )
+{
+
+    using ostk::core::types::Real ;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Central body gravity") ;
+    }
+
+    const double mu_SI = celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit) ;
+
+    const Vector3d& r = aContext.position ;
+    const double rNorm = aContext.positionNorm ;
+
+    // Point mass
+    Matrix3d jacobian = -mu_SI * (Matrix3d::Identity() / std::pow(rNorm, 3) - 3.0 * r * r.transpose() / std::pow(rNorm, 5)) ;
+
+    // J2, evaluated in the body fixed frame
+    const Real j2 = celestialObjectSPtr_->getJ2() ;
+
+    if (j2.isDefined() && (!j2.isZero()))
+    {
+
+        const Matrix3d dcm_GCRF_BODY = this->calculateRotationMatrix(aContext) ;
+
+        const Vector3d r_BODY = dcm_GCRF_BODY.transpose() * r ;
+        const double z = r_BODY.z() ;
+        const double equatorialRadius = celestialObjectSPtr_->getEquatorialRadius().inMeters() ;
+
+        const double r5 = std::pow(rNorm, -5) ;
+        const double r7 = std::pow(rNorm, -7) ;
+        const double r9 = std::pow(rNorm, -9) ;
+
+        // a_J2 = C * (f * r + 2 * z * r^-5 * e_z), with f = r^-5 - 5 * z^2 * r^-7
+        const double C = -1.5 * static_cast<double>(j2) * mu_SI * equatorialRadius * equatorialRadius ;
+        const double f = r5 - 5.0 * z * z * r7 ;
+        const Vector3d gradientF = r_BODY * (-5.0 * r7 + 35.0 * z * z * r9) - 10.0 * z * r7 * Vector3d::UnitZ() ;
+        const Vector3d gradientZR5 = Vector3d::UnitZ() * r5 - 5.0 * z * r7 * r_BODY ;
+
+        const Matrix3d jacobianJ2_BODY = C * (f * Matrix3d::Identity() + r_BODY * gradientF.transpose() + 2.0 * Vector3d::UnitZ() * gradientZR5.transpose()) ;
+
+        jacobian += dcm_GCRF_BODY * jacobianJ2_BODY * dcm_GCRF_BODY.transpose() ;
+
+    }
+
+    return jacobian ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Vector3d                        CentralBodyGravity::calculateBodyFixedAccelerationAt (   const   Vector3d&                   aBodyFixedPosition                          ) const
+{
+
+    if ((gravitySurrogateSPtr_ != nullptr) && gravitySurrogateSPtr_->contains(aBodyFixedPosition))
+    {
+
+        const Size referenceDegree = gravitySurrogateSPtr_->getReferenceDegree() ;
+
+        return sphericalHarmonicGravity_.getAccelerationAt(aBodyFixedPosition, referenceDegree, referenceDegree) + gravitySurrogateSPtr_->getAccelerationAt(aBodyFixedPosition) ;
+
+    }
+
+    return sphericalHarmonicGravity_.getAccelerationAt(aBodyFixedPosition) ;
+
+}
+
+Matrix3d                        CentralBodyGravity::calculateRotationMatrix (   const   ForceModel::Context&        aContext                                    ) const
+{
+
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    using ostk::physics::coord::Transform ;
+
+    const Shared<const Frame> bodyFrameSPtr = celestialObjectSPtr_->accessFrame() ;
+
+    if ((aContext.bodyFrameSPtr != nullptr) && ((*aContext.bodyFrameSPtr) == (*bodyFrameSPtr)))
+    {
+        return aContext.dcm_GCRF_BODY ;
+    }
+
+    const Quaternion q_GCRF_BODY = bodyFrameSPtr->getTransformTo(Frame::GCRF(), aContext.instant).getOrientation() ;
+
+    Matrix3d dcm_GCRF_BODY ;
+    dcm_GCRF_BODY.col(0) = q_GCRF_BODY * Vector3d::UnitX() ;
+    dcm_GCRF_BODY.col(1) = q_GCRF_BODY * Vector3d::UnitY() ;
+    dcm_GCRF_BODY.col(2) = q_GCRF_BODY * Vector3d::UnitZ() ;
+
+    return dcm_GCRF_BODY ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,360 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const double SolarRadiationPressureAtAstronomicalUnit = 4.56e-6 ; // [N/m^2]
+static const double AstronomicalUnit = 149597870700.0 ; // [m]
+
+static double                   ReflectivityAreaToMassRatioOf               (   const   SatelliteSystem&            aSatelliteSystem                            )
+{
+
+    if ((!aSatelliteSystem.isDefined()) || (!aSatelliteSystem.getReflectivityCoefficient().isDefined()))
+    {
+        return std::numeric_limits<double>::quiet_NaN() ;
+    }
+
+    return static_cast<double>(aSatelliteSystem.getReflectivityCoefficient() * aSatelliteSystem.getCrossSectionalSurfaceArea() / aSatelliteSystem.getMass().inKilograms()) ;
+
+}
+
+// Shadow functions of satellite positions (one per column), relative to the occulting body
+// The positions are processed as arrays, and every shadow case is evaluated then selected, so that the evaluation is vectorized over the positions
+
+template <class PositionsType>
+static Eigen::Array<double, 1, PositionsType::ColsAtCompileTime> ShadowFunctionsOf ( const Eigen::MatrixBase<PositionsType>& aPositions,
+                                                                                const   Vector3d&                   aSunPosition,
+                                                                                const   double                      anOccultingBodyRadius,
+                                                                                const   double                      aSunRadius,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       )
+{
+
+    typedef Eigen::Array<double, 1, PositionsType::ColsAtCompileTime> ShadowFunctionArray ;
+
+    switch (aShadowModel)
+    {
+
+        case SolarRadiationPressure::ShadowModel::NoShadow:
+            return ShadowFunctionArray::Ones(aPositions.cols()) ;
+
+        case SolarRadiationPressure::ShadowModel::Cylindrical:
+        {
+
+            // In umbra when behind the occulting body, within the cylinder of its radius along the Sun direction
+
+            const Vector3d sunDirection = aSunPosition.normalized() ;
+
+            const ShadowFunctionArray alongSunDistances = (sunDirection.transpose() * aPositions).array() ;
+            const ShadowFunctionArray acrossSunDistances = (aPositions - (sunDirection * alongSunDistances.matrix())).colwise().norm().array() ;
+
+            return 1.0 - ((alongSunDistances < 0.0) && (acrossSunDistances < anOccultingBodyRadius)).template cast<double>() ;
+
+        }
+
+        case SolarRadiationPressure::ShadowModel::Conical:
+        {
+
+            // Apparent radii of the Sun (a) and of the occulting body (b), and their apparent separation (c), seen from the satellite
+
+            const Eigen::Matrix<double, 3, PositionsType::ColsAtCompileTime> satelliteToSun = (-aPositions).colwise() + aSunPosition ;
+
+            const ShadowFunctionArray satelliteToSunDistances = satelliteToSun.colwise().norm().array() ;
+            const ShadowFunctionArray positionNorms = aPositions.colwise().norm().array() ;
+
+            const ShadowFunctionArray a = (aSunRadius / satelliteToSunDistances).min(1.0).asin() ;
+            const ShadowFunctionArray b = (anOccultingBodyRadius / positionNorms).min(1.0).asin() ;
+            const ShadowFunctionArray c = (-(aPositions.cwiseProduct(satelliteToSun)).colwise().sum().array() / (positionNorms * satelliteToSunDistances)).max(-1.0).min(1.0).acos().max(std::numeric_limits<double>::min()) ;
+
+            // Partial occultation: area of the overlap of two disks, clamped so that every case is evaluated without NaN
+
+            const ShadowFunctionArray x = ((c * c) + (a * a) - (b * b)) / (2.0 * c) ;
+            const ShadowFunctionArray y = ((a * a) - (x * x)).max(0.0).sqrt() ;
+
+            const ShadowFunctionArray overlapAreas = (a * a * (x / a).max(-1.0).min(1.0).acos())
+                                                   + (b * b * ((c - x) / b).max(-1.0).min(1.0).acos())
+                                                   - (c * y) ;
+
+            const ShadowFunctionArray penumbraShadowFunctions = 1.0 - (overlapAreas / (M_PI * a * a)) ;
+
+            // Total (b > a) or annular (a > b) occultation, when one disk lies within the other
+
+            const ShadowFunctionArray innerShadowFunctions = (1.0 - ((b * b) / (a * a))).max(0.0) ;
+
+            const ShadowFunctionArray shadowFunctions = (c >= (a + b)).select(ShadowFunctionArray::Ones(aPositions.cols()), (c <= (a - b).abs()).select(innerShadowFunctions, penumbraShadowFunctions)) ;
+
+            return shadowFunctions.max(0.0).min(1.0) ;
+
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Shadow model") ;
+
+    }
+
+    return ShadowFunctionArray::Ones(aPositions.cols()) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                SolarRadiationPressure::SolarRadiationPressure (   const   Shared<const Celestial>&    aSunSPtr,
+                                                                                const   Shared<const Celestial>&    anOccultingBodySPtr,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       )
+                                :   ForceModel("Solar Radiation Pressure"),
+                                    sunSPtr_(aSunSPtr),
+                                    occultingBodySPtr_(anOccultingBodySPtr),
+                                    reflectivityAreaToMassRatio_(ReflectivityAreaToMassRatioOf(aSatelliteSystem)),
+                                    sunRadius_(((aSunSPtr != nullptr) && aSunSPtr->isDefined()) ? static_cast<double>(aSunSPtr->getEquatorialRadius().inMeters()) : std::numeric_limits<double>::quiet_NaN()),
+                                    occultingBodyRadius_(((anOccultingBodySPtr != nullptr) && anOccultingBodySPtr->isDefined()) ? static_cast<double>(anOccultingBodySPtr->getEquatorialRadius().inMeters()) : std::numeric_limits<double>::quiet_NaN()),
+                                    shadowModel_(aShadowModel),
+                                    sunEphemerisCache_(EphemerisCache::Undefined()),
+                                    occultingBodyAtOrigin_(false),
+                                    occultingBodyEphemerisCache_(EphemerisCache::Undefined())
+{
+
+}
+
+                                SolarRadiationPressure::~SolarRadiationPressure ( )
+{
+
+}
+
+SolarRadiationPressure*         SolarRadiationPressure::clone               ( ) const
+{
+    return new SolarRadiationPressure(*this) ;
+}
+
+bool                            SolarRadiationPressure::operator ==         (   const   ForceModel&                 aForceModel                                 ) const
+{
+
+    const SolarRadiationPressure* solarRadiationPressurePtr = dynamic_cast<const SolarRadiationPressure*>(&aForceModel) ;
+
+    if ((solarRadiationPressurePtr == nullptr) || (!this->isDefined()) || (!solarRadiationPressurePtr->isDefined()))
+    {
+        return false ;
+    }
+
+    return (this->getName() == solarRadiationPressurePtr->getName())
+        && (sunSPtr_->getName() == solarRadiationPressurePtr->sunSPtr_->getName())
+        && (occultingBodySPtr_->getName() == solarRadiationPressurePtr->occultingBodySPtr_->getName())
+        && (reflectivityAreaToMassRatio_ == solarRadiationPressurePtr->reflectivityAreaToMassRatio_)
+        && (sunRadius_ == solarRadiationPressurePtr->sunRadius_)
+        && (occultingBodyRadius_ == solarRadiationPressurePtr->occultingBodyRadius_)
+        && (shadowModel_ == solarRadiationPressurePtr->shadowModel_) ;
+
+}
+
+bool                            SolarRadiationPressure::isDefined           ( ) const
+{
+    return std::isfinite(sunRadius_)
+        && std::isfinite(occultingBodyRadius_)
+        && std::isfinite(reflectivityAreaToMassRatio_) ;
+}
+
+SolarRadiationPressure::ShadowModel SolarRadiationPressure::getShadowModel  ( ) const
+{
+    return shadowModel_ ;
+}
+
+void                            SolarRadiationPressure::print               (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Solar Radiation Pressure") : void () ;
+
+    ForceModel::print(anOutputStream, false) ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Occulting Body:" << ((occultingBodySPtr_ != nullptr) ? occultingBodySPtr_->getName() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Reflectivity Area To Mass Ratio [m^2/kg]:" << reflectivityAreaToMassRatio_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Shadow Model:" << SolarRadiationPressure::StringFromShadowModel(shadowModel_) ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+double                          SolarRadiationPressure::calculateShadowFunctionAt (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Solar radiation pressure") ;
+    }
+
+    const Vector3d occultingBodyPosition = this->calculateOccultingBodyPosition(aContext) ;
+
+    return SolarRadiationPressure::ShadowFunction(aContext.position - occultingBodyPosition, this->calculateSunPosition(aContext) - occultingBodyPosition, occultingBodyRadius_, sunRadius_, shadowModel_) ;
+
+}
+
+Vector3d                        SolarRadiationPressure::calculateAccelerationAt (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Solar radiation pressure") ;
+    }
+
+    const Vector3d sunPosition = this->calculateSunPosition(aContext) ;
+
+    const Vector3d occultingBodyPosition = this->calculateOccultingBodyPosition(aContext) ;
+
+    const double shadowFunction = SolarRadiationPressure::ShadowFunction(aContext.position - occultingBodyPosition, sunPosition - occultingBodyPosition, occultingBodyRadius_, sunRadius_, shadowModel_) ;
+
+    const Vector3d satelliteToSun = sunPosition - aContext.position ;
+    const double satelliteToSunDistance = satelliteToSun.norm() ;
+
+    const double distanceRatio = AstronomicalUnit / satelliteToSunDistance ;
+
+    return (-shadowFunction * SolarRadiationPressureAtAstronomicalUnit * reflectivityAreaToMassRatio_ * distanceRatio * distanceRatio / satelliteToSunDistance) * satelliteToSun ;
+
+}
+
+double                          SolarRadiationPressure::ShadowFunction      (   const   Vector3d&                   aPosition,
+                                                                                const   Vector3d&                   aSunPosition,
+                                                                                const   double                      anOccultingBodyRadius,
+                                                                                const   double                      aSunRadius,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       )
+{
+    return ShadowFunctionsOf(aPosition, aSunPosition, anOccultingBodyRadius, aSunRadius, aShadowModel)[0] ;
+}
+
+VectorXd                        SolarRadiationPressure::ShadowFunctions     (   const   MatrixXd&                   aPositionArray,
+                                                                                const   Vector3d&                   aSunPosition,
+                                                                                const   double                      anOccultingBodyRadius,
+                                                                                const   double                      aSunRadius,
+                                                                                const   SolarRadiationPressure::ShadowModel& aShadowModel                       )
+{
+
+    if (aPositionArray.rows() != 3)
+    {
+        throw ostk::core::error::runtime::Wrong("Position array") ;
+    }
+
+    return ShadowFunctionsOf(aPositionArray, aSunPosition, anOccultingBodyRadius, aSunRadius, aShadowModel).transpose().matrix() ;
+
+}
+
+String                          SolarRadiationPressure::StringFromShadowModel (   const   SolarRadiationPressure::ShadowModel& aShadowModel                       )
+{
+
+    switch (aShadowModel)
+    {
+
+        case SolarRadiationPressure::ShadowModel::NoShadow:
+            return "NoShadow" ;
+
+        case SolarRadiationPressure::ShadowModel::Cylindrical:
+            return "Cylindrical" ;
+
+        case SolarRadiationPressure::ShadowModel::Conical:
+            return "Conical" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Shadow model") ;
+
+    }
+
+    return String::Empty() ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Vector3d                        SolarRadiationPressure::calculateSunPosition (  const   ForceModel::Context&        aContext                                    )
+{
+
+    if (aContext.sunPosition.allFinite())
+    {
+        return aContext.sunPosition ;
+    }
+
+    if (sunSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Sun") ;
+    }
+
+    if (!sunEphemerisCache_.isDefined())
+    {
+        sunEphemerisCache_ = { sunSPtr_->accessFrame(), Frame::GCRF(), aContext.instant } ;
+    }
+
+    return sunEphemerisCache_.getPositionAt(aContext.instant) ;
+
+}
+
+Vector3d                        SolarRadiationPressure::calculateOccultingBodyPosition ( const ForceModel::Context& aContext                                    )
+{
+
+    if (occultingBodyAtOrigin_)
+    {
+        return Vector3d::Zero() ;
+    }
+
+    if (!occultingBodyEphemerisCache_.isDefined())
+    {
+
+        if (occultingBodySPtr_ == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Occulting body") ;
+        }
+
+        // The central body lies at the GCRF origin at all times: its position is not cached
+
+        if (occultingBodySPtr_->accessFrame()->getOriginIn(Frame::GCRF(), aContext.instant).inMeters().getCoordinates().norm() < 1.0)
+        {
+
+            occultingBodyAtOrigin_ = true ;
+
+            return Vector3d::Zero() ;
+
+        }
+
+        occultingBodyEphemerisCache_ = { occultingBodySPtr_->accessFrame(), Frame::GCRF(), aContext.instant } ;
+
+    }
+
+    return occultingBodyEphemerisCache_.getPositionAt(aContext.instant) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/ThirdBodyGravity.hpp>
+
+#include <OpenSpaceToolkit/Physics/Units/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Length.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <cmath>
+
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace forcemodels
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::physics::units::Length ;
+using ostk::physics::units::Time ;
+using ostk::physics::units::Derived ;
+
+static const Derived::Unit GravitationalParameterSIUnit = Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                ThirdBodyGravity::ThirdBodyGravity          (   const   Shared<const Celestial>&    aCelestialObjectSPtr                        )
+                                :   ForceModel((aCelestialObjectSPtr != nullptr) ? (aCelestialObjectSPtr->getName() + " Gravity") : "Third Body Gravity"),
+                                    celestialObjectSPtr_(aCelestialObjectSPtr),
+                                    gravitationalParameter_SI_(((aCelestialObjectSPtr != nullptr) && aCelestialObjectSPtr->isDefined()) ? static_cast<double>(aCelestialObjectSPtr->getGravitationalParameter().in(GravitationalParameterSIUnit)) : std::numeric_limits<double>::quiet_NaN()),
+                                    isSun_((aCelestialObjectSPtr != nullptr) && (aCelestialObjectSPtr->getName() == "Sun")),
+                                    ephemerisCache_(EphemerisCache::Undefined())
+{
+
+}
+
+                                ThirdBodyGravity::~ThirdBodyGravity         ( )
+{
+
+}
+
+ThirdBodyGravity*               ThirdBodyGravity::clone                     ( ) const
+{
+    return new ThirdBodyGravity(*this) ;
+}
+
+bool                            ThirdBodyGravity::operator ==               (   const   ForceModel&                 aForceModel                                 ) const
+{
+
+    const ThirdBodyGravity* thirdBodyGravityPtr = dynamic_cast<const ThirdBodyGravity*>(&aForceModel) ;
+
+    if ((thirdBodyGravityPtr == nullptr) || (!this->isDefined()) || (!thirdBodyGravityPtr->isDefined()))
+    {
+        return false ;
+    }
+
+    return (this->getName() == thirdBodyGravityPtr->getName())
+        && (celestialObjectSPtr_->getName() == thirdBodyGravityPtr->celestialObjectSPtr_->getName())
+        && (gravitationalParameter_SI_ == thirdBodyGravityPtr->gravitationalParameter_SI_) ;
+
+}
+
+bool                            ThirdBodyGravity::isDefined                 ( ) const
+{
+    return (celestialObjectSPtr_ != nullptr) && celestialObjectSPtr_->isDefined() ;
+}
+
+Shared<const Celestial>         ThirdBodyGravity::getCelestialObject        ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Third body gravity") ;
+    }
+
+    return celestialObjectSPtr_ ;
+
+}
+
+void                            ThirdBodyGravity::print                     (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Third Body Gravity") : void () ;
+
+    ForceModel::print(anOutputStream, false) ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Celestial Object:" << ((celestialObjectSPtr_ != nullptr) ? celestialObjectSPtr_->getName() : "Undefined") ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+Vector3d                        ThirdBodyGravity::calculateAccelerationAt   (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Third body gravity") ;
+    }
+
+    const Vector3d thirdBodyPosition = this->calculateThirdBodyPosition(aContext) ;
+    const Vector3d relativePosition = thirdBodyPosition - aContext.position ;
+
+    return gravitationalParameter_SI_ * ((relativePosition / std::pow(relativePosition.norm(), 3)) - (thirdBodyPosition / std::pow(thirdBodyPosition.norm(), 3))) ;
+
+}
+
+Matrix3d                        ThirdBodyGravity::calculatePositionJacobianAt (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Third body gravity") ;
+    }
+
+    // The indirect term does not depend on the position
+    const Vector3d d = aContext.position - this->calculateThirdBodyPosition(aContext) ;
+    const double dNorm = d.norm() ;
+
+    return -gravitationalParameter_SI_ * (Matrix3d::Identity() / std::pow(dNorm, 3) - 3.0 * d * d.transpose() / std::pow(dNorm, 5)) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Vector3d                        ThirdBodyGravity::calculateThirdBodyPosition (   const   ForceModel::Context&        aContext                                    )
+{
+
+    if (isSun_ && aContext.sunPosition.allFinite())
+    {
+        return aContext.sunPosition ;
+    }
+
+    if (!ephemerisCache_.isDefined())
+    {
+        ephemerisCache_ = { celestialObjectSPtr_->accessFrame(), Frame::GCRF(), aContext.instant } ;
+    }
+
+    return ephemerisCache_.getPositionAt(aContext.instant) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
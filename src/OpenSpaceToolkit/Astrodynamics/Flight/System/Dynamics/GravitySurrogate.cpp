@@ -0,0 +1,608 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Binary file header, followed by the accelerations
+// The field parameters identify the field the table was generated from, its degree and order being equal
+
+struct GravitySurrogateFileHeader
+{
+
+    char                        magic[8] ;
+    double                      gravitationalParameter ;
+    double                      referenceRadius ;
+    std::uint64_t               degree ;
+    std::uint64_t               order ;
+    double                      accelerationTolerance ;
+    std::uint64_t               referenceDegree ;
+    std::uint64_t               radialCount ;
+    std::uint64_t               latitudeCount ;
+    double                      minimumRadius ;
+    double                      maximumRadius ;
+    double                      maximumError ;
+
+} ;
+
+static const char GravitySurrogateFileMagic[8] = { 'O', 'S', 'T', 'K', 'G', 'S', 'G', '2' } ;
+
+static_assert(sizeof(GravitySurrogateFileHeader) == 96, "Gravity surrogate file header must be 96 bytes.") ;
+
+// Disturbing acceleration of the field beyond the reference degree, the field being truncated as for a direct evaluation
+
+static Vector3d                 DisturbingAccelerationOf                    (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity,
+                                                                                const   Size                        aReferenceDegree,
+                                                                                const   Vector3d&                   aPosition                                   )
+{
+
+    const Size degree = std::max(aSphericalHarmonicGravity.getTruncationDegreeAt(aPosition.norm()), aReferenceDegree) ;
+
+    return aSphericalHarmonicGravity.getAccelerationAt(aPosition, degree, degree) - aSphericalHarmonicGravity.getAccelerationAt(aPosition, aReferenceDegree, aReferenceDegree) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                GravitySurrogate::GravitySurrogate          (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity,
+                                                                                const   Size                        aReferenceDegree,
+                                                                                const   double                      aMinimumRadius,
+                                                                                const   double                      aMaximumRadius,
+                                                                                const   double                      aRadialStep,
+                                                                                const   double                      anAngularStep                               )
+                                :   GravitySurrogate()
+{
+
+    if (!aSphericalHarmonicGravity.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    if (aReferenceDegree > aSphericalHarmonicGravity.getDegree())
+    {
+        throw ostk::core::error::runtime::Wrong("Reference degree") ;
+    }
+
+    if ((!(aMinimumRadius > 0.0)) || (!(aMaximumRadius > aMinimumRadius)))
+    {
+        throw ostk::core::error::runtime::Wrong("Radius") ;
+    }
+
+    if ((!(aRadialStep > 0.0)) || (!(anAngularStep > 0.0)) || (anAngularStep > 90.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Step") ;
+    }
+
+    gravitationalParameter_ = aSphericalHarmonicGravity.getGravitationalParameter() ;
+    referenceRadius_ = aSphericalHarmonicGravity.getReferenceRadius() ;
+    degree_ = aSphericalHarmonicGravity.getDegree() ;
+    accelerationTolerance_ = aSphericalHarmonicGravity.getAccelerationTolerance() ;
+
+    referenceDegree_ = aReferenceDegree ;
+    minimumRadius_ = aMinimumRadius ;
+    maximumRadius_ = aMaximumRadius ;
+
+    // Steps adjusted to span the shell and the sphere exactly
+
+    radialCount_ = static_cast<Size>(std::ceil((aMaximumRadius - aMinimumRadius) / aRadialStep)) + 1 ;
+    latitudeCount_ = static_cast<Size>(std::round(180.0 / anAngularStep)) + 1 ;
+    longitudeCount_ = 2 * (latitudeCount_ - 1) ;
+
+    radialStep_ = (aMaximumRadius - aMinimumRadius) / static_cast<double>(radialCount_ - 1) ;
+    angularStep_ = M_PI / static_cast<double>(latitudeCount_ - 1) ;
+
+    const Size nodeCount = radialCount_ * latitudeCount_ * longitudeCount_ ;
+
+    std::shared_ptr<float> accelerations(new float[3 * nodeCount], std::default_delete<float[]>()) ;
+
+    // Radial shells shared between threads, the spherical harmonic gravity being evaluated concurrently
+    // The first exception thrown stops the generation, and is rethrown on the calling thread once all threads are joined
+
+    std::atomic<Size> nextRadialIndex(0) ;
+    std::atomic<bool> failed(false) ;
+    std::exception_ptr exceptionPtr = nullptr ;
+    std::mutex exceptionMutex ;
+
+    const auto generateShell = [&, this] (const Size radialIndex) -> void
+    {
+
+        const double radius = minimumRadius_ + (static_cast<double>(radialIndex) * radialStep_) ;
+
+        for (Size latitudeIndex = 0 ; latitudeIndex < latitudeCount_ ; ++latitudeIndex)
+        {
+
+            const double latitude = (-M_PI / 2.0) + (static_cast<double>(latitudeIndex) * angularStep_) ;
+
+            for (Size longitudeIndex = 0 ; longitudeIndex < longitudeCount_ ; ++longitudeIndex)
+            {
+
+                const double longitude = -M_PI + (static_cast<double>(longitudeIndex) * angularStep_) ;
+
+                const Vector3d position = radius * Vector3d(std::cos(latitude) * std::cos(longitude), std::cos(latitude) * std::sin(longitude), std::sin(latitude)) ;
+                const Vector3d acceleration = DisturbingAccelerationOf(aSphericalHarmonicGravity, referenceDegree_, position) ;
+
+                float* node = accelerations.get() + (3 * (((radialIndex * latitudeCount_) + latitudeIndex) * longitudeCount_ + longitudeIndex)) ;
+
+                node[0] = static_cast<float>(acceleration.x()) ;
+                node[1] = static_cast<float>(acceleration.y()) ;
+                node[2] = static_cast<float>(acceleration.z()) ;
+
+            }
+
+        }
+
+    } ;
+
+    const auto generateShells = [&, this] ( ) -> void
+    {
+
+        try
+        {
+
+            for (Size radialIndex = nextRadialIndex++ ; (radialIndex < radialCount_) && (!failed) ; radialIndex = nextRadialIndex++)
+            {
+                generateShell(radialIndex) ;
+            }
+
+        }
+        catch (...)
+        {
+
+            const std::lock_guard<std::mutex> lock { exceptionMutex } ;
+
+            if (exceptionPtr == nullptr)
+            {
+                exceptionPtr = std::current_exception() ;
+            }
+
+            failed = true ;
+
+        }
+
+    } ;
+
+    const Size threadCount = std::max<Size>(1, std::min<Size>(std::thread::hardware_concurrency(), radialCount_)) ;
+
+    std::vector<std::thread> threads ;
+
+    try
+    {
+
+        for (Size threadIndex = 1 ; threadIndex < threadCount ; ++threadIndex)
+        {
+            threads.emplace_back(generateShells) ;
+        }
+
+    }
+    catch (...)
+    {
+
+        failed = true ;
+
+        for (auto& thread : threads)
+        {
+            thread.join() ;
+        }
+
+        throw ;
+
+    }
+
+    generateShells() ;
+
+    for (auto& thread : threads)
+    {
+        thread.join() ;
+    }
+
+    if (exceptionPtr != nullptr)
+    {
+        std::rethrow_exception(exceptionPtr) ;
+    }
+
+    accelerations_ = accelerations ;
+
+    // Interpolation error at the centers of a spread sample of cells, where multilinear interpolation errs the most
+
+    const Size cellCount = (radialCount_ - 1) * (latitudeCount_ - 1) * longitudeCount_ ;
+    const Size sampleCount = std::min<Size>(cellCount, 2000) ;
+
+    maximumError_ = 0.0 ;
+
+    for (Size sampleIndex = 0 ; sampleIndex < sampleCount ; ++sampleIndex)
+    {
+
+        const Size cellIndex = static_cast<Size>((static_cast<std::uint64_t>(sampleIndex) * 2654435761u) % cellCount) ;
+
+        const Size longitudeIndex = cellIndex % longitudeCount_ ;
+        const Size latitudeIndex = (cellIndex / longitudeCount_) % (latitudeCount_ - 1) ;
+        const Size radialIndex = cellIndex / (longitudeCount_ * (latitudeCount_ - 1)) ;
+
+        const double radius = minimumRadius_ + ((static_cast<double>(radialIndex) + 0.5) * radialStep_) ;
+        const double latitude = (-M_PI / 2.0) + ((static_cast<double>(latitudeIndex) + 0.5) * angularStep_) ;
+        const double longitude = -M_PI + ((static_cast<double>(longitudeIndex) + 0.5) * angularStep_) ;
+
+        const Vector3d position = radius * Vector3d(std::cos(latitude) * std::cos(longitude), std::cos(latitude) * std::sin(longitude), std::sin(latitude)) ;
+
+        const double error = (this->getAccelerationAt(position) - DisturbingAccelerationOf(aSphericalHarmonicGravity, referenceDegree_, position)).norm() ;
+
+        maximumError_ = std::max(maximumError_, error) ;
+
+    }
+
+}
+
+bool                            GravitySurrogate::isDefined                 ( ) const
+{
+    return accelerations_ != nullptr ;
+}
+
+Size                            GravitySurrogate::getReferenceDegree        ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    return referenceDegree_ ;
+
+}
+
+double                          GravitySurrogate::getMinimumRadius          ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    return minimumRadius_ ;
+
+}
+
+double                          GravitySurrogate::getMaximumRadius          ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    return maximumRadius_ ;
+
+}
+
+Size                            GravitySurrogate::getNodeCount              ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    return radialCount_ * latitudeCount_ * longitudeCount_ ;
+
+}
+
+double                          GravitySurrogate::getMaximumError           ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    return maximumError_ ;
+
+}
+
+bool                            GravitySurrogate::isCompatibleWith          (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    if (!aSphericalHarmonicGravity.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    // The parameters are stored as generated, they match exactly
+
+    return (gravitationalParameter_ == aSphericalHarmonicGravity.getGravitationalParameter())
+        && (referenceRadius_ == aSphericalHarmonicGravity.getReferenceRadius())
+        && (degree_ == aSphericalHarmonicGravity.getDegree())
+        && (accelerationTolerance_ == aSphericalHarmonicGravity.getAccelerationTolerance()) ;
+
+}
+
+bool                            GravitySurrogate::contains                  (   const   Vector3d&                   aPosition                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    const double radius = aPosition.norm() ;
+
+    return (radius >= minimumRadius_) && (radius <= maximumRadius_) ;
+
+}
+
+Vector3d                        GravitySurrogate::getAccelerationAt         (   const   Vector3d&                   aPosition                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    const double radius = aPosition.norm() ;
+
+    if ((!(radius >= minimumRadius_)) || (!(radius <= maximumRadius_)))
+    {
+        throw ostk::core::error::runtime::Wrong("Position") ;
+    }
+
+    const double latitude = std::atan2(aPosition.z(), std::hypot(aPosition.x(), aPosition.y())) ;
+    const double longitude = std::atan2(aPosition.y(), aPosition.x()) ;
+
+    // Cell and position within the cell, the last cell being closed on each side
+
+    const double radialCoordinate = (radius - minimumRadius_) / radialStep_ ;
+    const double latitudeCoordinate = (latitude + (M_PI / 2.0)) / angularStep_ ;
+    const double longitudeCoordinate = (longitude + M_PI) / angularStep_ ;
+
+    const Size radialIndex = std::min(static_cast<Size>(radialCoordinate), radialCount_ - 2) ;
+    const Size latitudeIndex = std::min(static_cast<Size>(latitudeCoordinate), latitudeCount_ - 2) ;
+    const Size longitudeIndex = std::min(static_cast<Size>(longitudeCoordinate), longitudeCount_ - 1) ;
+    const Size nextLongitudeIndex = (longitudeIndex + 1) % longitudeCount_ ;
+
+    const double radialWeight = radialCoordinate - static_cast<double>(radialIndex) ;
+    const double latitudeWeight = latitudeCoordinate - static_cast<double>(latitudeIndex) ;
+    const double longitudeWeight = longitudeCoordinate - static_cast<double>(longitudeIndex) ;
+
+    Vector3d acceleration = Vector3d::Zero() ;
+
+    for (Size radialOffset = 0 ; radialOffset < 2 ; ++radialOffset)
+    {
+
+        const double radialFactor = (radialOffset == 0) ? (1.0 - radialWeight) : radialWeight ;
+
+        for (Size latitudeOffset = 0 ; latitudeOffset < 2 ; ++latitudeOffset)
+        {
+
+            const double factor = radialFactor * ((latitudeOffset == 0) ? (1.0 - latitudeWeight) : latitudeWeight) ;
+
+            const float* row = accelerations_.get() + (3 * (((radialIndex + radialOffset) * latitudeCount_) + latitudeIndex + latitudeOffset) * longitudeCount_) ;
+
+            const float* node = row + (3 * longitudeIndex) ;
+            const float* nextNode = row + (3 * nextLongitudeIndex) ;
+
+            for (Size i = 0 ; i < 3 ; ++i)
+            {
+                acceleration[i] += factor * (((1.0 - longitudeWeight) * static_cast<double>(node[i])) + (longitudeWeight * static_cast<double>(nextNode[i]))) ;
+            }
+
+        }
+
+    }
+
+    return acceleration ;
+
+}
+
+void                            GravitySurrogate::save                      (   const   File&                       aFile                                       ) const
+{
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravity surrogate") ;
+    }
+
+    GravitySurrogateFileHeader header ;
+
+    std::memcpy(header.magic, GravitySurrogateFileMagic, sizeof(header.magic)) ;
+
+    header.gravitationalParameter = gravitationalParameter_ ;
+    header.referenceRadius = referenceRadius_ ;
+    header.degree = degree_ ;
+    header.order = degree_ ;
+    header.accelerationTolerance = accelerationTolerance_ ;
+    header.referenceDegree = referenceDegree_ ;
+    header.radialCount = radialCount_ ;
+    header.latitudeCount = latitudeCount_ ;
+    header.minimumRadius = minimumRadius_ ;
+    header.maximumRadius = maximumRadius_ ;
+    header.maximumError = maximumError_ ;
+
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc) ;
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString()) ;
+    }
+
+    fileStream.write(reinterpret_cast<const char*>(&header), sizeof(header)) ;
+    fileStream.write(reinterpret_cast<const char*>(accelerations_.get()), static_cast<std::streamsize>(3 * this->getNodeCount() * sizeof(float))) ;
+
+    if (!fileStream)
+    {
+        throw ostk::core::error::RuntimeError("Cannot write to file [{}].", aFile.toString()) ;
+    }
+
+}
+
+GravitySurrogate                GravitySurrogate::Undefined                 ( )
+{
+    return {} ;
+}
+
+GravitySurrogate                GravitySurrogate::Load                      (   const   File&                       aFile,
+                                                                                const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   )
+{
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File") ;
+    }
+
+    if (!aSphericalHarmonicGravity.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString()) ;
+    }
+
+    const int fileDescriptor = ::open(aFile.getPath().toString().c_str(), O_RDONLY) ;
+
+    if (fileDescriptor < 0)
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString()) ;
+    }
+
+    struct stat fileStatus ;
+
+    if ((::fstat(fileDescriptor, &fileStatus) != 0) || (static_cast<std::size_t>(fileStatus.st_size) < sizeof(GravitySurrogateFileHeader)))
+    {
+        ::close(fileDescriptor) ;
+        throw ostk::core::error::RuntimeError("Cannot read file [{}].", aFile.toString()) ;
+    }
+
+    const std::size_t mappingSize = static_cast<std::size_t>(fileStatus.st_size) ;
+
+    void* mapping = ::mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fileDescriptor, 0) ;
+
+    ::close(fileDescriptor) ;
+
+    if (mapping == MAP_FAILED)
+    {
+        throw ostk::core::error::RuntimeError("Cannot map file [{}].", aFile.toString()) ;
+    }
+
+    // The mapping is released with the last copy of the gravity surrogate
+
+    const std::shared_ptr<const char> mappingSPtr(static_cast<const char*>(mapping), [mappingSize] (const char* aMapping) { ::munmap(const_cast<char*>(aMapping), mappingSize) ; }) ;
+
+    GravitySurrogateFileHeader header ;
+
+    std::memcpy(&header, mappingSPtr.get(), sizeof(header)) ;
+
+    if ((std::memcmp(header.magic, GravitySurrogateFileMagic, sizeof(header.magic)) != 0) || (header.degree != header.order) || (header.referenceDegree > header.degree) || (header.radialCount < 2) || (header.latitudeCount < 3) || (!(header.maximumRadius > header.minimumRadius)))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is not a gravity surrogate.", aFile.toString()) ;
+    }
+
+    GravitySurrogate gravitySurrogate ;
+
+    gravitySurrogate.gravitationalParameter_ = header.gravitationalParameter ;
+    gravitySurrogate.referenceRadius_ = header.referenceRadius ;
+    gravitySurrogate.degree_ = static_cast<Size>(header.degree) ;
+    gravitySurrogate.accelerationTolerance_ = header.accelerationTolerance ;
+    gravitySurrogate.referenceDegree_ = static_cast<Size>(header.referenceDegree) ;
+    gravitySurrogate.minimumRadius_ = header.minimumRadius ;
+    gravitySurrogate.maximumRadius_ = header.maximumRadius ;
+    gravitySurrogate.radialCount_ = static_cast<Size>(header.radialCount) ;
+    gravitySurrogate.latitudeCount_ = static_cast<Size>(header.latitudeCount) ;
+    gravitySurrogate.longitudeCount_ = 2 * (gravitySurrogate.latitudeCount_ - 1) ;
+    gravitySurrogate.radialStep_ = (header.maximumRadius - header.minimumRadius) / static_cast<double>(gravitySurrogate.radialCount_ - 1) ;
+    gravitySurrogate.angularStep_ = M_PI / static_cast<double>(gravitySurrogate.latitudeCount_ - 1) ;
+    gravitySurrogate.maximumError_ = header.maximumError ;
+
+    if (mappingSize != (sizeof(header) + (3 * gravitySurrogate.radialCount_ * gravitySurrogate.latitudeCount_ * gravitySurrogate.longitudeCount_ * sizeof(float))))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is truncated.", aFile.toString()) ;
+    }
+
+    gravitySurrogate.accelerations_ = std::shared_ptr<const float>(mappingSPtr, reinterpret_cast<const float*>(mappingSPtr.get() + sizeof(header))) ;
+
+    if (!gravitySurrogate.isCompatibleWith(aSphericalHarmonicGravity))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] was not generated from the spherical harmonic gravity.", aFile.toString()) ;
+    }
+
+    return gravitySurrogate ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                GravitySurrogate::GravitySurrogate          ( )
+                                :   gravitationalParameter_(std::numeric_limits<double>::quiet_NaN()),
+                                    referenceRadius_(std::numeric_limits<double>::quiet_NaN()),
+                                    degree_(0),
+                                    accelerationTolerance_(std::numeric_limits<double>::quiet_NaN()),
+                                    referenceDegree_(0),
+                                    minimumRadius_(std::numeric_limits<double>::quiet_NaN()),
+                                    maximumRadius_(std::numeric_limits<double>::quiet_NaN()),
+                                    radialStep_(std::numeric_limits<double>::quiet_NaN()),
+                                    angularStep_(std::numeric_limits<double>::quiet_NaN()),
+                                    radialCount_(0),
+                                    latitudeCount_(0),
+                                    longitudeCount_(0),
+                                    maximumError_(std::numeric_limits<double>::quiet_NaN()),
+                                    accelerations_(nullptr)
+{
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
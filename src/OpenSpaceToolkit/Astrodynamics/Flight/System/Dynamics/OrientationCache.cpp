@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/OrientationCache.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/OrientationCache.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <Eigen/Geometry>
+
+#include <cmath>
+#include <limits>
+#include <iterator>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                OrientationCache::OrientationCache          (   const   Shared<const Frame>&        aFrameSPtr,
+                                                                                const   Shared<const Frame>&        aReferenceFrameSPtr,
+                                                                                const   Instant&                    anEpoch,
+                                                                                const   Duration&                   aSampleStep,
+                                                                                const   Size                        aCapacity                                   )
+                                :   frameSPtr_(aFrameSPtr),
+                                    referenceFrameSPtr_(aReferenceFrameSPtr),
+                                    epoch_(anEpoch),
+                                    sampleStep_(aSampleStep.isDefined() ? static_cast<double>(aSampleStep.inSeconds()) : std::numeric_limits<double>::quiet_NaN()),
+                                    capacity_(aCapacity),
+                                    samples_(),
+                                    lastIntervalIndex_(std::numeric_limits<std::int64_t>::min()),
+                                    lastIntervalStart_(),
+                                    lastIntervalEnd_()
+{
+
+    if (aSampleStep.isDefined() && (!(sampleStep_ > 0.0)))
+    {
+        throw ostk::core::error::runtime::Wrong("Sample step") ;
+    }
+
+    // Both samples bounding the queried interval are needed at once
+    if (capacity_ < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Capacity") ;
+    }
+
+}
+
+bool                            OrientationCache::isDefined                 ( ) const
+{
+    return (frameSPtr_ != nullptr) && (referenceFrameSPtr_ != nullptr) && epoch_.isDefined() && (sampleStep_ > 0.0) ;
+}
+
+Instant                         OrientationCache::getEpoch                  ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orientation cache") ;
+    }
+
+    return epoch_ ;
+
+}
+
+Size                            OrientationCache::getSampleCount            ( ) const
+{
+    return samples_.size() ;
+}
+
+Size                            OrientationCache::getCapacity               ( ) const
+{
+    return capacity_ ;
+}
+
+Matrix3d                        OrientationCache::getRotationMatrixAt       (   const   double                      aTime                                       )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orientation cache") ;
+    }
+
+    const std::int64_t intervalIndex = static_cast<std::int64_t>(std::floor(aTime / sampleStep_)) ;
+
+    if (intervalIndex != lastIntervalIndex_)
+    {
+
+        lastIntervalStart_ = this->accessSample(intervalIndex) ;
+        lastIntervalEnd_ = this->accessSample(intervalIndex + 1) ;
+
+        // Both quaternions in the same hemisphere, so that the shortest rotation is interpolated
+
+        if (lastIntervalStart_.orientation.dot(lastIntervalEnd_.orientation) < 0.0)
+        {
+            lastIntervalEnd_.orientation *= -1.0 ;
+            lastIntervalEnd_.orientationDerivative *= -1.0 ;
+        }
+
+        lastIntervalIndex_ = intervalIndex ;
+
+    }
+
+    // Cubic Hermite interpolation over the interval, on the time normalized to [0, 1]
+
+    const double tau = (aTime / sampleStep_) - static_cast<double>(intervalIndex) ;
+    const double tau2 = tau * tau ;
+    const double tau3 = tau2 * tau ;
+
+    const double h00 = (2.0 * tau3) - (3.0 * tau2) + 1.0 ;
+    const double h10 = (tau3 - (2.0 * tau2) + tau) * sampleStep_ ;
+    const double h01 = (3.0 * tau2) - (2.0 * tau3) ;
+    const double h11 = (tau3 - tau2) * sampleStep_ ;
+
+    const Vector4d orientation = (h00 * lastIntervalStart_.orientation) + (h10 * lastIntervalStart_.orientationDerivative) + (h01 * lastIntervalEnd_.orientation) + (h11 * lastIntervalEnd_.orientationDerivative) ;
+
+    return Eigen::Quaterniond(orientation[3], orientation[0], orientation[1], orientation[2]).normalized().toRotationMatrix() ;
+
+}
+
+Matrix3d                        OrientationCache::getRotationMatrixAt       (   const   Instant&                    anInstant                                   )
+{
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orientation cache") ;
+    }
+
+    return this->getRotationMatrixAt((anInstant - epoch_).inSeconds()) ;
+
+}
+
+void                            OrientationCache::clear                     ( )
+{
+
+    samples_.clear() ;
+
+    lastIntervalIndex_ = std::numeric_limits<std::int64_t>::min() ;
+
+}
+
+OrientationCache                OrientationCache::Undefined                 ( )
+{
+    return { nullptr, nullptr, Instant::Undefined(), Duration::Undefined() } ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const OrientationCache::Sample& OrientationCache::accessSample              (   const   std::int64_t                aSampleIndex                                )
+{
+
+    auto sampleIt = samples_.find(aSampleIndex) ;
+
+    if (sampleIt == samples_.end())
+    {
+
+        sampleIt = samples_.emplace(aSampleIndex, this->computeSample(aSampleIndex)).first ;
+
+        // Drop the sample farthest from the new one, which lies at either end of the map
+
+        if (samples_.size() > capacity_)
+        {
+
+            if ((aSampleIndex - samples_.begin()->first) > (samples_.rbegin()->first - aSampleIndex))
+            {
+                samples_.erase(samples_.begin()) ;
+            }
+            else
+            {
+                samples_.erase(std::prev(samples_.end())) ;
+            }
+
+        }
+
+    }
+
+    return sampleIt->second ;
+
+}
+
+OrientationCache::Sample        OrientationCache::computeSample             (   const   std::int64_t                aSampleIndex                                ) const
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    using ostk::physics::coord::Transform ;
+
+    const Transform transform_REF_FRAME = frameSPtr_->getTransformTo(referenceFrameSPtr_, epoch_ + Duration::Seconds(static_cast<double>(aSampleIndex) * sampleStep_)) ;
+
+    const Quaternion q_REF_FRAME = transform_REF_FRAME.getOrientation() ;
+    const Vector3d w_REF_FRAME_in_REF = transform_REF_FRAME.getAngularVelocity() ;
+
+    Matrix3d dcm_REF_FRAME ;
+    dcm_REF_FRAME.col(0) = q_REF_FRAME * Vector3d::UnitX() ;
+    dcm_REF_FRAME.col(1) = q_REF_FRAME * Vector3d::UnitY() ;
+    dcm_REF_FRAME.col(2) = q_REF_FRAME * Vector3d::UnitZ() ;
+
+    const Eigen::Quaterniond orientation(dcm_REF_FRAME) ;
+
+    // The frame axes rotate at -w_REF_FRAME in the reference frame, hence dq/dt = 0.5 * (-w_REF_FRAME_in_REF) * q
+
+    const Vector3d w_FRAME_REF_in_REF = -w_REF_FRAME_in_REF ;
+    const Eigen::Quaterniond orientationDerivative = Eigen::Quaterniond(0.0, w_FRAME_REF_in_REF.x(), w_FRAME_REF_in_REF.y(), w_FRAME_REF_in_REF.z()) * orientation ;
+
+    return { orientation.coeffs(), 0.5 * orientationDerivative.coeffs() } ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -12,6 +12,9 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <algorithm>
+#include <limits>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -27,33 +30,121 @@ namespace dynamics
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-using ostk::physics::units::Length ;
-using ostk::physics::units::Time ;
-using ostk::physics::units::Derived ;
+// The density is shared through the context when a single atmospheric drag model is present, several models may use different atmospheres
+
+static Shared<forcemodels::AtmosphericDrag> SharedDensityAtmosphericDrag    (   const   Array<Shared<ForceModel>>&  aForceModelArray                            )
+{
+
+    Shared<forcemodels::AtmosphericDrag> atmosphericDragSPtr = nullptr ;
+
+    for (const auto& forceModelSPtr : aForceModelArray)
+    {
+
+        if (const auto forceModelAtmosphericDragSPtr = std::dynamic_pointer_cast<forcemodels::AtmosphericDrag>(forceModelSPtr))
+        {
+
+            if (atmosphericDragSPtr != nullptr)
+            {
+                return nullptr ;
+            }
+
+            atmosphericDragSPtr = forceModelAtmosphericDragSPtr ;
+
+        }
+
+    }
+
+    return atmosphericDragSPtr ;
 
-static const Derived::Unit GravitationalParameterSIUnit = Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second) ;
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 SatelliteDynamics::SatelliteDynamics        (   const   Environment&                anEnvironment,
                                                                                 const   SatelliteSystem&            aSatelliteSystem                            )
+                                :   SatelliteDynamics(anEnvironment, aSatelliteSystem, Array<Shared<ForceModel>>::Empty())
+{
+
+    // Default force models: gravity of all the celestial objects of the environment
+
+    if (environmentSPtr_->isDefined())
+    {
+
+        for (const auto& objectName : environmentSPtr_->getObjectNames())
+        {
+
+            const auto celestialObjectSPtr = environmentSPtr_->accessCelestialObjectWithName(objectName) ;
+
+            if (objectName == "Earth")
+            {
+                forceModels_.add(std::make_shared<forcemodels::CentralBodyGravity>(celestialObjectSPtr)) ;
+            }
+            else
+            {
+                forceModels_.add(std::make_shared<forcemodels::ThirdBodyGravity>(celestialObjectSPtr)) ;
+            }
+
+        }
+
+    }
+
+}
+
+                                SatelliteDynamics::SatelliteDynamics        (   const   Environment&                anEnvironment,
+                                                                                const   SatelliteSystem&            aSatelliteSystem,
+                                                                                const   Array<Shared<ForceModel>>&  aForceModelArray                            )
                                 :   Dynamics(),
-                                    environment_(anEnvironment),
+                                    environmentSPtr_(std::make_shared<const Environment>(anEnvironment)),
                                     gcrfSPtr_(Frame::GCRF()),
                                     satelliteSystem_(aSatelliteSystem),
-                                    instant_(Instant::Undefined())
+                                    instant_(Instant::Undefined()),
+                                    forceModels_(Array<Shared<ForceModel>>::Empty()),
+                                    atmosphericDragSPtr_(nullptr),
+                                    cacheEpoch_(Instant::Undefined()),
+                                    cacheTimeOffset_(std::numeric_limits<double>::quiet_NaN()),
+                                    earthFrameSPtr_(nullptr),
+                                    earthOrientationCache_(OrientationCache::Undefined()),
+                                    sunEphemerisCache_(EphemerisCache::Undefined())
 {
 
+    for (const auto& forceModelSPtr : aForceModelArray)
+    {
+
+        if (forceModelSPtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Force model") ;
+        }
+
+        forceModels_.add(Shared<ForceModel>(forceModelSPtr->clone())) ;
+
+    }
+
+    atmosphericDragSPtr_ = SharedDensityAtmosphericDrag(forceModels_) ;
+
 }
 
                                 SatelliteDynamics::SatelliteDynamics        (   const   SatelliteDynamics&          aSatelliteDynamics                          )
                                 :   Dynamics(aSatelliteDynamics),
-                                    environment_(aSatelliteDynamics.environment_),
+                                    environmentSPtr_(aSatelliteDynamics.environmentSPtr_),
                                     gcrfSPtr_(aSatelliteDynamics.gcrfSPtr_),
                                     satelliteSystem_(aSatelliteDynamics.satelliteSystem_),
-                                    instant_(Instant::Undefined())
+                                    instant_(Instant::Undefined()),
+                                    forceModels_(Array<Shared<ForceModel>>::Empty()),
+                                    atmosphericDragSPtr_(nullptr),
+                                    cacheEpoch_(aSatelliteDynamics.cacheEpoch_),
+                                    cacheTimeOffset_(std::numeric_limits<double>::quiet_NaN()),
+                                    earthFrameSPtr_(aSatelliteDynamics.earthFrameSPtr_),
+                                    earthOrientationCache_(aSatelliteDynamics.earthOrientationCache_),
+                                    sunEphemerisCache_(aSatelliteDynamics.sunEphemerisCache_)
 {
 
+    for (const auto& forceModelSPtr : aSatelliteDynamics.forceModels_)
+    {
+        forceModels_.add(Shared<ForceModel>(forceModelSPtr->clone())) ;
+    }
+
+    atmosphericDragSPtr_ = SharedDensityAtmosphericDrag(forceModels_) ;
+
 }
 
                                 SatelliteDynamics::~SatelliteDynamics       ( )
@@ -74,9 +165,15 @@ bool                            SatelliteDynamics::operator ==              (
         return false ;
     }
 
-    return (environment_.getInstant() == aSatelliteDynamics.environment_.getInstant())
-        && (environment_.getObjectNames() == aSatelliteDynamics.environment_.getObjectNames())
-        && (satelliteSystem_ == aSatelliteDynamics.satelliteSystem_) ;
+    return (environmentSPtr_->getInstant() == aSatelliteDynamics.environmentSPtr_->getInstant())
+        && (environmentSPtr_->getObjectNames() == aSatelliteDynamics.environmentSPtr_->getObjectNames())
+        && (satelliteSystem_ == aSatelliteDynamics.satelliteSystem_)
+        && (forceModels_.getSize() == aSatelliteDynamics.forceModels_.getSize())
+        && std::equal(forceModels_.begin(), forceModels_.end(), aSatelliteDynamics.forceModels_.begin(),
+            [] (const Shared<ForceModel>& aForceModelSPtr, const Shared<ForceModel>& anotherForceModelSPtr) -> bool
+            {
+                return (*aForceModelSPtr) == (*anotherForceModelSPtr) ;
+            }) ;
 
 }
 
@@ -97,7 +194,7 @@ std::ostream&                   operator <<                                 (
 
 bool                            SatelliteDynamics::isDefined                ( ) const
 {
-    return environment_.isDefined() && satelliteSystem_.isDefined() ;
+    return environmentSPtr_->isDefined() && satelliteSystem_.isDefined() ;
 }
 
 void                            SatelliteDynamics::print                    (           std::ostream&               anOutputStream,
@@ -106,11 +203,18 @@ void                            SatelliteDynamics::print                    (
 
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Satellite Dynamics") : void () ;
 
-    ostk::core::utils::Print::Line(anOutputStream) << "Environment:" << environment_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Environment:" << (*environmentSPtr_) ;
 
     ostk::core::utils::Print::Separator(anOutputStream, "Satellite System") ;
     satelliteSystem_.print(anOutputStream, false) ;
 
+    ostk::core::utils::Print::Separator(anOutputStream, "Force Models") ;
+
+    for (const auto& forceModelSPtr : forceModels_)
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << forceModelSPtr->getName() ;
+    }
+
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
 
 }
@@ -120,9 +224,56 @@ Instant                         SatelliteDynamics::getInstant               ( )
     return instant_ ;
 }
 
+Array<Shared<const ForceModel>> SatelliteDynamics::getForceModels           ( ) const
+{
+
+    Array<Shared<const ForceModel>> forceModels = Array<Shared<const ForceModel>>::Empty() ;
+
+    for (const auto& forceModelSPtr : forceModels_)
+    {
+        forceModels.add(forceModelSPtr) ;
+    }
+
+    return forceModels ;
+
+}
+
 void                            SatelliteDynamics::setInstant               (   const   Instant&                    anInstant                                   )
 {
+
     this->instant_ = anInstant ;
+
+    if ((!anInstant.isDefined()) || (!environmentSPtr_->isDefined()))
+    {
+        return ;
+    }
+
+    // The caches are anchored at the first epoch, so that samples and segments computed by a propagation are reused by the next ones
+
+    if (!cacheEpoch_.isDefined())
+    {
+
+        for (const auto& objectName : environmentSPtr_->getObjectNames())
+        {
+
+            if (objectName == "Earth")
+            {
+                earthFrameSPtr_ = environmentSPtr_->accessCelestialObjectWithName(objectName)->accessFrame() ;
+                earthOrientationCache_ = { earthFrameSPtr_, gcrfSPtr_, anInstant } ;
+            }
+            else if (objectName == "Sun")
+            {
+                sunEphemerisCache_ = { environmentSPtr_->accessCelestialObjectWithName(objectName)->accessFrame(), gcrfSPtr_, anInstant } ;
+            }
+
+        }
+
+        cacheEpoch_ = anInstant ;
+
+    }
+
+    cacheTimeOffset_ = (anInstant - cacheEpoch_).inSeconds() ;
+
 }
 
 Dynamics::DynamicalEquationWrapper SatelliteDynamics::getDynamicalEquations ( )
@@ -142,6 +293,51 @@ Dynamics::DynamicalEquationWrapper SatelliteDynamics::getDynamicalEquations ( )
 
 }
 
+Dynamics::DynamicalEquationWrapper SatelliteDynamics::getSecondOrderDynamicalEquations ( )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SatelliteDynamics") ;
+    }
+
+    if (!this->instant_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant") ;
+    }
+
+    return std::bind(&SatelliteDynamics::SecondOrderDynamicalEquations, this, std::placeholders::_1,  std::placeholders::_2,  std::placeholders::_3) ;
+
+}
+
+Dynamics::DynamicalEquationWrapper SatelliteDynamics::getVariationalDynamicalEquations ( )
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SatelliteDynamics") ;
+    }
+
+    if (!this->instant_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant") ;
+    }
+
+    return std::bind(&SatelliteDynamics::VariationalDynamicalEquations, this, std::placeholders::_1,  std::placeholders::_2,  std::placeholders::_3) ;
+
+}
+
+SatelliteDynamics               SatelliteDynamics::Undefined                ( )
+{
+
+    using ostk::physics::units::Mass ;
+
+    const Composite satelliteGeometry = Composite { Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 1.0, 1.0 }) } ;
+
+    return { Environment::Undefined(), { Mass::Undefined(), satelliteGeometry, Matrix3d::Identity(), Real::Undefined(), Real::Undefined() } } ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void                            SatelliteDynamics::DynamicalEquations       (   const   Dynamics::StateVector&      x,
@@ -149,94 +345,162 @@ void                            SatelliteDynamics::DynamicalEquations       (
                                                                                 const   double                      t                                           )
 {
 
-    const Position currentPosition = Position::Meters({ x[0], x[1], x[2] }, gcrfSPtr_) ;
+    // Integrate velocity states
+    this->SecondOrderDynamicalEquations(x, dxdt, t) ;
+
+    // Integrate position states
+    dxdt[0] = x[3] ;
+    dxdt[1] = x[4] ;
+    dxdt[2] = x[5] ;
+
+}
+
+void                            SatelliteDynamics::SecondOrderDynamicalEquations (   const   Dynamics::StateVector&      x,
+                                                                                        Dynamics::StateVector&      dxdt,
+                                                                                const   double                      t                                           )
+{
+
+    const Vector3d acceleration = this->AccelerationAt(this->ContextAt(x, t)) ;
+
+    // Integrate velocity states
+    dxdt[3] = acceleration[0] ;
+    dxdt[4] = acceleration[1] ;
+    dxdt[5] = acceleration[2] ;
+
+}
+
+void                            SatelliteDynamics::VariationalDynamicalEquations (   const   Dynamics::StateVector&      x,
+                                                                                        Dynamics::StateVector&      dxdt,
+                                                                                const   double                      t                                           )
+{
+
+    using Matrix6d = Eigen::Matrix<double, 6, 6> ;
+
+    if ((x.size() != 42) || (dxdt.size() != 42))
+    {
+        throw ostk::core::error::runtime::Wrong("State vector size") ;
+    }
+
+    // Position and velocity derivatives, with the context shared by the partials
+
+    const ForceModel::Context context = this->ContextAt(x, t) ;
+
+    const Vector3d acceleration = this->AccelerationAt(context) ;
+
+    dxdt[0] = x[3] ;
+    dxdt[1] = x[4] ;
+    dxdt[2] = x[5] ;
+    dxdt[3] = acceleration[0] ;
+    dxdt[4] = acceleration[1] ;
+    dxdt[5] = acceleration[2] ;
+
+    // State transition matrix derivative: dPhi/dt = A * Phi, with A = [[0, I], [G, H]], G = da/dr and H = da/dv
+
+    const Matrix3d G = this->AccelerationJacobianAt(context) ;
+    const Matrix3d H = this->AccelerationVelocityJacobianAt(context) ;
+
+    const Eigen::Map<const Matrix6d> stateTransitionMatrix(x.data() + 6) ;
+    Eigen::Map<Matrix6d> stateTransitionMatrixDerivative(dxdt.data() + 6) ;
+
+    stateTransitionMatrixDerivative.topRows<3>() = stateTransitionMatrix.bottomRows<3>() ;
+    stateTransitionMatrixDerivative.bottomRows<3>().noalias() = G * stateTransitionMatrix.topRows<3>() ;
+    stateTransitionMatrixDerivative.bottomRows<3>().noalias() += H * stateTransitionMatrix.bottomRows<3>() ;
+
+}
+
+ForceModel::Context             SatelliteDynamics::ContextAt                (   const   Dynamics::StateVector&      x,
+                                                                                const   double                      t                                           )
+{
+
+    ForceModel::Context context ;
+
+    context.position = { x[0], x[1], x[2] } ;
+    context.velocity = { x[3], x[4], x[5] } ;
+    context.positionNorm = context.position.norm() ;
 
     // Check for radii below 70km altitude
-    if (currentPosition.getCoordinates().norm() < Earth::Models::EGM2008::EquatorialRadius.inMeters() + 70000.0)
+    if (context.positionNorm < Earth::Models::EGM2008::EquatorialRadius.inMeters() + 70000.0)
     {
         throw ostk::core::error::RuntimeError("Satellite altitude too low, has re-entered.") ;
     }
 
-    // Update environment time
-    const Instant currentInstant = instant_ + Duration::Seconds(t) ;
-    environment_.setInstant(currentInstant) ;
+    // The environment is shared between copies and left untouched, the instant is passed to the force models by the context
+    context.instant = instant_ + Duration::Seconds(t) ;
+
+    // Earth fixed position, from the cached Earth orientation
+    if (earthOrientationCache_.isDefined())
+    {
 
-    // Initialize gravitational acceleration vector
-    Vector3d totalGravitationalAcceleration_SI = { 0.0, 0.0, 0.0 } ;
+        context.bodyFrameSPtr = earthFrameSPtr_ ;
+        context.dcm_GCRF_BODY = earthOrientationCache_.getRotationMatrixAt(cacheTimeOffset_ + t) ;
+        context.bodyFixedPosition = context.dcm_GCRF_BODY.transpose() * context.position ;
 
-    // Access all objects in the environment and loop through them
-    for (const auto& objectName : environment_.getObjectNames())
+    }
+    else
     {
 
-        if (objectName != "Earth")
-        {
-            // Obtain 3rd body effect on center of Earth (origin in GCRF) aka 3rd body correction
-            const Vector gravitationalAcceleration3rdBodyCorrection = environment_.accessCelestialObjectWithName(objectName)->getGravitationalFieldAt(Position::Meters({ 0.0, 0.0, 0.0 }, gcrfSPtr_)) ;
+        context.bodyFrameSPtr = nullptr ;
+        context.dcm_GCRF_BODY = Matrix3d::Identity() ;
+        context.bodyFixedPosition = context.position ;
 
-            // Subtract 3rd body correct from total gravitational acceleration
-            totalGravitationalAcceleration_SI -= gravitationalAcceleration3rdBodyCorrection.inFrame(gcrfSPtr_, currentInstant).getValue() ;
-        }
+    }
 
-        // Obtain gravitational acceleration from current object
-        const Vector gravitationalAcceleration = environment_.accessCelestialObjectWithName(objectName)->getGravitationalFieldAt(currentPosition) ;
+    // Sun position, from the cached Sun ephemeris
+    context.sunPosition = sunEphemerisCache_.isDefined() ? sunEphemerisCache_.getPositionAt(cacheTimeOffset_ + t) : Vector3d::Constant(std::numeric_limits<double>::quiet_NaN()) ;
 
-        // Add object's gravity to total gravitational acceleration
-        totalGravitationalAcceleration_SI += gravitationalAcceleration.inFrame(gcrfSPtr_, currentInstant).getValue() ;
+    // Atmospheric density, evaluated once for the acceleration and the partials of the drag model
+    context.density = std::numeric_limits<double>::quiet_NaN() ;
 
+    if (atmosphericDragSPtr_ != nullptr)
+    {
+        context.density = atmosphericDragSPtr_->calculateDensityAt(context) ;
     }
 
-    // Integrate position and velocity states
-    dxdt[0] = x[3] ;
-    dxdt[1] = x[4] ;
-    dxdt[2] = x[5] ;
-    dxdt[3] = totalGravitationalAcceleration_SI[0] ;
-    dxdt[4] = totalGravitationalAcceleration_SI[1] ;
-    dxdt[5] = totalGravitationalAcceleration_SI[2] ;
-
-}
-
-// void                            SatelliteDynamics::Exponential_Dynamics
-//                                                                             (   const   SatelliteDynamics::StateVector&     x,
-//                                                                                         SatelliteDynamics::StateVector&     dxdt,
-//                                                                                 const   double                                                                  ) const
-// {
-//     // Find position magnitude
-//     const double positionMagnitude = std::sqrt(std::pow(x[0],2) + std::pow(x[1],2) + std::pow(x[2],2));
-
-//     // Integrate velocity states
-//     const double positionMagnitudeCubed = std::pow(positionMagnitude,3) ;
-
-//     // Access constants
-//     const double mu_SI = ((environment_.accessCelestialObjectWithName("Earth"))->getGravitationalParameter()).in(GravitationalParameterSIUnit) ;
-//     const double Re = ((environment_.accessCelestialObjectWithName("Earth"))->getEquatorialRadius()).inMeters() ;
-//     const double dragCoefficient = satelliteSystem_.getDragCoefficient() ;
-//     const double surfaceArea = satelliteSystem_.getCrossSectionalSurfaceArea() ;
-//     const double mass = satelliteSystem_.getMass().inKilograms() ;
-//     const Vector3d earthAngularVelocity = { 0, 0, 7.2921159e-5 } ; // rad/s
-//     const double rho0 = 6.967e-13 ; // kg/m^3
-//     const double h0 = 500000 ;
-//     const double H = 63822 ;
-
-//     // Calculate relative velocity to wind
-//     const Vector3d relativeVelocity = Vector3d({ x[3], x[4], x[5] }) - Vector3d({earthAngularVelocity.cross(Vector3d({ x[0], x[1], x[2] }))}) ;
-//     const double relativeVelocityMagnitude = std::sqrt(std::pow(relativeVelocity[0],2) + std::pow(relativeVelocity[1],2) + std::pow(relativeVelocity[2],2)) ;
-
-//     // Calculate density parameters
-//     const double hEllipse = positionMagnitude - Re ;
-//     const double rho = rho0 * std::exp( - (hEllipse - h0) / H ) ;
-
-//     // Calculate drag acceleration
-//     const Vector3d dragAcceleration = -0.5 * dragCoefficient * (surfaceArea / mass) * rho * relativeVelocityMagnitude * relativeVelocity ;
-
-//     // Integrate position and velocity states
-//     dxdt[0] = x[3] ;
-//     dxdt[1] = x[4] ;
-//     dxdt[2] = x[5] ;
-//     dxdt[3] = -(mu_SI / positionMagnitudeCubed) * x[0] + dragAcceleration[0] ;
-//     dxdt[4] = -(mu_SI / positionMagnitudeCubed) * x[1] + dragAcceleration[1] ;
-//     dxdt[5] = -(mu_SI / positionMagnitudeCubed) * x[2] + dragAcceleration[2] ;
-
-// }
+    return context ;
+
+}
+
+Vector3d                        SatelliteDynamics::AccelerationAt           (   const   ForceModel::Context&        aContext                                    )
+{
+
+    Vector3d acceleration = { 0.0, 0.0, 0.0 } ;
+
+    for (const auto& forceModelSPtr : forceModels_)
+    {
+        acceleration += forceModelSPtr->calculateAccelerationAt(aContext) ;
+    }
+
+    return acceleration ;
+
+}
+
+Matrix3d                        SatelliteDynamics::AccelerationJacobianAt   (   const   ForceModel::Context&        aContext                                    )
+{
+
+    Matrix3d jacobian = Matrix3d::Zero() ;
+
+    for (const auto& forceModelSPtr : forceModels_)
+    {
+        jacobian += forceModelSPtr->calculatePositionJacobianAt(aContext) ;
+    }
+
+    return jacobian ;
+
+}
+
+Matrix3d                        SatelliteDynamics::AccelerationVelocityJacobianAt ( const   ForceModel::Context&        aContext                                )
+{
+
+    Matrix3d jacobian = Matrix3d::Zero() ;
+
+    for (const auto& forceModelSPtr : forceModels_)
+    {
+        jacobian += forceModelSPtr->calculateVelocityJacobianAt(aContext) ;
+    }
+
+    return jacobian ;
+
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
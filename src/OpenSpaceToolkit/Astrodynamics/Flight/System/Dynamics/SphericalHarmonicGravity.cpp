@@ -0,0 +1,578 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                SphericalHarmonicGravity::SphericalHarmonicGravity (   const   double                      aGravitationalParameter,
+                                                                                const   double                      aReferenceRadius,
+                                                                                const   MatrixXd&                   aCosineCoefficients,
+                                                                                const   MatrixXd&                   aSineCoefficients,
+                                                                                const   double                      anAccelerationTolerance                     )
+                                :   gravitationalParameter_(aGravitationalParameter),
+                                    referenceRadius_(aReferenceRadius),
+                                    accelerationTolerance_(anAccelerationTolerance),
+                                    degree_(0),
+                                    degreeAmplitudes_(),
+                                    diagonalFactors_(),
+                                    verticalFactorsA_(),
+                                    verticalFactorsB_(),
+                                    upperOrderCosineCoefficients_(),
+                                    upperOrderSineCoefficients_(),
+                                    lowerOrderCosineCoefficients_(),
+                                    lowerOrderSineCoefficients_(),
+                                    sameOrderCosineCoefficients_(),
+                                    sameOrderSineCoefficients_()
+{
+
+    if ((aCosineCoefficients.size() == 0) && (aSineCoefficients.size() == 0))
+    {
+        return ;
+    }
+
+    if ((aCosineCoefficients.rows() != aCosineCoefficients.cols()) || (aSineCoefficients.rows() != aCosineCoefficients.rows()) || (aSineCoefficients.cols() != aCosineCoefficients.cols()))
+    {
+        throw ostk::core::error::runtime::Wrong("Coefficients") ;
+    }
+
+    if (!(aGravitationalParameter > 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Gravitational parameter") ;
+    }
+
+    if (!(aReferenceRadius > 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Reference radius") ;
+    }
+
+    if (!(anAccelerationTolerance >= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Acceleration tolerance") ;
+    }
+
+    degree_ = static_cast<Size>(aCosineCoefficients.rows() - 1) ;
+
+    // Coefficients stored as (m, n), so that the orders of a degree are contiguous. Only m <= n is used, the rest is zeroed.
+
+    MatrixXd cosineCoefficients = aCosineCoefficients.triangularView<Eigen::Lower>().toDenseMatrix().transpose() ;
+    MatrixXd sineCoefficients = aSineCoefficients.triangularView<Eigen::Lower>().toDenseMatrix().transpose() ;
+    sineCoefficients.row(0).setZero() ;
+
+    degreeAmplitudes_ = (cosineCoefficients.cwiseAbs2() + sineCoefficients.cwiseAbs2()).colwise().sum().cwiseSqrt().transpose() ;
+
+    // Recursion factors, up to degree + 1 (the accelerations of degree n involve V(n + 1, m) and V(n + 1, m +/- 1))
+
+    const Eigen::Index recursionSize = static_cast<Eigen::Index>(degree_) + 2 ;
+
+    diagonalFactors_ = VectorXd::Zero(recursionSize) ;
+    verticalFactorsA_ = MatrixXd::Zero(recursionSize, recursionSize) ;
+    verticalFactorsB_ = MatrixXd::Zero(recursionSize, recursionSize) ;
+
+    for (Eigen::Index m = 1 ; m < recursionSize ; ++m)
+    {
+        diagonalFactors_(m) = (m == 1) ? std::sqrt(3.0) : std::sqrt(static_cast<double>((2 * m) + 1) / static_cast<double>(2 * m)) ;
+    }
+
+    for (Eigen::Index m = 0 ; m < recursionSize ; ++m)
+    {
+
+        for (Eigen::Index n = m + 1 ; n < recursionSize ; ++n)
+        {
+
+            const double nd = static_cast<double>(n) ;
+            const double md = static_cast<double>(m) ;
+
+            verticalFactorsA_(m, n) = std::sqrt(((2.0 * nd) + 1.0) * ((2.0 * nd) - 1.0) / ((nd - md) * (nd + md))) ;
+
+            if (n >= (m + 2))
+            {
+                verticalFactorsB_(m, n) = std::sqrt(((2.0 * nd) + 1.0) * (nd + md - 1.0) * (nd - md - 1.0) / ((nd - md) * (nd + md) * ((2.0 * nd) - 3.0))) ;
+            }
+
+        }
+
+    }
+
+    // Acceleration factors, from the ratios of the normalization of the coefficients to that of V(n + 1, .)
+
+    const Eigen::Index coefficientSize = static_cast<Eigen::Index>(degree_) + 1 ;
+
+    MatrixXd upperOrderFactors = MatrixXd::Zero(coefficientSize, coefficientSize) ;
+    MatrixXd lowerOrderFactors = MatrixXd::Zero(coefficientSize, coefficientSize) ;
+    MatrixXd sameOrderFactors = MatrixXd::Zero(coefficientSize, coefficientSize) ;
+
+    for (Eigen::Index m = 0 ; m < coefficientSize ; ++m)
+    {
+
+        for (Eigen::Index n = m ; n < coefficientSize ; ++n)
+        {
+
+            const double nd = static_cast<double>(n) ;
+            const double md = static_cast<double>(m) ;
+
+            if (m == 0)
+            {
+                upperOrderFactors(m, n) = std::sqrt(((2.0 * nd) + 1.0) * (nd + 2.0) * (nd + 1.0) / (2.0 * ((2.0 * nd) + 3.0))) ;
+            }
+            else
+            {
+
+                const double lowerOrderNormalization = (m == 1) ? 1.0 : 2.0 ;
+
+                upperOrderFactors(m, n) = 0.5 * std::sqrt(((2.0 * nd) + 1.0) * (nd + md + 2.0) * (nd + md + 1.0) / ((2.0 * nd) + 3.0)) ;
+                lowerOrderFactors(m, n) = 0.5 * std::sqrt(2.0 * ((2.0 * nd) + 1.0) * (nd - md + 2.0) * (nd - md + 1.0) / (lowerOrderNormalization * ((2.0 * nd) + 3.0))) ;
+
+            }
+
+            sameOrderFactors(m, n) = std::sqrt(((2.0 * nd) + 1.0) * (nd + md + 1.0) * (nd - md + 1.0) / ((2.0 * nd) + 3.0)) ;
+
+        }
+
+    }
+
+    // Factors folded into the coefficients, the V(n + 1, m - 1) terms being shifted by one order so that all the sums start at the first row
+
+    upperOrderCosineCoefficients_ = upperOrderFactors.cwiseProduct(cosineCoefficients) ;
+    upperOrderSineCoefficients_ = upperOrderFactors.cwiseProduct(sineCoefficients) ;
+
+    lowerOrderCosineCoefficients_ = MatrixXd::Zero(coefficientSize, coefficientSize) ;
+    lowerOrderSineCoefficients_ = MatrixXd::Zero(coefficientSize, coefficientSize) ;
+
+    lowerOrderCosineCoefficients_.topRows(coefficientSize - 1) = lowerOrderFactors.bottomRows(coefficientSize - 1).cwiseProduct(cosineCoefficients.bottomRows(coefficientSize - 1)) ;
+    lowerOrderSineCoefficients_.topRows(coefficientSize - 1) = lowerOrderFactors.bottomRows(coefficientSize - 1).cwiseProduct(sineCoefficients.bottomRows(coefficientSize - 1)) ;
+
+    sameOrderCosineCoefficients_ = sameOrderFactors.cwiseProduct(cosineCoefficients) ;
+    sameOrderSineCoefficients_ = sameOrderFactors.cwiseProduct(sineCoefficients) ;
+
+}
+
+bool                            SphericalHarmonicGravity::operator ==       (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) const
+{
+
+    if ((!this->isDefined()) || (!aSphericalHarmonicGravity.isDefined()))
+    {
+        return false ;
+    }
+
+    // The scaled coefficients follow from the coefficients and the degree
+
+    return (gravitationalParameter_ == aSphericalHarmonicGravity.gravitationalParameter_)
+        && (referenceRadius_ == aSphericalHarmonicGravity.referenceRadius_)
+        && (accelerationTolerance_ == aSphericalHarmonicGravity.accelerationTolerance_)
+        && (degree_ == aSphericalHarmonicGravity.degree_)
+        && (sameOrderCosineCoefficients_ == aSphericalHarmonicGravity.sameOrderCosineCoefficients_)
+        && (sameOrderSineCoefficients_ == aSphericalHarmonicGravity.sameOrderSineCoefficients_) ;
+
+}
+
+bool                            SphericalHarmonicGravity::operator !=       (   const   SphericalHarmonicGravity&   aSphericalHarmonicGravity                   ) const
+{
+    return !((*this) == aSphericalHarmonicGravity) ;
+}
+
+bool                            SphericalHarmonicGravity::isDefined         ( ) const
+{
+    return (gravitationalParameter_ > 0.0) && (referenceRadius_ > 0.0) && (sameOrderCosineCoefficients_.size() > 0) ;
+}
+
+double                          SphericalHarmonicGravity::getGravitationalParameter ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    return gravitationalParameter_ ;
+
+}
+
+double                          SphericalHarmonicGravity::getReferenceRadius ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    return referenceRadius_ ;
+
+}
+
+Size                            SphericalHarmonicGravity::getDegree         ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    return degree_ ;
+
+}
+
+double                          SphericalHarmonicGravity::getAccelerationTolerance ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    return accelerationTolerance_ ;
+
+}
+
+Size                            SphericalHarmonicGravity::getTruncationDegreeAt (   const   double                      aDistance                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    if (!(aDistance > 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Distance") ;
+    }
+
+    // Estimated magnitudes of the terms of each degree, summed from the highest degree down until the target error is reached
+
+    const double radiusRatio = referenceRadius_ / aDistance ;
+    const double centralAcceleration = gravitationalParameter_ / (aDistance * aDistance) ;
+
+    double radiusRatioPower = std::pow(radiusRatio, static_cast<double>(degree_)) ;
+    double remainder = 0.0 ;
+
+    for (Size n = degree_ ; n > 0 ; --n)
+    {
+
+        remainder += centralAcceleration * static_cast<double>(n + 1) * radiusRatioPower * degreeAmplitudes_(n) ;
+
+        if (remainder > accelerationTolerance_)
+        {
+            return n ;
+        }
+
+        radiusRatioPower /= radiusRatio ;
+
+    }
+
+    return 0 ;
+
+}
+
+Vector3d                        SphericalHarmonicGravity::getAccelerationAt (   const   Vector3d&                   aPosition                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    const Size truncationDegree = this->getTruncationDegreeAt(aPosition.norm()) ;
+
+    return this->getAccelerationAt(aPosition, truncationDegree, truncationDegree) ;
+
+}
+
+Vector3d                        SphericalHarmonicGravity::getAccelerationAt (   const   Vector3d&                   aPosition,
+                                                                                const   Size                        aDegree,
+                                                                                const   Size                        anOrder                                     ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonic gravity") ;
+    }
+
+    if ((aDegree > degree_) || (anOrder > aDegree))
+    {
+        throw ostk::core::error::runtime::Wrong("Degree or order") ;
+    }
+
+    const double r2 = aPosition.squaredNorm() ;
+
+    if (!(r2 > 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Position") ;
+    }
+
+    const Eigen::Index degree = static_cast<Eigen::Index>(aDegree) ;
+    const Eigen::Index order = static_cast<Eigen::Index>(anOrder) ;
+
+    // Normalized V(n, m) and W(n, m) stored as (m, n), in per thread buffers to avoid an allocation per call
+
+    thread_local MatrixXd V ;
+    thread_local MatrixXd W ;
+
+    if ((V.rows() < (order + 2)) || (V.cols() < (degree + 2)))
+    {
+        V.resize(order + 2, degree + 2) ;
+        W.resize(order + 2, degree + 2) ;
+    }
+
+    const double x0 = aPosition.x() * referenceRadius_ / r2 ;
+    const double y0 = aPosition.y() * referenceRadius_ / r2 ;
+    const double z0 = aPosition.z() * referenceRadius_ / r2 ;
+    const double rho = referenceRadius_ * referenceRadius_ / r2 ;
+
+    V(0, 0) = referenceRadius_ / std::sqrt(r2) ;
+    W(0, 0) = 0.0 ;
+
+    // Recursion degree by degree, each degree being computed for all the orders at once (m <= n - 2), then for m = n - 1 and m = n
+
+    for (Eigen::Index n = 1 ; n <= (degree + 1) ; ++n)
+    {
+
+        if (n >= 2)
+        {
+
+            const Eigen::Index count = std::min(n - 1, order + 2) ;
+
+            const auto A = verticalFactorsA_.col(n).head(count) ;
+            const auto B = verticalFactorsB_.col(n).head(count) ;
+
+            V.col(n).head(count) = (z0 * A.cwiseProduct(V.col(n - 1).head(count))) - (rho * B.cwiseProduct(V.col(n - 2).head(count))) ;
+            W.col(n).head(count) = (z0 * A.cwiseProduct(W.col(n - 1).head(count))) - (rho * B.cwiseProduct(W.col(n - 2).head(count))) ;
+
+        }
+
+        if (n <= (order + 2))
+        {
+            V(n - 1, n) = verticalFactorsA_(n - 1, n) * z0 * V(n - 1, n - 1) ;
+            W(n - 1, n) = verticalFactorsA_(n - 1, n) * z0 * W(n - 1, n - 1) ;
+        }
+
+        if (n <= (order + 1))
+        {
+            V(n, n) = diagonalFactors_(n) * ((x0 * V(n - 1, n - 1)) - (y0 * W(n - 1, n - 1))) ;
+            W(n, n) = diagonalFactors_(n) * ((x0 * W(n - 1, n - 1)) + (y0 * V(n - 1, n - 1))) ;
+        }
+
+    }
+
+    // Sums over the orders of each degree, on contiguous segments of the columns
+
+    double ax = 0.0 ;
+    double ay = 0.0 ;
+    double az = 0.0 ;
+
+    for (Eigen::Index n = 0 ; n <= degree ; ++n)
+    {
+
+        const Eigen::Index count = std::min(n, order) + 1 ;
+
+        const auto upperC = upperOrderCosineCoefficients_.col(n).head(count) ;
+        const auto upperS = upperOrderSineCoefficients_.col(n).head(count) ;
+        const auto sameC = sameOrderCosineCoefficients_.col(n).head(count) ;
+        const auto sameS = sameOrderSineCoefficients_.col(n).head(count) ;
+
+        const auto Vupper = V.col(n + 1).segment(1, count) ;
+        const auto Wupper = W.col(n + 1).segment(1, count) ;
+        const auto Vsame = V.col(n + 1).head(count) ;
+        const auto Wsame = W.col(n + 1).head(count) ;
+
+        ax -= upperC.dot(Vupper) + upperS.dot(Wupper) ;
+        ay -= upperC.dot(Wupper) - upperS.dot(Vupper) ;
+        az -= sameC.dot(Vsame) + sameS.dot(Wsame) ;
+
+        if (count > 1)
+        {
+
+            const auto lowerC = lowerOrderCosineCoefficients_.col(n).head(count - 1) ;
+            const auto lowerS = lowerOrderSineCoefficients_.col(n).head(count - 1) ;
+
+            const auto Vlower = V.col(n + 1).head(count - 1) ;
+            const auto Wlower = W.col(n + 1).head(count - 1) ;
+
+            ax += lowerC.dot(Vlower) + lowerS.dot(Wlower) ;
+            ay += lowerS.dot(Vlower) - lowerC.dot(Wlower) ;
+
+        }
+
+    }
+
+    return (gravitationalParameter_ / (referenceRadius_ * referenceRadius_)) * Vector3d(ax, ay, az) ;
+
+}
+
+SphericalHarmonicGravity        SphericalHarmonicGravity::Undefined         ( )
+{
+    return { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), MatrixXd(), MatrixXd() } ;
+}
+
+SphericalHarmonicGravity        SphericalHarmonicGravity::Load              (   const   File&                       aFile,
+                                                                                const   Size                        aMaximumDegree,
+                                                                                const   double                      anAccelerationTolerance                     )
+{
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File") ;
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString()) ;
+    }
+
+    // Numbers may have Fortran double precision exponents (e.g. 1.0D-06)
+
+    const auto readNumber = [] (std::istringstream& aLineStream, double& aNumber) -> bool
+    {
+
+        std::string token ;
+
+        if (!(aLineStream >> token))
+        {
+            return false ;
+        }
+
+        std::replace(token.begin(), token.end(), 'D', 'E') ;
+        std::replace(token.begin(), token.end(), 'd', 'e') ;
+
+        std::istringstream tokenStream(token) ;
+
+        return static_cast<bool>(tokenStream >> aNumber) ;
+
+    } ;
+
+    std::istringstream contentsStream(aFile.getContents()) ;
+    std::string line ;
+
+    double gravitationalParameter = std::numeric_limits<double>::quiet_NaN() ;
+    double referenceRadius = std::numeric_limits<double>::quiet_NaN() ;
+    Size fileDegree = 0 ;
+    bool isNormalized = true ;
+    bool isHeaderRead = false ;
+
+    while (std::getline(contentsStream, line))
+    {
+
+        std::istringstream lineStream(line) ;
+        std::string keyword ;
+
+        if (!(lineStream >> keyword))
+        {
+            continue ;
+        }
+
+        if (keyword == "end_of_head")
+        {
+            isHeaderRead = true ;
+            break ;
+        }
+        else if (keyword == "earth_gravity_constant")
+        {
+            readNumber(lineStream, gravitationalParameter) ;
+        }
+        else if (keyword == "radius")
+        {
+            readNumber(lineStream, referenceRadius) ;
+        }
+        else if (keyword == "max_degree")
+        {
+            lineStream >> fileDegree ;
+        }
+        else if (keyword == "norm")
+        {
+
+            std::string norm ;
+            lineStream >> norm ;
+
+            isNormalized = (norm != "unnormalized") ;
+
+        }
+
+    }
+
+    if (!isHeaderRead)
+    {
+        throw ostk::core::error::RuntimeError("Cannot read header of file [{}].", aFile.toString()) ;
+    }
+
+    if (!(gravitationalParameter > 0.0) || !(referenceRadius > 0.0) || (fileDegree == 0))
+    {
+        throw ostk::core::error::RuntimeError("Cannot read gravitational parameter, reference radius or maximum degree of file [{}].", aFile.toString()) ;
+    }
+
+    if (!isNormalized)
+    {
+        throw ostk::core::error::RuntimeError("Coefficients of file [{}] are not fully normalized.", aFile.toString()) ;
+    }
+
+    const Eigen::Index degree = static_cast<Eigen::Index>(std::min(aMaximumDegree, fileDegree)) ;
+
+    MatrixXd cosineCoefficients = MatrixXd::Zero(degree + 1, degree + 1) ;
+    MatrixXd sineCoefficients = MatrixXd::Zero(degree + 1, degree + 1) ;
+
+    while (std::getline(contentsStream, line))
+    {
+
+        std::istringstream lineStream(line) ;
+        std::string keyword ;
+
+        if (!(lineStream >> keyword) || (keyword != "gfc"))
+        {
+            continue ;
+        }
+
+        Eigen::Index n ;
+        Eigen::Index m ;
+        double C = 0.0 ;
+        double S = 0.0 ;
+
+        if (!(lineStream >> n >> m) || !readNumber(lineStream, C) || !readNumber(lineStream, S) || (m < 0) || (m > n))
+        {
+            throw ostk::core::error::RuntimeError("Cannot read coefficient line [{}].", line) ;
+        }
+
+        if (n <= degree)
+        {
+            cosineCoefficients(n, m) = C ;
+            sineCoefficients(n, m) = S ;
+        }
+
+    }
+
+    return { gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients, anAccelerationTolerance } ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/ExponentialDrag.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/ExponentialDrag.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace terms
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                ExponentialDrag::ExponentialDrag            (   const   double                      aBallisticCoefficient,
+                                                                                const   double                      anEquatorialRadius,
+                                                                                const   double                      aFlattening,
+                                                                                const   double                      aRotationRate,
+                                                                                const   ExponentialAtmosphere&      anAtmosphere,
+                                                                                const   double                      aMinimumAltitude                            )
+                                :   ballisticCoefficient_(aBallisticCoefficient),
+                                    equatorialRadius_(anEquatorialRadius),
+                                    flattening_(aFlattening),
+                                    rotationRate_(aRotationRate),
+                                    atmosphere_(anAtmosphere),
+                                    minimumAltitude_(aMinimumAltitude)
+{
+
+}
+
+bool                            ExponentialDrag::isDefined                  ( ) const
+{
+    return std::isfinite(ballisticCoefficient_) && (ballisticCoefficient_ >= 0.0)
+        && std::isfinite(equatorialRadius_) && (equatorialRadius_ > 0.0)
+        && std::isfinite(flattening_)
+        && std::isfinite(rotationRate_)
+        && atmosphere_.isDefined()
+        && std::isfinite(minimumAltitude_) ;
+}
+
+double                          ExponentialDrag::getBallisticCoefficient    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Exponential drag") ;
+    }
+
+    return ballisticCoefficient_ ;
+
+}
+
+void                            ExponentialDrag::print                      (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Exponential Drag") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Drag Ballistic Coefficient [m^2/kg]:" << ballisticCoefficient_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Drag Equatorial Radius [m]:" << equatorialRadius_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Drag Flattening:" << flattening_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Drag Rotation Rate [rad/s]:" << rotationRate_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Drag Atmosphere Band Count:" << (atmosphere_.isDefined() ? atmosphere_.getBandCount() : 0) ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Drag Minimum Altitude [m]:" << minimumAltitude_ ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/J2Gravity.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/Terms/J2Gravity.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace flight
+{
+namespace system
+{
+namespace dynamics
+{
+namespace terms
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                J2Gravity::J2Gravity                        (   const   double                      aGravitationalParameter,
+                                                                                const   double                      anEquatorialRadius,
+                                                                                const   double                      aJ2                                         )
+                                :   gravitationalParameter_(aGravitationalParameter),
+                                    equatorialRadius_(anEquatorialRadius),
+                                    j2_(aJ2),
+                                    factor_(-1.5 * aGravitationalParameter * aJ2 * anEquatorialRadius * anEquatorialRadius)
+{
+
+}
+
+bool                            J2Gravity::isDefined                        ( ) const
+{
+    return std::isfinite(gravitationalParameter_) && (gravitationalParameter_ > 0.0)
+        && std::isfinite(equatorialRadius_) && (equatorialRadius_ > 0.0)
+        && std::isfinite(j2_) ;
+}
+
+double                          J2Gravity::getGravitationalParameter        ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("J2 gravity") ;
+    }
+
+    return gravitationalParameter_ ;
+
+}
+
+double                          J2Gravity::getEquatorialRadius              ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("J2 gravity") ;
+    }
+
+    return equatorialRadius_ ;
+
+}
+
+double                          J2Gravity::getJ2                            ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("J2 gravity") ;
+    }
+
+    return j2_ ;
+
+}
+
+void                            J2Gravity::print                            (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "J2 Gravity") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "J2 Gravitational Parameter [m^3/s^2]:" << gravitationalParameter_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "J2 Equatorial Radius [m]:" << equatorialRadius_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "J2:" << j2_ ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,11 +29,13 @@ namespace system
                                                                                 const   Composite&                  aSatelliteGeometry,
                                                                                 const   Matrix3d&                   anInertiaTensor,
                                                                                 const   Real&                       aCrossSectionalSurfaceArea,
-                                                                                const   Real&                       aDragCoefficient                            )
+                                                                                const   Real&                       aDragCoefficient,
+                                                                                const   Real&                       aReflectivityCoefficient                    )
                                 :   System(aMass, aSatelliteGeometry),
                                     inertiaTensor_(anInertiaTensor),
                                     crossSectionalSurfaceArea_(aCrossSectionalSurfaceArea),
-                                    dragCoefficient_(aDragCoefficient)
+                                    dragCoefficient_(aDragCoefficient),
+                                    reflectivityCoefficient_(aReflectivityCoefficient)
 {
 
 }
@@ -42,7 +44,8 @@ namespace system
                                 :   System(aSatelliteSystem),
                                     inertiaTensor_(aSatelliteSystem.inertiaTensor_),
                                     crossSectionalSurfaceArea_(aSatelliteSystem.crossSectionalSurfaceArea_),
-                                    dragCoefficient_(aSatelliteSystem.dragCoefficient_)
+                                    dragCoefficient_(aSatelliteSystem.dragCoefficient_),
+                                    reflectivityCoefficient_(aSatelliteSystem.reflectivityCoefficient_)
 {
 
 }
@@ -69,7 +72,8 @@ bool                            SatelliteSystem::operator ==                (
     return (System::operator == (aSatelliteSystem))
         && (inertiaTensor_ == aSatelliteSystem.inertiaTensor_)
         && (crossSectionalSurfaceArea_ == aSatelliteSystem.crossSectionalSurfaceArea_)
-        && (dragCoefficient_ == aSatelliteSystem.dragCoefficient_) ;
+        && (dragCoefficient_ == aSatelliteSystem.dragCoefficient_)
+        && ((reflectivityCoefficient_.isDefined() && aSatelliteSystem.reflectivityCoefficient_.isDefined()) ? (reflectivityCoefficient_ == aSatelliteSystem.reflectivityCoefficient_) : ((!reflectivityCoefficient_.isDefined()) && (!aSatelliteSystem.reflectivityCoefficient_.isDefined()))) ;
 
 }
 
@@ -106,6 +110,7 @@ void                            SatelliteSystem::print                      (
     ostk::core::utils::Print::Line(anOutputStream) << "Inertia Tensor:"                 << (inertiaTensor_.isDefined() ? inertiaTensor_.toString() : "Undefined") ;
     ostk::core::utils::Print::Line(anOutputStream) << "Cross Sectional Surface Area:"   << (crossSectionalSurfaceArea_.isDefined() ? crossSectionalSurfaceArea_.toString() : "Undefined") ;
     ostk::core::utils::Print::Line(anOutputStream) << "Drag Coefficient:"               << (dragCoefficient_.isDefined() ? dragCoefficient_.toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Reflectivity Coefficient:"       << (reflectivityCoefficient_.isDefined() ? reflectivityCoefficient_.toString() : "Undefined") ;
 
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
 
@@ -147,6 +152,18 @@ Real                            SatelliteSystem::getDragCoefficient         ( )
 
 }
 
+Real                            SatelliteSystem::getReflectivityCoefficient ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SatelliteSystem") ;
+    }
+
+    return reflectivityCoefficient_ ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -12,21 +12,57 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
-#include <boost/numeric/odeint.hpp>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-namespace ostk
+namespace boost
 {
-namespace astro
+namespace numeric
+{
+namespace odeint
 {
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Odeint support for two-dimensional Eigen arrays (ensemble states):
+// - infinity norm, required by the error checker of the controlled steppers
+// - copy by assignment, since Eigen only provides STL iterators for vectors
+
+template <typename B, int S1, int S2, int O, int M1, int M2>
+struct vector_space_norm_inf<Eigen::Array<B, S1, S2, O, M1, M2>>
+{
+
+    typedef B result_type ;
+
+    result_type operator () (const Eigen::Array<B, S1, S2, O, M1, M2>& anArray) const
+    {
+        return anArray.abs().maxCoeff() ;
+    }
+
+} ;
+
+template <typename B, int S1, int S2, int O, int M1, int M2>
+struct copy_impl<Eigen::Array<B, S1, S2, O, M1, M2>, Eigen::Array<B, S1, S2, O, M1, M2>>
+{
+
+    static void copy (const Eigen::Array<B, S1, S2, O, M1, M2>& aFromArray, Eigen::Array<B, S1, S2, O, M1, M2>& aToArray)
+    {
+        aToArray = aFromArray ;
+    }
 
-using namespace boost::numeric::odeint ;
+} ;
 
-typedef runge_kutta_cash_karp54<NumericalSolver::StateVector> error_stepper_type_54 ;
-typedef runge_kutta_fehlberg78<NumericalSolver::StateVector> error_stepper_type_78 ;
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,14 +70,18 @@ typedef runge_kutta_fehlberg78<NumericalSolver::StateVector> error_stepper_type_
                                                                                 const   NumericalSolver::StepperType& aStepperType,
                                                                                 const   Real&                       aTimeStep,
                                                                                 const   Real&                       aRelativeTolerance,
-                                                                                const   Real&                       anAbsoluteTolerance                         )
+                                                                                const   Real&                       anAbsoluteTolerance,
+                                                                                const   NumericalSolver::InitialStepType& anInitialStepType                     )
                                 :   logType_(aLogType),
                                     stepperType_(aStepperType),
                                     timeStep_(aTimeStep),
                                     relativeTolerance_(aRelativeTolerance),
                                     absoluteTolerance_(anAbsoluteTolerance),
-                                    states_(),
-                                    instants_ ()
+                                    initialStepType_(anInitialStepType),
+                                    evaluationTiming_(false),
+                                    mutex_(),
+                                    statistics_(),
+                                    warmStartTimeStep_(std::numeric_limits<double>::quiet_NaN())
 {
 
 }
@@ -52,10 +92,54 @@ typedef runge_kutta_fehlberg78<NumericalSolver::StateVector> error_stepper_type_
                                     timeStep_(aNumericalSolver.timeStep_),
                                     relativeTolerance_(aNumericalSolver.relativeTolerance_),
                                     absoluteTolerance_(aNumericalSolver.absoluteTolerance_),
-                                    states_(),
-                                    instants_ ()
+                                    initialStepType_(aNumericalSolver.initialStepType_),
+                                    evaluationTiming_(aNumericalSolver.evaluationTiming_),
+                                    mutex_(),
+                                    statistics_(),
+                                    warmStartTimeStep_(std::numeric_limits<double>::quiet_NaN())
+{
+
+    const std::lock_guard<std::mutex> lock { aNumericalSolver.mutex_ } ;
+
+    statistics_ = aNumericalSolver.statistics_ ;
+    warmStartTimeStep_ = aNumericalSolver.warmStartTimeStep_ ;
+
+}
+
+NumericalSolver&                NumericalSolver::operator =                 (   const   NumericalSolver&            aNumericalSolver                            )
 {
 
+    if (this != &aNumericalSolver)
+    {
+
+        Statistics statistics ;
+        double warmStartTimeStep ;
+
+        {
+
+            const std::lock_guard<std::mutex> lock { aNumericalSolver.mutex_ } ;
+
+            statistics = aNumericalSolver.statistics_ ;
+            warmStartTimeStep = aNumericalSolver.warmStartTimeStep_ ;
+
+        }
+
+        const std::lock_guard<std::mutex> lock { this->mutex_ } ;
+
+        this->logType_ = aNumericalSolver.logType_ ;
+        this->stepperType_ = aNumericalSolver.stepperType_ ;
+        this->timeStep_ = aNumericalSolver.timeStep_ ;
+        this->relativeTolerance_ = aNumericalSolver.relativeTolerance_ ;
+        this->absoluteTolerance_ = aNumericalSolver.absoluteTolerance_ ;
+        this->initialStepType_ = aNumericalSolver.initialStepType_ ;
+        this->evaluationTiming_ = aNumericalSolver.evaluationTiming_ ;
+        this->statistics_ = statistics ;
+        this->warmStartTimeStep_ = warmStartTimeStep ;
+
+    }
+
+    return *this ;
+
 }
 
 NumericalSolver*                NumericalSolver::clone                      ( ) const
@@ -75,7 +159,8 @@ bool                            NumericalSolver::operator ==                (
         && (stepperType_ == aNumericalSolver.stepperType_)
         && (timeStep_ == aNumericalSolver.timeStep_)
         && (relativeTolerance_ == aNumericalSolver.relativeTolerance_)
-        && (absoluteTolerance_ == aNumericalSolver.absoluteTolerance_) ;
+        && (absoluteTolerance_ == aNumericalSolver.absoluteTolerance_)
+        && (initialStepType_ == aNumericalSolver.initialStepType_) ;
 
 }
 
@@ -99,6 +184,30 @@ bool                            NumericalSolver::isDefined                  ( )
     return timeStep_.isDefined() && relativeTolerance_.isDefined() && absoluteTolerance_.isDefined() ;
 }
 
+bool                            NumericalSolver::isSecondOrder              ( ) const
+{
+
+    switch (stepperType_)
+    {
+
+        case NumericalSolver::StepperType::RungeKuttaNystrom64:
+        case NumericalSolver::StepperType::StormerVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        case NumericalSolver::StepperType::Yoshida6:
+            return true ;
+
+        default:
+            return false ;
+
+    }
+
+}
+
+bool                            NumericalSolver::hasDenseOutput             ( ) const
+{
+    return (stepperType_ == NumericalSolver::StepperType::RungeKuttaDopri5) || (stepperType_ == NumericalSolver::StepperType::BulirschStoerDenseOutput) ;
+}
+
 void                            NumericalSolver::print                      (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorator                            ) const
 {
@@ -110,6 +219,7 @@ void                            NumericalSolver::print                      (
     ostk::core::utils::Print::Line(anOutputStream) << "Integration time step:"              << (timeStep_.isDefined() ? timeStep_.toString() : "Undefined") ;
     ostk::core::utils::Print::Line(anOutputStream) << "Integration relative tolerance:"     << (relativeTolerance_.isDefined() ? relativeTolerance_.toString() : "Undefined") ;
     ostk::core::utils::Print::Line(anOutputStream) << "Integration absolute tolerance:"     << (absoluteTolerance_.isDefined() ? absoluteTolerance_.toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Integration initial step type:"      << NumericalSolver::StringFromInitialStepType(initialStepType_) ;
 
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
 
@@ -175,144 +285,254 @@ Real                            NumericalSolver::getAbsoluteTolerance       ( )
 
 }
 
+NumericalSolver::InitialStepType NumericalSolver::getInitialStepType        ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver") ;
+    }
+
+    return initialStepType_ ;
+
+}
+
+Statistics                      NumericalSolver::getStatistics              ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { mutex_ } ;
+
+    return statistics_ ;
+
+}
+
+bool                            NumericalSolver::isEvaluationTimingEnabled  ( ) const
+{
+    return evaluationTiming_ ;
+}
+
+void                            NumericalSolver::setEvaluationTiming        (   const   bool                        isEnabled                                   )
+{
+    evaluationTiming_ = isEnabled ;
+}
+
+void                            NumericalSolver::resetStatistics            ( )
+{
+
+    const std::lock_guard<std::mutex> lock { mutex_ } ;
+
+    statistics_.reset() ;
+
+}
+
+void                            NumericalSolver::resetWarmStart             ( )
+{
+
+    const std::lock_guard<std::mutex> lock { mutex_ } ;
+
+    warmStartTimeStep_ = std::numeric_limits<double>::quiet_NaN() ;
+
+}
+
 Array<NumericalSolver::StateVector> NumericalSolver::integrateStatesAtSortedInstants ( const   StateVector&         anInitialStateVector,
                                                                                 const   Instant&                    aStartInstant,
                                                                                 const   Array<Instant>&             anInstantArray,
-                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations           )
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
 {
 
-    NumericalSolver::StateVector aStateVector = anInitialStateVector ;
-    states_.clear() ;
-    instants_.clear() ;
-
     // Check if instant array has zero length
     if (anInstantArray.size() == 0)
     {
         throw ostk::core::error::RuntimeError("Instant Array is empty") ;
     }
 
+    Array<NumericalSolver::StateVector> stateVectorArray = Array<NumericalSolver::StateVector>::Empty() ;
+    stateVectorArray.reserve(anInstantArray.size()) ;
+
     // Check if the incoming instant array is the same as the start state if it has length 1
     if ((anInstantArray.size() == 1) && (anInstantArray[0] == aStartInstant))
     {
-        states_.push_back(anInitialStateVector) ;
-        return states_ ;
+        stateVectorArray.add(anInitialStateVector) ;
+        return stateVectorArray ;
     }
 
-    // Add start instant to the start of array and convert to integration seconds
-    Array<double> anIntegrationDurationInSecsArray = { 0 } ;
-    Size stopCounter = 0 ;
-    Integer durationSign = Integer::Undefined() ;
+    NumericalSolver::StateVector aStateVector = anInitialStateVector ;
 
-    for (const auto& instant : anInstantArray)
+    const Array<double> anIntegrationDurationInSecsArray = NumericalSolver::IntegrationTimesFromInstants(aStartInstant, anInstantArray) ;
+
+    if (anObserver != nullptr)
     {
+        anObserver->reset() ;
+    }
 
-        const double durationInSecs = (instant - aStartInstant).inSeconds() ;
-        anIntegrationDurationInSecsArray.add(durationInSecs) ;
+    // The first observation is a repeat of the start state and is skipped
+    bool isStartStateObserved = false ;
 
-        if (durationInSecs != 0 && stopCounter == 0)
+    this->integrateStateAtTimes
+    (
+        aStateVector,
+        anIntegrationDurationInSecsArray,
+        aSystemOfEquations,
+        [&] (const NumericalSolver::StateVector& x, const double t) -> void
         {
-            durationSign = (durationInSecs > 0) - (durationInSecs < 0) ;
-            stopCounter++ ;
-        }
 
-    }
+            this->observeState(x, t, anObserver) ;
 
-    // Ensure integration starts in the correct direction with the initial time step guess
-    const double adjustedTimeStep = timeStep_ * static_cast<double>(durationSign) ;
+            if (isStartStateObserved)
+            {
+                stateVectorArray.add(x) ;
+            }
 
-    switch (stepperType_)
-    {
+            isStartStateObserved = true ;
 
-        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
-        {
-            integrate_times(make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54()), aSystemOfEquations, aStateVector, anIntegrationDurationInSecsArray.begin(), anIntegrationDurationInSecsArray.end(), adjustedTimeStep, [&] (const NumericalSolver::StateVector &x, double t) -> void { this->observeNumericalIntegration(x, t) ; } ) ;
-            break ;
         }
+    ) ;
 
-        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
-        {
-            integrate_times(make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78()), aSystemOfEquations, aStateVector, anIntegrationDurationInSecsArray.begin(), anIntegrationDurationInSecsArray.end(), adjustedTimeStep, [&] (const NumericalSolver::StateVector &x, double t) -> void { this->observeNumericalIntegration(x, t) ; } ) ;
-            break ;
-        }
+    return stateVectorArray ;
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Stepper type") ;
+}
+
+NumericalSolver::StateVector    NumericalSolver::integrateStateForDuration  (   const   StateVector&                anInitialStateVector,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    if ((anIntegrationDuration.inSeconds()).isZero()) // If integration duration is zero seconds long, skip integration
+    {
+        return anInitialStateVector ;
+    }
+
+    NumericalSolver::StateVector aStateVector = anInitialStateVector ;
 
+    if (anObserver != nullptr)
+    {
+        anObserver->reset() ;
     }
 
-    // Return array of StateVectors excluding first element which is a repeat of the startState
-    return Array<NumericalSolver::StateVector> (states_.begin() + 1, states_.end()) ;
+    this->integrateState(aStateVector, 0.0, anIntegrationDuration.inSeconds(), aSystemOfEquations, [&] (const NumericalSolver::StateVector& x, const double t) -> void { this->observeState(x, t, anObserver) ; } ) ;
+
+    return aStateVector ;
 
 }
 
-NumericalSolver::StateVector    NumericalSolver::integrateStateForDuration  (   const   StateVector&                anInitialStateVector,
+NumericalSolver::StateVector    NumericalSolver::integrateStateFromInstantToInstant ( const   StateVector&          anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+    return this->integrateStateForDuration(anInitialStateVector, (anEndInstant - aStartInstant), aSystemOfEquations, anObserver) ;
+}
+
+Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> NumericalSolver::integrateStateWithEventsFromInstantToInstant ( const StateVector& anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+    return this->integrateStateWithEventsForDuration(anInitialStateVector, (anEndInstant - aStartInstant), aSystemOfEquations, anEventArray, anObserver) ;
+}
+
+Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> NumericalSolver::integrateStateWithEventsForDuration ( const StateVector& anInitialStateVector,
                                                                                 const   Duration&                   anIntegrationDuration,
-                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations           )
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
 {
 
-    NumericalSolver::StateVector aStateVector = anInitialStateVector ;
+    using namespace boost::numeric::odeint ;
+
+    for (const auto& eventSPtr : anEventArray)
+    {
+
+        if (eventSPtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Event") ;
+        }
 
-    states_.clear() ;
-    instants_.clear() ;
+    }
+
+    Array<Event::Occurrence> eventOccurrenceArray = Array<Event::Occurrence>::Empty() ;
 
     if ((anIntegrationDuration.inSeconds()).isZero()) // If integration duration is zero seconds long, skip integration
     {
-        return anInitialStateVector ;
+        return { anInitialStateVector, eventOccurrenceArray } ;
+    }
+
+    NumericalSolver::StateVector aStateVector = anInitialStateVector ;
+
+    if (anObserver != nullptr)
+    {
+        anObserver->reset() ;
     }
 
-    const double integrationDurationInSecs = anIntegrationDuration.inSeconds() ;
+    const double endTime = anIntegrationDuration.inSeconds() ;
 
-    // Ensure integration starts in the correct direction with the initial time step guess
-    Integer durationSign = (integrationDurationInSecs > 0) - (integrationDurationInSecs < 0) ;
-    const double adjustedTimeStep = timeStep_ * static_cast<double>(durationSign) ;
+    NumericalSolver::IntegrationRecord integrationRecord { *this } ;
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = this->systemWithStatistics(aSystemOfEquations, integrationRecord) ;
 
     switch (stepperType_)
     {
 
         case NumericalSolver::StepperType::RungeKuttaCashKarp54:
         {
-            switch (logType_)
-            {
+            this->integrateStateWithEvents(this->stepperWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_cash_karp54<NumericalSolver::StateVector>()), integrationRecord), make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_cash_karp54<NumericalSolver::StateVector>()), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
+        }
 
-                case NumericalSolver::LogType::NoLog:
-                case NumericalSolver::LogType::LogAdaptive:
-                {
-                    integrate_adaptive(make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54()), aSystemOfEquations, aStateVector, (0.0), integrationDurationInSecs, adjustedTimeStep, [&] (const NumericalSolver::StateVector &x, double t) -> void { this->observeNumericalIntegration(x, t) ; } ) ;
-                    return aStateVector ;
-                }
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        {
+            this->integrateStateWithEvents(this->stepperWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_fehlberg78<NumericalSolver::StateVector>()), integrationRecord), make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_fehlberg78<NumericalSolver::StateVector>()), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
+        }
 
-                case NumericalSolver::LogType::LogConstant:
-                {
-                    integrate_const(make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54()), aSystemOfEquations, aStateVector, (0.0), integrationDurationInSecs, adjustedTimeStep, [&] (const NumericalSolver::StateVector &x, double t) -> void { this->observeNumericalIntegration(x, t) ; } ) ;
-                    return aStateVector ;
-                }
-                default:
-                    throw ostk::core::error::runtime::Wrong("Log type") ;
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+        {
+            this->integrateStateWithEventsUsingDenseOutput(this->denseOutputWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_dopri5<NumericalSolver::StateVector>()), integrationRecord), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
+        }
 
-            }
+        case NumericalSolver::StepperType::AdamsBashforthMoulton:
+        {
+            // Occurrences are refined from the start of a step, where the multistep history is not available: use a single-step method
+            this->integrateStateWithEvents(this->stepperWithStatistics(this->makeAdamsBashforthMoultonStepper<NumericalSolver::StateVector>(), integrationRecord), make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_fehlberg78<NumericalSolver::StateVector>()), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
         }
 
-        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        case NumericalSolver::StepperType::BulirschStoer:
         {
-            switch (logType_)
-            {
+            this->integrateStateWithEvents(this->stepperWithStatistics(NumericalSolver::BulirschStoerStepper<NumericalSolver::StateVector>(absoluteTolerance_, relativeTolerance_), integrationRecord), NumericalSolver::BulirschStoerStepper<NumericalSolver::StateVector>(absoluteTolerance_, relativeTolerance_), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
+        }
 
-                case NumericalSolver::LogType::NoLog:
-                case NumericalSolver::LogType::LogAdaptive:
-                {
-                    integrate_adaptive(make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78()), aSystemOfEquations, aStateVector, (0.0), integrationDurationInSecs, adjustedTimeStep, [&] (const NumericalSolver::StateVector &x, double t) -> void { this->observeNumericalIntegration(x, t) ; } ) ;
-                    return aStateVector ;
-                }
+        case NumericalSolver::StepperType::BulirschStoerDenseOutput:
+        {
+            this->integrateStateWithEventsUsingDenseOutput(NumericalSolver::BulirschStoerDenseOutputStepper<NumericalSolver::StateVector>(absoluteTolerance_, relativeTolerance_, integrationRecord), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
+        }
 
-                case NumericalSolver::LogType::LogConstant:
-                {
-                    integrate_const(make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78()), aSystemOfEquations, aStateVector, (0.0), integrationDurationInSecs, adjustedTimeStep, [&] (const NumericalSolver::StateVector &x, double t) -> void { this->observeNumericalIntegration(x, t) ; } ) ;
-                    return aStateVector ;
-                }
-                default:
-                    throw ostk::core::error::runtime::Wrong("Log type") ;
+        case NumericalSolver::StepperType::RungeKuttaNystrom64:
+        {
+            this->integrateStateWithEvents(this->stepperWithStatistics(NumericalSolver::RungeKuttaNystromStepper<NumericalSolver::StateVector>(absoluteTolerance_, relativeTolerance_), integrationRecord), NumericalSolver::RungeKuttaNystromStepper<NumericalSolver::StateVector>(absoluteTolerance_, relativeTolerance_), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
+        }
 
-            }
+        case NumericalSolver::StepperType::StormerVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        case NumericalSolver::StepperType::Yoshida6:
+        {
+            // Occurrences are refined with a single step from the start of a step, of at most the fixed time step
+            this->integrateStateWithEvents(this->stepperWithStatistics(this->makeSymplecticStepper<NumericalSolver::StateVector>(), integrationRecord), this->makeSymplecticStepper<NumericalSolver::StateVector>(), aStateVector, endTime, systemOfEquations, anEventArray, eventOccurrenceArray, anObserver) ;
+            break ;
         }
 
         default:
@@ -320,104 +540,752 @@ NumericalSolver::StateVector    NumericalSolver::integrateStateForDuration  (
 
     }
 
-    throw ostk::core::error::RuntimeError("No State Vector returned from Odeint.") ;
-
-    return NumericalSolver::StateVector(anInitialStateVector.size()) ;
+    return { aStateVector, eventOccurrenceArray } ;
 
 }
 
-
-NumericalSolver::StateVector    NumericalSolver::integrateStateFromInstantToInstant ( const   StateVector&          anInitialStateVector,
+Array<NumericalSolver::DenseOutputStep> NumericalSolver::integrateDenseOutputFromInstantToInstant ( const StateVector& anInitialStateVector,
                                                                                 const   Instant&                    aStartInstant,
                                                                                 const   Instant&                    anEndInstant,
-                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations           )
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
 {
-    return this->integrateStateForDuration(anInitialStateVector, (anEndInstant - aStartInstant), aSystemOfEquations) ;
+    return this->integrateDenseOutputForDuration(anInitialStateVector, (anEndInstant - aStartInstant), aSystemOfEquations, anObserver) ;
 }
 
-String                          NumericalSolver::StringFromLogType          (   const   NumericalSolver::LogType&   aLogType                                    )
+Array<NumericalSolver::DenseOutputStep> NumericalSolver::integrateDenseOutputForDuration ( const StateVector&     anInitialStateVector,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
 {
 
-    switch (aLogType)
-    {
-
-        case NumericalSolver::LogType::NoLog:
-            return "NoLog" ;
+    using namespace boost::numeric::odeint ;
 
-        case NumericalSolver::LogType::LogConstant:
-            return "LogConstant" ;
+    // The steps are recovered as quintic polynomials, exact for the continuous extension of Dormand-Prince only
 
-        case NumericalSolver::LogType::LogAdaptive:
-            return "LogAdaptive" ;
+    if (stepperType_ != NumericalSolver::StepperType::RungeKuttaDopri5)
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("Dense output steps with stepper type [" + NumericalSolver::StringFromStepperType(stepperType_) + "]") ;
+    }
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Log Type") ;
+    Array<NumericalSolver::DenseOutputStep> denseOutputStepArray = Array<NumericalSolver::DenseOutputStep>::Empty() ;
 
+    if ((anIntegrationDuration.inSeconds()).isZero()) // If integration duration is zero seconds long, skip integration
+    {
+        return denseOutputStepArray ;
     }
 
-}
-
-String                          NumericalSolver::StringFromStepperType      (   const   NumericalSolver::StepperType& aStepperType                              )
-{
+    NumericalSolver::StateVector aStateVector = anInitialStateVector ;
 
-    switch (aStepperType)
+    if (anObserver != nullptr)
     {
+        anObserver->reset() ;
+    }
 
-        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
-            return "RungeKuttaCashKarp54" ;
-
-        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
-            return "RungeKuttaFehlberg78" ;
+    NumericalSolver::IntegrationRecord integrationRecord { *this } ;
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Stepper Type") ;
+    this->integrateDenseOutput(this->denseOutputWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_dopri5<NumericalSolver::StateVector>()), integrationRecord), aStateVector, anIntegrationDuration.inSeconds(), this->systemWithStatistics(aSystemOfEquations, integrationRecord), denseOutputStepArray, anObserver) ;
 
-    }
+    return denseOutputStepArray ;
 
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-void                            NumericalSolver::observeNumericalIntegration (  const   NumericalSolver::StateVector& x,
-                                                                                const   double                      t                                           )
+Array<NumericalSolver::EnsembleStateArray> NumericalSolver::integrateEnsembleAtSortedInstants ( const EnsembleStateArray& anInitialEnsembleStateArray,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray,
+                                                                                const   NumericalSolver::EnsembleSystemOfEquationsWrapper& aSystemOfEquations   ) const
 {
 
-    states_.push_back(x) ;
-    instants_.push_back(t) ;
+    // Check if instant array has zero length
+    if (anInstantArray.size() == 0)
+    {
+        throw ostk::core::error::RuntimeError("Instant Array is empty") ;
+    }
+
+    Array<NumericalSolver::EnsembleStateArray> ensembleStateArrays = Array<NumericalSolver::EnsembleStateArray>::Empty() ;
+    ensembleStateArrays.reserve(anInstantArray.size()) ;
 
-    switch (logType_)
+    // Check if the incoming instant array is the same as the start state if it has length 1
+    if ((anInstantArray.size() == 1) && (anInstantArray[0] == aStartInstant))
     {
+        ensembleStateArrays.add(anInitialEnsembleStateArray) ;
+        return ensembleStateArrays ;
+    }
 
-        case NumericalSolver::LogType::LogAdaptive:
-        case NumericalSolver::LogType::LogConstant:
-        {
+    NumericalSolver::EnsembleStateArray anEnsembleStateArray = anInitialEnsembleStateArray ;
+
+    const Array<double> anIntegrationDurationInSecsArray = NumericalSolver::IntegrationTimesFromInstants(aStartInstant, anInstantArray) ;
 
-            std::cout.precision(3) ;
-            std::cout.setf(std::ios::fixed,std::ios::floatfield) ;
+    // The first observation is a repeat of the start state and is skipped
+    bool isStartStateObserved = false ;
 
-            std::cout << std::left << std::setw(15) << t ;
+    this->integrateStateAtTimes
+    (
+        anEnsembleStateArray,
+        anIntegrationDurationInSecsArray,
+        aSystemOfEquations,
+        [&] (const NumericalSolver::EnsembleStateArray& x, const double) -> void
+        {
 
-            std::cout.precision(10) ;
-            std::cout.setf(std::ios::scientific,std::ios::floatfield) ;
-            for (Size i = 0; i < x.size(); i++)
+            if (isStartStateObserved)
             {
-                std::cout << std::internal << std::setw(16) << x[i] << "     " ;
+                ensembleStateArrays.add(x) ;
             }
-            std::cout << std::endl ;
-
-            std::cout.setf(std::ios::fixed,std::ios::floatfield) ;
 
-            break ;
+            isStartStateObserved = true ;
 
         }
+    ) ;
 
-        default:
+    return ensembleStateArrays ;
+
+}
+
+NumericalSolver::EnsembleStateArray NumericalSolver::integrateEnsembleFromInstantToInstant ( const EnsembleStateArray& anInitialEnsembleStateArray,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   NumericalSolver::EnsembleSystemOfEquationsWrapper& aSystemOfEquations   ) const
+{
+    return this->integrateEnsembleForDuration(anInitialEnsembleStateArray, (anEndInstant - aStartInstant), aSystemOfEquations) ;
+}
+
+NumericalSolver::EnsembleStateArray NumericalSolver::integrateEnsembleForDuration ( const EnsembleStateArray&   anInitialEnsembleStateArray,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   NumericalSolver::EnsembleSystemOfEquationsWrapper& aSystemOfEquations   ) const
+{
+
+    if ((anIntegrationDuration.inSeconds()).isZero()) // If integration duration is zero seconds long, skip integration
+    {
+        return anInitialEnsembleStateArray ;
+    }
+
+    NumericalSolver::EnsembleStateArray anEnsembleStateArray = anInitialEnsembleStateArray ;
+
+    this->integrateState(anEnsembleStateArray, 0.0, anIntegrationDuration.inSeconds(), aSystemOfEquations, [] (const NumericalSolver::EnsembleStateArray&, const double) -> void { } ) ;
+
+    return anEnsembleStateArray ;
+
+}
+
+String                          NumericalSolver::StringFromLogType          (   const   NumericalSolver::LogType&   aLogType                                    )
+{
+
+    switch (aLogType)
+    {
+
+        case NumericalSolver::LogType::NoLog:
+            return "NoLog" ;
+
+        case NumericalSolver::LogType::LogConstant:
+            return "LogConstant" ;
+
+        case NumericalSolver::LogType::LogAdaptive:
+            return "LogAdaptive" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Log Type") ;
+
+    }
+
+}
+
+String                          NumericalSolver::StringFromInitialStepType  (   const   NumericalSolver::InitialStepType& anInitialStepType                     )
+{
+
+    switch (anInitialStepType)
+    {
+
+        case NumericalSolver::InitialStepType::UserDefined:
+            return "UserDefined" ;
+
+        case NumericalSolver::InitialStepType::Automatic:
+            return "Automatic" ;
+
+        case NumericalSolver::InitialStepType::WarmStart:
+            return "WarmStart" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Initial Step Type") ;
+
+    }
+
+}
+
+String                          NumericalSolver::StringFromStepperType      (   const   NumericalSolver::StepperType& aStepperType                              )
+{
+
+    switch (aStepperType)
+    {
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+            return "RungeKuttaCashKarp54" ;
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            return "RungeKuttaFehlberg78" ;
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            return "RungeKuttaDopri5" ;
+
+        case NumericalSolver::StepperType::AdamsBashforthMoulton:
+            return "AdamsBashforthMoulton" ;
+
+        case NumericalSolver::StepperType::BulirschStoer:
+            return "BulirschStoer" ;
+
+        case NumericalSolver::StepperType::BulirschStoerDenseOutput:
+            return "BulirschStoerDenseOutput" ;
+
+        case NumericalSolver::StepperType::RungeKuttaNystrom64:
+            return "RungeKuttaNystrom64" ;
+
+        case NumericalSolver::StepperType::StormerVerlet:
+            return "StormerVerlet" ;
+
+        case NumericalSolver::StepperType::Yoshida4:
+            return "Yoshida4" ;
+
+        case NumericalSolver::StepperType::Yoshida6:
+            return "Yoshida6" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper Type") ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void                            NumericalSolver::observeState               (   const   NumericalSolver::StateVector& x,
+                                                                                const   double                      t,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    if (logType_ != NumericalSolver::LogType::NoLog)
+    {
+        NumericalSolver::LogState(x, t) ;
+    }
+
+    if (anObserver != nullptr)
+    {
+        anObserver->notify(x, t) ;
+    }
+
+}
+
+template <class ControlledStepperType>
+struct IsMultistepStepper : std::false_type { } ;
+
+template <class ErrorStepper, class StepAdjuster, class OrderAdjuster, class Resizer>
+struct IsMultistepStepper<boost::numeric::odeint::controlled_adams_bashforth_moulton<ErrorStepper, StepAdjuster, OrderAdjuster, Resizer>> : std::true_type { } ;
+
+template <class ControlledStepperType>
+boost::numeric::odeint::controlled_step_result TryStep                      (           ControlledStepperType&      aStepper,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                        NumericalSolver::StateVector& aStateVector,
+                                                                                const   NumericalSolver::StateVector& aDxdt,
+                                                                                        double&                     aTime,
+                                                                                        double&                     aTimeStep                                   )
+{
+
+    if constexpr (IsMultistepStepper<typename ControlledStepperType::controlled_stepper_type>::value)
+    {
+
+        // Multistep steppers hold their own derivative history
+
+        (void) aDxdt ;
+
+        return aStepper.try_step(aSystemOfEquations, aStateVector, aTime, aTimeStep) ;
+
+    }
+    else
+    {
+
+        // Single-step controlled steppers reuse the derivative at the start of the step
+
+        return aStepper.try_step(aSystemOfEquations, aStateVector, aDxdt, aTime, aTimeStep) ;
+
+    }
+
+}
+
+template <class ControlledStepperType, class RefinementStepperType>
+void                            NumericalSolver::integrateStateWithEvents   (           ControlledStepperType       aStepper,
+                                                                                        RefinementStepperType       aRefinementStepper,
+                                                                                        NumericalSolver::StateVector& aStateVector,
+                                                                                const   double                      anEndTime,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<Event::Occurrence>&   anEventOccurrenceArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    using namespace boost::numeric::odeint ;
+
+    const Size stateSize = aStateVector.size() ;
+
+    // Ensure integration starts in the correct direction with the initial time step guess
+    const double durationSign = (anEndTime < 0.0) ? -1.0 : +1.0 ;
+
+    double time = 0.0 ;
+    double timeStep = this->initialTimeStep(aStateVector, time, anEndTime, aSystemOfEquations) ;
+
+    // The derivative at the end of each step is reused by the next one, and by the step interpolant
+    NumericalSolver::StateVector dxdt(stateSize) ;
+    aSystemOfEquations(aStateVector, dxdt, time) ;
+
+    Array<double> eventValueArray = Array<double>::Empty() ;
+    eventValueArray.reserve(anEventArray.getSize()) ;
+
+    for (const auto& eventSPtr : anEventArray)
+    {
+        eventValueArray.add(eventSPtr->evaluate(aStateVector, time)) ;
+    }
+
+    this->observeState(aStateVector, time, anObserver) ;
+
+    NumericalSolver::StateVector previousStateVector(stateSize) ;
+    NumericalSolver::StateVector previousDxdt(stateSize) ;
+
+    while ((durationSign * (anEndTime - time)) > 0.0)
+    {
+
+        // Do not step past the end time
+        if ((durationSign * (time + timeStep - anEndTime)) > 0.0)
         {
-            break ;
+            timeStep = anEndTime - time ;
+        }
+
+        const double previousTime = time ;
+        previousStateVector = aStateVector ;
+        previousDxdt = dxdt ;
+
+        if (TryStep(aStepper, aSystemOfEquations, aStateVector, previousDxdt, time, timeStep) == fail)
+        {
+            continue ; // The step size was reduced, try again
         }
 
+        // Land exactly on the end time, to avoid a spurious last step
+        if (std::abs(anEndTime - time) <= (4.0 * std::numeric_limits<double>::epsilon() * std::abs(anEndTime)))
+        {
+            time = anEndTime ;
+        }
+
+        aSystemOfEquations(aStateVector, dxdt, time) ;
+
+        const double stepDuration = time - previousTime ;
+
+        // Cubic Hermite interpolant over the step
+        const auto interpolant = [&] (const double anInterpolationTime, NumericalSolver::StateVector& anInterpolatedStateVector) -> void
+        {
+
+            const double s = (anInterpolationTime - previousTime) / stepDuration ;
+            const double s2 = s * s ;
+            const double s3 = s2 * s ;
+
+            const double h00 = (2.0 * s3) - (3.0 * s2) + 1.0 ;
+            const double h10 = (s3 - (2.0 * s2) + s) * stepDuration ;
+            const double h01 = (-2.0 * s3) + (3.0 * s2) ;
+            const double h11 = (s3 - s2) * stepDuration ;
+
+            for (Size k = 0 ; k < stateSize ; ++k)
+            {
+                anInterpolatedStateVector[k] = (h00 * previousStateVector[k]) + (h10 * previousDxdt[k]) + (h01 * aStateVector[k]) + (h11 * dxdt[k]) ;
+            }
+
+        } ;
+
+        Array<Event::Occurrence> stepEventOccurrenceArray = NumericalSolver::LocateEvents(anEventArray, eventValueArray, previousTime, time, aStateVector, interpolant) ;
+
+        // The cubic interpolant is less accurate than the stepper: refine the occurrences with Newton iterations on integrated states,
+        // using the slope of the event function along the interpolant.
+        // The first state is integrated from the nearest end of the step, and each corrected one from the previous iterate, over the correction only.
+
+        const double timeTolerance = std::max(1e-9, 4.0 * std::numeric_limits<double>::epsilon() * std::abs(time)) ;
+        const double slopeTimeStep = 1e-3 * stepDuration ;
+
+        static const Size maximumCorrectionCount = 3 ;
+
+        NumericalSolver::StateVector forwardStateVector(stateSize) ;
+        NumericalSolver::StateVector backwardStateVector(stateSize) ;
+
+        for (Event::Occurrence& occurrence : stepEventOccurrenceArray)
+        {
+
+            const Event& event = *(anEventArray[occurrence.eventIndex]) ;
+
+            const bool isNearerStepEnd = std::abs(time - occurrence.time) < std::abs(occurrence.time - previousTime) ;
+
+            double integratedTime = isNearerStepEnd ? time : previousTime ;
+            occurrence.stateVector = isNearerStepEnd ? aStateVector : previousStateVector ;
+
+            for (Size iteration = 0 ; ; ++iteration)
+            {
+
+                if (occurrence.time != integratedTime)
+                {
+                    integrate_adaptive(aRefinementStepper, aSystemOfEquations, occurrence.stateVector, integratedTime, occurrence.time, (occurrence.time - integratedTime)) ;
+                    integratedTime = occurrence.time ;
+                }
+
+                if (iteration == maximumCorrectionCount)
+                {
+                    break ;
+                }
+
+                const double value = event.evaluate(occurrence.stateVector, occurrence.time) ;
+
+                interpolant(occurrence.time + slopeTimeStep, forwardStateVector) ;
+                interpolant(occurrence.time - slopeTimeStep, backwardStateVector) ;
+
+                const double slope = (event.evaluate(forwardStateVector, occurrence.time + slopeTimeStep) - event.evaluate(backwardStateVector, occurrence.time - slopeTimeStep)) / (2.0 * slopeTimeStep) ;
+
+                if ((value == 0.0) || (slope == 0.0))
+                {
+                    break ;
+                }
+
+                const double correctedTime = std::min(std::max(occurrence.time - (value / slope), std::min(previousTime, time)), std::max(previousTime, time)) ;
+
+                if (std::abs(correctedTime - occurrence.time) <= timeTolerance)
+                {
+                    break ;
+                }
+
+                occurrence.time = correctedTime ;
+
+            }
+
+        }
+
+        // The refined occurrences may have changed order
+
+        const bool isTerminated = NumericalSolver::AddEventOccurrences(anEventArray, stepEventOccurrenceArray, (durationSign < 0.0), anEventOccurrenceArray) ;
+
+        if (isTerminated)
+        {
+
+            aStateVector = anEventOccurrenceArray.accessLast().stateVector ;
+
+            this->observeState(aStateVector, anEventOccurrenceArray.accessLast().time, anObserver) ;
+
+            return ;
+
+        }
+
+        this->observeState(aStateVector, time, anObserver) ;
+
+    }
+
+}
+
+template <class DenseOutputStepperType>
+void                            NumericalSolver::integrateStateWithEventsUsingDenseOutput (   DenseOutputStepperType aStepper,
+                                                                                        NumericalSolver::StateVector& aStateVector,
+                                                                                const   double                      anEndTime,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<Event::Occurrence>&   anEventOccurrenceArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    // Ensure integration starts in the correct direction with the initial time step guess
+    const double durationSign = (anEndTime < 0.0) ? -1.0 : +1.0 ;
+
+    Array<double> eventValueArray = Array<double>::Empty() ;
+    eventValueArray.reserve(anEventArray.getSize()) ;
+
+    for (const auto& eventSPtr : anEventArray)
+    {
+        eventValueArray.add(eventSPtr->evaluate(aStateVector, 0.0)) ;
+    }
+
+    this->observeState(aStateVector, 0.0, anObserver) ;
+
+    aStepper.initialize(aStateVector, 0.0, this->initialTimeStep(aStateVector, 0.0, anEndTime, aSystemOfEquations)) ;
+
+    const auto interpolant = [&aStepper] (const double anInterpolationTime, NumericalSolver::StateVector& anInterpolatedStateVector) -> void
+    {
+        aStepper.calc_state(anInterpolationTime, anInterpolatedStateVector) ;
+    } ;
+
+    double time = 0.0 ;
+
+    while ((durationSign * (anEndTime - time)) > 0.0)
+    {
+
+        const double previousTime = time ;
+
+        aStepper.do_step(aSystemOfEquations) ;
+
+        // The stepper may step past the end time: the state at the end time is then interpolated
+        if ((durationSign * (aStepper.current_time() - anEndTime)) >= 0.0)
+        {
+            time = anEndTime ;
+            aStepper.calc_state(time, aStateVector) ;
+        }
+        else
+        {
+            time = aStepper.current_time() ;
+            aStateVector = aStepper.current_state() ;
+        }
+
+        if (NumericalSolver::AddEventOccurrences(anEventArray, NumericalSolver::LocateEvents(anEventArray, eventValueArray, previousTime, time, aStateVector, interpolant), (durationSign < 0.0), anEventOccurrenceArray))
+        {
+
+            aStateVector = anEventOccurrenceArray.accessLast().stateVector ;
+
+            this->observeState(aStateVector, anEventOccurrenceArray.accessLast().time, anObserver) ;
+
+            return ;
+
+        }
+
+        this->observeState(aStateVector, time, anObserver) ;
+
+    }
+
+}
+
+template <class DenseOutputStepperType>
+void                            NumericalSolver::integrateDenseOutput       (           DenseOutputStepperType      aStepper,
+                                                                                        NumericalSolver::StateVector& aStateVector,
+                                                                                const   double                      anEndTime,
+                                                                                const   NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+                                                                                        Array<NumericalSolver::DenseOutputStep>& aDenseOutputStepArray,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    // The Dormand-Prince continuous extension is a quintic polynomial of the normalized time, starting at the state at the start of the step:
+    // its five other coefficients are recovered exactly from the interpolant at five normalized times, with no evaluation of the system of equations
+
+    static constexpr Size InterpolationTimeCount = 5 ;
+
+    static const Eigen::Matrix<double, InterpolationTimeCount, InterpolationTimeCount> InverseVandermondeMatrix = [] () -> Eigen::Matrix<double, InterpolationTimeCount, InterpolationTimeCount>
+    {
+
+        Eigen::Matrix<double, InterpolationTimeCount, InterpolationTimeCount> vandermondeMatrix ;
+
+        for (Size j = 0 ; j < InterpolationTimeCount ; ++j)
+        {
+
+            for (Size k = 0 ; k < InterpolationTimeCount ; ++k)
+            {
+                vandermondeMatrix(j, k) = std::pow(static_cast<double>(j + 1) / static_cast<double>(InterpolationTimeCount), static_cast<double>(k + 1)) ;
+            }
+
+        }
+
+        return vandermondeMatrix.inverse() ;
+
+    }() ;
+
+    // Ensure integration starts in the correct direction with the initial time step guess
+    const double durationSign = (anEndTime < 0.0) ? -1.0 : +1.0 ;
+
+    this->observeState(aStateVector, 0.0, anObserver) ;
+
+    aStepper.initialize(aStateVector, 0.0, this->initialTimeStep(aStateVector, 0.0, anEndTime, aSystemOfEquations)) ;
+
+    Array<NumericalSolver::StateVector> differenceArray(InterpolationTimeCount, NumericalSolver::StateVector(aStateVector.size(), 0.0)) ;
+    NumericalSolver::StateVector interpolatedStateVector(aStateVector.size(), 0.0) ;
+
+    double time = 0.0 ;
+
+    while ((durationSign * (anEndTime - time)) > 0.0)
+    {
+
+        const double previousTime = time ;
+
+        aStepper.do_step(aSystemOfEquations) ;
+
+        // The stepper may step past the end time: the step is then cut at the end time
+        time = ((durationSign * (aStepper.current_time() - anEndTime)) >= 0.0) ? anEndTime : aStepper.current_time() ;
+
+        for (Size j = 0 ; j < InterpolationTimeCount ; ++j)
+        {
+
+            aStepper.calc_state(previousTime + ((static_cast<double>(j + 1) / static_cast<double>(InterpolationTimeCount)) * (time - previousTime)), interpolatedStateVector) ;
+
+            for (Size i = 0 ; i < aStateVector.size() ; ++i)
+            {
+                differenceArray[j][i] = interpolatedStateVector[i] - aStateVector[i] ;
+            }
+
+        }
+
+        Array<NumericalSolver::StateVector> coefficientArray(InterpolationTimeCount + 1, NumericalSolver::StateVector(aStateVector.size(), 0.0)) ;
+
+        coefficientArray[0] = aStateVector ;
+
+        for (Size k = 0 ; k < InterpolationTimeCount ; ++k)
+        {
+
+            for (Size j = 0 ; j < InterpolationTimeCount ; ++j)
+            {
+
+                for (Size i = 0 ; i < aStateVector.size() ; ++i)
+                {
+                    coefficientArray[k + 1][i] += InverseVandermondeMatrix(k, j) * differenceArray[j][i] ;
+                }
+
+            }
+
+        }
+
+        aDenseOutputStepArray.add({ previousTime, time, coefficientArray }) ;
+
+        aStateVector = (time == aStepper.current_time()) ? aStepper.current_state() : interpolatedStateVector ;
+
+        this->observeState(aStateVector, time, anObserver) ;
+
+    }
+
+}
+
+Array<Event::Occurrence>        NumericalSolver::LocateEvents               (   const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<double>&              anEventValueArray,
+                                                                                const   double                      aStepStartTime,
+                                                                                const   double                      aStepEndTime,
+                                                                                const   NumericalSolver::StateVector& aStepEndStateVector,
+                                                                                const   std::function<void(const double, StateVector&)>& anInterpolant )
+{
+
+    const bool isBackward = aStepEndTime < aStepStartTime ;
+
+    // Crossings are located to within a nanosecond, or to the time resolution
+    const double timeTolerance = std::max(1e-9, 4.0 * std::numeric_limits<double>::epsilon() * std::max(std::abs(aStepStartTime), std::abs(aStepEndTime))) ;
+
+    static const Size maximumIterationCount = 100 ;
+
+    Array<Event::Occurrence> stepOccurrenceArray = Array<Event::Occurrence>::Empty() ;
+
+    for (Size eventIndex = 0 ; eventIndex < anEventArray.getSize() ; ++eventIndex)
+    {
+
+        const Event& event = *(anEventArray[eventIndex]) ;
+
+        const double stepEndValue = event.evaluate(aStepEndStateVector, aStepEndTime) ;
+
+        if (event.isCrossing(anEventValueArray[eventIndex], stepEndValue, isBackward))
+        {
+
+            // Illinois (modified regula falsi) iterations on the step interpolant, keeping the crossing bracketed
+
+            double lowerTime = aStepStartTime ;
+            double lowerValue = anEventValueArray[eventIndex] ;
+            double upperTime = aStepEndTime ;
+            double upperValue = stepEndValue ;
+
+            NumericalSolver::StateVector stateVector = aStepEndStateVector ;
+
+            int lastMovedSide = 0 ;
+
+            for (Size iteration = 0 ; (iteration < maximumIterationCount) && (std::abs(upperTime - lowerTime) > timeTolerance) && (upperValue != 0.0) ; ++iteration)
+            {
+
+                const double time = ((lowerTime * upperValue) - (upperTime * lowerValue)) / (upperValue - lowerValue) ;
+
+                anInterpolant(time, stateVector) ;
+
+                const double value = event.evaluate(stateVector, time) ;
+
+                if ((value == 0.0) || ((value > 0.0) == (upperValue > 0.0)))
+                {
+
+                    upperTime = time ;
+                    upperValue = value ;
+
+                    if (lastMovedSide == -1)
+                    {
+                        lowerValue /= 2.0 ;
+                    }
+
+                    lastMovedSide = -1 ;
+
+                }
+                else
+                {
+
+                    lowerTime = time ;
+                    lowerValue = value ;
+
+                    if (lastMovedSide == +1)
+                    {
+                        upperValue /= 2.0 ;
+                    }
+
+                    lastMovedSide = +1 ;
+
+                }
+
+            }
+
+            // The occurrence is reported on the far side of the crossing
+            if (upperTime != aStepEndTime)
+            {
+                anInterpolant(upperTime, stateVector) ;
+            }
+
+            stepOccurrenceArray.add({ eventIndex, upperTime, stateVector }) ;
+
+        }
+
+        anEventValueArray[eventIndex] = stepEndValue ;
+
+    }
+
+    return stepOccurrenceArray ;
+
+}
+
+bool                            NumericalSolver::AddEventOccurrences        (   const   Array<Shared<const Event>>& anEventArray,
+                                                                                        Array<Event::Occurrence>    aStepEventOccurrenceArray,
+                                                                                const   bool                        isBackward,
+                                                                                        Array<Event::Occurrence>&   anEventOccurrenceArray                      )
+{
+
+    std::stable_sort
+    (
+        aStepEventOccurrenceArray.begin(),
+        aStepEventOccurrenceArray.end(),
+        [isBackward] (const Event::Occurrence& anOccurrence, const Event::Occurrence& anotherOccurrence) -> bool
+        {
+            return isBackward ? (anOccurrence.time > anotherOccurrence.time) : (anOccurrence.time < anotherOccurrence.time) ;
+        }
+    ) ;
+
+    for (const auto& occurrence : aStepEventOccurrenceArray)
+    {
+
+        anEventOccurrenceArray.add(occurrence) ;
+
+        if (anEventArray[occurrence.eventIndex]->isTerminal())
+        {
+            return true ;
+        }
+
+    }
+
+    return false ;
+
+}
+
+Array<double>                   NumericalSolver::IntegrationTimesFromInstants ( const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              )
+{
+
+    // Add start instant to the start of array and convert to integration seconds
+    Array<double> anIntegrationDurationInSecsArray = { 0.0 } ;
+    anIntegrationDurationInSecsArray.reserve(anInstantArray.size() + 1) ;
+
+    for (const auto& instant : anInstantArray)
+    {
+        anIntegrationDurationInSecsArray.add((instant - aStartInstant).inSeconds()) ;
     }
 
+    return anIntegrationDurationInSecsArray ;
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
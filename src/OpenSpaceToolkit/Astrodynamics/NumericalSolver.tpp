@@ -0,0 +1,1540 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver.tpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <boost/numeric/odeint.hpp>
+#include <boost/numeric/odeint/external/eigen/eigen.hpp>
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+#include <chrono>
+#include <tuple>
+#include <utility>
+#include <array>
+#include <mutex>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <int N, class SystemOfEquations>
+Array<NumericalSolver::FixedStateVector<N>> NumericalSolver::integrateStatesAtSortedInstants ( const FixedStateVector<N>& anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray,
+                                                                                const   SystemOfEquations&          aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    // Check if instant array has zero length
+    if (anInstantArray.size() == 0)
+    {
+        throw ostk::core::error::RuntimeError("Instant Array is empty") ;
+    }
+
+    Array<FixedStateVector<N>> stateVectorArray = Array<FixedStateVector<N>>::Empty() ;
+    stateVectorArray.reserve(anInstantArray.size()) ;
+
+    // Check if the incoming instant array is the same as the start state if it has length 1
+    if ((anInstantArray.size() == 1) && (anInstantArray[0] == aStartInstant))
+    {
+        stateVectorArray.add(anInitialStateVector) ;
+        return stateVectorArray ;
+    }
+
+    FixedStateVector<N> aStateVector = anInitialStateVector ;
+
+    const Array<double> anIntegrationDurationInSecsArray = NumericalSolver::IntegrationTimesFromInstants(aStartInstant, anInstantArray) ;
+
+    if (anObserver != nullptr)
+    {
+        anObserver->reset() ;
+    }
+
+    // Observers receive dynamically sized state vectors: reuse the same one for every notification
+    StateVector observedStateVector(anObserver != nullptr ? N : 0) ;
+
+    // The first observation is a repeat of the start state and is skipped
+    bool isStartStateObserved = false ;
+
+    this->integrateStateAtTimes
+    (
+        aStateVector,
+        anIntegrationDurationInSecsArray,
+        aSystemOfEquations,
+        [&] (const FixedStateVector<N>& x, const double t) -> void
+        {
+
+            this->observeFixedState(x, t, anObserver, observedStateVector) ;
+
+            if (isStartStateObserved)
+            {
+                stateVectorArray.add(x) ;
+            }
+
+            isStartStateObserved = true ;
+
+        }
+    ) ;
+
+    return stateVectorArray ;
+
+}
+
+template <int N, class SystemOfEquations>
+NumericalSolver::FixedStateVector<N> NumericalSolver::integrateStateFromInstantToInstant ( const FixedStateVector<N>& anInitialStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant,
+                                                                                const   SystemOfEquations&          aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+    return this->integrateStateForDuration<N>(anInitialStateVector, (anEndInstant - aStartInstant), aSystemOfEquations, anObserver) ;
+}
+
+template <int N, class SystemOfEquations>
+NumericalSolver::FixedStateVector<N> NumericalSolver::integrateStateForDuration ( const FixedStateVector<N>&  anInitialStateVector,
+                                                                                const   Duration&                   anIntegrationDuration,
+                                                                                const   SystemOfEquations&          aSystemOfEquations,
+                                                                                const   Shared<Observer>&           anObserver                                  ) const
+{
+
+    if ((anIntegrationDuration.inSeconds()).isZero()) // If integration duration is zero seconds long, skip integration
+    {
+        return anInitialStateVector ;
+    }
+
+    FixedStateVector<N> aStateVector = anInitialStateVector ;
+
+    if (anObserver != nullptr)
+    {
+        anObserver->reset() ;
+    }
+
+    // Observers receive dynamically sized state vectors: reuse the same one for every notification
+    StateVector observedStateVector(anObserver != nullptr ? N : 0) ;
+
+    this->integrateState
+    (
+        aStateVector,
+        0.0,
+        anIntegrationDuration.inSeconds(),
+        aSystemOfEquations,
+        [&] (const FixedStateVector<N>& x, const double t) -> void
+        {
+            this->observeFixedState(x, t, anObserver, observedStateVector) ;
+        }
+    ) ;
+
+    return aStateVector ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The step size controller of the multistep stepper applies its control law to each coefficient of the error,
+// which the vector space algebra used for Eigen states cannot do
+
+struct NumericalSolver::CoefficientWiseAlgebra
+{
+
+    template <class S1, class S2, class Op>
+    static void for_each2 (S1& s1, S2& s2, Op op)
+    {
+
+        for (std::ptrdiff_t i = 0 ; i < static_cast<std::ptrdiff_t>(s1.size()) ; ++i)
+        {
+            op(s1.data()[i], s2.data()[i]) ;
+        }
+
+    }
+
+    template <class S1, class S2, class S3, class Op>
+    static void for_each3 (S1& s1, S2& s2, S3& s3, Op op)
+    {
+
+        for (std::ptrdiff_t i = 0 ; i < static_cast<std::ptrdiff_t>(s1.size()) ; ++i)
+        {
+            op(s1.data()[i], s2.data()[i], s3.data()[i]) ;
+        }
+
+    }
+
+    template <class S1, class S2, class S3, class S4, class Op>
+    static void for_each4 (S1& s1, S2& s2, S3& s3, S4& s4, Op op)
+    {
+
+        for (std::ptrdiff_t i = 0 ; i < static_cast<std::ptrdiff_t>(s1.size()) ; ++i)
+        {
+            op(s1.data()[i], s2.data()[i], s3.data()[i], s4.data()[i]) ;
+        }
+
+    }
+
+    template <class S>
+    static double norm_inf (const S& s)
+    {
+
+        double norm = 0.0 ;
+
+        for (std::ptrdiff_t i = 0 ; i < static_cast<std::ptrdiff_t>(s.size()) ; ++i)
+        {
+            norm = std::max(norm, std::abs(s.data()[i])) ;
+        }
+
+        return norm ;
+
+    }
+
+} ;
+
+// Odeint's Bulirsch-Stoer stepper selects its order by comparing the work per unit step, signed with the step:
+// backward steps are taken in reversed time, where they are forward steps of the negated system of equations
+
+template <class StateType>
+class NumericalSolver::BulirschStoerStepper
+{
+
+    public:
+
+        typedef boost::numeric::odeint::bulirsch_stoer<StateType> stepper_type ;
+        typedef typename stepper_type::state_type state_type ;
+        typedef typename stepper_type::value_type value_type ;
+        typedef typename stepper_type::deriv_type deriv_type ;
+        typedef typename stepper_type::time_type time_type ;
+        typedef typename stepper_type::algebra_type algebra_type ;
+        typedef typename stepper_type::operations_type operations_type ;
+        typedef typename stepper_type::resizer_type resizer_type ;
+        typedef typename stepper_type::stepper_category stepper_category ;
+
+                                BulirschStoerStepper                        (   const   double                      anAbsoluteTolerance,
+                                                                                const   double                      aRelativeTolerance                          )
+                                :   stepper_(anAbsoluteTolerance, aRelativeTolerance)
+        {
+
+        }
+
+        template <class System>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            if (aTimeStep >= 0.0)
+            {
+                return stepper_.try_step(aSystem, aStateVector, aTime, aTimeStep) ;
+            }
+
+            return BulirschStoerStepper::TryReversedStep(aTime, aTimeStep, [&] (time_type& aReversedTime, time_type& aReversedTimeStep)
+            {
+                return stepper_.try_step(BulirschStoerStepper::ReversedSystem(aSystem), aStateVector, aReversedTime, aReversedTimeStep) ;
+            }) ;
+
+        }
+
+        template <class System>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                const   StateType&                  aDxdt,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            if (aTimeStep >= 0.0)
+            {
+                return stepper_.try_step(aSystem, aStateVector, aDxdt, aTime, aTimeStep) ;
+            }
+
+            StateType reversedDxdt = aDxdt ;
+            BulirschStoerStepper::Negate(reversedDxdt) ;
+
+            return BulirschStoerStepper::TryReversedStep(aTime, aTimeStep, [&] (time_type& aReversedTime, time_type& aReversedTimeStep)
+            {
+                return stepper_.try_step(BulirschStoerStepper::ReversedSystem(aSystem), aStateVector, reversedDxdt, aReversedTime, aReversedTimeStep) ;
+            }) ;
+
+        }
+
+    private:
+
+        stepper_type stepper_ ;
+
+        template <class TryStep>
+        static boost::numeric::odeint::controlled_step_result TryReversedStep (  time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep,
+                                                                                        TryStep                     aTryStep                                    )
+        {
+
+            time_type reversedTime = -aTime ;
+            time_type reversedTimeStep = -aTimeStep ;
+
+            const boost::numeric::odeint::controlled_step_result result = aTryStep(reversedTime, reversedTimeStep) ;
+
+            aTime = -reversedTime ;
+            aTimeStep = -reversedTimeStep ;
+
+            return result ;
+
+        }
+
+        template <class System>
+        static auto             ReversedSystem                              (           System                      aSystem                                     )
+        {
+
+            return [aSystem] (const StateType& x, StateType& dxdt, const time_type t) -> void
+            {
+
+                aSystem(x, dxdt, -t) ;
+
+                BulirschStoerStepper::Negate(dxdt) ;
+
+            } ;
+
+        }
+
+        static void             Negate                                      (           StateType&                  aStateVector                                )
+        {
+
+            for (std::ptrdiff_t i = 0 ; i < static_cast<std::ptrdiff_t>(aStateVector.size()) ; ++i)
+            {
+                aStateVector.data()[i] = -aStateVector.data()[i] ;
+            }
+
+        }
+
+} ;
+
+// Embedded Runge-Kutta-Nystrom pair RKN6(4)6FM of Dormand, El-Mikkawy & Prince (IMA Journal of Numerical Analysis, 1987), with its last stage
+// evaluated at the end of the step, and reused as the first stage of the next step.
+// The pair is built for accelerations depending on the positions only: the velocities at the stages, passed to the system of equations for
+// velocity dependent accelerations, are interpolated from the stage accelerations (exactly for polynomials up to the stage count).
+
+template <class StateType>
+class NumericalSolver::RungeKuttaNystromStepper
+{
+
+    public:
+
+        typedef RungeKuttaNystromStepper stepper_type ;
+        typedef StateType state_type ;
+        typedef double value_type ;
+        typedef StateType deriv_type ;
+        typedef double time_type ;
+        typedef typename boost::numeric::odeint::algebra_dispatcher<StateType>::algebra_type algebra_type ;
+        typedef typename boost::numeric::odeint::operations_dispatcher<StateType>::operations_type operations_type ;
+        typedef boost::numeric::odeint::initially_resizer resizer_type ;
+        typedef boost::numeric::odeint::controlled_stepper_tag stepper_category ;
+
+                                RungeKuttaNystromStepper                    (   const   double                      anAbsoluteTolerance,
+                                                                                const   double                      aRelativeTolerance                          )
+                                :   errorChecker_(anAbsoluteTolerance, aRelativeTolerance),
+                                    isDxdtDefined_(false),
+                                    dxdtTime_(std::numeric_limits<double>::quiet_NaN())
+        {
+
+        }
+
+        // The derivative at the end of an accepted step is kept for the next step
+        template <class System>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            if ((!isDxdtDefined_) || (dxdtTime_ != aTime))
+            {
+
+                dxdt_ = aStateVector ;
+                aSystem(aStateVector, dxdt_, aTime) ;
+
+                isDxdtDefined_ = true ;
+                dxdtTime_ = aTime ;
+
+            }
+
+            const boost::numeric::odeint::controlled_step_result result = this->tryStep(aSystem, aStateVector, dxdt_, aTime, aTimeStep) ;
+
+            if (result == boost::numeric::odeint::success)
+            {
+
+                std::swap(dxdt_, stageDxdts_[stageCount - 1]) ;
+
+                dxdtTime_ = aTime ;
+
+            }
+
+            return result ;
+
+        }
+
+        template <class System>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                const   StateType&                  aDxdt,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            isDxdtDefined_ = false ;
+
+            return this->tryStep(aSystem, aStateVector, aDxdt, aTime, aTimeStep) ;
+
+        }
+
+        void                    reset                                       ( )
+        {
+            isDxdtDefined_ = false ;
+        }
+
+    private:
+
+        static constexpr std::size_t stageCount = 6 ;
+
+        // Nodes
+        static constexpr double c_[stageCount] = { 0.0, 1.0 / 10.0, 3.0 / 10.0, 7.0 / 10.0, 17.0 / 25.0, 1.0 } ;
+
+        // Position stages (the last row holds the position weights)
+        static constexpr double a_[stageCount][stageCount - 1] =
+        {
+            { 0.0, 0.0, 0.0, 0.0, 0.0 },
+            { 1.0 / 200.0, 0.0, 0.0, 0.0, 0.0 },
+            { -1.0 / 2200.0, 1.0 / 22.0, 0.0, 0.0, 0.0 },
+            { 637.0 / 6600.0, -7.0 / 110.0, 7.0 / 33.0, 0.0, 0.0 },
+            { 225437.0 / 1968750.0, -30073.0 / 281250.0, 65569.0 / 281250.0, -9367.0 / 984375.0, 0.0 },
+            { 151.0 / 2142.0, 5.0 / 116.0, 385.0 / 1368.0, 55.0 / 168.0, -6250.0 / 28101.0 }
+        } ;
+
+        // Velocity stages, interpolating the accelerations of the previous stages
+        static constexpr double aDot_[stageCount][stageCount - 1] =
+        {
+            { 0.0, 0.0, 0.0, 0.0, 0.0 },
+            { 1.0 / 10.0, 0.0, 0.0, 0.0, 0.0 },
+            { -3.0 / 20.0, 9.0 / 20.0, 0.0, 0.0, 0.0 },
+            { 56.0 / 45.0, -49.0 / 24.0, 539.0 / 360.0, 0.0, 0.0 },
+            { 41684.0 / 196875.0, -26299.0 / 112500.0, 133229.0 / 225000.0, 173111.0 / 1575000.0, 0.0 },
+            { 907.0 / 2142.0, -395.0 / 522.0, 815.0 / 684.0, 1535.0 / 252.0, -334375.0 / 56202.0 }
+        } ;
+
+        // Velocity weights
+        static constexpr double bDot_[stageCount] = { 151.0 / 2142.0, 25.0 / 522.0, 275.0 / 684.0, 275.0 / 252.0, -78125.0 / 112404.0, 1.0 / 12.0 } ;
+
+        // Differences between the weights of the 6th and of the 4th order solutions, for positions and velocities
+        static constexpr double e_[stageCount] = { 151.0 / 2142.0 - 1349.0 / 157500.0, 5.0 / 116.0 - 7873.0 / 50000.0, 385.0 / 1368.0 - 192199.0 / 900000.0, 55.0 / 168.0 - 521683.0 / 2100000.0, -6250.0 / 28101.0 + 16.0 / 125.0, 0.0 } ;
+        static constexpr double eDot_[stageCount] = { 151.0 / 2142.0 - 1349.0 / 157500.0, 25.0 / 522.0 - 7873.0 / 45000.0, 275.0 / 684.0 - 27457.0 / 90000.0, 275.0 / 252.0 - 521683.0 / 630000.0, -78125.0 / 112404.0 + 2.0 / 5.0, 0.0 } ;
+
+        boost::numeric::odeint::default_error_checker<value_type, algebra_type, operations_type> errorChecker_ ;
+        algebra_type algebra_ ;
+
+        StateType dxdt_ ;
+        bool isDxdtDefined_ ;
+        time_type dxdtTime_ ;
+
+        std::array<StateType, stageCount> stageDxdts_ ;
+        StateType stageStateVector_ ;
+        StateType errorVector_ ;
+
+        template <class System>
+        boost::numeric::odeint::controlled_step_result tryStep              (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                const   StateType&                  aDxdt,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(aStateVector.size()) ;
+
+            if ((size % 2) != 0)
+            {
+                throw ostk::core::error::runtime::Wrong("State vector size") ;
+            }
+
+            const std::ptrdiff_t dimension = size / 2 ;
+
+            if (static_cast<std::ptrdiff_t>(stageStateVector_.size()) != size)
+            {
+
+                stageStateVector_ = aStateVector ;
+                errorVector_ = aStateVector ;
+
+                for (StateType& stageDxdt : stageDxdts_)
+                {
+                    stageDxdt = aStateVector ;
+                }
+
+            }
+
+            const double h = aTimeStep ;
+            const double* x = aStateVector.data() ;
+
+            stageDxdts_[0] = aDxdt ;
+
+            for (std::size_t i = 1 ; i < stageCount ; ++i)
+            {
+
+                double* stageX = stageStateVector_.data() ;
+
+                for (std::ptrdiff_t k = 0 ; k < dimension ; ++k)
+                {
+
+                    double position = x[k] + (c_[i] * h * x[dimension + k]) ;
+                    double velocity = x[dimension + k] ;
+
+                    for (std::size_t j = 0 ; j < i ; ++j)
+                    {
+
+                        const double acceleration = stageDxdts_[j].data()[dimension + k] ;
+
+                        position += h * h * a_[i][j] * acceleration ;
+                        velocity += h * aDot_[i][j] * acceleration ;
+
+                    }
+
+                    stageX[k] = position ;
+                    stageX[dimension + k] = velocity ;
+
+                }
+
+                aSystem(stageStateVector_, stageDxdts_[i], aTime + (c_[i] * h)) ;
+
+            }
+
+            // The last stage is evaluated at the position of the 6th order solution: complete it with the velocity, and estimate the error
+
+            double* stageX = stageStateVector_.data() ;
+            double* error = errorVector_.data() ;
+
+            for (std::ptrdiff_t k = 0 ; k < dimension ; ++k)
+            {
+
+                double velocity = x[dimension + k] ;
+                double positionError = 0.0 ;
+                double velocityError = 0.0 ;
+
+                for (std::size_t j = 0 ; j < stageCount ; ++j)
+                {
+
+                    const double acceleration = stageDxdts_[j].data()[dimension + k] ;
+
+                    velocity += h * bDot_[j] * acceleration ;
+                    positionError += h * h * e_[j] * acceleration ;
+                    velocityError += h * eDot_[j] * acceleration ;
+
+                }
+
+                stageX[dimension + k] = velocity ;
+                error[k] = positionError ;
+                error[dimension + k] = velocityError ;
+
+            }
+
+            const double maximumRelativeError = errorChecker_.error(algebra_, aStateVector, aDxdt, errorVector_, h) ;
+
+            // The error estimate is of order 5 in the step size: the step is adjusted after every step, accepted or not,
+            // which avoids the rejections of a step that is only ever increased until it fails
+            const double stepFactor = std::min(5.0, std::max(0.2, 0.9 * std::pow(std::max(maximumRelativeError, 1e-10), -1.0 / 5.0))) ;
+
+            if (maximumRelativeError > 1.0)
+            {
+
+                aTimeStep = h * stepFactor ;
+
+                return boost::numeric::odeint::fail ;
+
+            }
+
+            // The derivative at the end of the step holds the final velocities
+            double* endDxdt = stageDxdts_[stageCount - 1].data() ;
+
+            for (std::ptrdiff_t k = 0 ; k < dimension ; ++k)
+            {
+                endDxdt[k] = stageX[dimension + k] ;
+            }
+
+            std::swap(aStateVector, stageStateVector_) ;
+
+            aTime += h ;
+            aTimeStep = h * stepFactor ;
+
+            return boost::numeric::odeint::success ;
+
+        }
+
+} ;
+
+// Fixed-step symplectic stepper, composing velocity Stormer-Verlet (kick-drift-kick) sub-steps of the step size times each composition weight.
+// The acceleration at the end of a sub-step is the one at the start of the next: each sub-step evaluates the system of equations once.
+// The step is always accepted, and its size left unchanged.
+
+template <class StateType>
+class NumericalSolver::SymplecticStepper
+{
+
+    public:
+
+        typedef SymplecticStepper stepper_type ;
+        typedef StateType state_type ;
+        typedef double value_type ;
+        typedef StateType deriv_type ;
+        typedef double time_type ;
+        typedef typename boost::numeric::odeint::algebra_dispatcher<StateType>::algebra_type algebra_type ;
+        typedef typename boost::numeric::odeint::operations_dispatcher<StateType>::operations_type operations_type ;
+        typedef boost::numeric::odeint::initially_resizer resizer_type ;
+        typedef boost::numeric::odeint::controlled_stepper_tag stepper_category ;
+
+                                SymplecticStepper                           (   const   Array<double>&              aCompositionWeightArray                     )
+                                :   compositionWeights_(aCompositionWeightArray),
+                                    isDxdtDefined_(false),
+                                    dxdtTime_(std::numeric_limits<double>::quiet_NaN()),
+                                    timeCompensation_(0.0)
+        {
+
+        }
+
+        // The derivative at the end of a step is kept for the next step
+        template <class System>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            if ((!isDxdtDefined_) || (dxdtTime_ != aTime))
+            {
+
+                dxdt_ = aStateVector ;
+                aSystem(aStateVector, dxdt_, aTime) ;
+
+                timeCompensation_ = 0.0 ;
+
+            }
+
+            this->step(aSystem, aStateVector, aTime, aTimeStep) ;
+
+            isDxdtDefined_ = true ;
+            dxdtTime_ = aTime ;
+
+            return boost::numeric::odeint::success ;
+
+        }
+
+        template <class System>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                const   StateType&                  aDxdt,
+                                                                                        time_type&                  aTime,
+                                                                                        time_type&                  aTimeStep                                   )
+        {
+
+            dxdt_ = aDxdt ;
+            timeCompensation_ = 0.0 ;
+
+            this->step(aSystem, aStateVector, aTime, aTimeStep) ;
+
+            isDxdtDefined_ = false ;
+
+            return boost::numeric::odeint::success ;
+
+        }
+
+        void                    reset                                       ( )
+        {
+            isDxdtDefined_ = false ;
+        }
+
+    private:
+
+        Array<double> compositionWeights_ ;
+
+        StateType dxdt_ ;
+        bool isDxdtDefined_ ;
+        time_type dxdtTime_ ;
+        time_type timeCompensation_ ; // Rounding error of the time accumulated over consecutive steps
+
+        template <class System>
+        void                    step                                        (           System                      aSystem,
+                                                                                        StateType&                  aStateVector,
+                                                                                        time_type&                  aTime,
+                                                                                const   time_type                   aTimeStep                                   )
+        {
+
+            const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(aStateVector.size()) ;
+
+            if ((size % 2) != 0)
+            {
+                throw ostk::core::error::runtime::Wrong("State vector size") ;
+            }
+
+            const std::ptrdiff_t dimension = size / 2 ;
+
+            double* x = aStateVector.data() ;
+            double subStepTime = aTime ;
+
+            for (const double compositionWeight : compositionWeights_)
+            {
+
+                const double h = compositionWeight * aTimeStep ;
+
+                const double* acceleration = dxdt_.data() + dimension ;
+
+                for (std::ptrdiff_t k = 0 ; k < dimension ; ++k)
+                {
+
+                    x[dimension + k] += 0.5 * h * acceleration[k] ;
+                    x[k] += h * x[dimension + k] ;
+
+                }
+
+                subStepTime += h ;
+
+                aSystem(aStateVector, dxdt_, subStepTime) ;
+
+                acceleration = dxdt_.data() + dimension ;
+
+                for (std::ptrdiff_t k = 0 ; k < dimension ; ++k)
+                {
+                    x[dimension + k] += 0.5 * h * acceleration[k] ;
+                }
+
+            }
+
+            // Compensated summation: after n steps, the time is n times the step, and the integration does not end with a spurious tiny step
+            const double compensatedTimeStep = aTimeStep + timeCompensation_ ;
+            const double time = aTime + compensatedTimeStep ;
+
+            timeCompensation_ = compensatedTimeStep - (time - aTime) ;
+            aTime = time ;
+
+        }
+
+} ;
+
+// Records the statistics of a single integration without touching the solver, so that concurrent integrations on a shared solver do not race
+// The record is merged into the solver statistics when it goes out of scope, including when the integration throws
+
+class NumericalSolver::IntegrationRecord
+{
+
+    public:
+
+                                IntegrationRecord                           (   const   NumericalSolver&            aNumericalSolver                            )
+                                :   numericalSolver_(aNumericalSolver),
+                                    statistics_(),
+                                    warmStartTimeStep_(std::numeric_limits<double>::quiet_NaN())
+        {
+
+        }
+
+                                IntegrationRecord                           (   const   IntegrationRecord&          anIntegrationRecord                         ) = delete ;
+
+        IntegrationRecord&      operator =                                  (   const   IntegrationRecord&          anIntegrationRecord                         ) = delete ;
+
+                                ~IntegrationRecord                          ( )
+        {
+
+            const std::lock_guard<std::mutex> lock { numericalSolver_.mutex_ } ;
+
+            numericalSolver_.statistics_ += statistics_ ;
+
+            if (!std::isnan(warmStartTimeStep_))
+            {
+                numericalSolver_.warmStartTimeStep_ = warmStartTimeStep_ ;
+            }
+
+        }
+
+        void                    addEvaluation                               (   const   double                      aWallTimeInSeconds                          )
+        {
+            statistics_.addEvaluation(aWallTimeInSeconds) ;
+        }
+
+        void                    addAcceptedStep                             (   const   double                      aStepSizeInSeconds,
+                                                                                const   bool                        isSizedByController                         )
+        {
+
+            statistics_.addAcceptedStep(aStepSizeInSeconds) ;
+
+            if (isSizedByController)
+            {
+                warmStartTimeStep_ = std::abs(aStepSizeInSeconds) ;
+            }
+
+        }
+
+        void                    addRejectedStep                             ( )
+        {
+            statistics_.addRejectedStep() ;
+        }
+
+    private:
+
+        const NumericalSolver& numericalSolver_ ;
+        Statistics statistics_ ;
+        double warmStartTimeStep_ ;
+
+} ;
+
+// Forwards the steps of a controlled stepper, recording them into an integration record, along with the step size to warm start the next integration from
+// It is also usable as the underlying stepper of a dense output stepper
+
+template <class ControlledStepperType>
+class NumericalSolver::StepperWithStatistics
+{
+
+    public:
+
+        typedef ControlledStepperType controlled_stepper_type ;
+        typedef typename ControlledStepperType::stepper_type stepper_type ;
+        typedef typename ControlledStepperType::state_type state_type ;
+        typedef typename ControlledStepperType::value_type value_type ;
+        typedef typename ControlledStepperType::deriv_type deriv_type ;
+        typedef typename ControlledStepperType::time_type time_type ;
+        typedef typename ControlledStepperType::algebra_type algebra_type ;
+        typedef typename ControlledStepperType::operations_type operations_type ;
+        typedef typename ControlledStepperType::resizer_type resizer_type ;
+        typedef typename ControlledStepperType::stepper_category stepper_category ;
+
+                                StepperWithStatistics                       (   const   ControlledStepperType&      aStepper,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         )
+                                :   stepper_(aStepper),
+                                    integrationRecordPtr_(&anIntegrationRecord),
+                                    proposedStepSize_(std::numeric_limits<time_type>::quiet_NaN())
+        {
+
+        }
+
+        // The step size is always the last argument: it holds the attempted step on entry, and the next step proposal on exit
+        template <class System, class... Arguments>
+        boost::numeric::odeint::controlled_step_result try_step             (           System                      aSystem,
+                                                                                        Arguments&&...              anArguments                                 )
+        {
+
+            const auto& stepSize = std::get<sizeof...(Arguments) - 1>(std::forward_as_tuple(anArguments...)) ;
+
+            const time_type attemptedStepSize = stepSize ;
+
+            const boost::numeric::odeint::controlled_step_result result = stepper_.try_step(aSystem, std::forward<Arguments>(anArguments)...) ;
+
+            if (result == boost::numeric::odeint::success)
+            {
+
+                // Steps shortened to land on an end or output time, and the first step, are not sized by the controller
+                integrationRecordPtr_->addAcceptedStep(attemptedStepSize, (attemptedStepSize == proposedStepSize_)) ;
+
+            }
+            else
+            {
+                integrationRecordPtr_->addRejectedStep() ;
+            }
+
+            proposedStepSize_ = stepSize ;
+
+            return result ;
+
+        }
+
+        ControlledStepperType&  accessStepper                               ( )
+        {
+            return stepper_ ;
+        }
+
+        decltype(auto)          stepper                                     ( )
+        {
+            return stepper_.stepper() ;
+        }
+
+        decltype(auto)          stepper                                     ( ) const
+        {
+            return stepper_.stepper() ;
+        }
+
+    private:
+
+        ControlledStepperType stepper_ ;
+        IntegrationRecord* integrationRecordPtr_ ;
+        time_type proposedStepSize_ ;
+
+} ;
+
+// Odeint's dense output Bulirsch-Stoer stepper, interpolating within its steps with a Hermite polynomial of the extrapolation order.
+// Controlling the interpolation error as well shortens the steps at tight tolerances, for no gain in accuracy: only the steps are controlled.
+// As with the controlled stepper, backward steps are taken in reversed time.
+// The accepted steps are recorded into an integration record: the rejected ones are retried within the stepper, and are not counted.
+
+template <class StateType>
+class NumericalSolver::BulirschStoerDenseOutputStepper
+{
+
+    public:
+
+        typedef boost::numeric::odeint::bulirsch_stoer_dense_out<StateType> stepper_type ;
+        typedef typename stepper_type::state_type state_type ;
+        typedef typename stepper_type::value_type value_type ;
+        typedef typename stepper_type::deriv_type deriv_type ;
+        typedef typename stepper_type::time_type time_type ;
+        typedef typename stepper_type::algebra_type algebra_type ;
+        typedef typename stepper_type::operations_type operations_type ;
+        typedef typename stepper_type::resizer_type resizer_type ;
+        typedef typename stepper_type::stepper_category stepper_category ;
+
+                                BulirschStoerDenseOutputStepper             (   const   double                      anAbsoluteTolerance,
+                                                                                const   double                      aRelativeTolerance,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         )
+                                :   stepper_(anAbsoluteTolerance, aRelativeTolerance),
+                                    integrationRecordPtr_(&anIntegrationRecord),
+                                    timeSign_(+1.0)
+        {
+
+        }
+
+        template <class StateInType>
+        void                    initialize                                  (   const   StateInType&                aStateVector,
+                                                                                const   time_type                   aTime,
+                                                                                const   time_type                   aTimeStep                                   )
+        {
+
+            timeSign_ = (aTimeStep < 0.0) ? -1.0 : +1.0 ;
+
+            stepper_.initialize(aStateVector, (timeSign_ * aTime), (timeSign_ * aTimeStep)) ;
+
+        }
+
+        template <class System>
+        std::pair<time_type, time_type> do_step                             (           System                      aSystem                                     )
+        {
+
+            typename boost::numeric::odeint::unwrap_reference<System>::type& system = aSystem ;
+
+            const time_type timeSign = timeSign_ ;
+
+            const std::pair<time_type, time_type> stepTimes = stepper_.do_step([&system, timeSign] (const StateType& x, StateType& dxdt, const time_type t) -> void
+            {
+
+                system(x, dxdt, (timeSign * t)) ;
+
+                if (timeSign < 0.0)
+                {
+
+                    for (std::ptrdiff_t i = 0 ; i < static_cast<std::ptrdiff_t>(dxdt.size()) ; ++i)
+                    {
+                        dxdt.data()[i] = -dxdt.data()[i] ;
+                    }
+
+                }
+
+            }) ;
+
+            integrationRecordPtr_->addAcceptedStep((timeSign * (stepTimes.second - stepTimes.first)), true) ;
+
+            return { (timeSign * stepTimes.first), (timeSign * stepTimes.second) } ;
+
+        }
+
+        template <class StateOutType>
+        void                    calc_state                                  (   const   time_type                   aTime,
+                                                                                        StateOutType&               aStateVector                                ) const
+        {
+            stepper_.calc_state((timeSign_ * aTime), aStateVector) ;
+        }
+
+        const state_type&       current_state                               ( ) const
+        {
+            return stepper_.current_state() ;
+        }
+
+        time_type               current_time                                ( ) const
+        {
+            return timeSign_ * stepper_.current_time() ;
+        }
+
+        const state_type&       previous_state                              ( ) const
+        {
+            return stepper_.previous_state() ;
+        }
+
+        time_type               previous_time                               ( ) const
+        {
+            return timeSign_ * stepper_.previous_time() ;
+        }
+
+        time_type               current_time_step                           ( ) const
+        {
+            return timeSign_ * stepper_.current_time_step() ;
+        }
+
+    private:
+
+        stepper_type stepper_ ;
+        IntegrationRecord* integrationRecordPtr_ ;
+        time_type timeSign_ ;
+
+} ;
+
+template <class ControlledStepperType>
+NumericalSolver::StepperWithStatistics<ControlledStepperType> NumericalSolver::stepperWithStatistics ( const ControlledStepperType& aStepper, IntegrationRecord& anIntegrationRecord ) const
+{
+    return { aStepper, anIntegrationRecord } ;
+}
+
+template <class ControlledStepperType>
+auto                            NumericalSolver::denseOutputWithStatistics  (   const   ControlledStepperType&      aStepper,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         ) const
+{
+    return boost::numeric::odeint::dense_output_runge_kutta<NumericalSolver::StepperWithStatistics<ControlledStepperType>>(this->stepperWithStatistics(aStepper, anIntegrationRecord)) ;
+}
+
+template <class SystemType>
+auto                            NumericalSolver::systemWithStatistics       (   const   SystemType&                 aSystemOfEquations,
+                                                                                        IntegrationRecord&          anIntegrationRecord                         ) const
+{
+
+    const bool isSecondOrder = this->isSecondOrder() ;
+    const bool evaluationTiming = evaluationTiming_ ;
+
+    return [&aSystemOfEquations, &anIntegrationRecord, isSecondOrder, evaluationTiming] (const auto& x, auto& dxdt, const double t) -> void
+    {
+
+        // Evaluations are always counted, the clock is only read when timing is enabled
+
+        if (evaluationTiming)
+        {
+
+            const auto startTime = std::chrono::steady_clock::now() ;
+
+            aSystemOfEquations(x, dxdt, t) ;
+
+            anIntegrationRecord.addEvaluation(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count()) ;
+
+        }
+        else
+        {
+
+            aSystemOfEquations(x, dxdt, t) ;
+
+            anIntegrationRecord.addEvaluation(0.0) ;
+
+        }
+
+        if (isSecondOrder)
+        {
+
+            const std::ptrdiff_t dimension = static_cast<std::ptrdiff_t>(x.size()) / 2 ;
+
+            for (std::ptrdiff_t k = 0 ; k < dimension ; ++k)
+            {
+                dxdt.data()[k] = x.data()[dimension + k] ;
+            }
+
+        }
+
+    } ;
+
+}
+
+template <class StateType, class SystemType>
+double                          NumericalSolver::initialTimeStep            (   const   StateType&                  aStateVector,
+                                                                                const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemType&                 aSystemOfEquations                          ) const
+{
+
+    // Ensure integration starts in the correct direction
+    const double durationSign = (anEndTime < aStartTime) ? -1.0 : +1.0 ;
+
+    // Symplectic steppers are fixed-step: they always take the provided time step
+    switch (stepperType_)
+    {
+
+        case NumericalSolver::StepperType::StormerVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        case NumericalSolver::StepperType::Yoshida6:
+            return timeStep_ * durationSign ;
+
+        default:
+            break ;
+
+    }
+
+    switch (initialStepType_)
+    {
+
+        case NumericalSolver::InitialStepType::UserDefined:
+            return timeStep_ * durationSign ;
+
+        case NumericalSolver::InitialStepType::Automatic:
+            return this->estimateInitialTimeStep(aStateVector, aStartTime, anEndTime, aSystemOfEquations) * durationSign ;
+
+        case NumericalSolver::InitialStepType::WarmStart:
+        {
+
+            double warmStartTimeStep ;
+
+            {
+
+                const std::lock_guard<std::mutex> lock { mutex_ } ;
+
+                warmStartTimeStep = warmStartTimeStep_ ;
+
+            }
+
+            // The multistep stepper restarts at first order from each initial state: the step size it reached at high order does not carry over
+            if (std::isnan(warmStartTimeStep) || (stepperType_ == NumericalSolver::StepperType::AdamsBashforthMoulton))
+            {
+                return this->estimateInitialTimeStep(aStateVector, aStartTime, anEndTime, aSystemOfEquations) * durationSign ;
+            }
+
+            return warmStartTimeStep * durationSign ;
+
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Initial step type") ;
+
+    }
+
+}
+
+template <class StateType, class SystemType>
+double                          NumericalSolver::estimateInitialTimeStep    (   const   StateType&                  aStateVector,
+                                                                                const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemType&                 aSystemOfEquations                          ) const
+{
+
+    // Adapted from Hairer, Norsett & Wanner, Solving Ordinary Differential Equations I, II.4: the first and second derivatives of the state
+    // are estimated from the system of equations at the initial state, and after an explicit Euler step moving the state by a hundredth of its magnitude.
+    // They give the characteristic frequency of the motion (the mean motion, for an orbit), from which the step size is chosen so that
+    // the local error of the method, modeled as (frequency * step)^(order + 1) relative to the state, is of the order of the tolerance.
+    // Scaling each coefficient by its own tolerance, as in the original method, collapses the step when some coefficients are zero (e.g. an equatorial orbit).
+
+    const double absoluteTolerance = absoluteTolerance_ ;
+    const double relativeTolerance = relativeTolerance_ ;
+
+    const double durationSign = (anEndTime < aStartTime) ? -1.0 : +1.0 ;
+    const double duration = std::abs(anEndTime - aStartTime) ;
+
+    double order = 0.0 ;
+
+    switch (stepperType_)
+    {
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            order = 5.0 ;
+            break ;
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            order = 8.0 ;
+            break ;
+
+        case NumericalSolver::StepperType::RungeKuttaNystrom64:
+        case NumericalSolver::StepperType::Yoshida6:
+            order = 6.0 ;
+            break ;
+
+        case NumericalSolver::StepperType::StormerVerlet:
+            order = 2.0 ;
+            break ;
+
+        case NumericalSolver::StepperType::Yoshida4:
+            order = 4.0 ;
+            break ;
+
+        case NumericalSolver::StepperType::AdamsBashforthMoulton:
+            order = 1.0 ; // The multistep stepper starts at first order, and raises its order as its history builds up
+            break ;
+
+        case NumericalSolver::StepperType::BulirschStoer:
+        case NumericalSolver::StepperType::BulirschStoerDenseOutput:
+            order = 10.0 ; // The extrapolation starts at order 10, and adapts from there
+            break ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type") ;
+
+    }
+
+    const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(aStateVector.size()) ;
+
+    // Root mean square of the coefficients of a vector
+    const auto norm = [size] (const double* aVector) -> double
+    {
+
+        double sum = 0.0 ;
+
+        for (std::ptrdiff_t i = 0 ; i < size ; ++i)
+        {
+            sum += aVector[i] * aVector[i] ;
+        }
+
+        return std::sqrt(sum / static_cast<double>(std::max<std::ptrdiff_t>(size, 1))) ;
+
+    } ;
+
+    StateType dxdt = aStateVector ;
+    aSystemOfEquations(aStateVector, dxdt, aStartTime) ;
+
+    const double stateNorm = norm(aStateVector.data()) ;
+    const double derivativeNorm = norm(dxdt.data()) ;
+
+    static const double smallNorm = 1e-10 ;
+
+    double eulerTimeStep = ((stateNorm <= smallNorm) || (derivativeNorm <= smallNorm)) ? 1e-6 : (0.01 * stateNorm / derivativeNorm) ;
+
+    if (duration > 0.0)
+    {
+        eulerTimeStep = std::min(eulerTimeStep, duration) ;
+    }
+
+    StateType eulerStateVector = aStateVector ;
+
+    for (std::ptrdiff_t i = 0 ; i < size ; ++i)
+    {
+        eulerStateVector.data()[i] += durationSign * eulerTimeStep * dxdt.data()[i] ;
+    }
+
+    StateType eulerDxdt = aStateVector ;
+    aSystemOfEquations(eulerStateVector, eulerDxdt, aStartTime + (durationSign * eulerTimeStep)) ;
+
+    for (std::ptrdiff_t i = 0 ; i < size ; ++i)
+    {
+        eulerDxdt.data()[i] -= dxdt.data()[i] ;
+    }
+
+    const double secondDerivativeNorm = norm(eulerDxdt.data()) / eulerTimeStep ;
+
+    double timeStep = 0.0 ;
+
+    if ((stateNorm > smallNorm) && ((derivativeNorm > smallNorm) || (secondDerivativeNorm > smallNorm)))
+    {
+
+        const double frequency = std::max(derivativeNorm / stateNorm, std::sqrt(secondDerivativeNorm / stateNorm)) ;
+        const double tolerance = relativeTolerance + (absoluteTolerance / stateNorm) ;
+
+        timeStep = std::pow(tolerance, 1.0 / (order + 1.0)) / frequency ;
+
+    }
+    else
+    {
+        timeStep = std::max(1e-6, eulerTimeStep * 1e-3) ;
+    }
+
+    timeStep = std::min(timeStep, 100.0 * eulerTimeStep) ;
+
+    return (duration > 0.0) ? std::min(timeStep, duration) : timeStep ;
+
+}
+
+template <class StateType>
+auto                            NumericalSolver::makeAdamsBashforthMoultonStepper ( ) const
+{
+
+    using namespace boost::numeric::odeint ;
+
+    typedef adaptive_adams_bashforth_moulton<12, StateType> ErrorStepperType ;
+    typedef detail::pid_step_adjuster<StateType, double, StateType, double, NumericalSolver::CoefficientWiseAlgebra, default_operations> StepAdjusterType ;
+    typedef controlled_adams_bashforth_moulton<ErrorStepperType, StepAdjusterType> ControlledStepperType ;
+
+    // make_controlled would cap the step size to 1 s, which defeats the purpose of a high order method
+    return ControlledStepperType(StepAdjusterType(absoluteTolerance_, relativeTolerance_, std::numeric_limits<double>::max())) ;
+
+}
+
+template <class StateType>
+NumericalSolver::SymplecticStepper<StateType> NumericalSolver::makeSymplecticStepper ( ) const
+{
+
+    // Composition weights of Yoshida, Construction of higher order symplectic integrators (Physics Letters A, 1990)
+
+    switch (stepperType_)
+    {
+
+        case NumericalSolver::StepperType::StormerVerlet:
+            return NumericalSolver::SymplecticStepper<StateType>({ 1.0 }) ;
+
+        case NumericalSolver::StepperType::Yoshida4:
+        {
+
+            // Triple jump
+            const double cubeRootOfTwo = std::cbrt(2.0) ;
+
+            const double w1 = 1.0 / (2.0 - cubeRootOfTwo) ;
+            const double w0 = -cubeRootOfTwo / (2.0 - cubeRootOfTwo) ;
+
+            return NumericalSolver::SymplecticStepper<StateType>({ w1, w0, w1 }) ;
+
+        }
+
+        case NumericalSolver::StepperType::Yoshida6:
+        {
+
+            // Solution A
+            const double w1 = -1.17767998417887 ;
+            const double w2 = 0.235573213359357 ;
+            const double w3 = 0.784513610477560 ;
+            const double w0 = 1.0 - (2.0 * (w1 + w2 + w3)) ;
+
+            return NumericalSolver::SymplecticStepper<StateType>({ w3, w2, w1, w0, w1, w2, w3 }) ;
+
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type") ;
+
+    }
+
+}
+
+template <class StateType, class SystemType, class ObserverType>
+void                            NumericalSolver::integrateState             (           StateType&                  aStateVector,
+                                                                                const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   SystemType&                 aSystemOfEquations,
+                                                                                        ObserverType                anObserver                                  ) const
+{
+
+    using namespace boost::numeric::odeint ;
+
+    NumericalSolver::IntegrationRecord integrationRecord { *this } ;
+
+    const auto systemOfEquations = this->systemWithStatistics(aSystemOfEquations, integrationRecord) ;
+
+    // With constant logging, the time step is the logging interval
+    const double adjustedTimeStep = (logType_ == NumericalSolver::LogType::LogConstant)
+                                  ? (timeStep_ * ((anEndTime < aStartTime) ? -1.0 : +1.0))
+                                  : this->initialTimeStep(aStateVector, aStartTime, anEndTime, systemOfEquations) ;
+
+    const auto integrate = [&] (auto aStepper) -> void
+    {
+
+        switch (logType_)
+        {
+
+            case NumericalSolver::LogType::NoLog:
+            case NumericalSolver::LogType::LogAdaptive:
+            {
+                integrate_adaptive(aStepper, systemOfEquations, aStateVector, aStartTime, anEndTime, adjustedTimeStep, anObserver) ;
+                break ;
+            }
+
+            case NumericalSolver::LogType::LogConstant:
+            {
+                integrate_const(aStepper, systemOfEquations, aStateVector, aStartTime, anEndTime, adjustedTimeStep, anObserver) ;
+                break ;
+            }
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Log type") ;
+
+        }
+
+    } ;
+
+    switch (stepperType_)
+    {
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+        {
+            integrate(this->stepperWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_cash_karp54<StateType>()), integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        {
+            integrate(this->stepperWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_fehlberg78<StateType>()), integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+        {
+            integrate(this->denseOutputWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_dopri5<StateType>()), integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::AdamsBashforthMoulton:
+        {
+            integrate(this->stepperWithStatistics(this->makeAdamsBashforthMoultonStepper<StateType>(), integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::BulirschStoer:
+        {
+            integrate(this->stepperWithStatistics(NumericalSolver::BulirschStoerStepper<StateType>(absoluteTolerance_, relativeTolerance_), integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::BulirschStoerDenseOutput:
+        {
+            integrate(NumericalSolver::BulirschStoerDenseOutputStepper<StateType>(absoluteTolerance_, relativeTolerance_, integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaNystrom64:
+        {
+            integrate(this->stepperWithStatistics(NumericalSolver::RungeKuttaNystromStepper<StateType>(absoluteTolerance_, relativeTolerance_), integrationRecord)) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::StormerVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        case NumericalSolver::StepperType::Yoshida6:
+        {
+            integrate(this->stepperWithStatistics(this->makeSymplecticStepper<StateType>(), integrationRecord)) ;
+            break ;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type") ;
+
+    }
+
+}
+
+template <class StateType, class SystemType, class ObserverType>
+void                            NumericalSolver::integrateStateAtTimes      (           StateType&                  aStateVector,
+                                                                                const   Array<double>&              aTimeArray,
+                                                                                const   SystemType&                 aSystemOfEquations,
+                                                                                        ObserverType                anObserver                                  ) const
+{
+
+    using namespace boost::numeric::odeint ;
+
+    NumericalSolver::IntegrationRecord integrationRecord { *this } ;
+
+    const auto systemOfEquations = this->systemWithStatistics(aSystemOfEquations, integrationRecord) ;
+
+    // The times are sorted: the first and last ones bound the integration
+    const double adjustedTimeStep = this->initialTimeStep(aStateVector, aTimeArray[0], aTimeArray[aTimeArray.size() - 1], systemOfEquations) ;
+
+    switch (stepperType_)
+    {
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+        {
+            integrate_times(this->stepperWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_cash_karp54<StateType>()), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        {
+            integrate_times(this->stepperWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_fehlberg78<StateType>()), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+        {
+            // Steps are taken freely, and states at the requested times are obtained from the continuous interpolant
+            integrate_times(this->denseOutputWithStatistics(make_controlled(absoluteTolerance_, relativeTolerance_, runge_kutta_dopri5<StateType>()), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::AdamsBashforthMoulton:
+        {
+            // Steps are shortened to land on the requested times, which the variable-step history supports
+            integrate_times(this->stepperWithStatistics(this->makeAdamsBashforthMoultonStepper<StateType>(), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::BulirschStoer:
+        {
+            integrate_times(this->stepperWithStatistics(NumericalSolver::BulirschStoerStepper<StateType>(absoluteTolerance_, relativeTolerance_), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::BulirschStoerDenseOutput:
+        {
+            // Steps are taken freely, and states at the requested times are obtained from the continuous interpolant
+            integrate_times(NumericalSolver::BulirschStoerDenseOutputStepper<StateType>(absoluteTolerance_, relativeTolerance_, integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaNystrom64:
+        {
+            integrate_times(this->stepperWithStatistics(NumericalSolver::RungeKuttaNystromStepper<StateType>(absoluteTolerance_, relativeTolerance_), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        case NumericalSolver::StepperType::StormerVerlet:
+        case NumericalSolver::StepperType::Yoshida4:
+        case NumericalSolver::StepperType::Yoshida6:
+        {
+            // Steps are shortened to land on the requested times
+            integrate_times(this->stepperWithStatistics(this->makeSymplecticStepper<StateType>(), integrationRecord), systemOfEquations, aStateVector, aTimeArray.begin(), aTimeArray.end(), adjustedTimeStep, anObserver) ;
+            break ;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type") ;
+
+    }
+
+}
+
+template <int N>
+void                            NumericalSolver::observeFixedState          (   const   FixedStateVector<N>&        x,
+                                                                                const   double                      t,
+                                                                                const   Shared<Observer>&           anObserver,
+                                                                                        StateVector&                anObservedStateVector                       ) const
+{
+
+    if (logType_ != NumericalSolver::LogType::NoLog)
+    {
+        NumericalSolver::LogState(x, t) ;
+    }
+
+    if (anObserver != nullptr)
+    {
+
+        std::copy(x.data(), x.data() + N, anObservedStateVector.begin()) ;
+
+        anObserver->notify(anObservedStateVector, t) ;
+
+    }
+
+}
+
+template <class StateType>
+void                            NumericalSolver::LogState                   (   const   StateType&                  x,
+                                                                                const   double                      t                                           )
+{
+
+    std::cout.precision(3) ;
+    std::cout.setf(std::ios::fixed,std::ios::floatfield) ;
+
+    std::cout << std::left << std::setw(15) << t ;
+
+    std::cout.precision(10) ;
+    std::cout.setf(std::ios::scientific,std::ios::floatfield) ;
+
+    for (Size i = 0; i < static_cast<Size>(x.size()); i++)
+    {
+        std::cout << std::internal << std::setw(16) << x[i] << "     " ;
+    }
+
+    std::cout << std::endl ;
+
+    std::cout.setf(std::ios::fixed,std::ios::floatfield) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
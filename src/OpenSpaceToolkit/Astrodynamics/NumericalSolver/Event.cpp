@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Event.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Event.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Event::Event                                (   const   String&                     aName,
+                                                                                const   Function&                   aFunction,
+                                                                                const   Event::Direction&           aDirection,
+                                                                                const   bool                        isTerminal                                  )
+                                :   name_(aName),
+                                    function_(aFunction),
+                                    direction_(aDirection),
+                                    terminal_(isTerminal)
+{
+
+    if (!function_)
+    {
+        throw ostk::core::error::runtime::Undefined("Function") ;
+    }
+
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Event&                      anEvent                                     )
+{
+
+    anEvent.print(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+String                          Event::getName                              ( ) const
+{
+    return name_ ;
+}
+
+Event::Direction                Event::getDirection                         ( ) const
+{
+    return direction_ ;
+}
+
+bool                            Event::isTerminal                           ( ) const
+{
+    return terminal_ ;
+}
+
+double                          Event::evaluate                             (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       ) const
+{
+    return function_(aStateVector, aTime) ;
+}
+
+bool                            Event::isCrossing                           (   const   double                      aPreviousValue,
+                                                                                const   double                      aValue,
+                                                                                const   bool                        isBackward                                  ) const
+{
+
+    // Crossings in the order of integration: the previous value must be strictly on one side of zero
+    const bool isPositiveCrossing = (aPreviousValue < 0.0) && (aValue >= 0.0) ;
+    const bool isNegativeCrossing = (aPreviousValue > 0.0) && (aValue <= 0.0) ;
+
+    switch (direction_)
+    {
+
+        case Event::Direction::Increasing:
+            return isBackward ? isNegativeCrossing : isPositiveCrossing ;
+
+        case Event::Direction::Decreasing:
+            return isBackward ? isPositiveCrossing : isNegativeCrossing ;
+
+        case Event::Direction::Any:
+            return isPositiveCrossing || isNegativeCrossing ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Direction") ;
+
+    }
+
+}
+
+void                            Event::print                                (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Event") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Name:"                               << name_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Direction:"                          << Event::StringFromDirection(direction_) ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Terminal:"                           << (terminal_ ? "True" : "False") ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+String                          Event::StringFromDirection                  (   const   Event::Direction&           aDirection                                  )
+{
+
+    switch (aDirection)
+    {
+
+        case Event::Direction::Increasing:
+            return "Increasing" ;
+
+        case Event::Direction::Decreasing:
+            return "Decreasing" ;
+
+        case Event::Direction::Any:
+            return "Any" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Direction") ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
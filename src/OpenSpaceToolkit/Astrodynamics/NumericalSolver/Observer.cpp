@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observer.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Observer::Observer                          (   const   Size&                       aDecimation                                 )
+                                :   decimation_(aDecimation),
+                                    notificationCount_(0)
+{
+
+    if (decimation_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Decimation") ;
+    }
+
+}
+
+                                Observer::~Observer                         ( )
+{
+
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Observer&                   anObserver                                  )
+{
+
+    anObserver.print(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+Size                            Observer::getDecimation                     ( ) const
+{
+    return decimation_ ;
+}
+
+Size                            Observer::getNotificationCount              ( ) const
+{
+    return notificationCount_ ;
+}
+
+void                            Observer::notify                            (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       )
+{
+
+    if ((notificationCount_ % decimation_) == 0)
+    {
+        this->observe(aStateVector, aTime) ;
+    }
+
+    notificationCount_++ ;
+
+}
+
+void                            Observer::reset                             ( )
+{
+    notificationCount_ = 0 ;
+}
+
+void                            Observer::print                             (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Observer") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Decimation:"                         << decimation_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Notification count:"                 << notificationCount_ ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
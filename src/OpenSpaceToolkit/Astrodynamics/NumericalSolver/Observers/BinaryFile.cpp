@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/BinaryFile.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/BinaryFile.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+namespace observers
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                BinaryFile::BinaryFile                      (   const   File&                       aFile,
+                                                                                const   Size&                       aDecimation,
+                                                                                const   Size&                       aBufferSize                                 )
+                                :   Observer(aDecimation),
+                                    file_(aFile),
+                                    bufferSize_(aBufferSize),
+                                    stream_(),
+                                    buffer_(),
+                                    pendingBuffer_(),
+                                    pendingWrite_()
+{
+
+    if (!file_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File") ;
+    }
+
+    if (bufferSize_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Buffer size") ;
+    }
+
+    stream_.open(file_.getPath().toString(), std::ios::binary | std::ios::trunc) ;
+
+    if (!stream_.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", file_.toString()) ;
+    }
+
+    buffer_.reserve(bufferSize_) ;
+    pendingBuffer_.reserve(bufferSize_) ;
+
+}
+
+                                BinaryFile::~BinaryFile                     ( )
+{
+
+    try
+    {
+        this->flush() ;
+    }
+    catch (...)
+    {
+        // Destructor must not throw
+    }
+
+}
+
+File                            BinaryFile::getFile                         ( ) const
+{
+    return file_ ;
+}
+
+void                            BinaryFile::flush                           ( )
+{
+
+    this->waitForPendingWrite() ;
+
+    stream_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size() * sizeof(double)) ;
+    stream_.flush() ;
+
+    buffer_.clear() ;
+
+    if (!stream_.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write to file [{}].", file_.toString()) ;
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void                            BinaryFile::observe                         (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       )
+{
+
+    buffer_.push_back(aTime) ;
+    buffer_.insert(buffer_.end(), aStateVector.begin(), aStateVector.end()) ;
+
+    if (buffer_.size() >= bufferSize_)
+    {
+
+        this->waitForPendingWrite() ;
+
+        std::swap(buffer_, pendingBuffer_) ;
+        buffer_.clear() ;
+
+        pendingWrite_ = std::async
+        (
+            std::launch::async,
+            [this] () -> void
+            {
+                stream_.write(reinterpret_cast<const char*>(pendingBuffer_.data()), pendingBuffer_.size() * sizeof(double)) ;
+            }
+        ) ;
+
+    }
+
+}
+
+void                            BinaryFile::waitForPendingWrite             ( )
+{
+
+    if (pendingWrite_.valid())
+    {
+        pendingWrite_.get() ;
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
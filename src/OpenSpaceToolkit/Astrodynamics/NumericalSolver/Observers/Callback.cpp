@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/Callback.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/Callback.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+namespace observers
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Callback::Callback                          (   const   Function&                   aFunction,
+                                                                                const   Size&                       aDecimation                                 )
+                                :   Observer(aDecimation),
+                                    function_(aFunction)
+{
+
+    if (!function_)
+    {
+        throw ostk::core::error::runtime::Undefined("Function") ;
+    }
+
+}
+
+                                Callback::~Callback                         ( )
+{
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void                            Callback::observe                           (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       )
+{
+    function_(aStateVector, aTime) ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
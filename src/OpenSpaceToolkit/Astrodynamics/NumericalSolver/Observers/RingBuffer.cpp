@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/RingBuffer.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/RingBuffer.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+namespace observers
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                RingBuffer::RingBuffer                      (   const   Size&                       aCapacity,
+                                                                                const   Size&                       aDecimation                                 )
+                                :   Observer(aDecimation),
+                                    capacity_(aCapacity),
+                                    dimension_(0),
+                                    head_(0),
+                                    size_(0),
+                                    stateData_(),
+                                    times_()
+{
+
+    if (capacity_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Capacity") ;
+    }
+
+}
+
+                                RingBuffer::~RingBuffer                     ( )
+{
+
+}
+
+Size                            RingBuffer::getCapacity                     ( ) const
+{
+    return capacity_ ;
+}
+
+Size                            RingBuffer::getSize                         ( ) const
+{
+    return size_ ;
+}
+
+Array<RingBuffer::StateVector>  RingBuffer::getStateVectors                 ( ) const
+{
+
+    Array<StateVector> stateVectors = Array<StateVector>::Empty() ;
+    stateVectors.reserve(size_) ;
+
+    for (Size age = 0; age < size_; ++age)
+    {
+
+        const auto stateBegin = stateData_.begin() + (this->indexOf(age) * dimension_) ;
+
+        stateVectors.add(StateVector(stateBegin, stateBegin + dimension_)) ;
+
+    }
+
+    return stateVectors ;
+
+}
+
+Array<double>                   RingBuffer::getTimes                        ( ) const
+{
+
+    Array<double> times = Array<double>::Empty() ;
+    times.reserve(size_) ;
+
+    for (Size age = 0; age < size_; ++age)
+    {
+        times.add(times_[this->indexOf(age)]) ;
+    }
+
+    return times ;
+
+}
+
+void                            RingBuffer::clear                           ( )
+{
+
+    head_ = 0 ;
+    size_ = 0 ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void                            RingBuffer::observe                         (   const   StateVector&                aStateVector,
+                                                                                const   double                      aTime                                       )
+{
+
+    if (dimension_ == 0)
+    {
+
+        dimension_ = aStateVector.size() ;
+
+        stateData_.resize(capacity_ * dimension_) ;
+        times_.resize(capacity_) ;
+
+    }
+    else if (aStateVector.size() != dimension_)
+    {
+        throw ostk::core::error::runtime::Wrong("State vector dimension") ;
+    }
+
+    std::copy(aStateVector.begin(), aStateVector.end(), stateData_.begin() + (head_ * dimension_)) ;
+    times_[head_] = aTime ;
+
+    head_ = (head_ + 1) % capacity_ ;
+    size_ = std::min(size_ + 1, capacity_) ;
+
+}
+
+Size                            RingBuffer::indexOf                         (   const   Size&                       anAge                                       ) const
+{
+    return (head_ + capacity_ - size_ + anAge) % capacity_ ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
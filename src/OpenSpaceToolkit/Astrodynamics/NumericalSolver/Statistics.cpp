@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Statistics.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Statistics.hpp>
+
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace numericalsolver
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Statistics::Statistics                      ( )
+                                :   evaluationCount_(0),
+                                    acceptedStepCount_(0),
+                                    rejectedStepCount_(0),
+                                    minimumStepSize_(std::numeric_limits<double>::infinity()),
+                                    maximumStepSize_(0.0),
+                                    cumulativeStepSize_(0.0),
+                                    evaluationWallTime_(0.0)
+{
+
+}
+
+bool                            Statistics::operator ==                     (   const   Statistics&                 aStatistics                                 ) const
+{
+
+    return (evaluationCount_ == aStatistics.evaluationCount_)
+        && (acceptedStepCount_ == aStatistics.acceptedStepCount_)
+        && (rejectedStepCount_ == aStatistics.rejectedStepCount_)
+        && (minimumStepSize_ == aStatistics.minimumStepSize_)
+        && (maximumStepSize_ == aStatistics.maximumStepSize_)
+        && (cumulativeStepSize_ == aStatistics.cumulativeStepSize_)
+        && (evaluationWallTime_ == aStatistics.evaluationWallTime_) ;
+
+}
+
+bool                            Statistics::operator !=                     (   const   Statistics&                 aStatistics                                 ) const
+{
+    return !((*this) == aStatistics) ;
+}
+
+Statistics&                     Statistics::operator +=                     (   const   Statistics&                 aStatistics                                 )
+{
+
+    evaluationCount_ += aStatistics.evaluationCount_ ;
+    acceptedStepCount_ += aStatistics.acceptedStepCount_ ;
+    rejectedStepCount_ += aStatistics.rejectedStepCount_ ;
+    minimumStepSize_ = std::min(minimumStepSize_, aStatistics.minimumStepSize_) ;
+    maximumStepSize_ = std::max(maximumStepSize_, aStatistics.maximumStepSize_) ;
+    cumulativeStepSize_ += aStatistics.cumulativeStepSize_ ;
+    evaluationWallTime_ += aStatistics.evaluationWallTime_ ;
+
+    return *this ;
+
+}
+
+Statistics                      Statistics::operator +                      (   const   Statistics&                 aStatistics                                 ) const
+{
+
+    Statistics statistics = *this ;
+
+    statistics += aStatistics ;
+
+    return statistics ;
+
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Statistics&                 aStatistics                                 )
+{
+
+    aStatistics.print(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+Size                            Statistics::getEvaluationCount              ( ) const
+{
+    return evaluationCount_ ;
+}
+
+Size                            Statistics::getAcceptedStepCount            ( ) const
+{
+    return acceptedStepCount_ ;
+}
+
+Size                            Statistics::getRejectedStepCount            ( ) const
+{
+    return rejectedStepCount_ ;
+}
+
+Duration                        Statistics::getMinimumStepSize              ( ) const
+{
+    return (acceptedStepCount_ > 0) ? Duration::Seconds(minimumStepSize_) : Duration::Undefined() ;
+}
+
+Duration                        Statistics::getMaximumStepSize              ( ) const
+{
+    return (acceptedStepCount_ > 0) ? Duration::Seconds(maximumStepSize_) : Duration::Undefined() ;
+}
+
+Duration                        Statistics::getMeanStepSize                 ( ) const
+{
+    return (acceptedStepCount_ > 0) ? Duration::Seconds(cumulativeStepSize_ / static_cast<double>(acceptedStepCount_)) : Duration::Undefined() ;
+}
+
+Duration                        Statistics::getEvaluationWallTime           ( ) const
+{
+    return Duration::Seconds(evaluationWallTime_) ;
+}
+
+void                            Statistics::addEvaluation                   (   const   double                      aWallTimeInSeconds                          )
+{
+
+    ++evaluationCount_ ;
+    evaluationWallTime_ += aWallTimeInSeconds ;
+
+}
+
+void                            Statistics::addAcceptedStep                 (   const   double                      aStepSizeInSeconds                          )
+{
+
+    const double stepSize = std::abs(aStepSizeInSeconds) ;
+
+    ++acceptedStepCount_ ;
+    minimumStepSize_ = std::min(minimumStepSize_, stepSize) ;
+    maximumStepSize_ = std::max(maximumStepSize_, stepSize) ;
+    cumulativeStepSize_ += stepSize ;
+
+}
+
+void                            Statistics::addRejectedStep                 ( )
+{
+    ++rejectedStepCount_ ;
+}
+
+void                            Statistics::reset                           ( )
+{
+    *this = Statistics() ;
+}
+
+void                            Statistics::print                           (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    const auto durationString = [] (const Duration& aDuration) -> String
+    {
+        return aDuration.isDefined() ? aDuration.toString() : "Undefined" ;
+    } ;
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Integration Statistics") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Evaluation count:"                   << evaluationCount_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Accepted step count:"                << acceptedStepCount_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Rejected step count:"                << rejectedStepCount_ ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Minimum step size:"                  << durationString(this->getMinimumStepSize()) ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Maximum step size:"                  << durationString(this->getMaximumStepSize()) ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Mean step size:"                     << durationString(this->getMeanStepSize()) ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Evaluation wall time:"               << durationString(this->getEvaluationWallTime()) ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
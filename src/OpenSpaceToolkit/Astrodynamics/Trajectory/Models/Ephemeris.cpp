@@ -0,0 +1,447 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+namespace models
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::physics::time::Duration ;
+using ostk::physics::coord::Position ;
+using ostk::physics::coord::Velocity ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Quintic Hermite basis in the power basis: coefficients by increasing power of s, for the position and the velocity (scaled by the step) and the
+// acceleration (scaled by the step squared) at the start and at the end of a step
+
+static const double HermiteBasis[6][6] =
+{
+    { 1.0, 0.0, 0.0, -10.0, 15.0, -6.0 },                                       // Start position
+    { 0.0, 0.0, 0.0, 10.0, -15.0, 6.0 },                                        // End position
+    { 0.0, 1.0, 0.0, -6.0, 8.0, -3.0 },                                         // Start velocity
+    { 0.0, 0.0, 0.0, -4.0, 7.0, -3.0 },                                         // End velocity
+    { 0.0, 0.0, 0.5, -1.5, 1.5, -0.5 },                                         // Start acceleration
+    { 0.0, 0.0, 0.0, 0.5, -1.0, 0.5 }                                           // End acceleration
+} ;
+
+static Vector3d                 EvaluatePolynomial                          (   const   Array<Vector3d>&            aCoefficientArray,
+                                                                                const   double                      aNormalizedTime                             )
+{
+
+    Vector3d value = Vector3d::Zero() ;
+
+    for (auto coefficientIt = aCoefficientArray.rbegin() ; coefficientIt != aCoefficientArray.rend() ; ++coefficientIt)
+    {
+        value = (value * aNormalizedTime) + (*coefficientIt) ;
+    }
+
+    return value ;
+
+}
+
+                                Ephemeris::Ephemeris                        (   const   Array<State>&               aNodeStateArray,
+                                                                                const   Array<Vector3d>&            aNodeAccelerationArray                      )
+                                :   Model(),
+                                    epoch_(Instant::Undefined()),
+                                    frameSPtr_(nullptr),
+                                    times_(Array<double>::Empty()),
+                                    positions_(Array<Vector3d>::Empty()),
+                                    velocities_(Array<Vector3d>::Empty()),
+                                    stepPolynomials_(Array<Ephemeris::StepPolynomial>::Empty())
+{
+
+    if (aNodeStateArray.getSize() != aNodeAccelerationArray.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Node acceleration array size") ;
+    }
+
+    this->setNodes(aNodeStateArray) ;
+
+    if (times_.getSize() < 2)
+    {
+        return ;
+    }
+
+    stepPolynomials_.reserve(times_.getSize() - 1) ;
+
+    for (Size k = 0 ; (k + 1) < times_.getSize() ; ++k)
+    {
+
+        const double h = times_[k + 1] - times_[k] ;
+
+        const Vector3d nodeValues[6] = { positions_[k], positions_[k + 1], h * velocities_[k], h * velocities_[k + 1], (h * h) * aNodeAccelerationArray[k], (h * h) * aNodeAccelerationArray[k + 1] } ;
+
+        Array<Vector3d> positionCoefficients(6, Vector3d::Zero()) ;
+
+        for (Size power = 0 ; power < 6 ; ++power)
+        {
+
+            for (Size basisIndex = 0 ; basisIndex < 6 ; ++basisIndex)
+            {
+                positionCoefficients[power] += HermiteBasis[basisIndex][power] * nodeValues[basisIndex] ;
+            }
+
+        }
+
+        // The velocity is the derivative of the position
+
+        Array<Vector3d> velocityCoefficients(5, Vector3d::Zero()) ;
+
+        for (Size power = 0 ; power < 5 ; ++power)
+        {
+            velocityCoefficients[power] = (static_cast<double>(power + 1) / h) * positionCoefficients[power + 1] ;
+        }
+
+        stepPolynomials_.add({ positionCoefficients, velocityCoefficients }) ;
+
+    }
+
+}
+
+                                Ephemeris::Ephemeris                        (   const   Array<State>&               aNodeStateArray,
+                                                                                const   Array<Ephemeris::StepPolynomial>& aStepPolynomialArray                  )
+                                :   Model(),
+                                    epoch_(Instant::Undefined()),
+                                    frameSPtr_(nullptr),
+                                    times_(Array<double>::Empty()),
+                                    positions_(Array<Vector3d>::Empty()),
+                                    velocities_(Array<Vector3d>::Empty()),
+                                    stepPolynomials_(aStepPolynomialArray)
+{
+
+    if ((aNodeStateArray.isEmpty() && (!aStepPolynomialArray.isEmpty())) || ((!aNodeStateArray.isEmpty()) && ((aStepPolynomialArray.getSize() + 1) != aNodeStateArray.getSize())))
+    {
+        throw ostk::core::error::runtime::Wrong("Step polynomial array size") ;
+    }
+
+    for (const auto& stepPolynomial : aStepPolynomialArray)
+    {
+
+        if (stepPolynomial.positionCoefficientArray.isEmpty() || stepPolynomial.velocityCoefficientArray.isEmpty())
+        {
+            throw ostk::core::error::runtime::Undefined("Step polynomial") ;
+        }
+
+    }
+
+    this->setNodes(aNodeStateArray) ;
+
+}
+
+Ephemeris*                      Ephemeris::clone                            ( ) const
+{
+    return new Ephemeris(*this) ;
+}
+
+bool                            Ephemeris::operator ==                      (   const   Ephemeris&                  anEphemeris                                 ) const
+{
+
+    if ((!this->isDefined()) || (!anEphemeris.isDefined()))
+    {
+        return false ;
+    }
+
+    return (epoch_ == anEphemeris.epoch_)
+        && (*frameSPtr_ == *anEphemeris.frameSPtr_)
+        && (times_ == anEphemeris.times_)
+        && (positions_ == anEphemeris.positions_)
+        && (velocities_ == anEphemeris.velocities_)
+        && std::equal(stepPolynomials_.begin(), stepPolynomials_.end(), anEphemeris.stepPolynomials_.begin(), anEphemeris.stepPolynomials_.end(), [] (const auto& aStepPolynomial, const auto& anotherStepPolynomial) -> bool
+        {
+            return (aStepPolynomial.positionCoefficientArray == anotherStepPolynomial.positionCoefficientArray) && (aStepPolynomial.velocityCoefficientArray == anotherStepPolynomial.velocityCoefficientArray) ;
+        }) ;
+
+}
+
+bool                            Ephemeris::operator !=                      (   const   Ephemeris&                  anEphemeris                                 ) const
+{
+    return !((*this) == anEphemeris) ;
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Ephemeris&                  anEphemeris                                 )
+{
+
+    anEphemeris.print(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+bool                            Ephemeris::isDefined                        ( ) const
+{
+    return !times_.isEmpty() ;
+}
+
+Interval                        Ephemeris::getInterval                      ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris") ;
+    }
+
+    return Interval::Closed(epoch_, epoch_ + Duration::Seconds(times_.accessLast())) ;
+
+}
+
+Size                            Ephemeris::getStepCount                     ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris") ;
+    }
+
+    return times_.getSize() - 1 ;
+
+}
+
+Array<State>                    Ephemeris::getNodeStateArray                ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris") ;
+    }
+
+    Array<State> nodeStates = Array<State>::Empty() ;
+    nodeStates.reserve(times_.getSize()) ;
+
+    for (Size k = 0 ; k < times_.getSize() ; ++k)
+    {
+        nodeStates.add({ epoch_ + Duration::Seconds(times_[k]), Position::Meters(positions_[k], frameSPtr_), Velocity::MetersPerSecond(velocities_[k], frameSPtr_) }) ;
+    }
+
+    return nodeStates ;
+
+}
+
+State                           Ephemeris::calculateStateAt                 (   const   Instant&                    anInstant                                   ) const
+{
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris") ;
+    }
+
+    const double time = (anInstant - epoch_).inSeconds() ;
+
+    if ((time < 0.0) || (time > times_.accessLast()))
+    {
+        throw ostk::core::error::RuntimeError("Cannot calculate state at [{}], outside of ephemeris interval.", anInstant.toString()) ;
+    }
+
+    // Step holding the instant: the last node at or before it, the last step holding the end of the ephemeris
+
+    const Size nodeIndex = static_cast<Size>(std::upper_bound(times_.begin(), times_.end(), time) - times_.begin()) - 1 ;
+
+    if ((time == times_[nodeIndex]) || (times_.getSize() == 1))
+    {
+        return { anInstant, Position::Meters(positions_[nodeIndex], frameSPtr_), Velocity::MetersPerSecond(velocities_[nodeIndex], frameSPtr_) } ;
+    }
+
+    const Size stepIndex = std::min<Size>(nodeIndex, times_.getSize() - 2) ;
+
+    const double s = (time - times_[stepIndex]) / (times_[stepIndex + 1] - times_[stepIndex]) ;
+
+    const Ephemeris::StepPolynomial& stepPolynomial = stepPolynomials_[stepIndex] ;
+
+    const Vector3d position = EvaluatePolynomial(stepPolynomial.positionCoefficientArray, s) ;
+    const Vector3d velocity = EvaluatePolynomial(stepPolynomial.velocityCoefficientArray, s) ;
+
+    return { anInstant, Position::Meters(position, frameSPtr_), Velocity::MetersPerSecond(velocity, frameSPtr_) } ;
+
+}
+
+void                            Ephemeris::add                              (   const   Ephemeris&                  anEphemeris                                 )
+{
+
+    if (!anEphemeris.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris") ;
+    }
+
+    if (!this->isDefined())
+    {
+
+        (*this) = anEphemeris ;
+
+        return ;
+
+    }
+
+    if (*frameSPtr_ != *anEphemeris.frameSPtr_)
+    {
+        throw ostk::core::error::runtime::Wrong("Ephemeris frame") ;
+    }
+
+    const Interval interval = this->getInterval() ;
+    const Interval otherInterval = anEphemeris.getInterval() ;
+
+    // The shared node is taken from the ephemeris that ends there
+
+    if (otherInterval.accessStart() == interval.accessEnd())
+    {
+
+        const double timeOffset = (anEphemeris.epoch_ - epoch_).inSeconds() ;
+
+        for (Size k = 1 ; k < anEphemeris.times_.getSize() ; ++k)
+        {
+
+            times_.add(timeOffset + anEphemeris.times_[k]) ;
+            positions_.add(anEphemeris.positions_[k]) ;
+            velocities_.add(anEphemeris.velocities_[k]) ;
+
+        }
+
+        stepPolynomials_.add(anEphemeris.stepPolynomials_) ;
+
+    }
+    else if (otherInterval.accessEnd() == interval.accessStart())
+    {
+
+        Ephemeris ephemeris = anEphemeris ;
+
+        ephemeris.times_.pop_back() ;
+        ephemeris.positions_.pop_back() ;
+        ephemeris.velocities_.pop_back() ;
+
+        const double timeOffset = (epoch_ - ephemeris.epoch_).inSeconds() ;
+
+        for (Size k = 0 ; k < times_.getSize() ; ++k)
+        {
+
+            ephemeris.times_.add(timeOffset + times_[k]) ;
+            ephemeris.positions_.add(positions_[k]) ;
+            ephemeris.velocities_.add(velocities_[k]) ;
+
+        }
+
+        ephemeris.stepPolynomials_.add(stepPolynomials_) ;
+
+        (*this) = ephemeris ;
+
+    }
+    else
+    {
+        throw ostk::core::error::RuntimeError("Cannot add ephemeris over [{}], not adjacent to [{}].", otherInterval.toString(), interval.toString()) ;
+    }
+
+}
+
+void                            Ephemeris::print                            (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Ephemeris") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Start instant:" << (this->isDefined() ? this->getInterval().accessStart().toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "End instant:" << (this->isDefined() ? this->getInterval().accessEnd().toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Step count:" << (this->isDefined() ? std::to_string(this->getStepCount()) : "Undefined") ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+Ephemeris                       Ephemeris::Undefined                        ( )
+{
+    return { Array<State>::Empty(), Array<Vector3d>::Empty() } ;
+}
+
+void                            Ephemeris::setNodes                         (   const   Array<State>&               aNodeStateArray                             )
+{
+
+    if (aNodeStateArray.isEmpty())
+    {
+        return ;
+    }
+
+    epoch_ = aNodeStateArray.accessFirst().accessInstant() ;
+    frameSPtr_ = aNodeStateArray.accessFirst().accessPosition().accessFrame() ;
+
+    times_.reserve(aNodeStateArray.getSize()) ;
+    positions_.reserve(aNodeStateArray.getSize()) ;
+    velocities_.reserve(aNodeStateArray.getSize()) ;
+
+    for (Size k = 0 ; k < aNodeStateArray.getSize() ; ++k)
+    {
+
+        const State& state = aNodeStateArray[k] ;
+
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Node state") ;
+        }
+
+        if ((*(state.accessPosition().accessFrame()) != *frameSPtr_) || (*(state.accessVelocity().accessFrame()) != *frameSPtr_))
+        {
+            throw ostk::core::error::runtime::Wrong("Node state frame") ;
+        }
+
+        const double time = (state.accessInstant() - epoch_).inSeconds() ;
+
+        if ((k > 0) && (time <= times_.accessLast()))
+        {
+            throw ostk::core::error::runtime::Wrong("Node state instant order") ;
+        }
+
+        times_.add(time) ;
+        positions_.add(state.accessPosition().inUnit(Position::Unit::Meter).accessCoordinates()) ;
+        velocities_.add(state.accessVelocity().inUnit(Velocity::Unit::MeterPerSecond).accessCoordinates()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool                            Ephemeris::operator ==                      (   const   Model&                      aModel                                      ) const
+{
+
+    const Ephemeris* ephemerisModelPtr = dynamic_cast<const Ephemeris*>(&aModel) ;
+
+    return (ephemerisModelPtr != nullptr) && this->operator == (*ephemerisModelPtr) ;
+
+}
+
+bool                            Ephemeris::operator !=                      (   const   Model&                      aModel                                      ) const
+{
+    return !((*this) == aModel) ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,10 +40,14 @@ static const Shared<const Frame> gcrfSPtr = Frame::GCRF() ;
 
                                 Propagated::Propagated                      (   const   SatelliteDynamics&          aSatelliteDynamics,
                                                                                 const   NumericalSolver&            aNumericalSolver,
-                                                                                const   State&                      aState                                      )
+                                                                                const   State&                      aState,
+                                                                                const   bool                        isEphemerisRetained                         )
                                 :   Model(),
                                     propagator_(aSatelliteDynamics, aNumericalSolver),
-                                    cachedStateArray_(1, aState)
+                                    cachedStateArray_(1, aState),
+                                    ephemerisRetained_(isEphemerisRetained),
+                                    ephemerisMutex_(),
+                                    ephemerisSPtr_(nullptr)
 
 {
 
@@ -51,15 +55,66 @@ static const Shared<const Frame> gcrfSPtr = Frame::GCRF() ;
 
                                 Propagated::Propagated                      (   const   SatelliteDynamics&          aSatelliteDynamics,
                                                                                 const   NumericalSolver&            aNumericalSolver,
-                                                                                const   Array<State>&               aCachedStateArray                           )
+                                                                                const   Array<State>&               aCachedStateArray,
+                                                                                const   bool                        isEphemerisRetained                         )
                                 :   Model(),
                                     propagator_(aSatelliteDynamics, aNumericalSolver),
-                                    cachedStateArray_(aCachedStateArray)
+                                    cachedStateArray_(aCachedStateArray),
+                                    ephemerisRetained_(isEphemerisRetained),
+                                    ephemerisMutex_(),
+                                    ephemerisSPtr_(nullptr)
 
 {
     sanitizeCachedArray() ;
 }
 
+                                Propagated::Propagated                      (   const   Propagated&                 aPropagatedModel                            )
+                                :   Model(aPropagatedModel),
+                                    propagator_(aPropagatedModel.propagator_),
+                                    cachedStateArray_(aPropagatedModel.cachedStateArray_),
+                                    ephemerisRetained_(aPropagatedModel.ephemerisRetained_),
+                                    ephemerisMutex_(),
+                                    ephemerisSPtr_(nullptr)
+{
+
+    const std::lock_guard<std::mutex> lock { aPropagatedModel.ephemerisMutex_ } ;
+
+    ephemerisSPtr_ = aPropagatedModel.ephemerisSPtr_ ;
+
+}
+
+Propagated&                     Propagated::operator =                      (   const   Propagated&                 aPropagatedModel                            )
+{
+
+    if (this != &aPropagatedModel)
+    {
+
+        Shared<const Ephemeris> ephemerisSPtr = nullptr ;
+
+        {
+
+            const std::lock_guard<std::mutex> lock { aPropagatedModel.ephemerisMutex_ } ;
+
+            ephemerisSPtr = aPropagatedModel.ephemerisSPtr_ ;
+
+        }
+
+        Model::operator = (aPropagatedModel) ;
+
+        this->propagator_ = aPropagatedModel.propagator_ ;
+        this->cachedStateArray_ = aPropagatedModel.cachedStateArray_ ;
+        this->ephemerisRetained_ = aPropagatedModel.ephemerisRetained_ ;
+
+        const std::lock_guard<std::mutex> lock { this->ephemerisMutex_ } ;
+
+        this->ephemerisSPtr_ = ephemerisSPtr ;
+
+    }
+
+    return *this ;
+
+}
+
 Propagated*                     Propagated::clone                           ( ) const
 {
     return new Propagated(*this) ;
@@ -168,6 +223,17 @@ Array<State>                    Propagated::calculateStatesAt               (
 
     }
 
+    if (ephemerisRetained_)
+    {
+
+        // Sampled outside of the lock: the ephemeris is not modified once grown
+
+        const Shared<const Ephemeris> ephemerisSPtr = this->extendEphemeris(Interval::Closed(anInstantArray.accessFirst(), anInstantArray.accessLast())) ;
+
+        return ephemerisSPtr->calculateStatesAt(anInstantArray) ;
+
+    }
+
     Array<State> allStates = Array<State>::Empty() ;
 
     // Maintain counter separately so as to only iterate once through instant array
@@ -360,6 +426,42 @@ const Propagator&               Propagated::accessPropagator                ( )
 
 }
 
+bool                            Propagated::isEphemerisRetained             ( ) const
+{
+    return ephemerisRetained_ ;
+}
+
+Ephemeris                       Propagated::getEphemeris                    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagated") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { this->ephemerisMutex_ } ;
+
+    return (ephemerisSPtr_ != nullptr) ? (*ephemerisSPtr_) : Ephemeris::Undefined() ;
+
+}
+
+Statistics                      Propagated::getStatistics                   ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagated") ;
+    }
+
+    return propagator_.getStatistics() ;
+
+}
+
+void                            Propagated::resetStatistics                 ( )
+{
+    propagator_.resetStatistics() ;
+}
+
 void                            Propagated::setCachedStateArray             (   const   Array<State>&               aStateArray                                 )
 {
 
@@ -367,6 +469,10 @@ void                            Propagated::setCachedStateArray             (
 
     sanitizeCachedArray() ;
 
+    const std::lock_guard<std::mutex> lock { this->ephemerisMutex_ } ;
+
+    this->ephemerisSPtr_ = nullptr ;
+
 }
 
 void                            Propagated::print                           (       std::ostream&                   anOutputStream,
@@ -425,6 +531,102 @@ void                            Propagated::sanitizeCachedArray             ( )
 
 }
 
+Shared<const Ephemeris>         Propagated::extendEphemeris                 (   const   Interval&                   anInterval                                  ) const
+{
+
+    // The propagations run outside of the lock, from a snapshot of the retained ephemeris.
+    // The grown ephemeris is installed only if the retained one was not replaced meanwhile: otherwise the coverage is checked again
+    // against the latest one, and the propagated edges are reused where they still adjoin it.
+
+    Shared<const Ephemeris> ephemerisSPtr = nullptr ;
+
+    {
+
+        const std::lock_guard<std::mutex> lock { this->ephemerisMutex_ } ;
+
+        ephemerisSPtr = ephemerisSPtr_ ;
+
+    }
+
+    Ephemeris startEphemeris = Ephemeris::Undefined() ;
+    Ephemeris endEphemeris = Ephemeris::Undefined() ;
+
+    while (true)
+    {
+
+        Shared<const Ephemeris> grownEphemerisSPtr = nullptr ;
+
+        if (ephemerisSPtr == nullptr)
+        {
+            grownEphemerisSPtr = std::make_shared<const Ephemeris>(propagator_.calculateEphemeris(cachedStateArray_.accessFirst(), anInterval)) ;
+        }
+        else
+        {
+
+            const Interval ephemerisInterval = ephemerisSPtr->getInterval() ;
+
+            if ((anInterval.accessStart() >= ephemerisInterval.accessStart()) && (anInterval.accessEnd() <= ephemerisInterval.accessEnd()))
+            {
+                return ephemerisSPtr ;
+            }
+
+            if (startEphemeris.isDefined() && (startEphemeris.getInterval().accessEnd() != ephemerisInterval.accessStart()))
+            {
+                startEphemeris = Ephemeris::Undefined() ;
+            }
+
+            if (endEphemeris.isDefined() && (endEphemeris.getInterval().accessStart() != ephemerisInterval.accessEnd()))
+            {
+                endEphemeris = Ephemeris::Undefined() ;
+            }
+
+            // Integrate from the edges of the retained ephemeris, which are integration nodes
+
+            if ((!startEphemeris.isDefined()) && (anInterval.accessStart() < ephemerisInterval.accessStart()))
+            {
+                startEphemeris = propagator_.calculateEphemeris(ephemerisSPtr->calculateStateAt(ephemerisInterval.accessStart()), Interval::Closed(anInterval.accessStart(), ephemerisInterval.accessStart())) ;
+            }
+
+            if ((!endEphemeris.isDefined()) && (anInterval.accessEnd() > ephemerisInterval.accessEnd()))
+            {
+                endEphemeris = propagator_.calculateEphemeris(ephemerisSPtr->calculateStateAt(ephemerisInterval.accessEnd()), Interval::Closed(ephemerisInterval.accessEnd(), anInterval.accessEnd())) ;
+            }
+
+            Ephemeris ephemeris = *ephemerisSPtr ;
+
+            if (startEphemeris.isDefined())
+            {
+                ephemeris.add(startEphemeris) ;
+            }
+
+            if (endEphemeris.isDefined())
+            {
+                ephemeris.add(endEphemeris) ;
+            }
+
+            grownEphemerisSPtr = std::make_shared<const Ephemeris>(ephemeris) ;
+
+        }
+
+        const std::lock_guard<std::mutex> lock { this->ephemerisMutex_ } ;
+
+        if (ephemerisSPtr_ == ephemerisSPtr)
+        {
+
+            ephemerisSPtr_ = grownEphemerisSPtr ;
+
+            return ephemerisSPtr_ ;
+
+        }
+
+        ephemerisSPtr = ephemerisSPtr_ ;
+
+    }
+
+    return nullptr ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
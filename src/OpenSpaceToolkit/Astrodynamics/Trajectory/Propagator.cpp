@@ -8,10 +8,22 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Kepler/COE.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <deque>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <cmath>
+#include <limits>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -25,277 +37,1911 @@ namespace trajectory
 
 using ostk::core::types::Size ;
 
+using ostk::physics::units::Length ;
+using ostk::physics::units::Time ;
+using ostk::physics::units::Angle ;
+using ostk::physics::units::Derived ;
+using ostk::physics::env::obj::celest::Earth ;
+
+using ostk::astro::numericalsolver::Observer ;
+using ostk::astro::trajectory::orbit::models::kepler::COE ;
+
 static const Shared<const Frame> gcrfSPtr = Frame::GCRF() ;
+static const Derived::Unit GravitationalParameterSIUnit = Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second) ;
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Encke formulation: the reference is rectified when the position deviation exceeds this fraction of the reference radius,
+// checked at output instants and at least once per reference orbital period
+static const double EnckeRectificationThreshold = 1.0e-2 ;
+static const double EnckeKeplerTolerance = 1.0e-12 ;
 
-                                Propagator::Propagator                      (   const   SatelliteDynamics&          aSatelliteDynamics,
-                                                                                const   NumericalSolver&            aNumericalSolver                            )
-                                :   satelliteDynamics_(aSatelliteDynamics),
-                                    numericalSolver_(aNumericalSolver)
+// Kustaanheimo-Stiefel formulation: output instants are reached in fictitious time to this tolerance [s]
+static const double KustaanheimoStiefelTimeTolerance = 1.0e-9 ;
+static const Size KustaanheimoStiefelMaximumIterationCount = 20 ;
 
+// Elliptic Kepler reference orbit, in GCRF SI units
+struct KeplerReference
 {
 
-}
+    Instant                     epoch ;
+    double                      gravitationalParameter ;
+    double                      semiMajorAxis ;
+    double                      eccentricity ;
+    double                      meanMotion ;
+    double                      meanAnomalyAtEpoch ;
+    Vector3d                    p ;                                             // Perifocal axis towards periapsis
+    Vector3d                    q ;                                             // Perifocal axis 90 degrees ahead of periapsis
 
-Propagator*                     Propagator::clone                           ( ) const
+} ;
+
+// Gravitational parameter of the central body of satellite dynamics, about which the reference orbits are written
+
+static Derived                  CentralBodyGravitationalParameterOf         (   const   SatelliteDynamics&          aSatelliteDynamics                          )
 {
-    return new Propagator(*this) ;
+
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+
+    Shared<const CentralBodyGravity> centralBodyGravitySPtr = nullptr ;
+
+    for (const auto& forceModelSPtr : aSatelliteDynamics.getForceModels())
+    {
+
+        const Shared<const CentralBodyGravity> forceModelCentralBodyGravitySPtr = std::dynamic_pointer_cast<const CentralBodyGravity>(forceModelSPtr) ;
+
+        if (forceModelCentralBodyGravitySPtr == nullptr)
+        {
+            continue ;
+        }
+
+        if (centralBodyGravitySPtr != nullptr)
+        {
+            throw ostk::core::error::runtime::Wrong("Central body gravity count") ;
+        }
+
+        centralBodyGravitySPtr = forceModelCentralBodyGravitySPtr ;
+
+    }
+
+    if ((centralBodyGravitySPtr == nullptr) || (!centralBodyGravitySPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Central body gravity") ;
+    }
+
+    return centralBodyGravitySPtr->getCelestialObject()->getGravitationalParameter() ;
+
 }
 
-bool                            Propagator::operator ==                     (   const   Propagator&                 aPropagator                                 ) const
+static KeplerReference          OsculatingKeplerReferenceAt                 (   const   SatelliteDynamics::StateVector& aStateVector,
+                                                                                const   Instant&                    anInstant,
+                                                                                const   Derived&                    aGravitationalParameter                     )
 {
 
-    if ((!this->isDefined()) || (!aPropagator.isDefined()))
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    const COE coe = COE::Cartesian({ Position::Meters({ aStateVector[0], aStateVector[1], aStateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ aStateVector[3], aStateVector[4], aStateVector[5] }, gcrfSPtr) }, aGravitationalParameter) ;
+
+    const double eccentricity = coe.getEccentricity() ;
+
+    if (eccentricity >= 1.0)
     {
-        return false ;
+        throw ostk::core::error::RuntimeError("Encke formulation requires an elliptic reference orbit.") ;
     }
 
-    return (satelliteDynamics_ == aPropagator     .satelliteDynamics_) && (numericalSolver_ == aPropagator     .numericalSolver_) ;
+    const double gravitationalParameter = aGravitationalParameter.in(GravitationalParameterSIUnit) ;
+    const double semiMajorAxis = coe.getSemiMajorAxis().inMeters() ;
+
+    // Same rotation as COE::getCartesianState, from the perifocal frame to GCRF
+    const RotationMatrix perifocalToGcrf = RotationMatrix::RZ(Angle::Radians(-coe.getRaan().inRadians())) * RotationMatrix::RX(Angle::Radians(-coe.getInclination().inRadians())) * RotationMatrix::RZ(Angle::Radians(-coe.getAop().inRadians())) ;
+
+    return
+    {
+        anInstant,
+        gravitationalParameter,
+        semiMajorAxis,
+        eccentricity,
+        std::sqrt(gravitationalParameter / (semiMajorAxis * semiMajorAxis * semiMajorAxis)),
+        coe.getMeanAnomaly().inRadians(),
+        perifocalToGcrf * Vector3d::X(),
+        perifocalToGcrf * Vector3d::Y()
+    } ;
 
 }
 
-bool                            Propagator::operator !=                     (   const   Propagator&                 aPropagator                                 ) const
+static void                     KeplerReferenceStateAt                      (   const   KeplerReference&            aReference,
+                                                                                const   double                      aTimeSinceEpoch,
+                                                                                        double*                     aStateVector                                )
 {
-    return !((*this) == aPropagator     ) ;
+
+    const double e = aReference.eccentricity ;
+    const double a = aReference.semiMajorAxis ;
+
+    const double eccentricAnomaly = COE::EccentricAnomalyFromMeanAnomaly(Angle::Radians(aReference.meanAnomalyAtEpoch + (aReference.meanMotion * aTimeSinceEpoch)), e, EnckeKeplerTolerance).inRadians() ;
+
+    const double cosE = std::cos(eccentricAnomaly) ;
+    const double sinE = std::sin(eccentricAnomaly) ;
+    const double sqrtOneMinusE2 = std::sqrt(1.0 - (e * e)) ;
+
+    const double positionP = a * (cosE - e) ;
+    const double positionQ = a * sqrtOneMinusE2 * sinE ;
+
+    const double velocityFactor = aReference.meanMotion * a / (1.0 - (e * cosE)) ;
+    const double velocityP = -velocityFactor * sinE ;
+    const double velocityQ = velocityFactor * sqrtOneMinusE2 * cosE ;
+
+    for (Size k = 0 ; k < 3 ; ++k)
+    {
+        aStateVector[k] = (positionP * aReference.p[k]) + (positionQ * aReference.q[k]) ;
+        aStateVector[3 + k] = (velocityP * aReference.p[k]) + (velocityQ * aReference.q[k]) ;
+    }
+
 }
 
-std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
-                                                                                const   Propagator&                 aPropagator                                 )
-{
+// Product of the KS matrix L(u) with a 4-vector: x = L(u) u, v = (2 / r) L(u) u'
 
-    aPropagator     .print(anOutputStream) ;
+static void                     KustaanheimoStiefelProduct                  (   const   double*                     u,
+                                                                                const   double*                     w,
+                                                                                        double*                     aResult                                     )
+{
 
-    return anOutputStream ;
+    aResult[0] = (u[0] * w[0]) - (u[1] * w[1]) - (u[2] * w[2]) + (u[3] * w[3]) ;
+    aResult[1] = (u[1] * w[0]) + (u[0] * w[1]) - (u[3] * w[2]) - (u[2] * w[3]) ;
+    aResult[2] = (u[2] * w[0]) + (u[3] * w[1]) + (u[0] * w[2]) + (u[1] * w[3]) ;
+    aResult[3] = (u[3] * w[0]) - (u[2] * w[1]) + (u[1] * w[2]) - (u[0] * w[3]) ;
 
 }
 
-bool                            Propagator::isDefined                       ( ) const
+// Product of the transposed KS matrix L(u)^T with a 4-vector: u' = L(u)^T v / 2
+
+static void                     KustaanheimoStiefelTransposeProduct         (   const   double*                     u,
+                                                                                const   double*                     w,
+                                                                                        double*                     aResult                                     )
 {
-    return satelliteDynamics_.isDefined() && numericalSolver_.isDefined() ;
+
+    aResult[0] = (u[0] * w[0]) + (u[1] * w[1]) + (u[2] * w[2]) + (u[3] * w[3]) ;
+    aResult[1] = - (u[1] * w[0]) + (u[0] * w[1]) + (u[3] * w[2]) - (u[2] * w[3]) ;
+    aResult[2] = - (u[2] * w[0]) - (u[3] * w[1]) + (u[0] * w[2]) + (u[1] * w[3]) ;
+    aResult[3] = (u[3] * w[0]) - (u[2] * w[1]) + (u[1] * w[2]) - (u[0] * w[3]) ;
+
 }
 
-State                           Propagator::calculateStateAt                (   const   State&                      aState,
-                                                                                const   Instant&                    anInstant                                   ) const
+// Coefficients of a polynomial of s, as a polynomial of 1 - s: q_j = (-1)^j sum_{k >= j} C(k, j) c_k
+
+static Array<Vector3d>          ReversedPolynomial                          (   const   Array<Vector3d>&            aCoefficientArray                           )
 {
 
-    if (!this->isDefined())
+    Array<Vector3d> reversedCoefficients(aCoefficientArray.getSize(), Vector3d::Zero()) ;
+
+    for (Size j = 0 ; j < aCoefficientArray.getSize() ; ++j)
     {
-        throw ostk::core::error::runtime::Undefined("Propagator") ;
-    }
 
-    const VectorXd stateCoordinates = aState.getCoordinates() ;
+        double binomialCoefficient = 1.0 ; // C(k, j), from k = j
 
-    SatelliteDynamics::StateVector startStateVector(stateCoordinates.data(), stateCoordinates.data() + stateCoordinates.size()) ;
+        for (Size k = j ; k < aCoefficientArray.getSize() ; ++k)
+        {
 
-    satelliteDynamics_.setInstant(aState.getInstant()) ;
+            reversedCoefficients[j] += binomialCoefficient * aCoefficientArray[k] ;
 
-    SatelliteDynamics::StateVector endStateVector = numericalSolver_.integrateStateFromInstantToInstant(startStateVector, aState.getInstant(), anInstant, satelliteDynamics_.getDynamicalEquations()) ;
+            binomialCoefficient *= static_cast<double>(k + 1) / static_cast<double>(k + 1 - j) ;
 
-    return {anInstant, Position::Meters({ endStateVector[0], endStateVector[1], endStateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ endStateVector[3], endStateVector[4], endStateVector[5] }, gcrfSPtr)} ;
+        }
+
+        if ((j % 2) == 1)
+        {
+            reversedCoefficients[j] = -reversedCoefficients[j] ;
+        }
+
+    }
+
+    return reversedCoefficients ;
 
 }
 
-Array<State>                    Propagator::calculateStatesAt               (   const   State&                      aState,
-                                                                                const   Array<Instant>&             anInstantArray                              ) const
+// Number of sub-steps to split a step into, for its quintic Hermite interpolant to stay within the solver tolerance.
+// The interpolant deviates from the trajectory by up to (h / 2)^6 / 720 times the sixth derivative of the position,
+// of magnitude n^6 r for an orbit of radius r and mean motion n, with n^2 estimated from the acceleration at both ends of the step.
+
+static Size                     HermiteSubdivisionCount                     (   const   double                      aStepDuration,
+                                                                                const   Vector3d&                   aStartPosition,
+                                                                                const   Vector3d&                   aStartAcceleration,
+                                                                                const   Vector3d&                   anEndPosition,
+                                                                                const   Vector3d&                   anEndAcceleration,
+                                                                                const   double                      aRelativeTolerance,
+                                                                                const   double                      anAbsoluteTolerance                         )
 {
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Propagator") ;
-    }
 
-    if (!aState.isDefined())
+    const double radius = std::max(aStartPosition.norm(), anEndPosition.norm()) ;
+
+    if (radius == 0.0)
     {
-        throw ostk::core::error::runtime::Undefined("State") ;
+        return 1 ;
     }
 
-    if (anInstantArray.isEmpty())
+    const double meanMotionSquared = std::max(aStartAcceleration.norm() / std::max(aStartPosition.norm(), std::numeric_limits<double>::min()), anEndAcceleration.norm() / std::max(anEndPosition.norm(), std::numeric_limits<double>::min())) ;
+
+    if (meanMotionSquared == 0.0)
     {
-        return Array<State>::Empty() ;
+        return 1 ;
     }
 
-    for (Size k = 0 ; k < anInstantArray.getSize() - 1; ++k)
-    {
+    const double tolerance = anAbsoluteTolerance + (aRelativeTolerance * radius) ;
 
-        if (anInstantArray[k] > anInstantArray[k + 1])
+    const double maximumStepDuration = 2.0 * std::pow((720.0 * tolerance) / (meanMotionSquared * meanMotionSquared * meanMotionSquared * radius), 1.0 / 6.0) ;
+
+    return std::max<Size>(1, static_cast<Size>(std::ceil(aStepDuration / maximumStepDuration))) ;
+
+}
+
+// Persistent worker threads, shared by all the propagators of the process, so that threads are not created on each call.
+// A run hands the workers [1, aWorkerCount) to the pooled threads and runs the worker 0 on the calling thread. The workers not yet
+// started when the calling thread is done are withdrawn, so that a run never waits for threads busy with the runs of other callers.
+
+class WorkerPool
+{
+
+    public:
+
+                                WorkerPool                                  ( )
+                                :   mutex_(),
+                                    condition_(),
+                                    configurationMutex_(),
+                                    threadCount_(WorkerPool::DefaultThreadCount()),
+                                    isStopped_(false),
+                                    threads_(),
+                                    workItems_()
         {
-            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array") ;
+
         }
 
-    }
+                                WorkerPool                                  (   const   WorkerPool&                 aWorkerPool                                 ) = delete ;
 
-    const VectorXd stateCoordinates = aState.getCoordinates() ;
-    SatelliteDynamics::StateVector startStateVector(stateCoordinates.data(), stateCoordinates.data() + stateCoordinates.size()) ;
+        WorkerPool&             operator =                                  (   const   WorkerPool&                 aWorkerPool                                 ) = delete ;
 
-    satelliteDynamics_.setInstant(aState.getInstant()) ;
+                                ~WorkerPool                                 ( )
+        {
+            this->stop() ;
+        }
 
-    Array<Instant> forwardInstants ;
-    Array<Instant> backwardInstants ;
+        Size                    getThreadCount                              ( ) const
+        {
 
-    for (const Instant& anInstant : anInstantArray)
-    {
+            const std::lock_guard<std::mutex> lock { mutex_ } ;
 
-        if (anInstant <= aState.getInstant())
+            return threadCount_ ;
+
+        }
+
+        void                    setThreadCount                              (   const   Size                        aThreadCount                                )
         {
-            backwardInstants.add(anInstant) ;
+
+            const std::lock_guard<std::mutex> configurationLock { configurationMutex_ } ;
+
+            // The pooled threads are stopped, and started again on the next run
+
+            this->stop() ;
+
+            const std::lock_guard<std::mutex> lock { mutex_ } ;
+
+            threadCount_ = (aThreadCount > 0) ? aThreadCount : WorkerPool::DefaultThreadCount() ;
+
         }
-        else
+
+        void                    run                                         (   const   Size                        aWorkerCount,
+                                                                                const   std::function<void (const Size)>& aWorker                       )
         {
-            forwardInstants.add(anInstant) ;
+
+            Job job = { &aWorker, 0 } ;
+
+            {
+
+                const std::lock_guard<std::mutex> configurationLock { configurationMutex_ } ;
+                const std::lock_guard<std::mutex> lock { mutex_ } ;
+
+                this->startThreads() ;
+
+                for (Size workerIndex = 1 ; workerIndex < aWorkerCount ; ++workerIndex)
+                {
+                    workItems_.push_back({ &job, workerIndex }) ;
+                }
+
+                job.pendingCount = aWorkerCount - 1 ;
+
+            }
+
+            condition_.notify_all() ;
+
+            aWorker(0) ;
+
+            std::unique_lock<std::mutex> lock { mutex_ } ;
+
+            for (auto workItemIt = workItems_.begin() ; workItemIt != workItems_.end() ; )
+            {
+
+                if (workItemIt->first == &job)
+                {
+
+                    workItemIt = workItems_.erase(workItemIt) ;
+
+                    --job.pendingCount ;
+
+                }
+                else
+                {
+                    ++workItemIt ;
+                }
+
+            }
+
+            condition_.wait(lock, [&job] () -> bool { return job.pendingCount == 0 ; }) ;
+
         }
 
-    }
+        static WorkerPool&      Get                                         ( )
+        {
 
-    // forward propagation only
-    Array<SatelliteDynamics::StateVector> propagatedForwardStateVectorArray ;
-    if (!forwardInstants.isEmpty())
-    {
+            static WorkerPool workerPool ;
 
-        propagatedForwardStateVectorArray = numericalSolver_.integrateStatesAtSortedInstants
-        (
-            startStateVector,
-            aState.getInstant(),
-            forwardInstants,
-            satelliteDynamics_.getDynamicalEquations()
-        ) ;
+            return workerPool ;
 
-    }
+        }
 
-    // backward propagation only
-    Array<SatelliteDynamics::StateVector> propagatedBackwardStateVectorArray ;
-    if (!backwardInstants.isEmpty())
-    {
+    private:
 
-        std::reverse(backwardInstants.begin(), backwardInstants.end()) ;
+        struct Job
+        {
+            const std::function<void (const Size)>* workerPtr ;
+            Size                pendingCount ;                                  // Workers queued or running, guarded by the pool mutex
+        } ;
+
+        mutable std::mutex      mutex_ ;                                        // Guards the thread count, the stop flag and the work items
+        std::condition_variable condition_ ;
+        std::mutex              configurationMutex_ ;                           // Serializes the starts and stops of the pooled threads
+        Size                    threadCount_ ;
+        bool                    isStopped_ ;
+        std::vector<std::thread> threads_ ;
+        std::deque<std::pair<Job*, Size>> workItems_ ;
+
+        // Start the pooled threads if needed, the calling thread taking the last place. Called with both mutexes locked.
+        void                    startThreads                                ( )
+        {
 
-        propagatedBackwardStateVectorArray = numericalSolver_.integrateStatesAtSortedInstants
-        (
-            startStateVector,
-            aState.getInstant(),
-            backwardInstants,
-            satelliteDynamics_.getDynamicalEquations()
-        ) ;
+            isStopped_ = false ;
 
-        std::reverse(propagatedBackwardStateVectorArray.begin(), propagatedBackwardStateVectorArray.end()) ;
+            // The workers of the threads that could not be started are run by the others, or withdrawn
 
-    }
+            while ((threads_.size() + 1) < threadCount_)
+            {
 
-    Array<State> propagatedStates ;
-    propagatedStates.reserve(anInstantArray.getSize()) ;
+                try
+                {
+                    threads_.emplace_back([this] () -> void { this->work() ; }) ;
+                }
+                catch (const std::system_error&)
+                {
+                    break ;
+                }
 
-    Size k = 0 ;
-    for (const SatelliteDynamics::StateVector& stateVector : (propagatedBackwardStateVectorArray + propagatedForwardStateVectorArray))
-    {
+            }
 
-        State propagatedState = {anInstantArray[k], Position::Meters( {stateVector[0], stateVector[1], stateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ stateVector[3], stateVector[4], stateVector[5] }, gcrfSPtr)} ;
+        }
 
-        propagatedStates.add(propagatedState) ;
+        // Stop the pooled threads once done with their current worker. Called with the configuration mutex locked, if any.
+        void                    stop                                        ( )
+        {
 
-        ++k ;
+            std::vector<std::thread> threads ;
 
-    }
+            {
 
-    return propagatedStates;
+                const std::lock_guard<std::mutex> lock { mutex_ } ;
 
-}
+                isStopped_ = true ;
 
-void                            Propagator::print                           (       std::ostream&                   anOutputStream,
-                                                                                    bool                            displayDecorator                            ) const
-{
+                threads.swap(threads_) ;
 
-    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Propagator") : void () ;
+            }
 
-    ostk::core::utils::Print::Separator(anOutputStream, "Satellite Dynamics") ;
-    satelliteDynamics_.print(anOutputStream, false) ;
+            condition_.notify_all() ;
 
-    ostk::core::utils::Print::Separator(anOutputStream, "Numerical Solver") ;
-    numericalSolver_.print(anOutputStream, false) ;
+            for (std::thread& thread : threads)
+            {
+                thread.join() ;
+            }
 
-    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+        }
 
-}
+        void                    work                                        ( )
+        {
 
-Propagator                      Propagator::MediumFidelity                  ( )
-{
+            std::unique_lock<std::mutex> lock { mutex_ } ;
 
-    using ostk::math::obj::Matrix3d ;
-    using ostk::math::geom::d3::objects::Cuboid ;
-    using ostk::math::geom::d3::objects::Composite ;
-    using ostk::math::geom::d3::objects::Point ;
+            while (true)
+            {
 
-    using ostk::physics::Environment ;
-    using ostk::physics::units::Mass ;
-    using ostk::physics::env::Object ;
-    using ostk::physics::env::obj::celest::Earth ;
-    using ostk::physics::env::obj::celest::Sun ;
-    using ostk::physics::env::obj::celest::Moon ;
+                condition_.wait(lock, [this] () -> bool { return isStopped_ || (!workItems_.empty()) ; }) ;
 
-    using ostk::astro::flight::system::SatelliteSystem ;
+                if (isStopped_)
+                {
+                    return ;
+                }
 
-    // Create environment
-    const Array<Shared<Object>> objects = // [TBI] Add drag to environment once it is added in ostk-physics
-    {
-        std::make_shared<Earth>(Earth::EGM2008(35, 35))
-    } ;
+                const std::pair<Job*, Size> workItem = workItems_.front() ;
 
-    const Instant instant = Instant::J2000() ;
+                workItems_.pop_front() ;
 
-    const Environment customEnvironment = Environment(instant, objects) ;
+                lock.unlock() ;
 
-    // Satellite system setup
-    const Composite satelliteGeometry = Composite { Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } ) } ;
-    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+                (*workItem.first->workerPtr)(workItem.second) ;
 
-    // Satellite dynamics setup
-    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+                lock.lock() ;
 
-    // Construct default numerical solver
-    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+                if ((--workItem.first->pendingCount) == 0)
+                {
+                    condition_.notify_all() ;
+                }
 
-    return { satelliteDynamics, numericalSolver } ;
+            }
 
-}
+        }
 
-Propagator                      Propagator::HighFidelity                    ( )
-{
+        static Size             DefaultThreadCount                          ( )
+        {
+            return std::max<Size>(1, std::thread::hardware_concurrency()) ;
+        }
 
-    using ostk::math::obj::Matrix3d ;
-    using ostk::math::geom::d3::objects::Cuboid ;
-    using ostk::math::geom::d3::objects::Composite ;
-    using ostk::math::geom::d3::objects::Point ;
+} ;
 
-    using ostk::physics::Environment ;
-    using ostk::physics::units::Mass ;
-    using ostk::physics::env::Object ;
-    using ostk::physics::env::obj::celest::Earth ;
-    using ostk::physics::env::obj::celest::Sun ;
-    using ostk::physics::env::obj::celest::Moon ;
+// Run the tasks [0, aTaskCount) on a pool of threads, including the calling one. Each thread owns a queue of tasks, initially a
+// contiguous range, pops tasks from its front and, once empty, steals tasks from the back of the queues of the other threads.
+// The first exception thrown by a task stops the pool, and is rethrown.
 
-    using ostk::astro::flight::system::SatelliteSystem ;
+static void                     RunWithWorkStealing                         (   const   Size                        aTaskCount,
+                                                                                const   Size                        aThreadCount,
+                                                                                const   std::function<void (const Size)>& aTask                         )
+{
 
-    // Create environment
-    const Array<Shared<Object>> objects = // [TBI] Add drag to environment once it is added in ostk-physics
+    struct TaskQueue
     {
-        std::make_shared<Earth>(Earth::EGM2008(100, 100)),
-        std::make_shared<Sun>(Sun::Spherical()),
-        std::make_shared<Moon>(Moon::Spherical())
+        std::mutex              mutex ;
+        std::deque<Size>        taskIndices ;
     } ;
 
-    const Instant instant = Instant::J2000() ;
+    const Size threadCount = std::max<Size>(1, std::min<Size>(aThreadCount, aTaskCount)) ;
 
-    const Environment customEnvironment = Environment(instant, objects) ;
+    std::vector<TaskQueue> taskQueues(threadCount) ;
 
-    // Satellite system setup
-    const Composite satelliteGeometry = Composite { Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } ) } ;
-    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+    for (Size threadIndex = 0 ; threadIndex < threadCount ; ++threadIndex)
+    {
 
-    // Satellite dynamics setup
-    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+        for (Size taskIndex = ((threadIndex * aTaskCount) / threadCount) ; taskIndex < (((threadIndex + 1) * aTaskCount) / threadCount) ; ++taskIndex)
+        {
+            taskQueues[threadIndex].taskIndices.push_back(taskIndex) ;
+        }
 
-    // Construct default numerical solver
-    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+    }
 
-    return { satelliteDynamics, numericalSolver } ;
+    std::atomic<bool> isStopped { false } ;
+    std::mutex exceptionMutex ;
+    std::exception_ptr exceptionPtr = nullptr ;
+
+    const auto work = [&taskQueues, &isStopped, &exceptionMutex, &exceptionPtr, &aTask, threadCount] (const Size aThreadIndex) -> void
+    {
+
+        while (!isStopped)
+        {
+
+            bool hasTask = false ;
+            Size taskIndex = 0 ;
+
+            for (Size offset = 0 ; (!hasTask) && (offset < threadCount) ; ++offset)
+            {
+
+                TaskQueue& taskQueue = taskQueues[(aThreadIndex + offset) % threadCount] ;
+
+                const std::lock_guard<std::mutex> lock { taskQueue.mutex } ;
+
+                if (!taskQueue.taskIndices.empty())
+                {
+
+                    // Own tasks from the front, stolen ones from the back, so that the owner and the thief rarely compete
+
+                    if (offset == 0)
+                    {
+                        taskIndex = taskQueue.taskIndices.front() ;
+                        taskQueue.taskIndices.pop_front() ;
+                    }
+                    else
+                    {
+                        taskIndex = taskQueue.taskIndices.back() ;
+                        taskQueue.taskIndices.pop_back() ;
+                    }
+
+                    hasTask = true ;
+
+                }
+
+            }
+
+            // No task is added once the pool runs, so that all the queues being empty means the work is done
+
+            if (!hasTask)
+            {
+                return ;
+            }
+
+            try
+            {
+                aTask(taskIndex) ;
+            }
+            catch (...)
+            {
+
+                const std::lock_guard<std::mutex> lock { exceptionMutex } ;
+
+                if (exceptionPtr == nullptr)
+                {
+                    exceptionPtr = std::current_exception() ;
+                }
+
+                isStopped = true ;
+
+            }
+
+        }
+
+    } ;
+
+    // The tasks of the workers that are withdrawn, or not started yet, are stolen by the others
+
+    WorkerPool::Get().run(threadCount, work) ;
+
+    if (exceptionPtr != nullptr)
+    {
+        std::rethrow_exception(exceptionPtr) ;
+    }
+
+}
+
+// Records the states notified by the numerical solver: the start state, then the state at the end of each accepted step
+
+class StepRecorder : public Observer
+{
+
+    public:
+
+                                StepRecorder                                ( )
+                                :   Observer(1),
+                                    timeArray(Array<double>::Empty()),
+                                    stateVectorArray(Array<Observer::StateVector>::Empty())
+        {
+
+        }
+
+        virtual void            reset                                       ( ) override
+        {
+
+            Observer::reset() ;
+
+            timeArray.clear() ;
+            stateVectorArray.clear() ;
+
+        }
+
+        Array<double>           timeArray ;
+        Array<Observer::StateVector> stateVectorArray ;
+
+    protected:
+
+        virtual void            observe                                     (   const   Observer::StateVector&      aStateVector,
+                                                                                const   double                      aTime                                       ) override
+        {
+
+            timeArray.add(aTime) ;
+            stateVectorArray.add(aStateVector) ;
+
+        }
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Propagator::Propagator                      (   const   SatelliteDynamics&          aSatelliteDynamics,
+                                                                                const   NumericalSolver&            aNumericalSolver,
+                                                                                const   Propagator::FormulationType& aFormulationType                           )
+                                :   satelliteDynamics_(aSatelliteDynamics),
+                                    numericalSolver_(aNumericalSolver),
+                                    formulationType_(aFormulationType),
+                                    composedDynamicsSPtr_(nullptr),
+                                    composedDynamicsIntegrator_(),
+                                    composedDynamicsStateDerivative_(),
+                                    mutex_(),
+                                    statistics_(aNumericalSolver.getStatistics()),
+                                    idleIntegrationContexts_()
+{
+
+}
+
+                                Propagator::Propagator                      (   const   Propagator&                 aPropagator                                 )
+                                :   satelliteDynamics_(aPropagator.satelliteDynamics_),
+                                    numericalSolver_(aPropagator.numericalSolver_),
+                                    formulationType_(aPropagator.formulationType_),
+                                    composedDynamicsSPtr_(aPropagator.composedDynamicsSPtr_),
+                                    composedDynamicsIntegrator_(aPropagator.composedDynamicsIntegrator_),
+                                    composedDynamicsStateDerivative_(aPropagator.composedDynamicsStateDerivative_),
+                                    mutex_(),
+                                    statistics_(),
+                                    idleIntegrationContexts_()
+{
+
+    const std::lock_guard<std::mutex> lock { aPropagator.mutex_ } ;
+
+    statistics_ = aPropagator.statistics_ ;
+
+}
+
+Propagator&                     Propagator::operator =                      (   const   Propagator&                 aPropagator                                 )
+{
+
+    if (this != &aPropagator)
+    {
+
+        Statistics statistics ;
+
+        {
+
+            const std::lock_guard<std::mutex> lock { aPropagator.mutex_ } ;
+
+            statistics = aPropagator.statistics_ ;
+
+        }
+
+        const std::lock_guard<std::mutex> lock { this->mutex_ } ;
+
+        this->satelliteDynamics_ = aPropagator.satelliteDynamics_ ;
+        this->numericalSolver_ = aPropagator.numericalSolver_ ;
+        this->formulationType_ = aPropagator.formulationType_ ;
+        this->composedDynamicsSPtr_ = aPropagator.composedDynamicsSPtr_ ;
+        this->composedDynamicsIntegrator_ = aPropagator.composedDynamicsIntegrator_ ;
+        this->composedDynamicsStateDerivative_ = aPropagator.composedDynamicsStateDerivative_ ;
+        this->statistics_ = statistics ;
+
+        // The idle contexts were copied from the previous configuration
+        this->idleIntegrationContexts_.clear() ;
+
+    }
+
+    return *this ;
+
+}
+
+Propagator*                     Propagator::clone                           ( ) const
+{
+    return new Propagator(*this) ;
+}
+
+bool                            Propagator::operator ==                     (   const   Propagator&                 aPropagator                                 ) const
+{
+
+    if ((!this->isDefined()) || (!aPropagator.isDefined()))
+    {
+        return false ;
+    }
+
+    // Composed dynamics are immutable and shared between copies, they are compared by identity
+
+    if ((composedDynamicsSPtr_ != nullptr) || (aPropagator.composedDynamicsSPtr_ != nullptr))
+    {
+        return (composedDynamicsSPtr_ == aPropagator.composedDynamicsSPtr_) && (numericalSolver_ == aPropagator.numericalSolver_) ;
+    }
+
+    return (satelliteDynamics_ == aPropagator.satelliteDynamics_) && (numericalSolver_ == aPropagator.numericalSolver_) && (formulationType_ == aPropagator.formulationType_) ;
+
+}
+
+bool                            Propagator::operator !=                     (   const   Propagator&                 aPropagator                                 ) const
+{
+    return !((*this) == aPropagator) ;
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Propagator&                 aPropagator                                 )
+{
+
+    aPropagator.print(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+bool                            Propagator::isDefined                       ( ) const
+{
+
+    if (composedDynamicsSPtr_ != nullptr)
+    {
+        return composedDynamicsSPtr_->isDefined() && numericalSolver_.isDefined() ;
+    }
+
+    return satelliteDynamics_.isDefined() && numericalSolver_.isDefined() ;
+
+}
+
+Propagator::FormulationType     Propagator::getFormulationType              ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    return formulationType_ ;
+
+}
+
+State                           Propagator::calculateStateAt                (   const   State&                      aState,
+                                                                                const   Instant&                    anInstant                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    const VectorXd stateCoordinates = aState.getCoordinates() ;
+
+    SatelliteDynamics::StateVector startStateVector(stateCoordinates.data(), stateCoordinates.data() + stateCoordinates.size()) ;
+
+    const Shared<IntegrationContext> integrationContextSPtr = this->acquireIntegrationContext() ;
+
+    if ((composedDynamicsSPtr_ != nullptr) || (formulationType_ != Propagator::FormulationType::Cowell))
+    {
+
+        const SatelliteDynamics::StateVector endStateVector = this->integrateStatesAtSortedInstants(*integrationContextSPtr, startStateVector, aState.getInstant(), { anInstant }).accessFirst() ;
+
+        return {anInstant, Position::Meters({ endStateVector[0], endStateVector[1], endStateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ endStateVector[3], endStateVector[4], endStateVector[5] }, gcrfSPtr)} ;
+
+    }
+
+    integrationContextSPtr->satelliteDynamics.setInstant(aState.getInstant()) ;
+
+    SatelliteDynamics::StateVector endStateVector = integrationContextSPtr->numericalSolver.integrateStateFromInstantToInstant(startStateVector, aState.getInstant(), anInstant, this->getDynamicalEquations(*integrationContextSPtr)) ;
+
+    return {anInstant, Position::Meters({ endStateVector[0], endStateVector[1], endStateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ endStateVector[3], endStateVector[4], endStateVector[5] }, gcrfSPtr)} ;
+
+}
+
+Array<State>                    Propagator::calculateStatesAt               (   const   State&                      aState,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State") ;
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<State>::Empty() ;
+    }
+
+    for (Size k = 0 ; k < anInstantArray.getSize() - 1; ++k)
+    {
+
+        if (anInstantArray[k] > anInstantArray[k + 1])
+        {
+            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array") ;
+        }
+
+    }
+
+    const VectorXd stateCoordinates = aState.getCoordinates() ;
+    SatelliteDynamics::StateVector startStateVector(stateCoordinates.data(), stateCoordinates.data() + stateCoordinates.size()) ;
+
+    Array<Instant> forwardInstants ;
+    Array<Instant> backwardInstants ;
+
+    for (const Instant& anInstant : anInstantArray)
+    {
+
+        if (anInstant <= aState.getInstant())
+        {
+            backwardInstants.add(anInstant) ;
+        }
+        else
+        {
+            forwardInstants.add(anInstant) ;
+        }
+
+    }
+
+    const Shared<IntegrationContext> integrationContextSPtr = this->acquireIntegrationContext() ;
+
+    // forward propagation only
+    Array<SatelliteDynamics::StateVector> propagatedForwardStateVectorArray ;
+    if (!forwardInstants.isEmpty())
+    {
+
+        propagatedForwardStateVectorArray = this->integrateStatesAtSortedInstants
+        (
+            *integrationContextSPtr,
+            startStateVector,
+            aState.getInstant(),
+            forwardInstants
+        ) ;
+
+    }
+
+    // backward propagation only
+    Array<SatelliteDynamics::StateVector> propagatedBackwardStateVectorArray ;
+    if (!backwardInstants.isEmpty())
+    {
+
+        std::reverse(backwardInstants.begin(), backwardInstants.end()) ;
+
+        propagatedBackwardStateVectorArray = this->integrateStatesAtSortedInstants
+        (
+            *integrationContextSPtr,
+            startStateVector,
+            aState.getInstant(),
+            backwardInstants
+        ) ;
+
+        std::reverse(propagatedBackwardStateVectorArray.begin(), propagatedBackwardStateVectorArray.end()) ;
+
+    }
+
+    Array<State> propagatedStates ;
+    propagatedStates.reserve(anInstantArray.getSize()) ;
+
+    Size k = 0 ;
+    for (const SatelliteDynamics::StateVector& stateVector : (propagatedBackwardStateVectorArray + propagatedForwardStateVectorArray))
+    {
+
+        State propagatedState = {anInstantArray[k], Position::Meters( {stateVector[0], stateVector[1], stateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ stateVector[3], stateVector[4], stateVector[5] }, gcrfSPtr)} ;
+
+        propagatedStates.add(propagatedState) ;
+
+        ++k ;
+
+    }
+
+    return propagatedStates;
+
+}
+
+Array<State>                    Propagator::calculateStatesAt               (   const   Array<State>&               aStateArray,
+                                                                                const   Array<Instant>&             anInstantArray,
+                                                                                const   Size&                       aThreadCount                                ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    const Size instantCount = anInstantArray.getSize() ;
+
+    if (aStateArray.isEmpty() || (instantCount == 0))
+    {
+        return Array<State>::Empty() ;
+    }
+
+    const Size configuredThreadCount = Propagator::GetThreadCount() ;
+    const Size threadCount = (aThreadCount > 0) ? std::min<Size>(aThreadCount, configuredThreadCount) : configuredThreadCount ;
+
+    // Each trajectory writes its own range of the block, the propagator being thread safe
+
+    Array<State> propagatedStates(aStateArray.getSize() * instantCount, State::Undefined()) ;
+
+    RunWithWorkStealing(aStateArray.getSize(), threadCount, [this, &aStateArray, &anInstantArray, &propagatedStates, instantCount] (const Size aStateIndex) -> void
+    {
+
+        const Array<State> stateArray = this->calculateStatesAt(aStateArray[aStateIndex], anInstantArray) ;
+
+        std::copy(stateArray.begin(), stateArray.end(), propagatedStates.begin() + (aStateIndex * instantCount)) ;
+
+    }) ;
+
+    return propagatedStates ;
+
+}
+
+Pair<State, MatrixXd>           Propagator::calculateStateAndStateTransitionMatrixAt ( const State&                aState,
+                                                                                const   Instant&                    anInstant                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State") ;
+    }
+
+    if (numericalSolver_.isSecondOrder())
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("State transition matrix with a second order stepper") ;
+    }
+
+    if (composedDynamicsSPtr_ != nullptr)
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("State transition matrix with composed dynamics") ;
+    }
+
+    const VectorXd stateCoordinates = aState.inFrame(gcrfSPtr).getCoordinates() ;
+
+    // Augmented state: position, velocity and state transition matrix (column-major), initialized to identity
+    SatelliteDynamics::StateVector startStateVector(42, 0.0) ;
+    std::copy(stateCoordinates.data(), stateCoordinates.data() + 6, startStateVector.begin()) ;
+
+    for (Size k = 0 ; k < 6 ; ++k)
+    {
+        startStateVector[6 + (k * 6) + k] = 1.0 ;
+    }
+
+    const Shared<IntegrationContext> integrationContextSPtr = this->acquireIntegrationContext() ;
+
+    integrationContextSPtr->satelliteDynamics.setInstant(aState.getInstant()) ;
+
+    const SatelliteDynamics::StateVector endStateVector = integrationContextSPtr->numericalSolver.integrateStateFromInstantToInstant(startStateVector, aState.getInstant(), anInstant, integrationContextSPtr->satelliteDynamics.getVariationalDynamicalEquations()) ;
+
+    const State endState = { anInstant, Position::Meters({ endStateVector[0], endStateVector[1], endStateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ endStateVector[3], endStateVector[4], endStateVector[5] }, gcrfSPtr) } ;
+
+    const MatrixXd stateTransitionMatrix = Eigen::Map<const MatrixXd>(endStateVector.data() + 6, 6, 6) ;
+
+    return { endState, stateTransitionMatrix } ;
+
+}
+
+Ephemeris                       Propagator::calculateEphemeris              (   const   State&                      aState,
+                                                                                const   Interval&                   anInterval                                  ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State") ;
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval") ;
+    }
+
+    if ((composedDynamicsSPtr_ == nullptr) && (formulationType_ != Propagator::FormulationType::Cowell))
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("Ephemeris with the " + Propagator::StringFromFormulationType(formulationType_) + " formulation") ;
+    }
+
+    const VectorXd stateCoordinates = aState.inFrame(gcrfSPtr).getCoordinates() ;
+
+    const SatelliteDynamics::StateVector startStateVector(stateCoordinates.data(), stateCoordinates.data() + 6) ;
+
+    const Instant startInstant = std::min(anInterval.accessStart(), aState.getInstant()) ;
+    const Instant endInstant = std::max(anInterval.accessEnd(), aState.getInstant()) ;
+
+    const Shared<IntegrationContext> integrationContextSPtr = this->acquireIntegrationContext() ;
+
+    // Backward, then forward from the initial state: both ephemerides hold it, as their last and first node
+
+    Ephemeris ephemeris = this->integrateEphemeris(*integrationContextSPtr, startStateVector, aState.getInstant(), startInstant) ;
+
+    ephemeris.add(this->integrateEphemeris(*integrationContextSPtr, startStateVector, aState.getInstant(), endInstant)) ;
+
+    return ephemeris ;
+
+}
+
+Statistics                      Propagator::getStatistics                   ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { this->mutex_ } ;
+
+    return statistics_ ;
+
+}
+
+void                            Propagator::resetStatistics                 ( )
+{
+
+    const std::lock_guard<std::mutex> lock { this->mutex_ } ;
+
+    statistics_.reset() ;
+
+}
+
+void                            Propagator::print                           (       std::ostream&                   anOutputStream,
+                                                                                    bool                            displayDecorator                            ) const
+{
+
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Propagator") : void () ;
+
+    if (composedDynamicsSPtr_ != nullptr)
+    {
+        ostk::core::utils::Print::Separator(anOutputStream, "Composed Dynamics") ;
+        composedDynamicsSPtr_->print(anOutputStream, false) ;
+    }
+    else
+    {
+        ostk::core::utils::Print::Separator(anOutputStream, "Satellite Dynamics") ;
+        satelliteDynamics_.print(anOutputStream, false) ;
+    }
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Numerical Solver") ;
+    numericalSolver_.print(anOutputStream, false) ;
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Formulation") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Formulation type:" << Propagator::StringFromFormulationType(formulationType_) ;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+Propagator                      Propagator::MediumFidelity                  ( )
+{
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::objects::Point ;
+
+    using ostk::physics::Environment ;
+    using ostk::physics::units::Mass ;
+    using ostk::physics::env::Object ;
+    using ostk::physics::env::obj::Celestial ;
+    using ostk::physics::env::obj::celest::Earth ;
+    using ostk::physics::env::obj::celest::Sun ;
+    using ostk::physics::env::obj::celest::Moon ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+    using ostk::astro::flight::system::dynamics::forcemodels::AtmosphericDrag ;
+
+    // Create environment
+    const Array<Shared<Object>> objects =
+    {
+        std::make_shared<Earth>(Earth::EGM2008(35, 35))
+    } ;
+
+    const Instant instant = Instant::J2000() ;
+
+    const Environment customEnvironment = Environment(instant, objects) ;
+
+    // Satellite system setup
+    const Composite satelliteGeometry = Composite { Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } ) } ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    // Force models setup: gravity of Earth, and drag in the piecewise exponential atmosphere of Earth
+    const Shared<const Celestial> earthSPtr = customEnvironment.accessCelestialObjectWithName("Earth") ;
+
+    const Array<Shared<ForceModel>> forceModels =
+    {
+        std::make_shared<CentralBodyGravity>(earthSPtr),
+        std::make_shared<AtmosphericDrag>(earthSPtr, satelliteSystem)
+    } ;
+
+    // Satellite dynamics setup
+    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem, forceModels } ;
+
+    // Construct default numerical solver
+    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+
+    return { satelliteDynamics, numericalSolver } ;
+
+}
+
+Propagator                      Propagator::HighFidelity                    ( )
+{
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::objects::Point ;
+
+    using ostk::physics::Environment ;
+    using ostk::physics::units::Mass ;
+    using ostk::physics::env::Object ;
+    using ostk::physics::env::obj::Celestial ;
+    using ostk::physics::env::obj::celest::Earth ;
+    using ostk::physics::env::obj::celest::Sun ;
+    using ostk::physics::env::obj::celest::Moon ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+    using ostk::astro::flight::system::dynamics::forcemodels::ThirdBodyGravity ;
+    using ostk::astro::flight::system::dynamics::forcemodels::AtmosphericDrag ;
+
+    // Create environment
+    const Array<Shared<Object>> objects =
+    {
+        std::make_shared<Earth>(Earth::EGM2008(100, 100)),
+        std::make_shared<Sun>(Sun::Spherical()),
+        std::make_shared<Moon>(Moon::Spherical())
+    } ;
+
+    const Instant instant = Instant::J2000() ;
+
+    const Environment customEnvironment = Environment(instant, objects) ;
+
+    // Satellite system setup
+    const Composite satelliteGeometry = Composite { Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } ) } ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    // Force models setup: gravity of Earth, of the Sun and of the Moon, and drag in the piecewise exponential atmosphere of Earth
+    const Shared<const Celestial> earthSPtr = customEnvironment.accessCelestialObjectWithName("Earth") ;
+
+    const Array<Shared<ForceModel>> forceModels =
+    {
+        std::make_shared<CentralBodyGravity>(earthSPtr),
+        std::make_shared<ThirdBodyGravity>(customEnvironment.accessCelestialObjectWithName("Sun")),
+        std::make_shared<ThirdBodyGravity>(customEnvironment.accessCelestialObjectWithName("Moon")),
+        std::make_shared<AtmosphericDrag>(earthSPtr, satelliteSystem)
+    } ;
+
+    // Satellite dynamics setup
+    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem, forceModels } ;
+
+    // Construct default numerical solver
+    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+
+    return { satelliteDynamics, numericalSolver } ;
+
+}
+
+Propagator                      Propagator::LowFidelity                     ( )
+{
+
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+    using ostk::astro::flight::system::dynamics::terms::ExponentialDrag ;
+
+    // Earth model
+    const double gravitationalParameter = Earth::Models::EGM2008::GravitationalParameter.in(GravitationalParameterSIUnit) ;
+    const double equatorialRadius = Earth::Models::EGM2008::EquatorialRadius.inMeters() ;
+    const double flattening = Earth::Models::EGM2008::Flattening ;
+    const double j2 = Earth::Models::EGM2008::J2 ;
+    const double rotationRate = 7.2921159e-5 ; // [rad/s]
+
+    // Same satellite system as the other presets: drag coefficient 2.2, cross sectional area 0.8 m^2, mass 100 kg
+    const double ballisticCoefficient = 2.2 * 0.8 / 100.0 ; // [m^2/kg]
+
+    // Composed dynamics setup
+    const ComposedDynamics<PointMassGravity, J2Gravity, ExponentialDrag> composedDynamics =
+    {
+        PointMassGravity(gravitationalParameter),
+        J2Gravity(gravitationalParameter, equatorialRadius, j2),
+        ExponentialDrag(ballisticCoefficient, equatorialRadius, flattening, rotationRate, ExponentialAtmosphere::Default())
+    } ;
+
+    // Construct default numerical solver
+    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12 } ;
+
+    return { composedDynamics, numericalSolver } ;
+
+}
+
+String                          Propagator::StringFromFormulationType       (   const   Propagator::FormulationType& aFormulationType                           )
+{
+
+    switch (aFormulationType)
+    {
+
+        case Propagator::FormulationType::Cowell:
+            return "Cowell" ;
+
+        case Propagator::FormulationType::Encke:
+            return "Encke" ;
+
+        case Propagator::FormulationType::KustaanheimoStiefel:
+            return "KustaanheimoStiefel" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Formulation Type") ;
+
+    }
+
+}
+
+Size                            Propagator::GetThreadCount                  ( )
+{
+    return WorkerPool::Get().getThreadCount() ;
+}
+
+void                            Propagator::SetThreadCount                  (   const   Size&                       aThreadCount                                )
+{
+    WorkerPool::Get().setThreadCount(aThreadCount) ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Shared<Propagator::IntegrationContext> Propagator::acquireIntegrationContext ( ) const
+{
+
+    Unique<IntegrationContext> integrationContextUPtr = nullptr ;
+
+    {
+
+        const std::lock_guard<std::mutex> lock { this->mutex_ } ;
+
+        if (!idleIntegrationContexts_.isEmpty())
+        {
+
+            integrationContextUPtr = std::move(idleIntegrationContexts_.back()) ;
+
+            idleIntegrationContexts_.pop_back() ;
+
+        }
+
+    }
+
+    // Copying the satellite dynamics shares their environment, and clones their force models
+
+    if (integrationContextUPtr == nullptr)
+    {
+        integrationContextUPtr.reset(new IntegrationContext { satelliteDynamics_, numericalSolver_ }) ;
+    }
+
+    integrationContextUPtr->numericalSolver.resetStatistics() ;
+
+    return Shared<IntegrationContext>(integrationContextUPtr.release(), [this] (IntegrationContext* anIntegrationContextPtr) -> void
+    {
+
+        const std::lock_guard<std::mutex> lock { this->mutex_ } ;
+
+        this->statistics_ += anIntegrationContextPtr->numericalSolver.getStatistics() ;
+
+        this->idleIntegrationContexts_.emplace_back(anIntegrationContextPtr) ;
+
+    }) ;
+
+}
+
+SatelliteDynamics::DynamicalEquationWrapper Propagator::getDynamicalEquations (     IntegrationContext&         anIntegrationContext                        ) const
+{
+
+    if (numericalSolver_.isSecondOrder())
+    {
+        return anIntegrationContext.satelliteDynamics.getSecondOrderDynamicalEquations() ;
+    }
+
+    return anIntegrationContext.satelliteDynamics.getDynamicalEquations() ;
+
+}
+
+Array<SatelliteDynamics::StateVector> Propagator::integrateStatesAtSortedInstants ( IntegrationContext&         anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const
+{
+
+    if ((composedDynamicsSPtr_ == nullptr) && (formulationType_ == Propagator::FormulationType::Encke))
+    {
+        return this->integrateEnckeStatesAtSortedInstants(anIntegrationContext, aStartStateVector, aStartInstant, anInstantArray) ;
+    }
+
+    if ((composedDynamicsSPtr_ == nullptr) && (formulationType_ == Propagator::FormulationType::KustaanheimoStiefel))
+    {
+        return this->integrateKustaanheimoStiefelStatesAtSortedInstants(anIntegrationContext, aStartStateVector, aStartInstant, anInstantArray) ;
+    }
+
+    if (composedDynamicsSPtr_ == nullptr)
+    {
+
+        anIntegrationContext.satelliteDynamics.setInstant(aStartInstant) ;
+
+        return anIntegrationContext.numericalSolver.integrateStatesAtSortedInstants(aStartStateVector, aStartInstant, anInstantArray, this->getDynamicalEquations(anIntegrationContext)) ;
+
+    }
+
+    const NumericalSolver::FixedStateVector<6> startStateVector = Eigen::Map<const NumericalSolver::FixedStateVector<6>>(aStartStateVector.data()) ;
+
+    const Array<NumericalSolver::FixedStateVector<6>> stateVectorArray = composedDynamicsIntegrator_(anIntegrationContext.numericalSolver, startStateVector, aStartInstant, anInstantArray) ;
+
+    Array<SatelliteDynamics::StateVector> propagatedStateVectorArray ;
+    propagatedStateVectorArray.reserve(stateVectorArray.getSize()) ;
+
+    for (const NumericalSolver::FixedStateVector<6>& stateVector : stateVectorArray)
+    {
+        propagatedStateVectorArray.add(SatelliteDynamics::StateVector(stateVector.data(), stateVector.data() + 6)) ;
+    }
+
+    return propagatedStateVectorArray ;
+
+}
+
+Ephemeris                       Propagator::integrateEphemeris              (           IntegrationContext&         anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Instant&                    anEndInstant                                ) const
+{
+
+    const double durationSign = (anEndInstant < aStartInstant) ? -1.0 : +1.0 ;
+
+    // System of equations to integrate, and first order state derivative for the accelerations at the nodes
+
+    NumericalSolver::SystemOfEquationsWrapper systemOfEquations ;
+    NumericalSolver::SystemOfEquationsWrapper stateDerivative ;
+
+    if (composedDynamicsSPtr_ != nullptr)
+    {
+
+        const ComposedDynamicsStateDerivative composedDynamicsStateDerivative = composedDynamicsStateDerivative_ ;
+
+        stateDerivative = [composedDynamicsStateDerivative] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+        {
+            composedDynamicsStateDerivative(x.data(), dxdt.data()) ;
+        } ;
+
+        systemOfEquations = stateDerivative ;
+
+    }
+    else
+    {
+
+        anIntegrationContext.satelliteDynamics.setInstant(aStartInstant) ;
+
+        stateDerivative = anIntegrationContext.satelliteDynamics.getDynamicalEquations() ;
+        systemOfEquations = this->getDynamicalEquations(anIntegrationContext) ;
+
+    }
+
+    // Nodes must be strictly ordered in time, at the resolution of the instants
+
+    const auto isAfter = [durationSign] (const Instant& anInstant, const Instant& anotherInstant) -> bool
+    {
+        return (durationSign > 0.0) ? (anInstant > anotherInstant) : (anInstant < anotherInstant) ;
+    } ;
+
+    Array<State> nodeStates = Array<State>::Empty() ;
+
+    nodeStates.add({ aStartInstant, Position::Meters({ aStartStateVector[0], aStartStateVector[1], aStartStateVector[2] }, gcrfSPtr), Velocity::MetersPerSecond({ aStartStateVector[3], aStartStateVector[4], aStartStateVector[5] }, gcrfSPtr) }) ;
+
+    // With the quintic continuous extension of Dormand-Prince, each step retains the interpolation polynomial of the stepper, without evaluating the dynamics again
+
+    if (anIntegrationContext.numericalSolver.getStepperType() == NumericalSolver::StepperType::RungeKuttaDopri5)
+    {
+
+        const Array<NumericalSolver::DenseOutputStep> denseOutputSteps = anIntegrationContext.numericalSolver.integrateDenseOutputFromInstantToInstant(aStartStateVector, aStartInstant, anEndInstant, systemOfEquations) ;
+
+        Array<Ephemeris::StepPolynomial> stepPolynomials = Array<Ephemeris::StepPolynomial>::Empty() ;
+
+        nodeStates.reserve(denseOutputSteps.getSize() + 1) ;
+        stepPolynomials.reserve(denseOutputSteps.getSize()) ;
+
+        for (Size k = 0 ; k < denseOutputSteps.getSize() ; ++k)
+        {
+
+            // The last step ends at the end instant, up to the rounding of the accumulated step sizes
+
+            const Instant instant = ((k + 1) == denseOutputSteps.getSize()) ? anEndInstant : (aStartInstant + Duration::Seconds(denseOutputSteps[k].endTime)) ;
+
+            if (!isAfter(instant, nodeStates.accessLast().accessInstant()))
+            {
+                continue ;
+            }
+
+            Ephemeris::StepPolynomial stepPolynomial = { Array<Vector3d>::Empty(), Array<Vector3d>::Empty() } ;
+
+            Vector3d endPosition = Vector3d::Zero() ;
+            Vector3d endVelocity = Vector3d::Zero() ;
+
+            for (const NumericalSolver::StateVector& coefficient : denseOutputSteps[k].coefficientArray)
+            {
+
+                stepPolynomial.positionCoefficientArray.add({ coefficient[0], coefficient[1], coefficient[2] }) ;
+                stepPolynomial.velocityCoefficientArray.add({ coefficient[3], coefficient[4], coefficient[5] }) ;
+
+                endPosition += stepPolynomial.positionCoefficientArray.accessLast() ;
+                endVelocity += stepPolynomial.velocityCoefficientArray.accessLast() ;
+
+            }
+
+            nodeStates.add({ instant, Position::Meters(endPosition, gcrfSPtr), Velocity::MetersPerSecond(endVelocity, gcrfSPtr) }) ;
+            stepPolynomials.add(stepPolynomial) ;
+
+        }
+
+        // Backward steps run from their end node to their start node
+
+        if (durationSign < 0.0)
+        {
+
+            std::reverse(nodeStates.begin(), nodeStates.end()) ;
+            std::reverse(stepPolynomials.begin(), stepPolynomials.end()) ;
+
+            for (auto& stepPolynomial : stepPolynomials)
+            {
+
+                stepPolynomial.positionCoefficientArray = ReversedPolynomial(stepPolynomial.positionCoefficientArray) ;
+                stepPolynomial.velocityCoefficientArray = ReversedPolynomial(stepPolynomial.velocityCoefficientArray) ;
+
+            }
+
+        }
+
+        return { nodeStates, stepPolynomials } ;
+
+    }
+
+    // Otherwise, each step is interpolated from the states and the accelerations at its nodes
+
+    const Shared<StepRecorder> stepRecorderSPtr = std::make_shared<StepRecorder>() ;
+
+    anIntegrationContext.numericalSolver.integrateStateFromInstantToInstant(aStartStateVector, aStartInstant, anEndInstant, systemOfEquations, stepRecorderSPtr) ;
+
+    Array<SatelliteDynamics::StateVector> nodeStateVectors = { aStartStateVector } ;
+
+    nodeStates.reserve(stepRecorderSPtr->timeArray.getSize()) ;
+    nodeStateVectors.reserve(stepRecorderSPtr->timeArray.getSize()) ;
+
+    // The start state is recorded first, when anything is integrated
+
+    for (Size k = 1 ; k < stepRecorderSPtr->timeArray.getSize() ; ++k)
+    {
+
+        // The last step ends at the end instant, up to the rounding of the accumulated step sizes
+
+        const Instant instant = ((k + 1) == stepRecorderSPtr->timeArray.getSize()) ? anEndInstant : (aStartInstant + Duration::Seconds(stepRecorderSPtr->timeArray[k])) ;
+
+        if (!isAfter(instant, nodeStates.accessLast().accessInstant()))
+        {
+            continue ;
+        }
+
+        const SatelliteDynamics::StateVector& x = stepRecorderSPtr->stateVectorArray[k] ;
+
+        nodeStates.add({ instant, Position::Meters({ x[0], x[1], x[2] }, gcrfSPtr), Velocity::MetersPerSecond({ x[3], x[4], x[5] }, gcrfSPtr) }) ;
+        nodeStateVectors.add(x) ;
+
+    }
+
+    SatelliteDynamics::StateVector dxdt(aStartStateVector.size()) ;
+
+    Array<Vector3d> nodeAccelerations = Array<Vector3d>::Empty() ;
+    nodeAccelerations.reserve(nodeStates.getSize()) ;
+
+    for (Size k = 0 ; k < nodeStates.getSize() ; ++k)
+    {
+
+        stateDerivative(nodeStateVectors[k], dxdt, (nodeStates[k].accessInstant() - aStartInstant).inSeconds()) ;
+
+        nodeAccelerations.add({ dxdt[3], dxdt[4], dxdt[5] }) ;
+
+    }
+
+    // Steps too long for the interpolant to stay within the solver tolerance are split, by integrating from their start node to intermediate nodes
+
+    Array<State> refinedNodeStates = Array<State>::Empty() ;
+    Array<Vector3d> refinedNodeAccelerations = Array<Vector3d>::Empty() ;
+
+    refinedNodeStates.reserve(nodeStates.getSize()) ;
+    refinedNodeAccelerations.reserve(nodeStates.getSize()) ;
+
+    for (Size k = 0 ; k < nodeStates.getSize() ; ++k)
+    {
+
+        refinedNodeStates.add(nodeStates[k]) ;
+        refinedNodeAccelerations.add(nodeAccelerations[k]) ;
+
+        if ((k + 1) == nodeStates.getSize())
+        {
+            break ;
+        }
+
+        const Instant& stepStartInstant = nodeStates[k].accessInstant() ;
+
+        const double stepDuration = std::abs((nodeStates[k + 1].accessInstant() - stepStartInstant).inSeconds()) ;
+
+        const Size subdivisionCount = HermiteSubdivisionCount
+        (
+            stepDuration,
+            nodeStates[k].accessPosition().accessCoordinates(),
+            nodeAccelerations[k],
+            nodeStates[k + 1].accessPosition().accessCoordinates(),
+            nodeAccelerations[k + 1],
+            anIntegrationContext.numericalSolver.getRelativeTolerance(),
+            anIntegrationContext.numericalSolver.getAbsoluteTolerance()
+        ) ;
+
+        if (subdivisionCount == 1)
+        {
+            continue ;
+        }
+
+        Array<Instant> intermediateInstants = Array<Instant>::Empty() ;
+        intermediateInstants.reserve(subdivisionCount - 1) ;
+
+        for (Size j = 1 ; j < subdivisionCount ; ++j)
+        {
+
+            const Instant instant = stepStartInstant + Duration::Seconds(durationSign * stepDuration * static_cast<double>(j) / static_cast<double>(subdivisionCount)) ;
+
+            if (isAfter(instant, (intermediateInstants.isEmpty() ? stepStartInstant : intermediateInstants.accessLast())) && isAfter(nodeStates[k + 1].accessInstant(), instant))
+            {
+                intermediateInstants.add(instant) ;
+            }
+
+        }
+
+        if (intermediateInstants.isEmpty())
+        {
+            continue ;
+        }
+
+        // The satellite dynamics are evaluated at times relative to their instant
+
+        if (composedDynamicsSPtr_ == nullptr)
+        {
+            anIntegrationContext.satelliteDynamics.setInstant(stepStartInstant) ;
+        }
+
+        const Array<SatelliteDynamics::StateVector> intermediateStateVectors = anIntegrationContext.numericalSolver.integrateStatesAtSortedInstants(nodeStateVectors[k], stepStartInstant, intermediateInstants, systemOfEquations) ;
+
+        for (Size j = 0 ; j < intermediateInstants.getSize() ; ++j)
+        {
+
+            const SatelliteDynamics::StateVector& x = intermediateStateVectors[j] ;
+
+            stateDerivative(x, dxdt, (intermediateInstants[j] - stepStartInstant).inSeconds()) ;
+
+            refinedNodeStates.add({ intermediateInstants[j], Position::Meters({ x[0], x[1], x[2] }, gcrfSPtr), Velocity::MetersPerSecond({ x[3], x[4], x[5] }, gcrfSPtr) }) ;
+            refinedNodeAccelerations.add({ dxdt[3], dxdt[4], dxdt[5] }) ;
+
+        }
+
+    }
+
+    if (durationSign < 0.0)
+    {
+
+        std::reverse(refinedNodeStates.begin(), refinedNodeStates.end()) ;
+        std::reverse(refinedNodeAccelerations.begin(), refinedNodeAccelerations.end()) ;
+
+    }
+
+    return { refinedNodeStates, refinedNodeAccelerations } ;
+
+}
+
+Array<SatelliteDynamics::StateVector> Propagator::integrateEnckeStatesAtSortedInstants ( IntegrationContext&    anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const
+{
+
+    // The reference is a Kepler orbit about the central body of the dynamics. The deviation equations are exact for any reference,
+    // a closer reference only makes the deviation (and its accelerations) smaller.
+
+    const Derived gravitationalParameter = CentralBodyGravitationalParameterOf(anIntegrationContext.satelliteDynamics) ;
+
+    const SatelliteDynamics::DynamicalEquationWrapper dynamicalEquations = anIntegrationContext.satelliteDynamics.getDynamicalEquations() ;
+
+    KeplerReference reference = OsculatingKeplerReferenceAt(aStartStateVector, aStartInstant, gravitationalParameter) ;
+
+    SatelliteDynamics::StateVector referenceStateVector(6) ;
+    SatelliteDynamics::StateVector deviationStateVector(6) ;
+
+    // Initial deviation, not assumed to be zero so that the reference does not need to be exactly osculating
+
+    KeplerReferenceStateAt(reference, 0.0, referenceStateVector.data()) ;
+
+    for (Size k = 0 ; k < 6 ; ++k)
+    {
+        deviationStateVector[k] = aStartStateVector[k] - referenceStateVector[k] ;
+    }
+
+    Instant instant = aStartInstant ;
+
+    Array<SatelliteDynamics::StateVector> propagatedStateVectorArray ;
+    propagatedStateVectorArray.reserve(anInstantArray.getSize()) ;
+
+    for (const Instant& outputInstant : anInstantArray)
+    {
+
+        while (instant != outputInstant)
+        {
+
+            const double orbitalPeriod = 2.0 * M_PI / reference.meanMotion ;
+            const double remainingDuration = (outputInstant - instant).inSeconds() ;
+
+            const Instant segmentEndInstant = (std::abs(remainingDuration) > orbitalPeriod) ? (instant + Duration::Seconds(std::copysign(orbitalPeriod, remainingDuration))) : outputInstant ;
+
+            const double referenceTimeOffset = (instant - reference.epoch).inSeconds() ;
+
+            // Deviation equations: d(dr)/dt = dv, d(dv)/dt = a(r, v, t) - a_ref(r_ref), with the difference of the central accelerations
+            // written with Battin's f(q) function to avoid the cancellation between them
+
+            SatelliteDynamics::StateVector stateVector(6) ;
+            SatelliteDynamics::StateVector stateDerivativeVector(6) ;
+            SatelliteDynamics::StateVector stepReferenceStateVector(6) ;
+
+            const SatelliteDynamics::DynamicalEquationWrapper deviationEquations = [&reference, &dynamicalEquations, referenceTimeOffset, stateVector, stateDerivativeVector, stepReferenceStateVector] (const SatelliteDynamics::StateVector& x, SatelliteDynamics::StateVector& dxdt, const double t) mutable -> void
+            {
+
+                KeplerReferenceStateAt(reference, referenceTimeOffset + t, stepReferenceStateVector.data()) ;
+
+                for (Size k = 0 ; k < 6 ; ++k)
+                {
+                    stateVector[k] = stepReferenceStateVector[k] + x[k] ;
+                }
+
+                dynamicalEquations(stateVector, stateDerivativeVector, t) ;
+
+                const double r2 = (stateVector[0] * stateVector[0]) + (stateVector[1] * stateVector[1]) + (stateVector[2] * stateVector[2]) ;
+                const double r = std::sqrt(r2) ;
+                const double rho = std::sqrt((stepReferenceStateVector[0] * stepReferenceStateVector[0]) + (stepReferenceStateVector[1] * stepReferenceStateVector[1]) + (stepReferenceStateVector[2] * stepReferenceStateVector[2])) ;
+
+                // rho^2 / r^2 = 1 + q, and f = 1 - (rho / r)^3 = -q (3 + 3q + q^2) / (1 + (1 + q)^(3/2))
+                const double q = ((x[0] * (x[0] - (2.0 * stateVector[0]))) + (x[1] * (x[1] - (2.0 * stateVector[1]))) + (x[2] * (x[2] - (2.0 * stateVector[2])))) / r2 ;
+                const double f = -q * (3.0 + (3.0 * q) + (q * q)) / (1.0 + std::pow(1.0 + q, 1.5)) ;
+
+                const double centralFactor = reference.gravitationalParameter / (r2 * r) ;
+                const double referenceFactor = reference.gravitationalParameter / (rho * rho * rho) ;
+
+                for (Size k = 0 ; k < 3 ; ++k)
+                {
+
+                    dxdt[k] = x[3 + k] ;
+
+                    // Perturbing acceleration (total minus central), plus the difference of the central accelerations
+                    dxdt[3 + k] = (stateDerivativeVector[3 + k] + (centralFactor * stateVector[k])) + (referenceFactor * ((f * stateVector[k]) - x[k])) ;
+
+                }
+
+            } ;
+
+            anIntegrationContext.satelliteDynamics.setInstant(instant) ;
+
+            deviationStateVector = anIntegrationContext.numericalSolver.integrateStateFromInstantToInstant(deviationStateVector, instant, segmentEndInstant, deviationEquations) ;
+
+            instant = segmentEndInstant ;
+
+            // Rectify the reference to the osculating orbit once the deviation has grown too large
+
+            KeplerReferenceStateAt(reference, (instant - reference.epoch).inSeconds(), referenceStateVector.data()) ;
+
+            const double deviationNorm = std::sqrt((deviationStateVector[0] * deviationStateVector[0]) + (deviationStateVector[1] * deviationStateVector[1]) + (deviationStateVector[2] * deviationStateVector[2])) ;
+            const double referenceNorm = std::sqrt((referenceStateVector[0] * referenceStateVector[0]) + (referenceStateVector[1] * referenceStateVector[1]) + (referenceStateVector[2] * referenceStateVector[2])) ;
+
+            if (deviationNorm > (EnckeRectificationThreshold * referenceNorm))
+            {
+
+                SatelliteDynamics::StateVector rectificationStateVector(6) ;
+
+                for (Size k = 0 ; k < 6 ; ++k)
+                {
+                    rectificationStateVector[k] = referenceStateVector[k] + deviationStateVector[k] ;
+                }
+
+                reference = OsculatingKeplerReferenceAt(rectificationStateVector, instant, gravitationalParameter) ;
+
+                KeplerReferenceStateAt(reference, 0.0, referenceStateVector.data()) ;
+
+                for (Size k = 0 ; k < 6 ; ++k)
+                {
+                    deviationStateVector[k] = rectificationStateVector[k] - referenceStateVector[k] ;
+                }
+
+            }
+
+        }
+
+        KeplerReferenceStateAt(reference, (instant - reference.epoch).inSeconds(), referenceStateVector.data()) ;
+
+        SatelliteDynamics::StateVector propagatedStateVector(6) ;
+
+        for (Size k = 0 ; k < 6 ; ++k)
+        {
+            propagatedStateVector[k] = referenceStateVector[k] + deviationStateVector[k] ;
+        }
+
+        propagatedStateVectorArray.add(propagatedStateVector) ;
+
+    }
+
+    return propagatedStateVectorArray ;
+
+}
+
+Array<SatelliteDynamics::StateVector> Propagator::integrateKustaanheimoStiefelStatesAtSortedInstants ( IntegrationContext& anIntegrationContext,
+                                                                                const   SatelliteDynamics::StateVector& aStartStateVector,
+                                                                                const   Instant&                    aStartInstant,
+                                                                                const   Array<Instant>&             anInstantArray                              ) const
+{
+
+    // The KS state is not a position / velocity pair, it cannot be integrated with the second order steppers
+
+    if (numericalSolver_.isSecondOrder())
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("Kustaanheimo-Stiefel formulation with a second order stepper") ;
+    }
+
+    // The Kepler energy and the perturbing acceleration are taken about the central body of the dynamics
+
+    const double gravitationalParameter = CentralBodyGravitationalParameterOf(anIntegrationContext.satelliteDynamics).in(GravitationalParameterSIUnit) ;
+
+    const SatelliteDynamics::DynamicalEquationWrapper dynamicalEquations = anIntegrationContext.satelliteDynamics.getDynamicalEquations() ;
+
+    anIntegrationContext.satelliteDynamics.setInstant(aStartInstant) ;
+
+    // KS state: u (4), u' = du/ds (4), Kepler energy h = mu / r - v^2 / 2 (1), and time since start [s] (1)
+
+    const double* position = aStartStateVector.data() ;
+
+    const double startRadius = std::sqrt((position[0] * position[0]) + (position[1] * position[1]) + (position[2] * position[2])) ;
+
+    if (startRadius == 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Position") ;
+    }
+
+    SatelliteDynamics::StateVector ksStateVector(10, 0.0) ;
+
+    double* u = ksStateVector.data() ;
+
+    // Inverse of x = L(u) u, on the branch that avoids the division by a small number
+
+    if (position[0] >= 0.0)
+    {
+        u[0] = std::sqrt(0.5 * (startRadius + position[0])) ;
+        u[1] = position[1] / (2.0 * u[0]) ;
+        u[2] = position[2] / (2.0 * u[0]) ;
+        u[3] = 0.0 ;
+    }
+    else
+    {
+        u[1] = std::sqrt(0.5 * (startRadius - position[0])) ;
+        u[0] = position[1] / (2.0 * u[1]) ;
+        u[2] = 0.0 ;
+        u[3] = position[2] / (2.0 * u[1]) ;
+    }
+
+    const double startVelocity[4] = { aStartStateVector[3], aStartStateVector[4], aStartStateVector[5], 0.0 } ;
+
+    KustaanheimoStiefelTransposeProduct(u, startVelocity, ksStateVector.data() + 4) ;
+
+    for (Size k = 4 ; k < 8 ; ++k)
+    {
+        ksStateVector[k] *= 0.5 ;
+    }
+
+    ksStateVector[8] = (gravitationalParameter / startRadius) - (0.5 * ((startVelocity[0] * startVelocity[0]) + (startVelocity[1] * startVelocity[1]) + (startVelocity[2] * startVelocity[2]))) ;
+    ksStateVector[9] = 0.0 ;
+
+    // Fictitious time is scaled by the start radius, so that the solver steps are of the order of seconds near the start
+
+    const double lengthScale = startRadius ;
+
+    SatelliteDynamics::StateVector stateVector(6) ;
+    SatelliteDynamics::StateVector stateDerivativeVector(6) ;
+
+    const SatelliteDynamics::DynamicalEquationWrapper ksEquations = [&dynamicalEquations, gravitationalParameter, lengthScale, stateVector, stateDerivativeVector] (const SatelliteDynamics::StateVector& y, SatelliteDynamics::StateVector& dyds, const double) mutable -> void
+    {
+
+        const double* u = y.data() ;
+        const double* uPrime = y.data() + 4 ;
+        const double h = y[8] ;
+        const double t = y[9] ;
+
+        const double r = (u[0] * u[0]) + (u[1] * u[1]) + (u[2] * u[2]) + (u[3] * u[3]) ;
+
+        double x[4] ;
+        double v[4] ;
+
+        KustaanheimoStiefelProduct(u, u, x) ;
+        KustaanheimoStiefelProduct(u, uPrime, v) ;
+
+        for (Size k = 0 ; k < 3 ; ++k)
+        {
+            stateVector[k] = x[k] ;
+            stateVector[3 + k] = 2.0 * v[k] / r ;
+        }
+
+        dynamicalEquations(stateVector, stateDerivativeVector, t) ;
+
+        // Perturbing acceleration: total minus central
+
+        const double centralFactor = gravitationalParameter / (r * r * r) ;
+
+        const double perturbation[4] =
+        {
+            stateDerivativeVector[3] + (centralFactor * x[0]),
+            stateDerivativeVector[4] + (centralFactor * x[1]),
+            stateDerivativeVector[5] + (centralFactor * x[2]),
+            0.0
+        } ;
+
+        double transposedPerturbation[4] ;
+
+        KustaanheimoStiefelTransposeProduct(u, perturbation, transposedPerturbation) ;
+
+        // u'' = - h u / 2 + r L(u)^T P / 2, h' = - 2 u' . L(u)^T P, t' = r
+
+        for (Size k = 0 ; k < 4 ; ++k)
+        {
+            dyds[k] = uPrime[k] / lengthScale ;
+            dyds[4 + k] = ((-0.5 * h * u[k]) + (0.5 * r * transposedPerturbation[k])) / lengthScale ;
+        }
+
+        dyds[8] = -2.0 * ((uPrime[0] * transposedPerturbation[0]) + (uPrime[1] * transposedPerturbation[1]) + (uPrime[2] * transposedPerturbation[2]) + (uPrime[3] * transposedPerturbation[3])) / lengthScale ;
+        dyds[9] = r / lengthScale ;
+
+    } ;
+
+    Array<SatelliteDynamics::StateVector> propagatedStateVectorArray ;
+    propagatedStateVectorArray.reserve(anInstantArray.getSize()) ;
+
+    for (const Instant& outputInstant : anInstantArray)
+    {
+
+        const double outputTime = (outputInstant - aStartInstant).inSeconds() ;
+
+        // Newton iterations on the fictitious time, with dt/ds = r / r0: the mean rate (semi-major axis) is used first
+        // over long durations, then the local rate (radius)
+
+        Size iterationCount = 0 ;
+
+        while (std::abs(outputTime - ksStateVector[9]) > KustaanheimoStiefelTimeTolerance)
+        {
+
+            if (iterationCount++ >= KustaanheimoStiefelMaximumIterationCount)
+            {
+                throw ostk::core::error::RuntimeError("Cannot converge to output instant in fictitious time.") ;
+            }
+
+            const double remainingDuration = outputTime - ksStateVector[9] ;
+
+            const double radius = (ksStateVector[0] * ksStateVector[0]) + (ksStateVector[1] * ksStateVector[1]) + (ksStateVector[2] * ksStateVector[2]) + (ksStateVector[3] * ksStateVector[3]) ;
+
+            double rate = radius ;
+
+            if (ksStateVector[8] > 0.0)
+            {
+
+                const double semiMajorAxis = gravitationalParameter / (2.0 * ksStateVector[8]) ;
+                const double orbitalPeriod = 2.0 * M_PI * std::sqrt(semiMajorAxis * semiMajorAxis * semiMajorAxis / gravitationalParameter) ;
+
+                if (std::abs(remainingDuration) > (0.25 * orbitalPeriod))
+                {
+                    rate = semiMajorAxis ;
+                }
+
+            }
+
+            ksStateVector = anIntegrationContext.numericalSolver.integrateStateForDuration(ksStateVector, Duration::Seconds(lengthScale * remainingDuration / rate), ksEquations) ;
+
+        }
+
+        const double* outputU = ksStateVector.data() ;
+
+        const double r = (outputU[0] * outputU[0]) + (outputU[1] * outputU[1]) + (outputU[2] * outputU[2]) + (outputU[3] * outputU[3]) ;
+
+        double x[4] ;
+        double v[4] ;
+
+        KustaanheimoStiefelProduct(outputU, outputU, x) ;
+        KustaanheimoStiefelProduct(outputU, outputU + 4, v) ;
+
+        propagatedStateVectorArray.add({ x[0], x[1], x[2], 2.0 * v[0] / r, 2.0 * v[1] / r, 2.0 * v[2] / r }) ;
+
+    }
+
+    return propagatedStateVectorArray ;
 
 }
 
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.tpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace astro
+{
+namespace trajectory
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class... Terms>
+                                Propagator::Propagator                      (   const   ComposedDynamics<Terms...>& aComposedDynamics,
+                                                                                const   NumericalSolver&            aNumericalSolver                            )
+                                :   satelliteDynamics_(SatelliteDynamics::Undefined()),
+                                    numericalSolver_(aNumericalSolver),
+                                    formulationType_(Propagator::FormulationType::Cowell),
+                                    composedDynamicsSPtr_(nullptr),
+                                    composedDynamicsIntegrator_(),
+                                    composedDynamicsStateDerivative_(),
+                                    mutex_(),
+                                    statistics_(aNumericalSolver.getStatistics()),
+                                    idleIntegrationContexts_()
+{
+
+    const Shared<const ComposedDynamics<Terms...>> composedDynamicsSPtr = std::make_shared<const ComposedDynamics<Terms...>>(aComposedDynamics) ;
+
+    composedDynamicsSPtr_ = composedDynamicsSPtr ;
+
+    // The concrete dynamics type is captured here, so that the type erasure costs one call per integration, not one per right-hand side evaluation
+
+    composedDynamicsIntegrator_ = [composedDynamicsSPtr] (const NumericalSolver& aNumericalSolver, const NumericalSolver::FixedStateVector<6>& aStartStateVector, const Instant& aStartInstant, const Array<Instant>& anInstantArray) -> Array<NumericalSolver::FixedStateVector<6>>
+    {
+        return aNumericalSolver.integrateStatesAtSortedInstants<ComposedDynamics<Terms...>::StateDimension>(aStartStateVector, aStartInstant, anInstantArray, *composedDynamicsSPtr) ;
+    } ;
+
+    composedDynamicsStateDerivative_ = [composedDynamicsSPtr] (const double* x, double* dxdt) -> void
+    {
+        composedDynamicsSPtr->calculateStateDerivativeAt(x, dxdt) ;
+    } ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
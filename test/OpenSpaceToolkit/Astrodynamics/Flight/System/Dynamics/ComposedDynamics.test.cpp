@@ -0,0 +1,334 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <sstream>
+#include <cmath>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const double GravitationalParameter = 3.986004418e14 ;
+static const double EquatorialRadius = 6378137.0 ;
+static const double J2 = 1.0826266835e-3 ;
+static const double Flattening = 1.0 / 298.257223563 ;
+static const double RotationRate = 7.2921159e-5 ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, Constructor)
+{
+
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+    using ostk::astro::flight::system::dynamics::terms::ExponentialDrag ;
+
+    {
+
+        EXPECT_NO_THROW(ComposedDynamics<PointMassGravity>(PointMassGravity(GravitationalParameter))) ;
+        EXPECT_NO_THROW((ComposedDynamics<PointMassGravity, J2Gravity, ExponentialDrag>({ GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 }, { 0.01, EquatorialRadius, Flattening, RotationRate, ExponentialAtmosphere::Default() }))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, IsDefined)
+{
+
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+    using ostk::astro::flight::system::dynamics::terms::ExponentialDrag ;
+
+    {
+
+        EXPECT_TRUE(ComposedDynamics<PointMassGravity>(PointMassGravity(GravitationalParameter)).isDefined()) ;
+        EXPECT_TRUE((ComposedDynamics<PointMassGravity, J2Gravity>({ GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 }).isDefined())) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(ComposedDynamics<PointMassGravity>(PointMassGravity(std::nan(""))).isDefined()) ;
+        EXPECT_FALSE((ComposedDynamics<PointMassGravity, J2Gravity>({ GravitationalParameter }, { GravitationalParameter, -1.0, J2 }).isDefined())) ;
+        EXPECT_FALSE((ComposedDynamics<PointMassGravity, ExponentialDrag>({ GravitationalParameter }, { 0.01, EquatorialRadius, Flattening, RotationRate, ExponentialAtmosphere::Undefined() }).isDefined())) ;
+
+    }
+
+    {
+
+        const ComposedDynamics<PointMassGravity> dynamics = { PointMassGravity(std::nan("")) } ;
+
+        EXPECT_ANY_THROW(dynamics.accessTerm<0>().getGravitationalParameter()) ;
+
+        ComposedDynamics<PointMassGravity> dynamicsCopy = dynamics ;
+
+        EXPECT_ANY_THROW(dynamicsCopy.getDynamicalEquations()) ;
+        EXPECT_ANY_THROW(dynamicsCopy.getSecondOrderDynamicalEquations()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, Print)
+{
+
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+    using ostk::astro::flight::system::dynamics::terms::ExponentialDrag ;
+
+    {
+
+        const ComposedDynamics<PointMassGravity, J2Gravity, ExponentialDrag> dynamics = { { GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 }, { 0.01, EquatorialRadius, Flattening, RotationRate, ExponentialAtmosphere::Default() } } ;
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(dynamics.print(std::cout, true)) ;
+        EXPECT_NO_THROW(dynamics.print(std::cout, false)) ;
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, AccessTerm)
+{
+
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+
+    {
+
+        const ComposedDynamics<PointMassGravity, J2Gravity> dynamics = { { GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 } } ;
+
+        EXPECT_EQ(GravitationalParameter, dynamics.accessTerm<0>().getGravitationalParameter()) ;
+        EXPECT_EQ(EquatorialRadius, dynamics.accessTerm<1>().getEquatorialRadius()) ;
+        EXPECT_EQ(J2, dynamics.accessTerm<1>().getJ2()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, CalculateAccelerationAt)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+    using ostk::astro::flight::system::dynamics::terms::ExponentialDrag ;
+
+    const double x[6] = { 4000000.0, -3000000.0, 4500000.0, 3000.0, 5000.0, 2500.0 } ;
+    const Vector3d position = { x[0], x[1], x[2] } ;
+
+    // Point mass gravity
+
+    {
+
+        const ComposedDynamics<PointMassGravity> dynamics = { { GravitationalParameter } } ;
+
+        Vector3d acceleration ;
+        dynamics.calculateAccelerationAt(x, acceleration.data()) ;
+
+        const Vector3d referenceAcceleration = (-GravitationalParameter / std::pow(position.norm(), 3)) * position ;
+
+        EXPECT_GT(1e-15, (acceleration - referenceAcceleration).norm() / referenceAcceleration.norm()) ;
+
+    }
+
+    // Point mass and J2 gravity, against the spherical harmonic gravity of degree 2 (fully normalized C20 = -J2 / sqrt(5))
+
+    {
+
+        const ComposedDynamics<PointMassGravity, J2Gravity> dynamics = { { GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 } } ;
+
+        MatrixXd C = MatrixXd::Zero(3, 3) ;
+        MatrixXd S = MatrixXd::Zero(3, 3) ;
+
+        C(0, 0) = 1.0 ;
+        C(2, 0) = -J2 / std::sqrt(5.0) ;
+
+        const SphericalHarmonicGravity sphericalHarmonicGravity = { GravitationalParameter, EquatorialRadius, C, S } ;
+
+        Vector3d acceleration ;
+        dynamics.calculateAccelerationAt(x, acceleration.data()) ;
+
+        const Vector3d referenceAcceleration = sphericalHarmonicGravity.getAccelerationAt(position, 2, 0) ;
+
+        EXPECT_GT(1e-13, (acceleration - referenceAcceleration).norm() / referenceAcceleration.norm()) ;
+
+    }
+
+    // Drag, in an atmosphere co-rotating around the Z axis
+
+    {
+
+        const ExponentialAtmosphere atmosphere = ExponentialAtmosphere::Default() ;
+
+        const double ballisticCoefficient = 0.02 ;
+
+        const ComposedDynamics<ExponentialDrag> dynamics = { { ballisticCoefficient, EquatorialRadius, Flattening, RotationRate, atmosphere } } ;
+
+        const double lowX[6] = { 6778137.0 * std::cos(0.3), 0.0, 6778137.0 * std::sin(0.3), 0.0, 7600.0, 500.0 } ;
+
+        Vector3d acceleration ;
+        dynamics.calculateAccelerationAt(lowX, acceleration.data()) ;
+
+        const Vector3d lowPosition = { lowX[0], lowX[1], lowX[2] } ;
+        const Vector3d lowVelocity = { lowX[3], lowX[4], lowX[5] } ;
+
+        const double sinLatitude = lowPosition.z() / lowPosition.norm() ;
+        const double altitude = lowPosition.norm() - (EquatorialRadius * (1.0 - (Flattening * sinLatitude * sinLatitude))) ;
+
+        EXPECT_NEAR(altitude, dynamics.accessTerm<0>().getAltitudeAt(lowX, lowPosition.norm()), 1e-9) ;
+
+        const Vector3d relativeVelocity = lowVelocity - Vector3d(0.0, 0.0, RotationRate).cross(lowPosition) ;
+        const Vector3d referenceAcceleration = (-0.5 * ballisticCoefficient * atmosphere.getDensityAt(altitude) * relativeVelocity.norm()) * relativeVelocity ;
+
+        EXPECT_LT(0.0, referenceAcceleration.norm()) ;
+        EXPECT_GT(1e-14, (acceleration - referenceAcceleration).norm() / referenceAcceleration.norm()) ;
+
+    }
+
+    // Sum of the terms
+
+    {
+
+        const ComposedDynamics<PointMassGravity> pointMassDynamics = { { GravitationalParameter } } ;
+        const ComposedDynamics<J2Gravity> j2Dynamics = { { GravitationalParameter, EquatorialRadius, J2 } } ;
+        const ComposedDynamics<PointMassGravity, J2Gravity> dynamics = { { GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 } } ;
+
+        Vector3d pointMassAcceleration ;
+        Vector3d j2Acceleration ;
+        Vector3d acceleration ;
+
+        pointMassDynamics.calculateAccelerationAt(x, pointMassAcceleration.data()) ;
+        j2Dynamics.calculateAccelerationAt(x, j2Acceleration.data()) ;
+        dynamics.calculateAccelerationAt(x, acceleration.data()) ;
+
+        EXPECT_GT(1e-15, (acceleration - (pointMassAcceleration + j2Acceleration)).norm() / acceleration.norm()) ;
+
+    }
+
+    // Re-entry
+
+    {
+
+        const ComposedDynamics<ExponentialDrag> dynamics = { { 0.02, EquatorialRadius, Flattening, RotationRate, ExponentialAtmosphere::Default() } } ;
+
+        const double reentryX[6] = { EquatorialRadius + 50000.0, 0.0, 0.0, 0.0, 7800.0, 0.0 } ;
+
+        Vector3d acceleration ;
+
+        EXPECT_ANY_THROW(dynamics.calculateAccelerationAt(reentryX, acceleration.data())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, GetDynamicalEquations)
+{
+
+    using ostk::astro::flight::system::Dynamics ;
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+    using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
+
+    ComposedDynamics<PointMassGravity, J2Gravity> dynamics = { { GravitationalParameter }, { GravitationalParameter, EquatorialRadius, J2 } } ;
+
+    const Dynamics::StateVector x = { 4000000.0, -3000000.0, 4500000.0, 3000.0, 5000.0, 2500.0 } ;
+
+    double referenceDxdt[6] ;
+    dynamics.calculateStateDerivativeAt(x.data(), referenceDxdt) ;
+
+    {
+
+        Dynamics::StateVector dxdt(6, 0.0) ;
+
+        dynamics.getDynamicalEquations()(x, dxdt, 0.0) ;
+
+        for (std::size_t i = 0 ; i < 6 ; ++i)
+        {
+            EXPECT_EQ(referenceDxdt[i], dxdt[i]) ;
+        }
+
+        EXPECT_EQ(x[3], dxdt[0]) ;
+        EXPECT_EQ(x[4], dxdt[1]) ;
+        EXPECT_EQ(x[5], dxdt[2]) ;
+
+    }
+
+    {
+
+        Dynamics::StateVector dxdt(6, 0.0) ;
+
+        dynamics.getSecondOrderDynamicalEquations()(x, dxdt, 0.0) ;
+
+        for (std::size_t i = 3 ; i < 6 ; ++i)
+        {
+            EXPECT_EQ(referenceDxdt[i], dxdt[i]) ;
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ComposedDynamics, Integration)
+{
+
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+    using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+    using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+
+    // Circular orbit, propagated over one period with the fixed-size path of the numerical solver
+
+    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-13, 1.0e-13 } ;
+
+    const ComposedDynamics<PointMassGravity> dynamics = { { GravitationalParameter } } ;
+
+    const double radius = 7000000.0 ;
+    const double speed = std::sqrt(GravitationalParameter / radius) ;
+    const double period = 2.0 * M_PI * radius / speed ;
+
+    const NumericalSolver::FixedStateVector<6> initialStateVector = (NumericalSolver::FixedStateVector<6>() << radius, 0.0, 0.0, 0.0, speed * std::cos(0.5), speed * std::sin(0.5)).finished() ;
+
+    {
+
+        const NumericalSolver::FixedStateVector<6> finalStateVector = numericalSolver.integrateStateForDuration<6>(initialStateVector, Duration::Seconds(period), dynamics) ;
+
+        EXPECT_GT(1e-3, (finalStateVector.head<3>() - initialStateVector.head<3>()).norm()) ;
+        EXPECT_GT(1e-6, (finalStateVector.tail<3>() - initialStateVector.tail<3>()).norm()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
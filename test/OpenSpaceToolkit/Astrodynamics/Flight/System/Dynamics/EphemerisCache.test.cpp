@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/EphemerisCache.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache, Constructor)
+{
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+    const Environment environment = Environment::Default() ;
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EXPECT_NO_THROW(EphemerisCache(environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch)) ;
+        EXPECT_NO_THROW(EphemerisCache(environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch, Duration::Hours(12.0), 9)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(EphemerisCache(environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch, Duration::Zero())) ;
+        EXPECT_ANY_THROW(EphemerisCache(environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch, Duration::Hours(-1.0))) ;
+        EXPECT_ANY_THROW(EphemerisCache(environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch, Duration::Hours(1.0), 11, 0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache, IsDefined)
+{
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+    const Environment environment = Environment::Default() ;
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EXPECT_TRUE(EphemerisCache(environment.accessCelestialObjectWithName("Sun")->accessFrame(), Frame::GCRF(), epoch).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(EphemerisCache::Undefined().isDefined()) ;
+        EXPECT_FALSE(EphemerisCache(nullptr, Frame::GCRF(), epoch).isDefined()) ;
+        EXPECT_FALSE(EphemerisCache(environment.accessCelestialObjectWithName("Sun")->accessFrame(), Frame::GCRF(), Instant::Undefined()).isDefined()) ;
+        EXPECT_FALSE(EphemerisCache(environment.accessCelestialObjectWithName("Sun")->accessFrame(), Frame::GCRF(), epoch, Duration::Undefined()).isDefined()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache, GetEpoch)
+{
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+    const Environment environment = Environment::Default() ;
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EXPECT_EQ(epoch, EphemerisCache(environment.accessCelestialObjectWithName("Sun")->accessFrame(), Frame::GCRF(), epoch).getEpoch()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(EphemerisCache::Undefined().getEpoch()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache, GetPositionAt)
+{
+
+    using ostk::core::types::Shared ;
+
+    using ostk::math::obj::Vector3d ;
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+    const Environment environment = Environment::Default() ;
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    // Moon and Sun positions in GCRF, against the full ephemeris, over 5 days (forward and backward)
+
+    for (const auto& objectName : { "Moon", "Sun" })
+    {
+
+        const Shared<const Frame> objectFrameSPtr = environment.accessCelestialObjectWithName(objectName)->accessFrame() ;
+
+        EphemerisCache ephemerisCache = { objectFrameSPtr, Frame::GCRF(), epoch } ;
+
+        for (double time = -2.0 * 86400.0 ; time <= 3.0 * 86400.0 ; time += 1234.5)
+        {
+
+            const Vector3d referencePosition = objectFrameSPtr->getOriginIn(Frame::GCRF(), epoch + Duration::Seconds(time)).inMeters().getCoordinates() ;
+
+            EXPECT_GT(1e-3, (ephemerisCache.getPositionAt(time) - referencePosition).norm()) << objectName << " at " << time << " [s]" ;
+            EXPECT_GT(1e-3, (ephemerisCache.getPositionAt(epoch + Duration::Seconds(time)) - referencePosition).norm()) << objectName << " at " << time << " [s]" ;
+
+        }
+
+        EXPECT_EQ(5, ephemerisCache.getSegmentCount()) ;
+
+    }
+
+    // Segments dropped out of a small window are fitted again identically when queried again
+
+    {
+
+        const Shared<const Frame> moonFrameSPtr = environment.accessCelestialObjectWithName("Moon")->accessFrame() ;
+
+        EphemerisCache ephemerisCache = { moonFrameSPtr, Frame::GCRF(), epoch, Duration::Hours(6.0), 11, 2 } ;
+
+        EXPECT_EQ(2, ephemerisCache.getCapacity()) ;
+
+        const Vector3d position = ephemerisCache.getPositionAt(3600.0) ;
+
+        for (double time = 0.0 ; time <= 2.0 * 86400.0 ; time += 1234.5)
+        {
+
+            ephemerisCache.getPositionAt(time) ;
+
+            EXPECT_GE(2, ephemerisCache.getSegmentCount()) ;
+
+        }
+
+        EXPECT_EQ(2, ephemerisCache.getSegmentCount()) ;
+
+        EXPECT_EQ(position, ephemerisCache.getPositionAt(3600.0)) ;
+        EXPECT_EQ(2, ephemerisCache.getSegmentCount()) ;
+
+    }
+
+    {
+
+        EphemerisCache ephemerisCache = EphemerisCache::Undefined() ;
+
+        EXPECT_ANY_THROW(ephemerisCache.getPositionAt(0.0)) ;
+        EXPECT_ANY_THROW(ephemerisCache.getPositionAt(epoch)) ;
+
+    }
+
+    {
+
+        EphemerisCache ephemerisCache = { environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch } ;
+
+        EXPECT_ANY_THROW(ephemerisCache.getPositionAt(Instant::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_EphemerisCache, Clear)
+{
+
+    using ostk::math::obj::Vector3d ;
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::dynamics::EphemerisCache ;
+
+    const Environment environment = Environment::Default() ;
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EphemerisCache ephemerisCache = { environment.accessCelestialObjectWithName("Moon")->accessFrame(), Frame::GCRF(), epoch } ;
+
+        const Vector3d position = ephemerisCache.getPositionAt(3600.0) ;
+
+        EXPECT_EQ(1, ephemerisCache.getSegmentCount()) ;
+
+        const EphemerisCache ephemerisCacheCopy = ephemerisCache ;
+
+        ephemerisCache.clear() ;
+
+        EXPECT_EQ(0, ephemerisCache.getSegmentCount()) ;
+        EXPECT_EQ(1, ephemerisCacheCopy.getSegmentCount()) ;
+
+        EXPECT_EQ(position, ephemerisCache.getPositionAt(3600.0)) ;
+        EXPECT_EQ(1, ephemerisCache.getSegmentCount()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
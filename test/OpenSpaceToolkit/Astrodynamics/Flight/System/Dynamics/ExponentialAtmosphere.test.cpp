@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ExponentialAtmosphere.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+
+#include <Global.test.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere, Constructor)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+    {
+
+        EXPECT_NO_THROW(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 }, { 25000.0, 3.899e-2, 6349.0 } })) ;
+        EXPECT_NO_THROW(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } })) ;
+        EXPECT_NO_THROW(ExponentialAtmosphere::Default()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(ExponentialAtmosphere({ { 25000.0, 3.899e-2, 6349.0 }, { 0.0, 1.225, 7249.0 } })) ;
+        EXPECT_ANY_THROW(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 }, { 0.0, 1.225, 7249.0 } })) ;
+        EXPECT_ANY_THROW(ExponentialAtmosphere({ { 0.0, 0.0, 7249.0 } })) ;
+        EXPECT_ANY_THROW(ExponentialAtmosphere({ { 0.0, 1.225, -7249.0 } })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere, EqualToOperator)
+{
+
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+    {
+
+        EXPECT_TRUE(ExponentialAtmosphere::Default() == ExponentialAtmosphere::Default()) ;
+        EXPECT_TRUE(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } }) == ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } })) ;
+
+        EXPECT_FALSE(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } }) == ExponentialAtmosphere({ { 0.0, 1.225, 7000.0 } })) ;
+        EXPECT_FALSE(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } }) == ExponentialAtmosphere::Default()) ;
+        EXPECT_FALSE(ExponentialAtmosphere::Undefined() == ExponentialAtmosphere::Undefined()) ;
+
+        EXPECT_TRUE(ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } }) != ExponentialAtmosphere::Default()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere, IsDefined)
+{
+
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+    {
+
+        EXPECT_TRUE(ExponentialAtmosphere::Default().isDefined()) ;
+        EXPECT_FALSE(ExponentialAtmosphere::Undefined().isDefined()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere, GetBandCount)
+{
+
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+    {
+
+        EXPECT_EQ(28, ExponentialAtmosphere::Default().getBandCount()) ;
+        EXPECT_EQ(0, ExponentialAtmosphere::Undefined().getBandCount()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ExponentialAtmosphere, GetDensityAt)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
+
+    // Band base densities
+
+    {
+
+        const ExponentialAtmosphere atmosphere = ExponentialAtmosphere::Default() ;
+
+        EXPECT_DOUBLE_EQ(1.225, atmosphere.getDensityAt(0.0)) ;
+        EXPECT_DOUBLE_EQ(2.070e-9, atmosphere.getDensityAt(150000.0)) ;
+        EXPECT_DOUBLE_EQ(1.585e-12, atmosphere.getDensityAt(450000.0)) ;
+        EXPECT_DOUBLE_EQ(6.967e-13, atmosphere.getDensityAt(500000.0)) ;
+        EXPECT_DOUBLE_EQ(3.019e-15, atmosphere.getDensityAt(1000000.0)) ;
+
+        EXPECT_DOUBLE_EQ(6.967e-13 * std::exp(-0.5), atmosphere.getDensityAt(500000.0 + (0.5 * 63822.0))) ;
+
+        EXPECT_DOUBLE_EQ(3.019e-15 * std::exp(-1.0), atmosphere.getDensityAt(1000000.0 + 268000.0)) ;
+        EXPECT_DOUBLE_EQ(1.225 * std::exp(1.0), atmosphere.getDensityAt(-7249.0)) ;
+
+    }
+
+    // Against a linear search over irregular bands
+
+    {
+
+        const Array<ExponentialAtmosphere::Band> bands =
+        {
+            {     0.0, 1.0e-1,  8000.0 },
+            {  7000.0, 5.0e-2, 10000.0 },
+            { 10000.0, 1.0e-2, 20000.0 },
+            { 55000.0, 1.0e-4, 30000.0 },
+            { 58500.0, 5.0e-5, 40000.0 }
+        } ;
+
+        const ExponentialAtmosphere atmosphere = { bands } ;
+
+        for (double altitude = -1000.0 ; altitude <= 70000.0 ; altitude += 12.5)
+        {
+
+            std::size_t bandIndex = 0 ;
+
+            while (((bandIndex + 1) < bands.getSize()) && (altitude >= bands.at(bandIndex + 1).baseAltitude))
+            {
+                ++bandIndex ;
+            }
+
+            const ExponentialAtmosphere::Band& band = bands.at(bandIndex) ;
+
+            EXPECT_DOUBLE_EQ(band.baseDensity * std::exp(-(altitude - band.baseAltitude) / band.scaleHeight), atmosphere.getDensityAt(altitude)) << altitude ;
+            EXPECT_EQ(band.scaleHeight, atmosphere.getScaleHeightAt(altitude)) << altitude ;
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(ExponentialAtmosphere::Undefined().getDensityAt(0.0)) ;
+        EXPECT_ANY_THROW(ExponentialAtmosphere::Undefined().getScaleHeightAt(0.0)) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
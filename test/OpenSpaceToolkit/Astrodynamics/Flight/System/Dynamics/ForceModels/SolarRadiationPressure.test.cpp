@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ForceModels/SolarRadiationPressure.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SatelliteDynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Units/Mass.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <Global.test.hpp>
+
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_SolarRadiationPressure, ShadowFunction)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::VectorXd ;
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::forcemodels::SolarRadiationPressure ;
+
+    const double earthRadius = 6378137.0 ;
+    const double sunRadius = 695700000.0 ;
+    const Vector3d sunPosition = { 1.496e11, 0.0, 0.0 } ;
+
+    // GEO satellite crossing the shadow of Earth, at decreasing distance from the Sun - Earth line
+
+    {
+
+        const Vector3d sunlitPosition = { 42164000.0, 0.0, 0.0 } ;
+        const Vector3d umbraPosition = { -42164000.0, 0.0, 0.0 } ;
+        const Vector3d penumbraPosition = { -42164000.0, 6370000.0, 0.0 } ;
+        const Vector3d outerPenumbraPosition = { -42164000.0, 6400000.0, 0.0 } ;
+
+        for (const auto& shadowModel : { SolarRadiationPressure::ShadowModel::NoShadow, SolarRadiationPressure::ShadowModel::Cylindrical, SolarRadiationPressure::ShadowModel::Conical })
+        {
+            EXPECT_EQ(1.0, SolarRadiationPressure::ShadowFunction(sunlitPosition, sunPosition, earthRadius, sunRadius, shadowModel)) ;
+        }
+
+        EXPECT_EQ(1.0, SolarRadiationPressure::ShadowFunction(umbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::NoShadow)) ;
+        EXPECT_EQ(0.0, SolarRadiationPressure::ShadowFunction(umbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Cylindrical)) ;
+        EXPECT_EQ(0.0, SolarRadiationPressure::ShadowFunction(umbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Conical)) ;
+
+        // Fraction of the solar disk visible, against a Monte Carlo integration over the disk: 0.4710
+
+        EXPECT_EQ(0.0, SolarRadiationPressure::ShadowFunction(penumbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Cylindrical)) ;
+        EXPECT_NEAR(0.4710, SolarRadiationPressure::ShadowFunction(penumbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Conical), 1e-3) ;
+
+        EXPECT_EQ(1.0, SolarRadiationPressure::ShadowFunction(outerPenumbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Cylindrical)) ;
+        EXPECT_NEAR(0.5683, SolarRadiationPressure::ShadowFunction(outerPenumbraPosition, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Conical), 1e-3) ;
+
+    }
+
+    // Batch, consistent with single evaluations, and monotonic across the penumbra
+
+    {
+
+        MatrixXd positions(3, 101) ;
+
+        for (Eigen::Index index = 0 ; index < positions.cols() ; ++index)
+        {
+            positions.col(index) = Vector3d { -42164000.0, 6000000.0 + (10000.0 * static_cast<double>(index)), 0.0 } ;
+        }
+
+        const VectorXd shadowFunctions = SolarRadiationPressure::ShadowFunctions(positions, sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Conical) ;
+
+        ASSERT_EQ(positions.cols(), shadowFunctions.size()) ;
+
+        for (Eigen::Index index = 0 ; index < positions.cols() ; ++index)
+        {
+
+            EXPECT_NEAR(SolarRadiationPressure::ShadowFunction(positions.col(index), sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Conical), shadowFunctions[index], 1e-9) ;
+
+            EXPECT_LE(0.0, shadowFunctions[index]) ;
+            EXPECT_GE(1.0, shadowFunctions[index]) ;
+
+            if (index > 0)
+            {
+                EXPECT_LE(shadowFunctions[index - 1], shadowFunctions[index]) ;
+            }
+
+        }
+
+        EXPECT_EQ(0.0, shadowFunctions[0]) ;
+        EXPECT_EQ(1.0, shadowFunctions[100]) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(SolarRadiationPressure::ShadowFunctions(MatrixXd::Zero(2, 4), sunPosition, earthRadius, sunRadius, SolarRadiationPressure::ShadowModel::Conical)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_ForceModels_SolarRadiationPressure, CalculateAccelerationAt)
+{
+
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+
+    using ostk::physics::units::Mass ;
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::SolarRadiationPressure ;
+
+    const Environment environment = Environment::Default() ;
+    const Instant instant = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 10.0, 2.2, 1.5 } ;
+
+    const Vector3d sunPosition = environment.accessCelestialObjectWithName("Sun")->accessFrame()->getOriginIn(Frame::GCRF(), instant).inMeters().getCoordinates() ;
+
+    SolarRadiationPressure solarRadiationPressure = { environment.accessCelestialObjectWithName("Sun"), environment.accessCelestialObjectWithName("Earth"), satelliteSystem } ;
+
+    EXPECT_TRUE(solarRadiationPressure.isDefined()) ;
+    EXPECT_EQ(SolarRadiationPressure::ShadowModel::Conical, solarRadiationPressure.getShadowModel()) ;
+
+    // GEO, on the Sun side: P * Cr * A / m, away from the Sun, scaled by the squared distance ratio to 1 AU
+
+    {
+
+        ForceModel::Context context ;
+
+        context.instant = instant ;
+        context.position = 42164000.0 * sunPosition.normalized() ;
+        context.velocity = Vector3d::Zero() ;
+        context.positionNorm = context.position.norm() ;
+        context.bodyFrameSPtr = nullptr ;
+        context.dcm_GCRF_BODY = Matrix3d::Identity() ;
+        context.bodyFixedPosition = context.position ;
+        context.sunPosition = sunPosition ;
+        context.density = std::numeric_limits<double>::quiet_NaN() ;
+
+        const Vector3d acceleration = solarRadiationPressure.calculateAccelerationAt(context) ;
+
+        const double distanceRatio = 149597870700.0 / (sunPosition - context.position).norm() ;
+
+        EXPECT_NEAR(4.56e-6 * 1.5 * 10.0 / 100.0 * distanceRatio * distanceRatio, acceleration.norm(), 1e-15) ;
+        EXPECT_NEAR(-1.0, acceleration.normalized().dot(sunPosition.normalized()), 1e-12) ;
+
+        // Sun position from the model cache, when not in the context
+
+        context.sunPosition = Vector3d::Constant(std::numeric_limits<double>::quiet_NaN()) ;
+
+        EXPECT_NEAR(0.0, (solarRadiationPressure.calculateAccelerationAt(context) - acceleration).norm(), 1e-15) ;
+
+        // In umbra
+
+        context.position = -42164000.0 * sunPosition.normalized() ;
+        context.positionNorm = context.position.norm() ;
+        context.sunPosition = sunPosition ;
+
+        EXPECT_EQ(0.0, solarRadiationPressure.calculateShadowFunctionAt(context)) ;
+        EXPECT_EQ(0.0, solarRadiationPressure.calculateAccelerationAt(context).norm()) ;
+
+    }
+
+    // Shadow of the Moon: the geometry is relative to the Moon at the instant, not to the GCRF origin
+
+    {
+
+        const Vector3d moonPosition = environment.accessCelestialObjectWithName("Moon")->accessFrame()->getOriginIn(Frame::GCRF(), instant).inMeters().getCoordinates() ;
+
+        SolarRadiationPressure lunarSolarRadiationPressure = { environment.accessCelestialObjectWithName("Sun"), environment.accessCelestialObjectWithName("Moon"), satelliteSystem } ;
+
+        ForceModel::Context context ;
+
+        context.instant = instant ;
+        context.position = moonPosition - (5000000.0 * (sunPosition - moonPosition).normalized()) ;
+        context.velocity = Vector3d::Zero() ;
+        context.positionNorm = context.position.norm() ;
+        context.bodyFrameSPtr = nullptr ;
+        context.dcm_GCRF_BODY = Matrix3d::Identity() ;
+        context.bodyFixedPosition = context.position ;
+        context.sunPosition = sunPosition ;
+        context.density = std::numeric_limits<double>::quiet_NaN() ;
+
+        EXPECT_EQ(0.0, lunarSolarRadiationPressure.calculateShadowFunctionAt(context)) ;
+        EXPECT_EQ(0.0, lunarSolarRadiationPressure.calculateAccelerationAt(context).norm()) ;
+
+        // On the Sun side of the Moon
+
+        context.position = moonPosition + (5000000.0 * (sunPosition - moonPosition).normalized()) ;
+        context.positionNorm = context.position.norm() ;
+
+        EXPECT_EQ(1.0, lunarSolarRadiationPressure.calculateShadowFunctionAt(context)) ;
+
+        // Behind the Earth: shadowed by the Earth only
+
+        context.position = -42164000.0 * sunPosition.normalized() ;
+        context.positionNorm = context.position.norm() ;
+
+        EXPECT_EQ(0.0, solarRadiationPressure.calculateShadowFunctionAt(context)) ;
+        EXPECT_EQ(1.0, lunarSolarRadiationPressure.calculateShadowFunctionAt(context)) ;
+
+    }
+
+    // Without reflectivity coefficient
+
+    {
+
+        const SatelliteSystem satelliteSystemWithoutReflectivity = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 10.0, 2.2 } ;
+
+        SolarRadiationPressure undefinedSolarRadiationPressure = { environment.accessCelestialObjectWithName("Sun"), environment.accessCelestialObjectWithName("Earth"), satelliteSystemWithoutReflectivity } ;
+
+        EXPECT_FALSE(undefinedSolarRadiationPressure.isDefined()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
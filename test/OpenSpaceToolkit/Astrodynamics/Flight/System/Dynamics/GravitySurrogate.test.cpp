@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/GravitySurrogate.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+
+#include <Global.test.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate, Constructor)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4) ;
+
+    {
+
+        EXPECT_NO_THROW(GravitySurrogate(sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 5.0)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(GravitySurrogate(SphericalHarmonicGravity::Undefined(), 2, 6578e3, 8378e3, 100e3, 5.0)) ;
+        EXPECT_ANY_THROW(GravitySurrogate(sphericalHarmonicGravity, 5, 6578e3, 8378e3, 100e3, 5.0)) ;
+        EXPECT_ANY_THROW(GravitySurrogate(sphericalHarmonicGravity, 2, 8378e3, 6578e3, 100e3, 5.0)) ;
+        EXPECT_ANY_THROW(GravitySurrogate(sphericalHarmonicGravity, 2, 0.0, 8378e3, 100e3, 5.0)) ;
+        EXPECT_ANY_THROW(GravitySurrogate(sphericalHarmonicGravity, 2, 6578e3, 8378e3, 0.0, 5.0)) ;
+        EXPECT_ANY_THROW(GravitySurrogate(sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 0.0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate, Getters)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4) ;
+
+    {
+
+        const GravitySurrogate gravitySurrogate = { sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 5.0 } ;
+
+        EXPECT_TRUE(gravitySurrogate.isDefined()) ;
+        EXPECT_EQ(2, gravitySurrogate.getReferenceDegree()) ;
+        EXPECT_EQ(6578e3, gravitySurrogate.getMinimumRadius()) ;
+        EXPECT_EQ(8378e3, gravitySurrogate.getMaximumRadius()) ;
+        EXPECT_EQ(19 * 37 * 72, gravitySurrogate.getNodeCount()) ;
+        EXPECT_LE(0.0, gravitySurrogate.getMaximumError()) ;
+
+    }
+
+    {
+
+        const GravitySurrogate gravitySurrogate = GravitySurrogate::Undefined() ;
+
+        EXPECT_FALSE(gravitySurrogate.isDefined()) ;
+
+        EXPECT_ANY_THROW(gravitySurrogate.getReferenceDegree()) ;
+        EXPECT_ANY_THROW(gravitySurrogate.getNodeCount()) ;
+        EXPECT_ANY_THROW(gravitySurrogate.getMaximumError()) ;
+        EXPECT_ANY_THROW(gravitySurrogate.getAccelerationAt({ 7000e3, 0.0, 0.0 })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate, IsCompatibleWith)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    const File gravityFieldFile = File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")) ;
+
+    const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(gravityFieldFile, 4) ;
+
+    const GravitySurrogate gravitySurrogate = { sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 5.0 } ;
+
+    {
+
+        EXPECT_TRUE(gravitySurrogate.isCompatibleWith(sphericalHarmonicGravity)) ;
+        EXPECT_TRUE(gravitySurrogate.isCompatibleWith(SphericalHarmonicGravity::Load(gravityFieldFile, 4))) ;
+
+    }
+
+    // Other degree, tolerance, gravitational parameter or reference radius
+
+    {
+
+        EXPECT_FALSE(gravitySurrogate.isCompatibleWith(SphericalHarmonicGravity::Load(gravityFieldFile, 3))) ;
+        EXPECT_FALSE(gravitySurrogate.isCompatibleWith(SphericalHarmonicGravity::Load(gravityFieldFile, 4, 1e-9))) ;
+
+        const MatrixXd cosineCoefficients = MatrixXd::Identity(5, 5) ;
+        const MatrixXd sineCoefficients = MatrixXd::Zero(5, 5) ;
+
+        EXPECT_FALSE(gravitySurrogate.isCompatibleWith({ 1.1 * sphericalHarmonicGravity.getGravitationalParameter(), sphericalHarmonicGravity.getReferenceRadius(), cosineCoefficients, sineCoefficients })) ;
+        EXPECT_FALSE(gravitySurrogate.isCompatibleWith({ sphericalHarmonicGravity.getGravitationalParameter(), 1.1 * sphericalHarmonicGravity.getReferenceRadius(), cosineCoefficients, sineCoefficients })) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(gravitySurrogate.isCompatibleWith(SphericalHarmonicGravity::Undefined())) ;
+        EXPECT_ANY_THROW(GravitySurrogate::Undefined().isCompatibleWith(sphericalHarmonicGravity)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate, GetAccelerationAt)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::math::obj::Vector3d ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4) ;
+
+    const GravitySurrogate gravitySurrogate = { sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 2.0 } ;
+
+    // Against the field beyond degree 2, over the shell (including the poles and the antimeridian)
+
+    {
+
+        double maximumDisturbingAcceleration = 0.0 ;
+        double maximumError = 0.0 ;
+
+        for (double radius = 6578.001e3 ; radius < 8378e3 ; radius += 123.4e3)
+        {
+
+            for (double latitude = -90.0 ; latitude <= 90.0 ; latitude += 7.3)
+            {
+
+                for (double longitude = -180.0 ; longitude <= 180.0 ; longitude += 11.7)
+                {
+
+                    const double latitudeRad = latitude * M_PI / 180.0 ;
+                    const double longitudeRad = longitude * M_PI / 180.0 ;
+
+                    const Vector3d position = radius * Vector3d(std::cos(latitudeRad) * std::cos(longitudeRad), std::cos(latitudeRad) * std::sin(longitudeRad), std::sin(latitudeRad)) ;
+
+                    const Vector3d referenceAcceleration = sphericalHarmonicGravity.getAccelerationAt(position, 4, 4) - sphericalHarmonicGravity.getAccelerationAt(position, 2, 2) ;
+
+                    maximumDisturbingAcceleration = std::max(maximumDisturbingAcceleration, referenceAcceleration.norm()) ;
+                    maximumError = std::max(maximumError, (gravitySurrogate.getAccelerationAt(position) - referenceAcceleration).norm()) ;
+
+                }
+
+            }
+
+        }
+
+        EXPECT_GT(1e-2 * maximumDisturbingAcceleration, maximumError) ;
+        EXPECT_GT(1.5 * gravitySurrogate.getMaximumError(), maximumError) ;
+
+    }
+
+    {
+
+        EXPECT_TRUE(gravitySurrogate.contains({ 7000e3, 0.0, 0.0 })) ;
+        EXPECT_TRUE(gravitySurrogate.contains({ 0.0, 0.0, -6578e3 })) ;
+        EXPECT_FALSE(gravitySurrogate.contains({ 6000e3, 0.0, 0.0 })) ;
+        EXPECT_FALSE(gravitySurrogate.contains({ 0.0, 9000e3, 0.0 })) ;
+
+        EXPECT_ANY_THROW(gravitySurrogate.getAccelerationAt({ 6000e3, 0.0, 0.0 })) ;
+        EXPECT_ANY_THROW(gravitySurrogate.getAccelerationAt({ 0.0, 9000e3, 0.0 })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate, SaveLoad)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::math::obj::Vector3d ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4) ;
+
+    {
+
+        File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate_SaveLoad.bin")) ;
+
+        const GravitySurrogate gravitySurrogate = { sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 5.0 } ;
+
+        gravitySurrogate.save(file) ;
+
+        {
+
+            const GravitySurrogate loadedGravitySurrogate = GravitySurrogate::Load(file, sphericalHarmonicGravity) ;
+
+            EXPECT_TRUE(loadedGravitySurrogate.isCompatibleWith(sphericalHarmonicGravity)) ;
+
+            EXPECT_EQ(gravitySurrogate.getReferenceDegree(), loadedGravitySurrogate.getReferenceDegree()) ;
+            EXPECT_EQ(gravitySurrogate.getMinimumRadius(), loadedGravitySurrogate.getMinimumRadius()) ;
+            EXPECT_EQ(gravitySurrogate.getMaximumRadius(), loadedGravitySurrogate.getMaximumRadius()) ;
+            EXPECT_EQ(gravitySurrogate.getNodeCount(), loadedGravitySurrogate.getNodeCount()) ;
+            EXPECT_EQ(gravitySurrogate.getMaximumError(), loadedGravitySurrogate.getMaximumError()) ;
+
+            for (const Vector3d& position : { Vector3d(7000e3, 0.0, 0.0), Vector3d(-3000e3, 4000e3, 5000e3), Vector3d(0.0, 0.0, -8000e3) })
+            {
+                EXPECT_EQ(gravitySurrogate.getAccelerationAt(position), loadedGravitySurrogate.getAccelerationAt(position)) ;
+            }
+
+        }
+
+        // A table is only loaded along with the field it was generated from
+
+        {
+
+            EXPECT_ANY_THROW(GravitySurrogate::Load(file, SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 3))) ;
+            EXPECT_ANY_THROW(GravitySurrogate::Load(file, SphericalHarmonicGravity::Undefined())) ;
+
+        }
+
+        file.remove() ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(GravitySurrogate::Load(File::Undefined(), sphericalHarmonicGravity)) ;
+        EXPECT_ANY_THROW(GravitySurrogate::Load(File::Path(Path::Parse("/does/not/exist.bin")), sphericalHarmonicGravity)) ;
+        EXPECT_ANY_THROW(GravitySurrogate::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), sphericalHarmonicGravity)) ;
+
+        EXPECT_ANY_THROW(GravitySurrogate::Undefined().save(File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_GravitySurrogate_SaveLoad.bin")))) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
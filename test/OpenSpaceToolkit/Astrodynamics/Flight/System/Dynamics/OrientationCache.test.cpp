@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/OrientationCache.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/OrientationCache.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache, Constructor)
+{
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+
+    using ostk::astro::flight::system::dynamics::OrientationCache ;
+
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EXPECT_NO_THROW(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch)) ;
+        EXPECT_NO_THROW(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch, Duration::Seconds(30.0))) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch, Duration::Zero())) ;
+        EXPECT_ANY_THROW(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch, Duration::Seconds(-30.0))) ;
+        EXPECT_ANY_THROW(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch, Duration::Seconds(30.0), 1)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache, IsDefined)
+{
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+
+    using ostk::astro::flight::system::dynamics::OrientationCache ;
+
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EXPECT_TRUE(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(OrientationCache::Undefined().isDefined()) ;
+        EXPECT_FALSE(OrientationCache(nullptr, Frame::GCRF(), epoch).isDefined()) ;
+        EXPECT_FALSE(OrientationCache(Frame::ITRF(), Frame::GCRF(), Instant::Undefined()).isDefined()) ;
+        EXPECT_FALSE(OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch, Duration::Undefined()).isDefined()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache, GetEpoch)
+{
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+
+    using ostk::astro::flight::system::dynamics::OrientationCache ;
+
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        EXPECT_EQ(epoch, OrientationCache(Frame::ITRF(), Frame::GCRF(), epoch).getEpoch()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(OrientationCache::Undefined().getEpoch()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache, GetRotationMatrixAt)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+    using ostk::physics::coord::Transform ;
+
+    using ostk::astro::flight::system::dynamics::OrientationCache ;
+
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    // ITRF orientation in GCRF, against the full frame transform, over 1 day (forward and backward)
+
+    {
+
+        OrientationCache orientationCache = { Frame::ITRF(), Frame::GCRF(), epoch } ;
+
+        for (double time = -43200.0 ; time <= 43200.0 ; time += 123.4)
+        {
+
+            const Instant instant = epoch + Duration::Seconds(time) ;
+
+            const Quaternion q_GCRF_ITRF = Frame::ITRF()->getTransformTo(Frame::GCRF(), instant).getOrientation() ;
+
+            Matrix3d dcm_GCRF_ITRF ;
+            dcm_GCRF_ITRF.col(0) = q_GCRF_ITRF * Vector3d::UnitX() ;
+            dcm_GCRF_ITRF.col(1) = q_GCRF_ITRF * Vector3d::UnitY() ;
+            dcm_GCRF_ITRF.col(2) = q_GCRF_ITRF * Vector3d::UnitZ() ;
+
+            // Below 1 cm at 7000 km
+
+            EXPECT_GT(1e-9, (orientationCache.getRotationMatrixAt(time) - dcm_GCRF_ITRF).norm()) << time << " [s]" ;
+            EXPECT_GT(1e-9, (orientationCache.getRotationMatrixAt(instant) - dcm_GCRF_ITRF).norm()) << time << " [s]" ;
+
+        }
+
+        // The 1441 samples of the day do not fit: the ones farthest from the last query were dropped
+
+        EXPECT_EQ(1024, orientationCache.getCapacity()) ;
+        EXPECT_EQ(1024, orientationCache.getSampleCount()) ;
+
+    }
+
+    // Samples dropped out of a small window are recomputed identically when queried again
+
+    {
+
+        OrientationCache orientationCache = { Frame::ITRF(), Frame::GCRF(), epoch, Duration::Minutes(1.0), 4 } ;
+
+        const Matrix3d rotationMatrix = orientationCache.getRotationMatrixAt(90.0) ;
+
+        for (double time = 0.0 ; time <= 3600.0 ; time += 30.0)
+        {
+
+            orientationCache.getRotationMatrixAt(time) ;
+
+            EXPECT_GE(4, orientationCache.getSampleCount()) ;
+
+        }
+
+        EXPECT_EQ(4, orientationCache.getSampleCount()) ;
+
+        EXPECT_EQ(rotationMatrix, orientationCache.getRotationMatrixAt(90.0)) ;
+        EXPECT_EQ(4, orientationCache.getSampleCount()) ;
+
+    }
+
+    {
+
+        OrientationCache orientationCache = OrientationCache::Undefined() ;
+
+        EXPECT_ANY_THROW(orientationCache.getRotationMatrixAt(0.0)) ;
+        EXPECT_ANY_THROW(orientationCache.getRotationMatrixAt(epoch)) ;
+
+    }
+
+    {
+
+        OrientationCache orientationCache = { Frame::ITRF(), Frame::GCRF(), epoch } ;
+
+        EXPECT_ANY_THROW(orientationCache.getRotationMatrixAt(Instant::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_OrientationCache, Clear)
+{
+
+    using ostk::math::obj::Matrix3d ;
+
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::coord::Frame ;
+
+    using ostk::astro::flight::system::dynamics::OrientationCache ;
+
+    const Instant epoch = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    {
+
+        OrientationCache orientationCache = { Frame::ITRF(), Frame::GCRF(), epoch } ;
+
+        const Matrix3d rotationMatrix = orientationCache.getRotationMatrixAt(90.0) ;
+
+        EXPECT_EQ(2, orientationCache.getSampleCount()) ;
+
+        orientationCache.clear() ;
+
+        EXPECT_EQ(0, orientationCache.getSampleCount()) ;
+
+        EXPECT_EQ(rotationMatrix, orientationCache.getRotationMatrixAt(90.0)) ;
+        EXPECT_EQ(2, orientationCache.getSampleCount()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
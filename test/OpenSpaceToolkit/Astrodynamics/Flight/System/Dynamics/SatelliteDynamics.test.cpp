@@ -28,6 +28,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
 
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Shared.hpp>
@@ -185,10 +187,15 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, E
     using ostk::physics::env::obj::celest::Earth ;
     using ostk::physics::env::obj::celest::Sun ;
     using ostk::physics::env::obj::celest::Moon ;
+    using ostk::physics::env::obj::Celestial ;
 
     using ostk::astro::trajectory::State ;
     using ostk::astro::flight::system::SatelliteSystem ;
     using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+    using ostk::astro::flight::system::dynamics::forcemodels::AtmosphericDrag ;
+    using ostk::astro::flight::system::dynamics::ExponentialAtmosphere ;
 
     using namespace boost::numeric::odeint ;
 
@@ -215,6 +222,24 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, E
 
         EXPECT_FALSE(satelliteDynamics == satelliteDynamics_1) ;
 
+        // Test for different force models
+        const Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(defaultEnvironment.accessCelestialObjectWithName("Earth")) } ;
+        const SatelliteDynamics satelliteDynamics_2 = { defaultEnvironment, satelliteSystem, forceModels } ;
+        const SatelliteDynamics satelliteDynamics_3 = { defaultEnvironment, satelliteSystem, forceModels } ;
+
+        EXPECT_TRUE(satelliteDynamics_2 == satelliteDynamics_3) ;
+        EXPECT_FALSE(satelliteDynamics == satelliteDynamics_2) ;
+
+        // Test for force models of the same type, with different configurations
+        const Shared<const Celestial> earthSPtr = defaultEnvironment.accessCelestialObjectWithName("Earth") ;
+        const SatelliteDynamics satelliteDynamics_4 = { defaultEnvironment, satelliteSystem, { std::make_shared<AtmosphericDrag>(earthSPtr, satelliteSystem) } } ;
+        const SatelliteDynamics satelliteDynamics_5 = { defaultEnvironment, satelliteSystem, { std::make_shared<AtmosphericDrag>(earthSPtr, satelliteSystem_1) } } ;
+        const SatelliteDynamics satelliteDynamics_6 = { defaultEnvironment, satelliteSystem, { std::make_shared<AtmosphericDrag>(earthSPtr, satelliteSystem, ExponentialAtmosphere({ { 0.0, 1.225, 7249.0 } })) } } ;
+
+        EXPECT_TRUE(satelliteDynamics_4 == SatelliteDynamics(satelliteDynamics_4)) ;
+        EXPECT_FALSE(satelliteDynamics_4 == satelliteDynamics_5) ;
+        EXPECT_FALSE(satelliteDynamics_4 == satelliteDynamics_6) ;
+
     }
 
 }
@@ -254,6 +279,8 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, N
     using ostk::astro::trajectory::State ;
     using ostk::astro::flight::system::SatelliteSystem ;
     using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
 
     using namespace boost::numeric::odeint ;
 
@@ -280,6 +307,14 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, N
 
         EXPECT_TRUE(satelliteDynamics != satelliteDynamics_1) ;
 
+        // Test for different force models
+        const Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(defaultEnvironment.accessCelestialObjectWithName("Earth")) } ;
+        const SatelliteDynamics satelliteDynamics_2 = { defaultEnvironment, satelliteSystem, forceModels } ;
+        const SatelliteDynamics satelliteDynamics_3 = { defaultEnvironment, satelliteSystem, forceModels } ;
+
+        EXPECT_FALSE(satelliteDynamics_2 != satelliteDynamics_3) ;
+        EXPECT_TRUE(satelliteDynamics != satelliteDynamics_2) ;
+
     }
 
 }
@@ -339,6 +374,12 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, I
 
     }
 
+    {
+
+        EXPECT_FALSE(SatelliteDynamics::Undefined().isDefined()) ;
+
+    }
+
 }
 
 TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, StreamOperator)
@@ -463,6 +504,221 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, P
 
 }
 
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, GetForceModels)
+{
+
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Array ;
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+
+    using ostk::physics::units::Mass ;
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::Environment ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::Dynamics ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+    using ostk::astro::flight::system::dynamics::forcemodels::AtmosphericDrag ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+    using ostk::astro::flight::system::dynamics::forcemodels::ThirdBodyGravity ;
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+    using ostk::astro::flight::system::dynamics::GravitySurrogate ;
+
+    const Environment environment = Environment::Default() ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Instant startInstant = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    // Default force models, from the environment
+    {
+
+        const SatelliteDynamics satelliteDynamics = { environment, satelliteSystem } ;
+
+        const Array<Shared<const ForceModel>> forceModels = satelliteDynamics.getForceModels() ;
+
+        EXPECT_EQ(environment.getObjectNames().getSize(), forceModels.getSize()) ;
+        EXPECT_EQ("Earth Gravity", forceModels.accessFirst()->getName()) ;
+
+    }
+
+    // Explicit force models, giving the same dynamical equations as the default ones
+    {
+
+        const Array<Shared<ForceModel>> forceModels =
+        {
+            std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")),
+            std::make_shared<ThirdBodyGravity>(environment.accessCelestialObjectWithName("Sun")),
+            std::make_shared<ThirdBodyGravity>(environment.accessCelestialObjectWithName("Moon"))
+        } ;
+
+        SatelliteDynamics defaultSatelliteDynamics = { environment, satelliteSystem } ;
+        SatelliteDynamics satelliteDynamics = { environment, satelliteSystem, forceModels } ;
+
+        EXPECT_EQ(3, satelliteDynamics.getForceModels().getSize()) ;
+
+        defaultSatelliteDynamics.setInstant(startInstant) ;
+        satelliteDynamics.setInstant(startInstant) ;
+
+        const Dynamics::StateVector x = { 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0 } ;
+
+        Dynamics::StateVector defaultDxdt(6) ;
+        Dynamics::StateVector dxdt(6) ;
+
+        defaultSatelliteDynamics.getDynamicalEquations()(x, defaultDxdt, 60.0) ;
+        satelliteDynamics.getDynamicalEquations()(x, dxdt, 60.0) ;
+
+        for (std::size_t i = 0 ; i < 6 ; ++i)
+        {
+            EXPECT_NEAR(defaultDxdt[i], dxdt[i], 1e-12) ;
+        }
+
+    }
+
+    // Gravity of Earth only
+    {
+
+        const Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")) } ;
+
+        SatelliteDynamics satelliteDynamics = { environment, satelliteSystem, forceModels } ;
+
+        satelliteDynamics.setInstant(startInstant) ;
+
+        const Dynamics::StateVector x = { 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0 } ;
+        Dynamics::StateVector dxdt(6) ;
+
+        satelliteDynamics.getDynamicalEquations()(x, dxdt, 0.0) ;
+
+        EXPECT_NEAR(-398600.4418e9 / (7000000.0 * 7000000.0), dxdt[3], 5e-2) ; // Point mass, up to J2 and higher order terms
+
+    }
+
+    // Atmospheric drag, opposed to the velocity
+    {
+
+        const Array<Shared<ForceModel>> gravityForceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")) } ;
+        const Array<Shared<ForceModel>> dragForceModels =
+        {
+            std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")),
+            std::make_shared<AtmosphericDrag>(environment.accessCelestialObjectWithName("Earth"), satelliteSystem)
+        } ;
+
+        SatelliteDynamics gravitySatelliteDynamics = { environment, satelliteSystem, gravityForceModels } ;
+        SatelliteDynamics dragSatelliteDynamics = { environment, satelliteSystem, dragForceModels } ;
+
+        gravitySatelliteDynamics.setInstant(startInstant) ;
+        dragSatelliteDynamics.setInstant(startInstant) ;
+
+        const Dynamics::StateVector x = { 6778137.0, 0.0, 0.0, 0.0, 7668.6, 0.0 } ;
+
+        Dynamics::StateVector gravityDxdt(6) ;
+        Dynamics::StateVector dragDxdt(6) ;
+
+        gravitySatelliteDynamics.getDynamicalEquations()(x, gravityDxdt, 0.0) ;
+        dragSatelliteDynamics.getDynamicalEquations()(x, dragDxdt, 0.0) ;
+
+        const Vector3d dragAcceleration = { dragDxdt[3] - gravityDxdt[3], dragDxdt[4] - gravityDxdt[4], dragDxdt[5] - gravityDxdt[5] } ;
+
+        // 0.5 * rho(400 km) * Cd * A / m * v^2, with the atmosphere co-rotating with Earth
+        const double expectedDragAccelerationNorm = 0.5 * 3.725e-12 * 2.2 * 0.8 / 100.0 * std::pow(7668.6 - (7.2921159e-5 * 6778137.0), 2) ;
+
+        EXPECT_NEAR(expectedDragAccelerationNorm, dragAcceleration.norm(), 0.05 * expectedDragAccelerationNorm) ;
+        EXPECT_GT(-0.99, dragAcceleration.normalized().dot(Vector3d::UnitY())) ;
+
+    }
+
+    // Spherical harmonic gravity field of Earth (up to degree 4), against the gravitational model of Earth
+    {
+
+        const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4) ;
+
+        const Array<Shared<ForceModel>> referenceForceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")) } ;
+        const Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth"), sphericalHarmonicGravity) } ;
+
+        SatelliteDynamics referenceSatelliteDynamics = { environment, satelliteSystem, referenceForceModels } ;
+        SatelliteDynamics satelliteDynamics = { environment, satelliteSystem, forceModels } ;
+
+        referenceSatelliteDynamics.setInstant(startInstant) ;
+        satelliteDynamics.setInstant(startInstant) ;
+
+        const Dynamics::StateVector x = { 4000000.0, -3000000.0, 4500000.0, 0.0, 5000.0, 5000.0 } ;
+
+        Dynamics::StateVector referenceDxdt(6) ;
+        Dynamics::StateVector dxdt(6) ;
+
+        referenceSatelliteDynamics.getDynamicalEquations()(x, referenceDxdt, 0.0) ;
+        satelliteDynamics.getDynamicalEquations()(x, dxdt, 0.0) ;
+
+        for (std::size_t i = 3 ; i < 6 ; ++i)
+        {
+            EXPECT_NEAR(referenceDxdt[i], dxdt[i], 1e-4) ; // Up to the terms of degree higher than 4
+        }
+
+        EXPECT_ANY_THROW(CentralBodyGravity(environment.accessCelestialObjectWithName("Earth"), SphericalHarmonicGravity::Undefined())) ;
+
+    }
+
+    // Gravity surrogate of the spherical harmonic gravity field beyond J2, against the field
+    {
+
+        const SphericalHarmonicGravity sphericalHarmonicGravity = SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4) ;
+        const Shared<const GravitySurrogate> gravitySurrogateSPtr = std::make_shared<GravitySurrogate>(sphericalHarmonicGravity, 2, 6578e3, 8378e3, 100e3, 2.0) ;
+
+        const Array<Shared<ForceModel>> referenceForceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth"), sphericalHarmonicGravity) } ;
+        const Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth"), sphericalHarmonicGravity, gravitySurrogateSPtr) } ;
+
+        SatelliteDynamics referenceSatelliteDynamics = { environment, satelliteSystem, referenceForceModels } ;
+        SatelliteDynamics satelliteDynamics = { environment, satelliteSystem, forceModels } ;
+
+        referenceSatelliteDynamics.setInstant(startInstant) ;
+        satelliteDynamics.setInstant(startInstant) ;
+
+        // Within and beyond the shell of the gravity surrogate
+
+        for (const Dynamics::StateVector& x : { Dynamics::StateVector { 4000000.0, -3000000.0, 4500000.0, 0.0, 5000.0, 5000.0 }, Dynamics::StateVector { 30000000.0, 0.0, 0.0, 0.0, 3600.0, 0.0 } })
+        {
+
+            Dynamics::StateVector referenceDxdt(6) ;
+            Dynamics::StateVector dxdt(6) ;
+
+            referenceSatelliteDynamics.getDynamicalEquations()(x, referenceDxdt, 0.0) ;
+            satelliteDynamics.getDynamicalEquations()(x, dxdt, 0.0) ;
+
+            for (std::size_t i = 3 ; i < 6 ; ++i)
+            {
+                EXPECT_NEAR(referenceDxdt[i], dxdt[i], 2.0 * gravitySurrogateSPtr->getMaximumError()) ;
+            }
+
+        }
+
+        EXPECT_EQ(gravitySurrogateSPtr, std::static_pointer_cast<const CentralBodyGravity>(satelliteDynamics.getForceModels().accessFirst())->getGravitySurrogate()) ;
+
+        EXPECT_ANY_THROW(CentralBodyGravity(environment.accessCelestialObjectWithName("Earth"), sphericalHarmonicGravity, nullptr)) ;
+        EXPECT_ANY_THROW(CentralBodyGravity(environment.accessCelestialObjectWithName("Earth"), SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 1), gravitySurrogateSPtr)) ;
+        EXPECT_ANY_THROW(CentralBodyGravity(environment.accessCelestialObjectWithName("Earth"), SphericalHarmonicGravity::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")), 4, 1e-9), gravitySurrogateSPtr)) ;
+
+    }
+
+    {
+
+        const Array<Shared<ForceModel>> forceModels = { Shared<ForceModel>(nullptr) } ;
+
+        EXPECT_ANY_THROW(SatelliteDynamics(environment, satelliteSystem, forceModels)) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, GetSetInstant)
 {
 
@@ -804,4 +1060,302 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, g
 
 }
 
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, getVariationalDynamicalEquations)
+{
+
+    using ostk::core::types::Shared ;
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+
+    using ostk::physics::units::Mass ;
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::Environment ;
+    using ostk::physics::env::Object ;
+    using ostk::physics::env::obj::celest::Earth ;
+    using ostk::physics::env::obj::celest::Sun ;
+    using ostk::physics::env::obj::celest::Moon ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::ForceModel ;
+    using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+    using ostk::astro::flight::system::dynamics::forcemodels::AtmosphericDrag ;
+    using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Instant startInstant = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    const SatelliteDynamics::StateVector startStateVector = { 5000000.0, 3000000.0, 4000000.0, -4000.0, 5500.0, 1000.0 } ;
+
+    // Analytic partials match finite differences of the acceleration for point mass, J2 and third body gravity
+    {
+
+        const Array<Array<Shared<Object>>> objectsArray =
+        {
+            { std::make_shared<Earth>(Earth::Spherical()) },
+            { std::make_shared<Earth>(Earth::EGM2008(2, 0)) },
+            { std::make_shared<Earth>(Earth::Spherical()), std::make_shared<Sun>(Sun::Default()), std::make_shared<Moon>(Moon::Default()) }
+        } ;
+
+        for (const auto& objects : objectsArray)
+        {
+
+            SatelliteDynamics satelliteDynamics = { Environment(Instant::J2000(), objects), satelliteSystem } ;
+            satelliteDynamics.setInstant(startInstant) ;
+
+            // Augmented state, with the state transition matrix set to identity
+            SatelliteDynamics::StateVector augmentedStateVector(42, 0.0) ;
+            std::copy(startStateVector.begin(), startStateVector.end(), augmentedStateVector.begin()) ;
+
+            for (Size k = 0 ; k < 6 ; ++k)
+            {
+                augmentedStateVector[6 + (k * 6) + k] = 1.0 ;
+            }
+
+            SatelliteDynamics::StateVector augmentedStateVectorDerivative(42) ;
+            satelliteDynamics.getVariationalDynamicalEquations()(augmentedStateVector, augmentedStateVectorDerivative, 0.0) ;
+
+            SatelliteDynamics::StateVector stateVectorDerivative(6) ;
+            satelliteDynamics.getDynamicalEquations()(startStateVector, stateVectorDerivative, 0.0) ;
+
+            for (Size k = 0 ; k < 6 ; ++k)
+            {
+                EXPECT_EQ(stateVectorDerivative[k], augmentedStateVectorDerivative[k]) ;
+            }
+
+            // With identity state transition matrix, its derivative is the system matrix [[0, I], [G, 0]]
+
+            for (Size column = 0 ; column < 3 ; ++column)
+            {
+
+                SatelliteDynamics::StateVector positiveStateVector = startStateVector ;
+                SatelliteDynamics::StateVector negativeStateVector = startStateVector ;
+
+                positiveStateVector[column] += 1.0 ;
+                negativeStateVector[column] -= 1.0 ;
+
+                SatelliteDynamics::StateVector positiveStateVectorDerivative(6) ;
+                SatelliteDynamics::StateVector negativeStateVectorDerivative(6) ;
+
+                satelliteDynamics.getDynamicalEquations()(positiveStateVector, positiveStateVectorDerivative, 0.0) ;
+                satelliteDynamics.getDynamicalEquations()(negativeStateVector, negativeStateVectorDerivative, 0.0) ;
+
+                for (Size row = 0 ; row < 3 ; ++row)
+                {
+
+                    const double finiteDifferencePartial = (positiveStateVectorDerivative[3 + row] - negativeStateVectorDerivative[3 + row]) / 2.0 ;
+
+                    EXPECT_NEAR(finiteDifferencePartial, augmentedStateVectorDerivative[6 + (column * 6) + 3 + row], 1e-12) ;
+                    EXPECT_EQ(0.0, augmentedStateVectorDerivative[6 + (column * 6) + row]) ;
+
+                }
+
+            }
+
+            for (Size column = 3 ; column < 6 ; ++column)
+            {
+
+                for (Size row = 0 ; row < 6 ; ++row)
+                {
+                    EXPECT_EQ(((row + 3) == column) ? 1.0 : 0.0, augmentedStateVectorDerivative[6 + (column * 6) + row]) ;
+                }
+
+            }
+
+        }
+
+    }
+
+    // With atmospheric drag, the system matrix [[0, I], [G, H]] also holds the partials with respect to the velocity, matching finite differences,
+    // and the drag partials with respect to the position (density gradient, rotating atmosphere)
+    {
+
+        const Environment environment = Environment::Default() ;
+
+        const Array<Shared<ForceModel>> forceModels =
+        {
+            std::make_shared<CentralBodyGravity>(environment.accessCelestialObjectWithName("Earth")),
+            std::make_shared<AtmosphericDrag>(environment.accessCelestialObjectWithName("Earth"), satelliteSystem)
+        } ;
+
+        SatelliteDynamics satelliteDynamics = { environment, satelliteSystem, forceModels } ;
+        satelliteDynamics.setInstant(startInstant) ;
+
+        // Low orbit, for a significant drag, away from the base altitudes of the atmosphere bands
+        const SatelliteDynamics::StateVector stateVector = { 6798137.0, 0.0, 0.0, 0.0, 7657.3, 0.0 } ;
+
+        SatelliteDynamics::StateVector augmentedStateVector(42, 0.0) ;
+        std::copy(stateVector.begin(), stateVector.end(), augmentedStateVector.begin()) ;
+
+        for (Size k = 0 ; k < 6 ; ++k)
+        {
+            augmentedStateVector[6 + (k * 6) + k] = 1.0 ;
+        }
+
+        SatelliteDynamics::StateVector augmentedStateVectorDerivative(42) ;
+        satelliteDynamics.getVariationalDynamicalEquations()(augmentedStateVector, augmentedStateVectorDerivative, 0.0) ;
+
+        for (Size column = 3 ; column < 6 ; ++column)
+        {
+
+            SatelliteDynamics::StateVector positiveStateVector = stateVector ;
+            SatelliteDynamics::StateVector negativeStateVector = stateVector ;
+
+            positiveStateVector[column] += 1.0 ;
+            negativeStateVector[column] -= 1.0 ;
+
+            SatelliteDynamics::StateVector positiveStateVectorDerivative(6) ;
+            SatelliteDynamics::StateVector negativeStateVectorDerivative(6) ;
+
+            satelliteDynamics.getDynamicalEquations()(positiveStateVector, positiveStateVectorDerivative, 0.0) ;
+            satelliteDynamics.getDynamicalEquations()(negativeStateVector, negativeStateVectorDerivative, 0.0) ;
+
+            for (Size row = 0 ; row < 3 ; ++row)
+            {
+
+                const double finiteDifferencePartial = (positiveStateVectorDerivative[3 + row] - negativeStateVectorDerivative[3 + row]) / 2.0 ;
+
+                EXPECT_EQ(((row + 3) == column) ? 1.0 : 0.0, augmentedStateVectorDerivative[6 + (column * 6) + row]) ;
+                EXPECT_NEAR(finiteDifferencePartial, augmentedStateVectorDerivative[6 + (column * 6) + 3 + row], 1e-12) ;
+
+            }
+
+            // Drag opposes the velocity: its partials are not zero
+            EXPECT_GT(-1e-11, augmentedStateVectorDerivative[6 + (column * 6) + column]) ;
+
+        }
+
+        // Position partials, without the central body gravity whose partials are truncated to J2
+
+        SatelliteDynamics dragDynamics = { environment, satelliteSystem, { forceModels[1] } } ;
+        dragDynamics.setInstant(startInstant) ;
+
+        dragDynamics.getVariationalDynamicalEquations()(augmentedStateVector, augmentedStateVectorDerivative, 0.0) ;
+
+        for (Size column = 0 ; column < 3 ; ++column)
+        {
+
+            SatelliteDynamics::StateVector positiveStateVector = stateVector ;
+            SatelliteDynamics::StateVector negativeStateVector = stateVector ;
+
+            positiveStateVector[column] += 1.0 ;
+            negativeStateVector[column] -= 1.0 ;
+
+            SatelliteDynamics::StateVector positiveStateVectorDerivative(6) ;
+            SatelliteDynamics::StateVector negativeStateVectorDerivative(6) ;
+
+            dragDynamics.getDynamicalEquations()(positiveStateVector, positiveStateVectorDerivative, 0.0) ;
+            dragDynamics.getDynamicalEquations()(negativeStateVector, negativeStateVectorDerivative, 0.0) ;
+
+            for (Size row = 0 ; row < 3 ; ++row)
+            {
+
+                const double finiteDifferencePartial = (positiveStateVectorDerivative[3 + row] - negativeStateVectorDerivative[3 + row]) / 2.0 ;
+
+                EXPECT_EQ(0.0, augmentedStateVectorDerivative[6 + (column * 6) + row]) ;
+                EXPECT_NEAR(finiteDifferencePartial, augmentedStateVectorDerivative[6 + (column * 6) + 3 + row], 1e-14) ;
+
+            }
+
+        }
+
+        // The density gradient dominates the radial partial: drag decreases with the altitude
+        EXPECT_LT(1e-12, augmentedStateVectorDerivative[6 + 3 + 1]) ;
+
+    }
+
+    // Wrong state vector size
+    {
+
+        SatelliteDynamics satelliteDynamics = { Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }), satelliteSystem } ;
+        satelliteDynamics.setInstant(startInstant) ;
+
+        SatelliteDynamics::StateVector stateVectorDerivative(6) ;
+
+        EXPECT_ANY_THROW(satelliteDynamics.getVariationalDynamicalEquations()(startStateVector, stateVectorDerivative, 0.0)) ;
+
+    }
+
+    // Undefined instant
+    {
+
+        SatelliteDynamics satelliteDynamics = { Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }), satelliteSystem } ;
+
+        EXPECT_ANY_THROW(satelliteDynamics.getVariationalDynamicalEquations()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SatelliteDynamics, getSecondOrderDynamicalEquations)
+{
+
+    using ostk::core::types::Shared ;
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+
+    using ostk::physics::units::Mass ;
+    using ostk::physics::time::Scale ;
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::DateTime ;
+    using ostk::physics::Environment ;
+    using ostk::physics::env::Object ;
+    using ostk::physics::env::obj::celest::Earth ;
+    using ostk::physics::env::obj::celest::Sun ;
+    using ostk::physics::env::obj::celest::Moon ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+    using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Instant startInstant = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC) ;
+
+    const SatelliteDynamics::StateVector startStateVector = { 5000000.0, 3000000.0, 4000000.0, -4000.0, 5500.0, 1000.0 } ;
+
+    // Accelerations match the first order equations, velocities are left untouched
+    {
+
+        SatelliteDynamics satelliteDynamics = { Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(2, 0)), std::make_shared<Sun>(Sun::Default()), std::make_shared<Moon>(Moon::Default()) }), satelliteSystem } ;
+        satelliteDynamics.setInstant(startInstant) ;
+
+        SatelliteDynamics::StateVector stateVectorDerivative(6) ;
+        satelliteDynamics.getDynamicalEquations()(startStateVector, stateVectorDerivative, 0.0) ;
+
+        SatelliteDynamics::StateVector secondOrderStateVectorDerivative(6, 0.0) ;
+        satelliteDynamics.getSecondOrderDynamicalEquations()(startStateVector, secondOrderStateVectorDerivative, 0.0) ;
+
+        for (Size k = 0 ; k < 3 ; ++k)
+        {
+            EXPECT_EQ(0.0, secondOrderStateVectorDerivative[k]) ;
+            EXPECT_EQ(stateVectorDerivative[3 + k], secondOrderStateVectorDerivative[3 + k]) ;
+        }
+
+    }
+
+    // Undefined instant
+    {
+
+        SatelliteDynamics satelliteDynamics = { Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }), satelliteSystem } ;
+
+        EXPECT_ANY_THROW(satelliteDynamics.getSecondOrderDynamicalEquations()) ;
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+
+#include <Global.test.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::MatrixXd ;
+
+const double gravitationalParameter = 3.986004415e14 ;
+const double referenceRadius = 6378136.3 ;
+
+// Coefficients with the magnitudes of Kaula's rule, without the central term
+
+void                            generateCoefficients                        (   const   Eigen::Index                aDegree,
+                                                                                        MatrixXd&                   aCosineCoefficients,
+                                                                                        MatrixXd&                   aSineCoefficients                           )
+{
+
+    aCosineCoefficients = MatrixXd::Zero(aDegree + 1, aDegree + 1) ;
+    aSineCoefficients = MatrixXd::Zero(aDegree + 1, aDegree + 1) ;
+
+    std::srand(42) ;
+
+    for (Eigen::Index n = 2 ; n <= aDegree ; ++n)
+    {
+
+        for (Eigen::Index m = 0 ; m <= n ; ++m)
+        {
+
+            aCosineCoefficients(n, m) = 1e-5 / static_cast<double>(n * n) * ((2.0 * std::rand() / RAND_MAX) - 1.0) ;
+            aSineCoefficients(n, m) = (m == 0) ? 0.0 : 1e-5 / static_cast<double>(n * n) * ((2.0 * std::rand() / RAND_MAX) - 1.0) ;
+
+        }
+
+    }
+
+    aCosineCoefficients(2, 0) = -4.84165143790815e-04 ;
+
+}
+
+// Potential from the spherical coordinates, with the associated Legendre functions of the standard library (without Condon-Shortley phase)
+
+double                          calculatePotential                          (   const   Vector3d&                   aPosition,
+                                                                                const   MatrixXd&                   aCosineCoefficients,
+                                                                                const   MatrixXd&                   aSineCoefficients                           )
+{
+
+    const double r = aPosition.norm() ;
+    const double sinLatitude = aPosition.z() / r ;
+    const double longitude = std::atan2(aPosition.y(), aPosition.x()) ;
+
+    double potential = 0.0 ;
+
+    for (Eigen::Index n = 0 ; n < aCosineCoefficients.rows() ; ++n)
+    {
+
+        for (Eigen::Index m = 0 ; m <= n ; ++m)
+        {
+
+            const double normalization = std::sqrt(((m == 0) ? 1.0 : 2.0) * ((2.0 * n) + 1.0) * std::exp(std::lgamma(n - m + 1.0) - std::lgamma(n + m + 1.0))) ;
+            const double legendre = normalization * std::assoc_legendre(static_cast<unsigned>(n), static_cast<unsigned>(m), sinLatitude) ;
+
+            potential += std::pow(referenceRadius / r, n) * legendre * ((aCosineCoefficients(n, m) * std::cos(m * longitude)) + (aSineCoefficients(n, m) * std::sin(m * longitude))) ;
+
+        }
+
+    }
+
+    return gravitationalParameter / r * potential ;
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity, Constructor)
+{
+
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(10, C, S) ;
+
+        EXPECT_NO_THROW(SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C, S)) ;
+        EXPECT_NO_THROW(SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C, S, 1e-8)) ;
+
+        EXPECT_ANY_THROW(SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C, S.topLeftCorner(5, 5))) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C.leftCols(5), S.leftCols(5))) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity(-gravitationalParameter, referenceRadius, C, S)) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity(gravitationalParameter, 0.0, C, S)) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C, S, -1.0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity, EqualToOperator)
+{
+
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(10, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S } ;
+
+        EXPECT_TRUE(gravity == SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C, S)) ;
+
+        EXPECT_FALSE(gravity == SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C, S, 1e-8)) ;
+        EXPECT_FALSE(gravity == SphericalHarmonicGravity(gravitationalParameter, referenceRadius + 1.0, C, S)) ;
+        EXPECT_FALSE(gravity == SphericalHarmonicGravity(gravitationalParameter, referenceRadius, C.topLeftCorner(5, 5), S.topLeftCorner(5, 5))) ;
+
+        MatrixXd otherC = C ;
+        otherC(3, 1) *= 2.0 ;
+
+        EXPECT_FALSE(gravity == SphericalHarmonicGravity(gravitationalParameter, referenceRadius, otherC, S)) ;
+        EXPECT_TRUE(gravity != SphericalHarmonicGravity(gravitationalParameter, referenceRadius, otherC, S)) ;
+
+        EXPECT_FALSE(SphericalHarmonicGravity::Undefined() == SphericalHarmonicGravity::Undefined()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity, IsDefined)
+{
+
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(10, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S } ;
+
+        EXPECT_TRUE(gravity.isDefined()) ;
+        EXPECT_EQ(10, gravity.getDegree()) ;
+        EXPECT_EQ(gravitationalParameter, gravity.getGravitationalParameter()) ;
+        EXPECT_EQ(referenceRadius, gravity.getReferenceRadius()) ;
+        EXPECT_EQ(1e-10, gravity.getAccelerationTolerance()) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(SphericalHarmonicGravity::Undefined().isDefined()) ;
+
+        EXPECT_ANY_THROW(SphericalHarmonicGravity::Undefined().getDegree()) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity::Undefined().getTruncationDegreeAt(7000e3)) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity::Undefined().getAccelerationAt(Vector3d(7000e3, 0.0, 0.0))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity, GetAccelerationAt)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    // Against the gradient of the potential, by central differences, including close to the poles
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(20, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S } ;
+
+        const double step = 10.0 ;
+
+        for (const Vector3d& position : { Vector3d(6778e3, 0.0, 0.0), Vector3d(-3000e3, 4000e3, 5000e3), Vector3d(1234e3, -5678e3, -3456e3), Vector3d(1.0, 2.0, 6800e3), Vector3d(-500.0, 0.0, -6800e3), Vector3d(20000e3, 30000e3, -10000e3) })
+        {
+
+            Vector3d referenceAcceleration ;
+
+            for (Eigen::Index i = 0 ; i < 3 ; ++i)
+            {
+
+                const Vector3d offset = step * Vector3d::Unit(i) ;
+
+                referenceAcceleration(i) = (calculatePotential(position + offset, C, S) - calculatePotential(position - offset, C, S)) / (2.0 * step) ;
+
+            }
+
+            const Vector3d acceleration = gravity.getAccelerationAt(position, 20, 20) ;
+
+            EXPECT_GT(1e-9, (acceleration - referenceAcceleration).norm()) << position.transpose() ;
+
+        }
+
+    }
+
+    // Continuity at the poles
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(20, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S } ;
+
+        for (const double z : { 6800e3, -6800e3 })
+        {
+            EXPECT_GT(1e-12, (gravity.getAccelerationAt(Vector3d(0.0, 0.0, z), 20, 20) - gravity.getAccelerationAt(Vector3d(1e-6, 0.0, z), 20, 20)).norm()) ;
+        }
+
+    }
+
+    // Central term
+
+    {
+
+        MatrixXd C = MatrixXd::Zero(3, 3) ;
+        MatrixXd S = MatrixXd::Zero(3, 3) ;
+
+        C(0, 0) = 1.0 ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S } ;
+
+        const Vector3d position = { 1234e3, -5678e3, 3456e3 } ;
+
+        EXPECT_GT(1e-12, (gravity.getAccelerationAt(position, 2, 2) + (gravitationalParameter * position / std::pow(position.norm(), 3))).norm()) ;
+
+    }
+
+    // Truncation at the target error
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(60, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S, 1e-9 } ;
+
+        for (const Vector3d& position : { Vector3d(6778e3, 0.0, 0.0), Vector3d(-3000e3, 4000e3, 5000e3), Vector3d(26560e3, 0.0, 0.0), Vector3d(0.0, 30000e3, 30000e3) })
+        {
+            EXPECT_GT(2e-9, (gravity.getAccelerationAt(position) - gravity.getAccelerationAt(position, 60, 60)).norm()) << position.transpose() ;
+        }
+
+    }
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(10, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S } ;
+
+        EXPECT_ANY_THROW(gravity.getAccelerationAt(Vector3d(7000e3, 0.0, 0.0), 11, 11)) ;
+        EXPECT_ANY_THROW(gravity.getAccelerationAt(Vector3d(7000e3, 0.0, 0.0), 5, 6)) ;
+        EXPECT_ANY_THROW(gravity.getAccelerationAt(Vector3d::Zero(), 5, 5)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity, GetTruncationDegreeAt)
+{
+
+    using ostk::core::types::Size ;
+
+    using ostk::math::obj::MatrixXd ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    {
+
+        MatrixXd C ;
+        MatrixXd S ;
+
+        generateCoefficients(60, C, S) ;
+
+        const SphericalHarmonicGravity gravity = { gravitationalParameter, referenceRadius, C, S, 1e-9 } ;
+
+        const Size leoDegree = gravity.getTruncationDegreeAt(6778e3) ;
+        const Size meoDegree = gravity.getTruncationDegreeAt(26560e3) ;
+        const Size geoDegree = gravity.getTruncationDegreeAt(42164e3) ;
+
+        EXPECT_GE(60, leoDegree) ;
+        EXPECT_LT(meoDegree, leoDegree) ;
+        EXPECT_LE(geoDegree, meoDegree) ;
+        EXPECT_GE(4, geoDegree) ;
+
+        EXPECT_EQ(0, gravity.getTruncationDegreeAt(1e12)) ;
+
+        EXPECT_ANY_THROW(gravity.getTruncationDegreeAt(0.0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_Dynamics_SphericalHarmonicGravity, Load)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::math::obj::Vector3d ;
+
+    using ostk::astro::flight::system::dynamics::SphericalHarmonicGravity ;
+
+    {
+
+        const File file = File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SphericalHarmonicGravity/Test.gfc")) ;
+
+        const SphericalHarmonicGravity gravity = SphericalHarmonicGravity::Load(file, 100) ;
+
+        EXPECT_TRUE(gravity.isDefined()) ;
+        EXPECT_EQ(4, gravity.getDegree()) ;
+        EXPECT_EQ(3.986004415e14, gravity.getGravitationalParameter()) ;
+        EXPECT_EQ(6378136.3, gravity.getReferenceRadius()) ;
+
+        // Zonal degree 2 term, against J2
+
+        const SphericalHarmonicGravity zonalGravity = SphericalHarmonicGravity::Load(file, 2) ;
+
+        EXPECT_EQ(2, zonalGravity.getDegree()) ;
+
+        const double J2 = 4.84165143790815e-04 * std::sqrt(5.0) ;
+
+        const Vector3d position = { 4000e3, -3000e3, 4500e3 } ;
+
+        const double r = position.norm() ;
+        const double z2 = (position.z() * position.z()) / (r * r) ;
+        const double J2Factor = 1.5 * J2 * std::pow(6378136.3 / r, 2) ;
+
+        const Vector3d referenceAcceleration = -3.986004415e14 / std::pow(r, 3) * Vector3d(position.x() * (1.0 + J2Factor * (1.0 - 5.0 * z2)), position.y() * (1.0 + J2Factor * (1.0 - 5.0 * z2)), position.z() * (1.0 + J2Factor * (3.0 - 5.0 * z2))) ;
+
+        EXPECT_GT(1e-12, (zonalGravity.getAccelerationAt(position, 2, 0) - referenceAcceleration).norm()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(SphericalHarmonicGravity::Load(File::Undefined(), 100)) ;
+        EXPECT_ANY_THROW(SphericalHarmonicGravity::Load(File::Path(Path::Parse("/does/not/exist.gfc")), 100)) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
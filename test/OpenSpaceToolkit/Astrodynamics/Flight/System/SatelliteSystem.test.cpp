@@ -609,3 +609,47 @@ TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem, getDragCoeff
     }
 
 }
+
+TEST (OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem, getReflectivityCoefficient)
+{
+
+    using ostk::core::types::Real ;
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::objects::Point ;
+
+    using ostk::physics::units::Mass ;
+
+    using ostk::astro::flight::system::SatelliteSystem ;
+
+    const Mass satelliteMass(90.0, Mass::Unit::Kilogram) ;
+    const Matrix3d satelliteInertiaTensor = Matrix3d::Identity() ;
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+
+    {
+
+        const SatelliteSystem satelliteSystem = { satelliteMass, satelliteGeometry, satelliteInertiaTensor, 0.8, 2.2, 1.3 } ;
+
+        EXPECT_EQ(satelliteSystem.getReflectivityCoefficient(), 1.3) ;
+
+        EXPECT_TRUE(satelliteSystem == SatelliteSystem(satelliteMass, satelliteGeometry, satelliteInertiaTensor, 0.8, 2.2, 1.3)) ;
+        EXPECT_FALSE(satelliteSystem == SatelliteSystem(satelliteMass, satelliteGeometry, satelliteInertiaTensor, 0.8, 2.2, 1.8)) ;
+        EXPECT_FALSE(satelliteSystem == SatelliteSystem(satelliteMass, satelliteGeometry, satelliteInertiaTensor, 0.8, 2.2)) ;
+
+    }
+
+    {
+
+        const SatelliteSystem satelliteSystem = { satelliteMass, satelliteGeometry, satelliteInertiaTensor, 0.8, 2.2 } ;
+
+        EXPECT_TRUE(satelliteSystem.isDefined()) ;
+        EXPECT_FALSE(satelliteSystem.getReflectivityCoefficient().isDefined()) ;
+
+        EXPECT_TRUE(satelliteSystem == SatelliteSystem(satelliteMass, satelliteGeometry, satelliteInertiaTensor, 0.8, 2.2)) ;
+
+    }
+
+}
@@ -8,6 +8,8 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <OpenSpaceToolkit/Astrodynamics/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/Callback.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/RingBuffer.hpp>
 
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -19,6 +21,9 @@
 
 #include <Global.test.hpp>
 
+#include <thread>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, Constructor)
@@ -106,6 +111,11 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, EqualToOperator)
 
         EXPECT_FALSE(numericalSolver == numericalSolver_5) ;
 
+        // Test initialStepType
+        const NumericalSolver numericalSolver_6 = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15, NumericalSolver::InitialStepType::Automatic } ;
+
+        EXPECT_FALSE(numericalSolver == numericalSolver_6) ;
+
     }
 
 }
@@ -153,6 +163,11 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, NotEqualToOperator)
 
         EXPECT_TRUE(numericalSolver != numericalSolver_5) ;
 
+        // Test initialStepType
+        const NumericalSolver numericalSolver_6 = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15, NumericalSolver::InitialStepType::WarmStart } ;
+
+        EXPECT_TRUE(numericalSolver != numericalSolver_6) ;
+
     }
 
 }
@@ -268,6 +283,17 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, GetType)
         EXPECT_EQ(numericalSolver_RungeKuttaFehlberg78.getStepperType(),NumericalSolver::StepperType::RungeKuttaFehlberg78) ;
     }
 
+    {
+        const NumericalSolver numericalSolver_UserDefined = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15 } ;
+        EXPECT_EQ(numericalSolver_UserDefined.getInitialStepType(),NumericalSolver::InitialStepType::UserDefined) ;
+
+        const NumericalSolver numericalSolver_Automatic = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15, NumericalSolver::InitialStepType::Automatic } ;
+        EXPECT_EQ(numericalSolver_Automatic.getInitialStepType(),NumericalSolver::InitialStepType::Automatic) ;
+
+        const NumericalSolver numericalSolver_WarmStart = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15, NumericalSolver::InitialStepType::WarmStart } ;
+        EXPECT_EQ(numericalSolver_WarmStart.getInitialStepType(),NumericalSolver::InitialStepType::WarmStart) ;
+    }
+
 }
 
 TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, GetNumbers)
@@ -295,6 +321,221 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, GetNumbers)
 
 }
 
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, GetStatistics)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+    using ostk::astro::numericalsolver::Event ;
+    using ostk::astro::numericalsolver::Statistics ;
+
+    const NumericalSolver::StateVector currentStateVector = { 0.0, 1.0 } ;
+    const Instant startInstant = Instant::J2000() ;
+
+    Size evaluationCount = 0 ;
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = [&evaluationCount] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+    {
+        dxdt[0] = x[1] ;
+        dxdt[1] = -x[0] ;
+        ++evaluationCount ;
+    } ;
+
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        EXPECT_EQ(Statistics(), numericalSolver.getStatistics()) ;
+
+    }
+
+    // Every evaluation and every step attempt is recorded: RKF78 evaluates 13 stages per attempt, and Dopri5 6 stages plus a few for its initialization
+
+    {
+
+        evaluationCount = 0 ;
+
+        NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 100.0, 1.0e-12, 1.0e-12 } ;
+
+        numericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(-1000.0), systemOfEquations) ;
+
+        const Statistics statistics = numericalSolver.getStatistics() ;
+
+        EXPECT_EQ(evaluationCount, statistics.getEvaluationCount()) ;
+        EXPECT_LT(0, statistics.getAcceptedStepCount()) ;
+        EXPECT_LT(0, statistics.getRejectedStepCount()) ;
+        EXPECT_EQ(13 * (statistics.getAcceptedStepCount() + statistics.getRejectedStepCount()), statistics.getEvaluationCount()) ;
+
+        EXPECT_LT(0.0, statistics.getMinimumStepSize().inSeconds()) ;
+        EXPECT_LE(statistics.getMinimumStepSize().inSeconds(), statistics.getMeanStepSize().inSeconds()) ;
+        EXPECT_LE(statistics.getMeanStepSize().inSeconds(), statistics.getMaximumStepSize().inSeconds()) ;
+        EXPECT_NEAR(1000.0, statistics.getMeanStepSize().inSeconds() * static_cast<double>(statistics.getAcceptedStepCount()), 1e-6) ;
+        EXPECT_EQ(0.0, statistics.getEvaluationWallTime().inSeconds()) ;
+
+        // Statistics accumulate over integrations until reset
+
+        numericalSolver.integrateStatesAtSortedInstants(currentStateVector, startInstant, { startInstant + Duration::Seconds(500.0), startInstant + Duration::Seconds(1000.0) }, systemOfEquations) ;
+
+        EXPECT_EQ(evaluationCount, numericalSolver.getStatistics().getEvaluationCount()) ;
+        EXPECT_LT(statistics.getAcceptedStepCount(), numericalSolver.getStatistics().getAcceptedStepCount()) ;
+
+        numericalSolver.resetStatistics() ;
+
+        EXPECT_EQ(Statistics(), numericalSolver.getStatistics()) ;
+
+    }
+
+    // The evaluation wall time is only recorded on request
+
+    {
+
+        NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 100.0, 1.0e-12, 1.0e-12 } ;
+
+        EXPECT_FALSE(numericalSolver.isEvaluationTimingEnabled()) ;
+
+        numericalSolver.setEvaluationTiming(true) ;
+
+        EXPECT_TRUE(numericalSolver.isEvaluationTimingEnabled()) ;
+        EXPECT_TRUE(NumericalSolver(numericalSolver).isEvaluationTimingEnabled()) ;
+
+        numericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(1000.0), systemOfEquations) ;
+
+        EXPECT_LT(0.0, numericalSolver.getStatistics().getEvaluationWallTime().inSeconds()) ;
+
+    }
+
+    {
+
+        evaluationCount = 0 ;
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 100.0, 1.0e-12, 1.0e-12 } ;
+
+        numericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(1000.0), systemOfEquations) ;
+
+        const Statistics statistics = numericalSolver.getStatistics() ;
+
+        EXPECT_EQ(evaluationCount, statistics.getEvaluationCount()) ;
+        EXPECT_LT(0, statistics.getAcceptedStepCount()) ;
+        EXPECT_LE(6 * (statistics.getAcceptedStepCount() + statistics.getRejectedStepCount()), statistics.getEvaluationCount()) ;
+        EXPECT_GE(6 * (statistics.getAcceptedStepCount() + statistics.getRejectedStepCount()) + 2, statistics.getEvaluationCount()) ;
+
+    }
+
+    // Fixed-size states, multistep stepper and events
+
+    {
+
+        evaluationCount = 0 ;
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::AdamsBashforthMoulton, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        numericalSolver.integrateStateForDuration<2>
+        (
+            { 0.0, 1.0 },
+            Duration::Seconds(1000.0),
+            [&evaluationCount] (const NumericalSolver::FixedStateVector<2>& x, NumericalSolver::FixedStateVector<2>& dxdt, const double) -> void
+            {
+                dxdt[0] = x[1] ;
+                dxdt[1] = -x[0] ;
+                ++evaluationCount ;
+            }
+        ) ;
+
+        EXPECT_EQ(evaluationCount, numericalSolver.getStatistics().getEvaluationCount()) ;
+        EXPECT_LT(0, numericalSolver.getStatistics().getAcceptedStepCount()) ;
+
+        const Shared<const Event> eventSPtr = std::make_shared<Event>("Zero", [] (const Event::StateVector& x, const double) -> double { return x[0] ; }) ;
+
+        const Size acceptedStepCount = numericalSolver.getStatistics().getAcceptedStepCount() ;
+
+        numericalSolver.integrateStateWithEventsForDuration(currentStateVector, Duration::Seconds(1000.0), systemOfEquations, { eventSPtr }) ;
+
+        EXPECT_EQ(evaluationCount, numericalSolver.getStatistics().getEvaluationCount()) ;
+        EXPECT_LT(acceptedStepCount, numericalSolver.getStatistics().getAcceptedStepCount()) ;
+
+    }
+
+    // A solver shared between threads merges the statistics of every integration
+
+    {
+
+        const NumericalSolver::SystemOfEquationsWrapper harmonicOscillator = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+        {
+            dxdt[0] = x[1] ;
+            dxdt[1] = -x[0] ;
+        } ;
+
+        const NumericalSolver referenceNumericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 100.0, 1.0e-12, 1.0e-12 } ;
+
+        referenceNumericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(1000.0), harmonicOscillator) ;
+
+        const Statistics referenceStatistics = referenceNumericalSolver.getStatistics() ;
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 100.0, 1.0e-12, 1.0e-12 } ;
+
+        const Size threadCount = 4 ;
+        const Size integrationCount = 25 ;
+
+        std::vector<std::thread> threads ;
+
+        for (Size threadIndex = 0 ; threadIndex < threadCount ; ++threadIndex)
+        {
+
+            threads.emplace_back([&numericalSolver, &currentStateVector, &harmonicOscillator, integrationCount] () -> void
+            {
+
+                for (Size integrationIndex = 0 ; integrationIndex < integrationCount ; ++integrationIndex)
+                {
+                    numericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(1000.0), harmonicOscillator) ;
+                }
+
+            }) ;
+
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join() ;
+        }
+
+        const Statistics statistics = numericalSolver.getStatistics() ;
+
+        EXPECT_EQ(threadCount * integrationCount * referenceStatistics.getEvaluationCount(), statistics.getEvaluationCount()) ;
+        EXPECT_EQ(threadCount * integrationCount * referenceStatistics.getAcceptedStepCount(), statistics.getAcceptedStepCount()) ;
+        EXPECT_EQ(threadCount * integrationCount * referenceStatistics.getRejectedStepCount(), statistics.getRejectedStepCount()) ;
+        EXPECT_EQ(referenceStatistics.getMinimumStepSize(), statistics.getMinimumStepSize()) ;
+        EXPECT_EQ(referenceStatistics.getMaximumStepSize(), statistics.getMaximumStepSize()) ;
+
+        // Copies and assignments take a consistent snapshot of the statistics
+
+        EXPECT_EQ(statistics, NumericalSolver(numericalSolver).getStatistics()) ;
+
+        NumericalSolver assignedNumericalSolver = referenceNumericalSolver ;
+
+        EXPECT_EQ(referenceStatistics, assignedNumericalSolver.getStatistics()) ;
+
+        assignedNumericalSolver = numericalSolver ;
+
+        EXPECT_EQ(statistics, assignedNumericalSolver.getStatistics()) ;
+
+    }
+
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, ostk::core::types::Real::Undefined(), 1.0e-15, 1.0e-15 } ;
+
+        EXPECT_ANY_THROW(numericalSolver.getStatistics()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, StringFromType)
 {
 
@@ -312,6 +553,14 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, StringFromType)
 
         EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::RungeKuttaCashKarp54) == "RungeKuttaCashKarp54") ;
         EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::RungeKuttaFehlberg78) == "RungeKuttaFehlberg78") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::RungeKuttaDopri5) == "RungeKuttaDopri5") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::AdamsBashforthMoulton) == "AdamsBashforthMoulton") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::BulirschStoer) == "BulirschStoer") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::BulirschStoerDenseOutput) == "BulirschStoerDenseOutput") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::RungeKuttaNystrom64) == "RungeKuttaNystrom64") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::StormerVerlet) == "StormerVerlet") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::Yoshida4) == "Yoshida4") ;
+        EXPECT_TRUE(NumericalSolver::StringFromStepperType(NumericalSolver::StepperType::Yoshida6) == "Yoshida6") ;
 
     }
 
@@ -321,6 +570,10 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, StringFromType)
         EXPECT_TRUE(NumericalSolver::StringFromLogType(NumericalSolver::LogType::LogConstant) == "LogConstant") ;
         EXPECT_TRUE(NumericalSolver::StringFromLogType(NumericalSolver::LogType::LogAdaptive) == "LogAdaptive") ;
 
+        EXPECT_TRUE(NumericalSolver::StringFromInitialStepType(NumericalSolver::InitialStepType::UserDefined) == "UserDefined") ;
+        EXPECT_TRUE(NumericalSolver::StringFromInitialStepType(NumericalSolver::InitialStepType::Automatic) == "Automatic") ;
+        EXPECT_TRUE(NumericalSolver::StringFromInitialStepType(NumericalSolver::InitialStepType::WarmStart) == "WarmStart") ;
+
     }
 
 
@@ -862,4 +1115,1543 @@ TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateStateFromInstantT
     }
 }
 
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateFixedStateVector)
+{
+
+    using ostk::core::types::Real ;
+    using ostk::core::types::String ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    typedef NumericalSolver::FixedStateVector<2> StateVector2d ;
+
+    const auto systemOfEquations = [] (const StateVector2d& x, StateVector2d& dxdt, const double) -> void
+    {
+        dxdt[0] = x[1] ;
+        dxdt[1] = -x[0] ;
+    } ;
+
+    const StateVector2d currentStateVector = { 0.0, 1.0 } ;
+    const Instant startInstant = Instant::J2000() ;
+
+    // Validate integrateStatesAtSortedInstants in forward and backward time, against an analytical function
+    {
+
+        const Array<NumericalSolver::StepperType> stepperTypes = { NumericalSolver::StepperType::RungeKuttaCashKarp54, NumericalSolver::StepperType::RungeKuttaFehlberg78, NumericalSolver::StepperType::AdamsBashforthMoulton, NumericalSolver::StepperType::BulirschStoer, NumericalSolver::StepperType::BulirschStoerDenseOutput, NumericalSolver::StepperType::RungeKuttaNystrom64 } ;
+
+        for (const auto& stepperType : stepperTypes)
+        {
+
+            for (const double sign : { +1.0, -1.0 })
+            {
+
+                const Array<Instant> instantArray =
+                {
+                    startInstant + Duration::Seconds(sign * 100.0),
+                    startInstant + Duration::Seconds(sign * 400.0),
+                    startInstant + Duration::Seconds(sign * 700.0),
+                    startInstant + Duration::Seconds(sign * 1000.0)
+                } ;
+
+                const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 5.0, 1.0e-15, 1.0e-15 } ;
+
+                const Array<StateVector2d> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants<2>(currentStateVector, startInstant, instantArray, systemOfEquations) ;
+
+                ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+                for (size_t i = 0; i < instantArray.size(); i++)
+                {
+
+                    const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                    EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+                    EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    // Validate integrateStateForDuration and integrateStateFromInstantToInstant against the dynamically sized state vector path
+    {
+
+        const NumericalSolver::StateVector dynamicStateVector = { 0.0, 1.0 } ;
+
+        for (const Duration& duration : { Duration::Seconds(1000.0), Duration::Seconds(-1000.0) })
+        {
+
+            NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+
+            const StateVector2d propagatedStateVector = numericalSolver.integrateStateForDuration<2>(currentStateVector, duration, systemOfEquations) ;
+            const StateVector2d propagatedStateVectorFromInstant = numericalSolver.integrateStateFromInstantToInstant<2>(currentStateVector, startInstant, startInstant + duration, systemOfEquations) ;
+
+            const NumericalSolver::StateVector referenceStateVector = numericalSolver.integrateStateForDuration
+            (
+                dynamicStateVector,
+                duration,
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[0] = x[1] ;
+                    dxdt[1] = -x[0] ;
+                }
+            ) ;
+
+            EXPECT_GT(2e-10, std::abs(propagatedStateVector[0] - std::sin(duration.inSeconds()))) ;
+            EXPECT_GT(2e-10, std::abs(propagatedStateVector[1] - std::cos(duration.inSeconds()))) ;
+
+            EXPECT_EQ(referenceStateVector[0], propagatedStateVector[0]) ;
+            EXPECT_EQ(referenceStateVector[1], propagatedStateVector[1]) ;
+
+            EXPECT_EQ(propagatedStateVector, propagatedStateVectorFromInstant) ;
+
+        }
+
+    }
+
+    // Zero duration and empty instant array
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        EXPECT_EQ(currentStateVector, numericalSolver.integrateStateForDuration<2>(currentStateVector, Duration::Zero(), systemOfEquations)) ;
+        EXPECT_ANY_THROW(numericalSolver.integrateStatesAtSortedInstants<2>(currentStateVector, startInstant, Array<Instant>::Empty(), systemOfEquations)) ;
+
+    }
+
+    // Logging
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::LogAdaptive, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        testing::internal::CaptureStdout() ;
+        numericalSolver.integrateStateForDuration<2>(currentStateVector, Duration::Seconds(100.0), systemOfEquations) ;
+        const String output = testing::internal::GetCapturedStdout() ;
+
+        EXPECT_FALSE(output.empty()) ;
+
+    }
+
+}
+
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithDenseOutput)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+    const Instant startInstant = Instant::J2000() ;
+
+    // Validate integrateStatesAtSortedInstants in forward and backward time against an analytical function
+    {
+
+        for (const double sign : { +1.0, -1.0 })
+        {
+
+            Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+            for (Size i = 1; i <= 100; ++i)
+            {
+                instantArray.add(startInstant + Duration::Seconds(sign * 10.0 * static_cast<double>(i))) ;
+            }
+
+            NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-15, 1.0e-15 } ;
+
+            const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants
+            (
+                currentStateVector,
+                startInstant,
+                instantArray,
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[0] = x[1] ;
+                    dxdt[1] = -x[0] ;
+                }
+            ) ;
+
+            ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+            for (size_t i = 0; i < instantArray.size(); i++)
+            {
+
+                const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+            }
+
+        }
+
+    }
+
+    // The number of evaluations of the system of equations does not depend on the output density
+    {
+
+        const auto countEvaluations = [&] (const Size anOutputCount) -> Size
+        {
+
+            Size evaluationCount = 0 ;
+
+            Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+            for (Size i = 1; i <= anOutputCount; ++i)
+            {
+                instantArray.add(startInstant + Duration::Seconds(1000.0 * static_cast<double>(i) / static_cast<double>(anOutputCount))) ;
+            }
+
+            NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-12, 1.0e-12 } ;
+
+            numericalSolver.integrateStatesAtSortedInstants
+            (
+                currentStateVector,
+                startInstant,
+                instantArray,
+                [&evaluationCount] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[0] = x[1] ;
+                    dxdt[1] = -x[0] ;
+                    ++evaluationCount ;
+                }
+            ) ;
+
+            return evaluationCount ;
+
+        } ;
+
+        const Size sparseEvaluationCount = countEvaluations(10) ;
+        const Size denseEvaluationCount = countEvaluations(1000) ;
+
+        EXPECT_GT(sparseEvaluationCount + 10, denseEvaluationCount) ;
+
+    }
+
+    // Retain the continuous extension of each step, in forward and backward time, without evaluating the system of equations again
+    {
+
+        EXPECT_TRUE((NumericalSolver { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-12, 1.0e-12 }).hasDenseOutput()) ;
+        EXPECT_TRUE((NumericalSolver { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::BulirschStoerDenseOutput, 5.0, 1.0e-12, 1.0e-12 }).hasDenseOutput()) ;
+        EXPECT_FALSE((NumericalSolver { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12 }).hasDenseOutput()) ;
+
+        for (const double sign : { +1.0, -1.0 })
+        {
+
+            Size evaluationCount = 0 ;
+
+            const auto oscillator = [&evaluationCount] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+            {
+                dxdt[0] = x[1] ;
+                dxdt[1] = -x[0] ;
+                ++evaluationCount ;
+            } ;
+
+            const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-12, 1.0e-12 } ;
+
+            numericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(sign * 10.0), oscillator) ;
+
+            const Size stateEvaluationCount = evaluationCount ;
+
+            evaluationCount = 0 ;
+
+            const Array<NumericalSolver::DenseOutputStep> denseOutputSteps = numericalSolver.integrateDenseOutputFromInstantToInstant(currentStateVector, startInstant, startInstant + Duration::Seconds(sign * 10.0), oscillator) ;
+
+            EXPECT_GE(stateEvaluationCount, evaluationCount) ;
+
+            ASSERT_LT(1, denseOutputSteps.getSize()) ;
+
+            EXPECT_EQ(0.0, denseOutputSteps.accessFirst().startTime) ;
+            EXPECT_EQ(sign * 10.0, denseOutputSteps.accessLast().endTime) ;
+
+            for (Size k = 0 ; k < denseOutputSteps.getSize() ; ++k)
+            {
+
+                const NumericalSolver::DenseOutputStep& denseOutputStep = denseOutputSteps[k] ;
+
+                EXPECT_EQ(6, denseOutputStep.coefficientArray.getSize()) ;
+
+                if (k > 0)
+                {
+                    EXPECT_EQ(denseOutputSteps[k - 1].endTime, denseOutputStep.startTime) ;
+                }
+
+                for (const double s : { 0.0, 0.25, 0.5, 0.75, 1.0 })
+                {
+
+                    const double time = denseOutputStep.startTime + (s * (denseOutputStep.endTime - denseOutputStep.startTime)) ;
+
+                    double position = 0.0 ;
+                    double velocity = 0.0 ;
+
+                    for (Size power = denseOutputStep.coefficientArray.getSize() ; power-- > 0 ; )
+                    {
+                        position = (position * s) + denseOutputStep.coefficientArray[power][0] ;
+                        velocity = (velocity * s) + denseOutputStep.coefficientArray[power][1] ;
+                    }
+
+                    EXPECT_GT(1e-8, std::abs(position - std::sin(time))) ;
+                    EXPECT_GT(1e-8, std::abs(velocity - std::cos(time))) ;
+
+                }
+
+            }
+
+        }
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        EXPECT_ANY_THROW(numericalSolver.integrateDenseOutputForDuration(currentStateVector, Duration::Seconds(100.0), [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void { dxdt[0] = x[1] ; dxdt[1] = -x[0] ; })) ;
+
+    }
+
+    // Validate integrateStateForDuration with a fixed-size state vector
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        const NumericalSolver::FixedStateVector<2> propagatedStateVector = numericalSolver.integrateStateForDuration<2>
+        (
+            { 0.0, 1.0 },
+            Duration::Seconds(-1000.0),
+            [] (const NumericalSolver::FixedStateVector<2>& x, NumericalSolver::FixedStateVector<2>& dxdt, const double) -> void
+            {
+                dxdt[0] = x[1] ;
+                dxdt[1] = -x[0] ;
+            }
+        ) ;
+
+        EXPECT_GT(2e-8, std::abs(propagatedStateVector[0] - std::sin(-1000.0))) ;
+        EXPECT_GT(2e-8, std::abs(propagatedStateVector[1] - std::cos(-1000.0))) ;
+
+    }
+
+}
+
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithMultistep)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    const Instant startInstant = Instant::J2000() ;
+
+    // Validate integrateStatesAtSortedInstants in forward and backward time against an analytical function
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+
+        for (const double sign : { +1.0, -1.0 })
+        {
+
+            Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+            for (Size i = 1; i <= 100; ++i)
+            {
+                instantArray.add(startInstant + Duration::Seconds(sign * 10.0 * static_cast<double>(i))) ;
+            }
+
+            NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::AdamsBashforthMoulton, 5.0, 1.0e-15, 1.0e-15 } ;
+
+            const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants
+            (
+                currentStateVector,
+                startInstant,
+                instantArray,
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[0] = x[1] ;
+                    dxdt[1] = -x[0] ;
+                }
+            ) ;
+
+            ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+            for (size_t i = 0; i < instantArray.size(); i++)
+            {
+
+                const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+            }
+
+        }
+
+    }
+
+    // Over a day of a low Earth orbit, the multistep method matches RKF78 with far fewer evaluations of the system of equations
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 7000.0e3, 0.0, 0.0, 0.0, 5335.865450622126, 5335.865450622126 } ;
+
+        const auto integrate = [&] (const NumericalSolver::StepperType& aStepperType, Size& anEvaluationCount) -> NumericalSolver::StateVector
+        {
+
+            const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, aStepperType, 5.0, 1.0e-14, 1.0e-14 } ;
+
+            return numericalSolver.integrateStateForDuration
+            (
+                currentStateVector,
+                Duration::Days(1.0),
+                [&anEvaluationCount] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+
+                    const double r = std::sqrt((x[0] * x[0]) + (x[1] * x[1]) + (x[2] * x[2])) ;
+                    const double muOverR3 = 3.986004418e14 / (r * r * r) ;
+
+                    dxdt[0] = x[3] ;
+                    dxdt[1] = x[4] ;
+                    dxdt[2] = x[5] ;
+                    dxdt[3] = -muOverR3 * x[0] ;
+                    dxdt[4] = -muOverR3 * x[1] ;
+                    dxdt[5] = -muOverR3 * x[2] ;
+
+                    ++anEvaluationCount ;
+
+                }
+            ) ;
+
+        } ;
+
+        Size multistepEvaluationCount = 0 ;
+        Size rungeKuttaEvaluationCount = 0 ;
+
+        const NumericalSolver::StateVector multistepStateVector = integrate(NumericalSolver::StepperType::AdamsBashforthMoulton, multistepEvaluationCount) ;
+        const NumericalSolver::StateVector rungeKuttaStateVector = integrate(NumericalSolver::StepperType::RungeKuttaFehlberg78, rungeKuttaEvaluationCount) ;
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            EXPECT_GT(1e-2, std::abs(multistepStateVector[i] - rungeKuttaStateVector[i])) ;
+            EXPECT_GT(1e-5, std::abs(multistepStateVector[i + 3] - rungeKuttaStateVector[i + 3])) ;
+        }
+
+        EXPECT_GT(rungeKuttaEvaluationCount, 2 * multistepEvaluationCount) ;
+
+    }
+
+    // Constant output logging
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::LogConstant, NumericalSolver::StepperType::AdamsBashforthMoulton, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        testing::internal::CaptureStdout() ;
+
+        const NumericalSolver::StateVector propagatedStateVector = numericalSolver.integrateStateForDuration
+        (
+            { 0.0, 1.0 },
+            Duration::Seconds(100.0),
+            [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+            {
+                dxdt[0] = x[1] ;
+                dxdt[1] = -x[0] ;
+            }
+        ) ;
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty()) ;
+
+        EXPECT_GT(2e-8, std::abs(propagatedStateVector[0] - std::sin(100.0))) ;
+        EXPECT_GT(2e-8, std::abs(propagatedStateVector[1] - std::cos(100.0))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithExtrapolation)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    const Instant startInstant = Instant::J2000() ;
+
+    // Validate integrateStatesAtSortedInstants in forward and backward time against an analytical function
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+
+        for (const double sign : { +1.0, -1.0 })
+        {
+
+            Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+            for (Size i = 1; i <= 100; ++i)
+            {
+                instantArray.add(startInstant + Duration::Seconds(sign * 10.0 * static_cast<double>(i))) ;
+            }
+
+            NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::BulirschStoer, 5.0, 1.0e-15, 1.0e-15 } ;
+
+            const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants
+            (
+                currentStateVector,
+                startInstant,
+                instantArray,
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[0] = x[1] ;
+                    dxdt[1] = -x[0] ;
+                }
+            ) ;
+
+            ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+            for (size_t i = 0; i < instantArray.size(); i++)
+            {
+
+                const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+            }
+
+        }
+
+    }
+
+    // Over a day of a low Earth orbit at the tightest tolerances, the extrapolation method matches RKF78 with far fewer evaluations of the system of equations
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 7000.0e3, 0.0, 0.0, 0.0, 5335.865450622126, 5335.865450622126 } ;
+
+        const auto integrate = [&] (const NumericalSolver::StepperType& aStepperType, Size& anEvaluationCount) -> NumericalSolver::StateVector
+        {
+
+            const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, aStepperType, 5.0, 1.0e-15, 1.0e-15 } ;
+
+            const NumericalSolver::StateVector stateVector = numericalSolver.integrateStateForDuration
+            (
+                currentStateVector,
+                Duration::Days(1.0),
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+
+                    const double r = std::sqrt((x[0] * x[0]) + (x[1] * x[1]) + (x[2] * x[2])) ;
+                    const double muOverR3 = 3.986004418e14 / (r * r * r) ;
+
+                    dxdt[0] = x[3] ;
+                    dxdt[1] = x[4] ;
+                    dxdt[2] = x[5] ;
+                    dxdt[3] = -muOverR3 * x[0] ;
+                    dxdt[4] = -muOverR3 * x[1] ;
+                    dxdt[5] = -muOverR3 * x[2] ;
+
+                }
+            ) ;
+
+            anEvaluationCount = numericalSolver.getStatistics().getEvaluationCount() ;
+
+            return stateVector ;
+
+        } ;
+
+        Size extrapolationEvaluationCount = 0 ;
+        Size rungeKuttaEvaluationCount = 0 ;
+
+        const NumericalSolver::StateVector extrapolationStateVector = integrate(NumericalSolver::StepperType::BulirschStoer, extrapolationEvaluationCount) ;
+        const NumericalSolver::StateVector rungeKuttaStateVector = integrate(NumericalSolver::StepperType::RungeKuttaFehlberg78, rungeKuttaEvaluationCount) ;
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            EXPECT_GT(1e-2, std::abs(extrapolationStateVector[i] - rungeKuttaStateVector[i])) ;
+            EXPECT_GT(1e-5, std::abs(extrapolationStateVector[i + 3] - rungeKuttaStateVector[i + 3])) ;
+        }
+
+        EXPECT_GT(2 * rungeKuttaEvaluationCount, 3 * extrapolationEvaluationCount) ;
+
+    }
+
+    // On a dense output grid at the tightest tolerances, the dense output variant interpolates within its steps, in forward and backward time,
+    // with fewer evaluations of the system of equations than the controlled variant, whose steps are cut at every output time
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+
+        for (const double sign : { +1.0, -1.0 })
+        {
+
+            Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+            for (Size i = 1; i <= 1000; ++i)
+            {
+                instantArray.add(startInstant + Duration::Seconds(sign * 1.0 * static_cast<double>(i))) ;
+            }
+
+            const auto integrate = [&] (const NumericalSolver::StepperType& aStepperType, Size& anEvaluationCount) -> Array<NumericalSolver::StateVector>
+            {
+
+                const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, aStepperType, 5.0, 1.0e-15, 1.0e-15 } ;
+
+                const Array<NumericalSolver::StateVector> stateVectorArray = numericalSolver.integrateStatesAtSortedInstants
+                (
+                    currentStateVector,
+                    startInstant,
+                    instantArray,
+                    [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                    {
+                        dxdt[0] = x[1] ;
+                        dxdt[1] = -x[0] ;
+                    }
+                ) ;
+
+                anEvaluationCount = numericalSolver.getStatistics().getEvaluationCount() ;
+
+                return stateVectorArray ;
+
+            } ;
+
+            Size denseOutputEvaluationCount = 0 ;
+            Size controlledEvaluationCount = 0 ;
+
+            const Array<NumericalSolver::StateVector> denseOutputStateVectorArray = integrate(NumericalSolver::StepperType::BulirschStoerDenseOutput, denseOutputEvaluationCount) ;
+            integrate(NumericalSolver::StepperType::BulirschStoer, controlledEvaluationCount) ;
+
+            ASSERT_EQ(instantArray.size(), denseOutputStateVectorArray.size()) ;
+
+            for (size_t i = 0; i < instantArray.size(); i++)
+            {
+
+                const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                EXPECT_GT(2e-8, std::abs(denseOutputStateVectorArray[i][0] - std::sin(time))) ;
+                EXPECT_GT(2e-8, std::abs(denseOutputStateVectorArray[i][1] - std::cos(time))) ;
+
+            }
+
+            EXPECT_GT(controlledEvaluationCount, 2 * denseOutputEvaluationCount) ;
+
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithSecondOrderSystem)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    const Instant startInstant = Instant::J2000() ;
+
+    // Validate integrateStatesAtSortedInstants in forward and backward time against an analytical function, with a system only returning the acceleration
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+
+        for (const double sign : { +1.0, -1.0 })
+        {
+
+            Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+            for (Size i = 1; i <= 100; ++i)
+            {
+                instantArray.add(startInstant + Duration::Seconds(sign * 10.0 * static_cast<double>(i))) ;
+            }
+
+            NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaNystrom64, 5.0, 1.0e-15, 1.0e-15 } ;
+
+            const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants
+            (
+                currentStateVector,
+                startInstant,
+                instantArray,
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[1] = -x[0] ;
+                }
+            ) ;
+
+            ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+            for (size_t i = 0; i < instantArray.size(); i++)
+            {
+
+                const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+                EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+            }
+
+        }
+
+    }
+
+    // Validate a velocity dependent acceleration against the analytical damped oscillator x(t) = exp(-t / 10) * sin(w * t) / w
+    {
+
+        const double w = std::sqrt(1.0 - 0.01) ;
+
+        NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaNystrom64, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        const NumericalSolver::StateVector propagatedStateVector = numericalSolver.integrateStateForDuration
+        (
+            { 0.0, 1.0 },
+            Duration::Seconds(20.0),
+            [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+            {
+                dxdt[1] = -x[0] - (0.2 * x[1]) ;
+            }
+        ) ;
+
+        EXPECT_GT(1e-8, std::abs(propagatedStateVector[0] - (std::exp(-2.0) * std::sin(w * 20.0) / w))) ;
+        EXPECT_GT(1e-8, std::abs(propagatedStateVector[1] - (std::exp(-2.0) * (std::cos(w * 20.0) - (0.1 * std::sin(w * 20.0) / w))))) ;
+
+    }
+
+    // Over a day of a low Earth orbit with J2, the Runge-Kutta-Nystrom stepper is more accurate than Dopri5 at the same tolerance, with fewer evaluations
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 7000.0e3, 0.0, 0.0, 0.0, 5335.865450622126, 5335.865450622126 } ;
+
+        const auto systemOfEquations = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+        {
+
+            const double r = std::sqrt((x[0] * x[0]) + (x[1] * x[1]) + (x[2] * x[2])) ;
+            const double muOverR3 = 3.986004418e14 / (r * r * r) ;
+            const double j2Factor = 1.5 * 1.08263e-3 * (6378137.0 * 6378137.0) / (r * r) ;
+            const double z2OverR2 = (x[2] * x[2]) / (r * r) ;
+
+            dxdt[0] = x[3] ;
+            dxdt[1] = x[4] ;
+            dxdt[2] = x[5] ;
+            dxdt[3] = -muOverR3 * x[0] * (1.0 + j2Factor * (1.0 - 5.0 * z2OverR2)) ;
+            dxdt[4] = -muOverR3 * x[1] * (1.0 + j2Factor * (1.0 - 5.0 * z2OverR2)) ;
+            dxdt[5] = -muOverR3 * x[2] * (1.0 + j2Factor * (3.0 - 5.0 * z2OverR2)) ;
+
+        } ;
+
+        const auto integrate = [&] (const NumericalSolver::StepperType& aStepperType, const double aTolerance, Size& anEvaluationCount) -> NumericalSolver::StateVector
+        {
+
+            const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, aStepperType, 5.0, aTolerance, aTolerance } ;
+
+            const NumericalSolver::StateVector stateVector = numericalSolver.integrateStateForDuration(currentStateVector, Duration::Days(1.0), systemOfEquations) ;
+
+            anEvaluationCount = numericalSolver.getStatistics().getEvaluationCount() ;
+
+            return stateVector ;
+
+        } ;
+
+        Size referenceEvaluationCount = 0 ;
+        Size nystromEvaluationCount = 0 ;
+        Size dopriEvaluationCount = 0 ;
+
+        const NumericalSolver::StateVector referenceStateVector = integrate(NumericalSolver::StepperType::RungeKuttaFehlberg78, 1.0e-15, referenceEvaluationCount) ;
+        const NumericalSolver::StateVector nystromStateVector = integrate(NumericalSolver::StepperType::RungeKuttaNystrom64, 1.0e-10, nystromEvaluationCount) ;
+        const NumericalSolver::StateVector dopriStateVector = integrate(NumericalSolver::StepperType::RungeKuttaDopri5, 1.0e-10, dopriEvaluationCount) ;
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            EXPECT_GT(1e-2, std::abs(nystromStateVector[i] - referenceStateVector[i])) ;
+            EXPECT_GT(1e-5, std::abs(nystromStateVector[i + 3] - referenceStateVector[i + 3])) ;
+        }
+
+        EXPECT_GT(dopriEvaluationCount, nystromEvaluationCount) ;
+
+    }
+
+    // The state must hold positions and velocities
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaNystrom64, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        EXPECT_ANY_THROW
+        (
+            numericalSolver.integrateStateForDuration
+            (
+                { 1.0, 0.0, 0.0 },
+                Duration::Seconds(10.0),
+                [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+                {
+                    dxdt[0] = x[1] ;
+                    dxdt[1] = x[2] ;
+                    dxdt[2] = -x[0] ;
+                }
+            )
+        ) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithSymplectic)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Pair ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+    using ostk::astro::numericalsolver::Event ;
+
+    const Array<Pair<NumericalSolver::StepperType, double>> stepperTypesAndOrders =
+    {
+        { NumericalSolver::StepperType::StormerVerlet, 2.0 },
+        { NumericalSolver::StepperType::Yoshida4, 4.0 },
+        { NumericalSolver::StepperType::Yoshida6, 6.0 }
+    } ;
+
+    const auto oscillator = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+    {
+        dxdt[1] = -x[0] ;
+    } ;
+
+    {
+
+        EXPECT_TRUE((NumericalSolver { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::Yoshida4, 5.0, 1.0e-12, 1.0e-12 }).isSecondOrder()) ;
+        EXPECT_TRUE((NumericalSolver { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaNystrom64, 5.0, 1.0e-12, 1.0e-12 }).isSecondOrder()) ;
+        EXPECT_FALSE((NumericalSolver { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12 }).isSecondOrder()) ;
+
+    }
+
+    // Steps have the provided time step, and halving it divides the error by 2^order, in forward and backward time
+    {
+
+        for (const auto& stepperTypeAndOrder : stepperTypesAndOrders)
+        {
+
+            for (const double sign : { +1.0, -1.0 })
+            {
+
+                const double duration = sign * 10.0 ;
+
+                Array<double> errors = Array<double>::Empty() ;
+
+                for (const double timeStep : { 0.2, 0.1 })
+                {
+
+                    const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, stepperTypeAndOrder.first, timeStep, 1.0e-15, 1.0e-15, NumericalSolver::InitialStepType::Automatic } ;
+
+                    const NumericalSolver::StateVector propagatedStateVector = numericalSolver.integrateStateForDuration({ 0.0, 1.0 }, Duration::Seconds(duration), oscillator) ;
+
+                    errors.add(std::abs(propagatedStateVector[0] - std::sin(duration)) + std::abs(propagatedStateVector[1] - std::cos(duration))) ;
+
+                    EXPECT_EQ(static_cast<Size>(std::round(10.0 / timeStep)), numericalSolver.getStatistics().getAcceptedStepCount()) ;
+                    EXPECT_EQ(0, numericalSolver.getStatistics().getRejectedStepCount()) ;
+                    EXPECT_NEAR(timeStep, numericalSolver.getStatistics().getMaximumStepSize().inSeconds(), 1e-12) ;
+
+                }
+
+                const double order = std::log2(errors[0] / errors[1]) ;
+
+                EXPECT_NEAR(stepperTypeAndOrder.second, order, 0.2) << NumericalSolver::StringFromStepperType(stepperTypeAndOrder.first) ;
+
+            }
+
+        }
+
+    }
+
+    // Steps are shortened to land on the requested instants
+    {
+
+        const Instant startInstant = Instant::J2000() ;
+
+        const Array<Instant> instantArray = { startInstant + Duration::Seconds(0.25), startInstant + Duration::Seconds(3.33), startInstant + Duration::Seconds(10.0) } ;
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::Yoshida6, 0.01, 1.0e-15, 1.0e-15 } ;
+
+        const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants({ 0.0, 1.0 }, startInstant, instantArray, oscillator) ;
+
+        ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+        for (Size i = 0; i < instantArray.size(); ++i)
+        {
+
+            const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+            EXPECT_GT(1e-11, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+            EXPECT_GT(1e-11, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+        }
+
+    }
+
+    // Events are located within a fixed step
+    {
+
+        const Shared<const Event> terminalEventSPtr = std::make_shared<Event>("Terminal", [] (const Event::StateVector& x, const double) -> double { return x[1] + 0.5 ; }, Event::Direction::Increasing, true) ;
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::Yoshida6, 0.01, 1.0e-15, 1.0e-15 } ;
+
+        const Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsForDuration({ 0.0, 1.0 }, Duration::Seconds(13.0), oscillator, { terminalEventSPtr }) ;
+
+        ASSERT_EQ(1, stateAndOccurrences.second.size()) ;
+
+        EXPECT_GT(1e-8, std::abs(stateAndOccurrences.second[0].time - (4.0 * M_PI / 3.0))) ;
+        EXPECT_GT(1e-8, std::abs(stateAndOccurrences.first[1] + 0.5)) ;
+
+    }
+
+    // Over a hundred revolutions of an eccentric Kepler orbit, the energy error stays bounded instead of drifting
+    {
+
+        const auto kepler = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+        {
+
+            const double r = std::sqrt((x[0] * x[0]) + (x[1] * x[1])) ;
+            const double r3 = r * r * r ;
+
+            dxdt[2] = -x[0] / r3 ;
+            dxdt[3] = -x[1] / r3 ;
+
+        } ;
+
+        const auto energy = [] (const NumericalSolver::StateVector& x) -> double
+        {
+            return (0.5 * ((x[2] * x[2]) + (x[3] * x[3]))) - (1.0 / std::sqrt((x[0] * x[0]) + (x[1] * x[1]))) ;
+        } ;
+
+        // Periapsis of an orbit of eccentricity 0.5 and unit semi-major axis, with a period of 2.pi
+        const NumericalSolver::StateVector currentStateVector = { 0.5, 0.0, 0.0, std::sqrt(3.0) } ;
+        const double initialEnergy = energy(currentStateVector) ;
+
+        const Instant startInstant = Instant::J2000() ;
+
+        // A hundred samples per revolution
+        Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+        for (Size i = 1; i <= 10000; ++i)
+        {
+            instantArray.add(startInstant + Duration::Seconds(2.0 * M_PI * static_cast<double>(i) / 100.0)) ;
+        }
+
+        for (const auto& stepperTypeAndOrder : stepperTypesAndOrders)
+        {
+
+            const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, stepperTypeAndOrder.first, 2.0 * M_PI / 1000.0, 1.0e-15, 1.0e-15 } ;
+
+            const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants(currentStateVector, startInstant, instantArray, kepler) ;
+
+            double earlyEnergyError = 0.0 ;
+            double lateEnergyError = 0.0 ;
+
+            // Over the first and last ten revolutions
+            for (Size i = 0; i < 1000; ++i)
+            {
+                earlyEnergyError = std::max(earlyEnergyError, std::abs(energy(propagatedStateVectorArray[i]) - initialEnergy)) ;
+                lateEnergyError = std::max(lateEnergyError, std::abs(energy(propagatedStateVectorArray[9000 + i]) - initialEnergy)) ;
+            }
+
+            EXPECT_GT(1e-3, lateEnergyError) << NumericalSolver::StringFromStepperType(stepperTypeAndOrder.first) ;
+            EXPECT_GT((2.0 * earlyEnergyError) + 1e-12, lateEnergyError) << NumericalSolver::StringFromStepperType(stepperTypeAndOrder.first) ;
+
+        }
+
+    }
+
+    // The state must hold positions and velocities
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::StormerVerlet, 0.1, 1.0e-12, 1.0e-12 } ;
+
+        EXPECT_ANY_THROW(numericalSolver.integrateStateForDuration({ 1.0, 0.0, 0.0 }, Duration::Seconds(1.0), oscillator)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithInitialStepType)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    const Instant startInstant = Instant::J2000() ;
+
+    const Array<NumericalSolver::StepperType> stepperTypes =
+    {
+        NumericalSolver::StepperType::RungeKuttaCashKarp54,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        NumericalSolver::StepperType::AdamsBashforthMoulton,
+        NumericalSolver::StepperType::BulirschStoer,
+        NumericalSolver::StepperType::RungeKuttaNystrom64
+    } ;
+
+    const auto oscillator = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+    {
+        dxdt[0] = x[1] ;
+        dxdt[1] = -x[0] ;
+    } ;
+
+    const auto twoBody = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+    {
+
+        const double r = std::sqrt((x[0] * x[0]) + (x[1] * x[1]) + (x[2] * x[2])) ;
+        const double muOverR3 = 3.986004418e14 / (r * r * r) ;
+
+        dxdt[0] = x[3] ;
+        dxdt[1] = x[4] ;
+        dxdt[2] = x[5] ;
+        dxdt[3] = -muOverR3 * x[0] ;
+        dxdt[4] = -muOverR3 * x[1] ;
+        dxdt[5] = -muOverR3 * x[2] ;
+
+    } ;
+
+    // The estimated and warm started initial time steps keep the accuracy, in forward and backward time
+    {
+
+        for (const auto& stepperType : stepperTypes)
+        {
+
+            for (const auto& initialStepType : { NumericalSolver::InitialStepType::Automatic, NumericalSolver::InitialStepType::WarmStart })
+            {
+
+                const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 5.0, 1.0e-15, 1.0e-15, initialStepType } ;
+
+                for (const double sign : { +1.0, -1.0, +1.0 })
+                {
+
+                    const double duration = sign * 100.0 ;
+
+                    const NumericalSolver::StateVector propagatedStateVector = numericalSolver.integrateStateForDuration({ 0.0, 1.0 }, Duration::Seconds(duration), oscillator) ;
+
+                    EXPECT_GT(2e-8, std::abs(propagatedStateVector[0] - std::sin(duration))) ;
+                    EXPECT_GT(2e-8, std::abs(propagatedStateVector[1] - std::cos(duration))) ;
+
+                    Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+                    for (Size i = 1; i <= 10; ++i)
+                    {
+                        instantArray.add(startInstant + Duration::Seconds(duration * static_cast<double>(i) / 10.0)) ;
+                    }
+
+                    const Array<NumericalSolver::StateVector> propagatedStateVectorArray = numericalSolver.integrateStatesAtSortedInstants({ 0.0, 1.0 }, startInstant, instantArray, oscillator) ;
+
+                    ASSERT_EQ(instantArray.size(), propagatedStateVectorArray.size()) ;
+
+                    for (Size i = 0; i < instantArray.size(); ++i)
+                    {
+
+                        const double time = (instantArray[i] - startInstant).inSeconds() ;
+
+                        EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][0] - std::sin(time))) ;
+                        EXPECT_GT(2e-8, std::abs(propagatedStateVectorArray[i][1] - std::cos(time))) ;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    // Starting from a poor time step guess, the estimated initial time step saves the step size ramp-up
+
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 7000.0e3, 0.0, 0.0, 0.0, 5335.865450622126, 5335.865450622126 } ;
+
+        for (const auto& stepperType : stepperTypes)
+        {
+
+            // Far too small, and far too large
+
+            for (const double timeStep : { 1.0e-6, 1.0e3 })
+            {
+
+                NumericalSolver userDefinedNumericalSolver = { NumericalSolver::LogType::NoLog, stepperType, timeStep, 1.0e-12, 1.0e-12 } ;
+                NumericalSolver automaticNumericalSolver = { NumericalSolver::LogType::NoLog, stepperType, timeStep, 1.0e-12, 1.0e-12, NumericalSolver::InitialStepType::Automatic } ;
+
+                const NumericalSolver::StateVector userDefinedStateVector = userDefinedNumericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(300.0), twoBody) ;
+                const NumericalSolver::StateVector automaticStateVector = automaticNumericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(300.0), twoBody) ;
+
+                for (Size i = 0; i < 3; ++i)
+                {
+                    EXPECT_GT(1e-3, std::abs(automaticStateVector[i] - userDefinedStateVector[i])) ;
+                    EXPECT_GT(1e-6, std::abs(automaticStateVector[i + 3] - userDefinedStateVector[i + 3])) ;
+                }
+
+                EXPECT_GT(userDefinedNumericalSolver.getStatistics().getEvaluationCount(), automaticNumericalSolver.getStatistics().getEvaluationCount()) ;
+
+            }
+
+        }
+
+    }
+
+    // Repeated integrations to nearby instants, as when computing states one at a time, are warm started from the step size reached previously
+
+    {
+
+        const NumericalSolver::StateVector currentStateVector = { 4000.0e3, 5000.0e3, 2000.0e3, -5000.0, 2500.0, 3700.0 } ;
+
+        for (const auto& stepperType : stepperTypes)
+        {
+
+            NumericalSolver userDefinedNumericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 1.0e-2, 1.0e-12, 1.0e-12 } ;
+            NumericalSolver warmStartNumericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 1.0e-2, 1.0e-12, 1.0e-12, NumericalSolver::InitialStepType::WarmStart } ;
+
+            for (Size i = 0; i < 20; ++i)
+            {
+
+                const Duration duration = Duration::Seconds(600.0 + (10.0 * static_cast<double>(i))) ;
+
+                const NumericalSolver::StateVector userDefinedStateVector = userDefinedNumericalSolver.integrateStateForDuration(currentStateVector, duration, twoBody) ;
+                const NumericalSolver::StateVector warmStartStateVector = warmStartNumericalSolver.integrateStateForDuration(currentStateVector, duration, twoBody) ;
+
+                for (Size j = 0; j < 3; ++j)
+                {
+                    EXPECT_GT(1e-3, std::abs(warmStartStateVector[j] - userDefinedStateVector[j])) ;
+                    EXPECT_GT(1e-6, std::abs(warmStartStateVector[j + 3] - userDefinedStateVector[j + 3])) ;
+                }
+
+            }
+
+            EXPECT_GT(userDefinedNumericalSolver.getStatistics().getEvaluationCount(), warmStartNumericalSolver.getStatistics().getEvaluationCount()) ;
+
+            // Once reset, the warm start estimates the initial time step again
+
+            const NumericalSolver automaticNumericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 1.0e-2, 1.0e-12, 1.0e-12, NumericalSolver::InitialStepType::Automatic } ;
+
+            automaticNumericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(600.0), twoBody) ;
+
+            warmStartNumericalSolver.resetWarmStart() ;
+            warmStartNumericalSolver.resetStatistics() ;
+
+            warmStartNumericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(600.0), twoBody) ;
+
+            EXPECT_EQ(automaticNumericalSolver.getStatistics().getEvaluationCount(), warmStartNumericalSolver.getStatistics().getEvaluationCount()) ;
+
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithObserver)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+    using ostk::astro::numericalsolver::observers::Callback ;
+    using ostk::astro::numericalsolver::observers::RingBuffer ;
+
+    const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+
+    const auto systemOfEquations = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+    {
+        dxdt[0] = x[1] ;
+        dxdt[1] = -x[0] ;
+    } ;
+
+    // Ring buffer keeps the most recent steps, with their states matching the analytical solution
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        const Shared<RingBuffer> ringBufferSPtr = std::make_shared<RingBuffer>(10) ;
+
+        const NumericalSolver::StateVector propagatedStateVector = numericalSolver.integrateStateForDuration(currentStateVector, Duration::Seconds(1000.0), systemOfEquations, ringBufferSPtr) ;
+
+        EXPECT_EQ(10, ringBufferSPtr->getSize()) ;
+        EXPECT_LT(10, ringBufferSPtr->getNotificationCount()) ;
+
+        const Array<double> times = ringBufferSPtr->getTimes() ;
+        const Array<NumericalSolver::StateVector> stateVectors = ringBufferSPtr->getStateVectors() ;
+
+        EXPECT_EQ(1000.0, times.accessLast()) ;
+        EXPECT_EQ(propagatedStateVector, stateVectors.accessLast()) ;
+
+        for (Size i = 0; i < times.size(); ++i)
+        {
+
+            EXPECT_GT(2e-8, std::abs(stateVectors[i][0] - std::sin(times[i]))) ;
+            EXPECT_GT(2e-8, std::abs(stateVectors[i][1] - std::cos(times[i]))) ;
+
+        }
+
+    }
+
+    // Callback with decimation, at requested instants
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        const Instant startInstant = Instant::J2000() ;
+
+        Array<Instant> instantArray = Array<Instant>::Empty() ;
+
+        for (Size i = 1; i <= 10; ++i)
+        {
+            instantArray.add(startInstant + Duration::Seconds(-10.0 * static_cast<double>(i))) ;
+        }
+
+        Array<double> times = Array<double>::Empty() ;
+
+        const Shared<Callback> callbackSPtr = std::make_shared<Callback>([&times] (const Callback::StateVector&, const double t) -> void { times.add(t) ; }, 5) ;
+
+        numericalSolver.integrateStatesAtSortedInstants(currentStateVector, startInstant, instantArray, systemOfEquations, callbackSPtr) ;
+
+        EXPECT_EQ(Array<double>({ 0.0, -50.0, -100.0 }), times) ;
+
+        // Observer is reset at the start of each integration
+
+        times.clear() ;
+
+        numericalSolver.integrateStatesAtSortedInstants(currentStateVector, startInstant, instantArray, systemOfEquations, callbackSPtr) ;
+
+        EXPECT_EQ(Array<double>({ 0.0, -50.0, -100.0 }), times) ;
+
+    }
+
+    // Fixed-size state vector
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        const Shared<RingBuffer> ringBufferSPtr = std::make_shared<RingBuffer>(1) ;
+
+        const NumericalSolver::FixedStateVector<2> propagatedStateVector = numericalSolver.integrateStateForDuration<2>
+        (
+            { 0.0, 1.0 },
+            Duration::Seconds(100.0),
+            [] (const NumericalSolver::FixedStateVector<2>& x, NumericalSolver::FixedStateVector<2>& dxdt, const double) -> void
+            {
+                dxdt[0] = x[1] ;
+                dxdt[1] = -x[0] ;
+            },
+            ringBufferSPtr
+        ) ;
+
+        ASSERT_EQ(1, ringBufferSPtr->getSize()) ;
+
+        EXPECT_EQ(100.0, ringBufferSPtr->getTimes()[0]) ;
+        EXPECT_EQ(NumericalSolver::StateVector({ propagatedStateVector[0], propagatedStateVector[1] }), ringBufferSPtr->getStateVectors()[0]) ;
+
+    }
+
+}
+
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateWithEvents)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::types::Shared ;
+    using ostk::core::ctnr::Pair ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+    using ostk::astro::numericalsolver::Event ;
+
+    const NumericalSolver::StateVector currentStateVector = { 0, 1 } ;
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = [] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double) -> void
+    {
+        dxdt[0] = x[1] ;
+        dxdt[1] = -x[0] ;
+    } ;
+
+    // x = sin(t) crosses zero increasingly at 2k.pi, and decreasingly at (2k + 1).pi
+    const Shared<const Event> increasingZeroEventSPtr = std::make_shared<Event>("Increasing Zero", [] (const Event::StateVector& x, const double) -> double { return x[0] ; }, Event::Direction::Increasing) ;
+    const Shared<const Event> decreasingZeroEventSPtr = std::make_shared<Event>("Decreasing Zero", [] (const Event::StateVector& x, const double) -> double { return x[0] ; }, Event::Direction::Decreasing) ;
+
+    // v = cos(t) crosses -0.5 increasingly at 4.pi / 3
+    const Shared<const Event> terminalEventSPtr = std::make_shared<Event>("Terminal", [] (const Event::StateVector& x, const double) -> double { return x[1] + 0.5 ; }, Event::Direction::Increasing, true) ;
+
+    const Array<NumericalSolver::StepperType> stepperTypes =
+    {
+        NumericalSolver::StepperType::RungeKuttaCashKarp54,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        NumericalSolver::StepperType::AdamsBashforthMoulton,
+        NumericalSolver::StepperType::BulirschStoer,
+        NumericalSolver::StepperType::BulirschStoerDenseOutput,
+        NumericalSolver::StepperType::RungeKuttaNystrom64
+    } ;
+
+    for (const auto& stepperType : stepperTypes)
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 5.0, 1.0e-15, 1.0e-15 } ;
+
+        // Non-terminal events, forward and backward in time, all located in a single pass
+        {
+
+            for (const double sign : { +1.0, -1.0 })
+            {
+
+                const Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsForDuration
+                (
+                    currentStateVector,
+                    Duration::Seconds(sign * 13.0),
+                    systemOfEquations,
+                    { increasingZeroEventSPtr, decreasingZeroEventSPtr }
+                ) ;
+
+                EXPECT_GT(1e-9, std::abs(stateAndOccurrences.first[0] - std::sin(sign * 13.0))) ;
+                EXPECT_GT(1e-9, std::abs(stateAndOccurrences.first[1] - std::cos(sign * 13.0))) ;
+
+                const Array<Event::Occurrence>& occurrences = stateAndOccurrences.second ;
+
+                ASSERT_EQ(4, occurrences.size()) ;
+
+                for (Size i = 0 ; i < occurrences.size() ; ++i)
+                {
+
+                    const double expectedTime = sign * static_cast<double>(i + 1) * M_PI ;
+
+                    // Directions are with respect to time: sin decreases through zero at +/- pi, +/- 3.pi, and increases at +/- 2.pi, +/- 4.pi
+                    const Size expectedEventIndex = (i % 2 == 0) ? 1 : 0 ;
+
+                    EXPECT_EQ(expectedEventIndex, occurrences[i].eventIndex) ;
+                    EXPECT_GT(1e-8, std::abs(occurrences[i].time - expectedTime)) << NumericalSolver::StringFromStepperType(stepperType) ;
+                    EXPECT_GT(1e-8, std::abs(occurrences[i].stateVector[0])) << NumericalSolver::StringFromStepperType(stepperType) ;
+
+                }
+
+            }
+
+        }
+
+        // Terminal event stops the integration
+        {
+
+            const Instant startInstant = Instant::J2000() ;
+
+            const Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsFromInstantToInstant
+            (
+                currentStateVector,
+                startInstant,
+                startInstant + Duration::Seconds(13.0),
+                systemOfEquations,
+                { increasingZeroEventSPtr, decreasingZeroEventSPtr, terminalEventSPtr }
+            ) ;
+
+            const double terminalTime = 4.0 * M_PI / 3.0 ;
+
+            const Array<Event::Occurrence>& occurrences = stateAndOccurrences.second ;
+
+            ASSERT_EQ(2, occurrences.size()) ;
+
+            EXPECT_EQ(1, occurrences[0].eventIndex) ;
+            EXPECT_GT(1e-8, std::abs(occurrences[0].time - M_PI)) ;
+
+            EXPECT_EQ(2, occurrences[1].eventIndex) ;
+            EXPECT_GT(1e-8, std::abs(occurrences[1].time - terminalTime)) << NumericalSolver::StringFromStepperType(stepperType) ;
+
+            EXPECT_EQ(occurrences[1].stateVector, stateAndOccurrences.first) ;
+            EXPECT_GT(1e-8, std::abs(stateAndOccurrences.first[0] - std::sin(terminalTime))) ;
+            EXPECT_GT(1e-8, std::abs(stateAndOccurrences.first[1] + 0.5)) ;
+
+        }
+
+        // Events a microsecond apart within a step, on different components of the state, are reported in chronological order
+        {
+
+            const double firstTime = 0.7 ;
+            const double secondTime = firstTime + 1e-6 ;
+
+            const Shared<const Event> positionEventSPtr = std::make_shared<Event>("Position", [firstTime] (const Event::StateVector& x, const double) -> double { return x[0] - std::sin(firstTime) ; }, Event::Direction::Increasing) ;
+            const Shared<const Event> velocityEventSPtr = std::make_shared<Event>("Velocity", [secondTime] (const Event::StateVector& x, const double) -> double { return std::cos(secondTime) - x[1] ; }, Event::Direction::Increasing) ;
+
+            const Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsForDuration(currentStateVector, Duration::Seconds(1.5), systemOfEquations, { velocityEventSPtr, positionEventSPtr }) ;
+
+            const Array<Event::Occurrence>& occurrences = stateAndOccurrences.second ;
+
+            ASSERT_EQ(2, occurrences.size()) ;
+
+            EXPECT_EQ(1, occurrences[0].eventIndex) << NumericalSolver::StringFromStepperType(stepperType) ;
+            EXPECT_GT(1e-8, std::abs(occurrences[0].time - firstTime)) << NumericalSolver::StringFromStepperType(stepperType) ;
+
+            EXPECT_EQ(0, occurrences[1].eventIndex) << NumericalSolver::StringFromStepperType(stepperType) ;
+            EXPECT_GT(1e-8, std::abs(occurrences[1].time - secondTime)) << NumericalSolver::StringFromStepperType(stepperType) ;
+
+        }
+
+        // Zero duration
+        {
+
+            const Pair<NumericalSolver::StateVector, Array<Event::Occurrence>> stateAndOccurrences = numericalSolver.integrateStateWithEventsForDuration(currentStateVector, Duration::Zero(), systemOfEquations, { increasingZeroEventSPtr }) ;
+
+            EXPECT_EQ(currentStateVector, stateAndOccurrences.first) ;
+            EXPECT_TRUE(stateAndOccurrences.second.isEmpty()) ;
+
+        }
+
+        // Undefined event
+        {
+
+            EXPECT_ANY_THROW(numericalSolver.integrateStateWithEventsForDuration(currentStateVector, Duration::Seconds(1.0), systemOfEquations, { nullptr })) ;
+
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver, IntegrateEnsemble)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::physics::time::Instant ;
+    using ostk::physics::time::Duration ;
+
+    using ostk::astro::NumericalSolver ;
+
+    // Point mass and J2 gravity, evaluated for all samples at once
+
+    const double mu = 3.986004418e14 ;
+    const double equatorialRadius = 6378137.0 ;
+    const double j2 = 1.08262668e-3 ;
+
+    const auto ensembleSystemOfEquations = [=] (const NumericalSolver::EnsembleStateArray& x, NumericalSolver::EnsembleStateArray& dxdt, const double) -> void
+    {
+
+        const Eigen::ArrayXd r2 = x.col(0).square() + x.col(1).square() + x.col(2).square() ;
+        const Eigen::ArrayXd r = r2.sqrt() ;
+        const Eigen::ArrayXd muOverR3 = mu / (r2 * r) ;
+        const Eigen::ArrayXd z2OverR2 = x.col(2).square() / r2 ;
+        const Eigen::ArrayXd j2Factor = 1.5 * j2 * (equatorialRadius * equatorialRadius) / r2 ;
+
+        dxdt.col(0) = x.col(3) ;
+        dxdt.col(1) = x.col(4) ;
+        dxdt.col(2) = x.col(5) ;
+        dxdt.col(3) = -muOverR3 * x.col(0) * (1.0 + j2Factor * (1.0 - 5.0 * z2OverR2)) ;
+        dxdt.col(4) = -muOverR3 * x.col(1) * (1.0 + j2Factor * (1.0 - 5.0 * z2OverR2)) ;
+        dxdt.col(5) = -muOverR3 * x.col(2) * (1.0 + j2Factor * (3.0 - 5.0 * z2OverR2)) ;
+
+    } ;
+
+    const auto systemOfEquations = [&] (const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t) -> void
+    {
+
+        NumericalSolver::EnsembleStateArray ensembleDxdt(1, 6) ;
+
+        ensembleSystemOfEquations(Eigen::Map<const NumericalSolver::EnsembleStateArray>(x.data(), 1, 6), ensembleDxdt, t) ;
+
+        std::copy(ensembleDxdt.data(), ensembleDxdt.data() + 6, dxdt.begin()) ;
+
+    } ;
+
+    // Dispersed samples around a 700 km altitude, inclined circular orbit
+
+    const Size sampleCount = 50 ;
+
+    NumericalSolver::EnsembleStateArray initialEnsembleStateArray(sampleCount, 6) ;
+
+    for (Size i = 0; i < sampleCount; ++i)
+    {
+
+        const double dispersion = static_cast<double>(i) / static_cast<double>(sampleCount) ;
+
+        const double radius = equatorialRadius + 700.0e3 + 1.0e3 * dispersion ;
+        const double speed = std::sqrt(mu / radius) + dispersion ;
+
+        initialEnsembleStateArray.row(i) << radius, 0.0, 0.0, 0.0, speed * std::cos(1.7), speed * std::sin(1.7) ;
+
+    }
+
+    const Instant startInstant = Instant::J2000() ;
+
+    for (const auto stepperType : { NumericalSolver::StepperType::RungeKuttaCashKarp54, NumericalSolver::StepperType::RungeKuttaFehlberg78, NumericalSolver::StepperType::RungeKuttaDopri5, NumericalSolver::StepperType::AdamsBashforthMoulton, NumericalSolver::StepperType::BulirschStoer, NumericalSolver::StepperType::BulirschStoerDenseOutput, NumericalSolver::StepperType::RungeKuttaNystrom64, NumericalSolver::StepperType::Yoshida6 })
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, stepperType, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        const Array<Instant> instantArray = { startInstant + Duration::Seconds(-1000.0), startInstant + Duration::Seconds(-6000.0) } ;
+
+        const Array<NumericalSolver::EnsembleStateArray> ensembleStateArrays = numericalSolver.integrateEnsembleAtSortedInstants(initialEnsembleStateArray, startInstant, instantArray, ensembleSystemOfEquations) ;
+        const NumericalSolver::EnsembleStateArray ensembleStateArray = numericalSolver.integrateEnsembleFromInstantToInstant(initialEnsembleStateArray, startInstant, instantArray.accessLast(), ensembleSystemOfEquations) ;
+
+        ASSERT_EQ(instantArray.size(), ensembleStateArrays.size()) ;
+
+        EXPECT_GT(1e-3, (ensembleStateArrays.accessLast() - ensembleStateArray).abs().maxCoeff()) ;
+
+        // Compare each sample against its own integration
+
+        for (Size i = 0; i < sampleCount; i += 7)
+        {
+
+            NumericalSolver::StateVector initialStateVector(6) ;
+            Eigen::Map<Eigen::RowVectorXd>(initialStateVector.data(), 6) = initialEnsembleStateArray.row(i).matrix() ;
+
+            const Array<NumericalSolver::StateVector> stateVectors = numericalSolver.integrateStatesAtSortedInstants(initialStateVector, startInstant, instantArray, systemOfEquations) ;
+
+            for (Size j = 0; j < instantArray.size(); ++j)
+            {
+
+                for (Size k = 0; k < 3; ++k)
+                {
+
+                    EXPECT_GT(1e-3, std::abs(ensembleStateArrays[j](i, k) - stateVectors[j][k])) ;
+                    EXPECT_GT(1e-6, std::abs(ensembleStateArrays[j](i, k + 3) - stateVectors[j][k + 3])) ;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaCashKarp54, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        EXPECT_TRUE((initialEnsembleStateArray == numericalSolver.integrateEnsembleForDuration(initialEnsembleStateArray, Duration::Zero(), ensembleSystemOfEquations)).all()) ;
+        EXPECT_ANY_THROW(numericalSolver.integrateEnsembleAtSortedInstants(initialEnsembleStateArray, startInstant, Array<Instant>::Empty(), ensembleSystemOfEquations)) ;
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
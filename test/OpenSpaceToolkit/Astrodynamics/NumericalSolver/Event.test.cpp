@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Event.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Event.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event, Constructor)
+{
+
+    using ostk::astro::numericalsolver::Event ;
+
+    {
+
+        EXPECT_NO_THROW(Event("Event", [] (const Event::StateVector& x, const double) -> double { return x[0] ; })) ;
+        EXPECT_NO_THROW(Event("Event", [] (const Event::StateVector& x, const double) -> double { return x[0] ; }, Event::Direction::Increasing, true)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Event("Event", Event::Function())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event, StreamOperator)
+{
+
+    using ostk::astro::numericalsolver::Event ;
+
+    {
+
+        const Event event = { "Ascending Node", [] (const Event::StateVector& x, const double) -> double { return x[2] ; }, Event::Direction::Increasing } ;
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(std::cout << event << std::endl) ;
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event, Getters)
+{
+
+    using ostk::astro::numericalsolver::Event ;
+
+    {
+
+        const Event event = { "Ascending Node", [] (const Event::StateVector& x, const double t) -> double { return x[2] + t ; }, Event::Direction::Decreasing, true } ;
+
+        EXPECT_EQ("Ascending Node", event.getName()) ;
+        EXPECT_EQ(Event::Direction::Decreasing, event.getDirection()) ;
+        EXPECT_TRUE(event.isTerminal()) ;
+        EXPECT_EQ(5.0, event.evaluate({ 0.0, 0.0, 3.0 }, 2.0)) ;
+
+    }
+
+    {
+
+        const Event event = { "Event", [] (const Event::StateVector& x, const double) -> double { return x[0] ; } } ;
+
+        EXPECT_EQ(Event::Direction::Any, event.getDirection()) ;
+        EXPECT_FALSE(event.isTerminal()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event, IsCrossing)
+{
+
+    using ostk::astro::numericalsolver::Event ;
+
+    const Event::Function function = [] (const Event::StateVector& x, const double) -> double { return x[0] ; } ;
+
+    {
+
+        const Event event = { "Event", function, Event::Direction::Increasing } ;
+
+        EXPECT_TRUE(event.isCrossing(-1.0, 1.0)) ;
+        EXPECT_TRUE(event.isCrossing(-1.0, 0.0)) ;
+        EXPECT_FALSE(event.isCrossing(0.0, 1.0)) ;
+        EXPECT_FALSE(event.isCrossing(1.0, -1.0)) ;
+        EXPECT_FALSE(event.isCrossing(1.0, 2.0)) ;
+
+        // Backward in time, the function increases in time when it decreases in the order of integration
+        EXPECT_TRUE(event.isCrossing(1.0, -1.0, true)) ;
+        EXPECT_FALSE(event.isCrossing(-1.0, 1.0, true)) ;
+
+    }
+
+    {
+
+        const Event event = { "Event", function, Event::Direction::Decreasing } ;
+
+        EXPECT_TRUE(event.isCrossing(1.0, -1.0)) ;
+        EXPECT_TRUE(event.isCrossing(1.0, 0.0)) ;
+        EXPECT_FALSE(event.isCrossing(0.0, -1.0)) ;
+        EXPECT_FALSE(event.isCrossing(-1.0, 1.0)) ;
+
+        EXPECT_TRUE(event.isCrossing(-1.0, 1.0, true)) ;
+        EXPECT_FALSE(event.isCrossing(1.0, -1.0, true)) ;
+
+    }
+
+    {
+
+        const Event event = { "Event", function, Event::Direction::Any } ;
+
+        EXPECT_TRUE(event.isCrossing(1.0, -1.0)) ;
+        EXPECT_TRUE(event.isCrossing(-1.0, 1.0)) ;
+        EXPECT_TRUE(event.isCrossing(1.0, -1.0, true)) ;
+        EXPECT_TRUE(event.isCrossing(-1.0, 1.0, true)) ;
+        EXPECT_FALSE(event.isCrossing(1.0, 2.0)) ;
+        EXPECT_FALSE(event.isCrossing(0.0, 0.0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Event, StringFromDirection)
+{
+
+    using ostk::astro::numericalsolver::Event ;
+
+    {
+
+        EXPECT_EQ("Increasing", Event::StringFromDirection(Event::Direction::Increasing)) ;
+        EXPECT_EQ("Decreasing", Event::StringFromDirection(Event::Direction::Decreasing)) ;
+        EXPECT_EQ("Any", Event::StringFromDirection(Event::Direction::Any)) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/BinaryFile.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/BinaryFile.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile, Constructor)
+{
+
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::astro::numericalsolver::observers::BinaryFile ;
+
+    {
+
+        File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile_Constructor.bin")) ;
+
+        {
+
+            EXPECT_NO_THROW(BinaryFile binaryFile(file)) ;
+
+            const BinaryFile binaryFile = { file, 2, 100 } ;
+
+            EXPECT_EQ(2, binaryFile.getDecimation()) ;
+            EXPECT_EQ(file.toString(), binaryFile.getFile().toString()) ;
+
+        }
+
+        file.remove() ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(BinaryFile(File::Undefined())) ;
+        EXPECT_ANY_THROW(BinaryFile(File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile_Constructor.bin")), 1, 0)) ;
+        EXPECT_ANY_THROW(BinaryFile(File::Path(Path::Parse("/this/directory/does/not/exist/states.bin")))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile, Notify)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::fs::Path ;
+    using ostk::core::fs::File ;
+
+    using ostk::astro::numericalsolver::observers::BinaryFile ;
+
+    File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_BinaryFile_Notify.bin")) ;
+
+    // Small buffer size, to go through several background writes (decimation of 2)
+    {
+
+        BinaryFile binaryFile = { file, 2, 7 } ;
+
+        for (Size i = 0; i < 100; ++i)
+        {
+            binaryFile.notify({ static_cast<double>(i), 2.0 * static_cast<double>(i) }, 10.0 * static_cast<double>(i)) ;
+        }
+
+        // Remaining records are written on destruction
+
+    }
+
+    {
+
+        std::ifstream stream(file.getPath().toString(), std::ios::binary | std::ios::ate) ;
+
+        const std::streamsize byteCount = stream.tellg() ;
+
+        ASSERT_EQ(static_cast<std::streamsize>(50 * 3 * sizeof(double)), byteCount) ;
+
+        stream.seekg(0) ;
+
+        std::vector<double> data(50 * 3) ;
+        stream.read(reinterpret_cast<char*>(data.data()), byteCount) ;
+
+        for (Size j = 0; j < 50; ++j)
+        {
+
+            const double i = 2.0 * static_cast<double>(j) ;
+
+            EXPECT_EQ(10.0 * i, data[3 * j + 0]) ;
+            EXPECT_EQ(i, data[3 * j + 1]) ;
+            EXPECT_EQ(2.0 * i, data[3 * j + 2]) ;
+
+        }
+
+    }
+
+    file.remove() ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
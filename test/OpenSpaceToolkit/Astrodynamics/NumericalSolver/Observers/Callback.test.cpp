@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/Callback.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/Callback.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_Callback, Constructor)
+{
+
+    using ostk::astro::numericalsolver::observers::Callback ;
+
+    {
+
+        EXPECT_NO_THROW(Callback([] (const Callback::StateVector&, const double) -> void { })) ;
+        EXPECT_NO_THROW(Callback([] (const Callback::StateVector&, const double) -> void { }, 10)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Callback(Callback::Function())) ;
+        EXPECT_ANY_THROW(Callback([] (const Callback::StateVector&, const double) -> void { }, 0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_Callback, Notify)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::astro::numericalsolver::observers::Callback ;
+
+    {
+
+        Array<double> times = Array<double>::Empty() ;
+
+        Callback callback = { [&times] (const Callback::StateVector& x, const double t) -> void { EXPECT_EQ(t, x[0]) ; times.add(t) ; } } ;
+
+        for (Size i = 0; i < 5; ++i)
+        {
+            callback.notify({ static_cast<double>(i) }, static_cast<double>(i)) ;
+        }
+
+        EXPECT_EQ(Array<double>({ 0.0, 1.0, 2.0, 3.0, 4.0 }), times) ;
+        EXPECT_EQ(5, callback.getNotificationCount()) ;
+
+    }
+
+    {
+
+        Array<double> times = Array<double>::Empty() ;
+
+        Callback callback = { [&times] (const Callback::StateVector&, const double t) -> void { times.add(t) ; }, 3 } ;
+
+        for (Size i = 0; i < 10; ++i)
+        {
+            callback.notify({ 0.0 }, static_cast<double>(i)) ;
+        }
+
+        EXPECT_EQ(Array<double>({ 0.0, 3.0, 6.0, 9.0 }), times) ;
+        EXPECT_EQ(3, callback.getDecimation()) ;
+        EXPECT_EQ(10, callback.getNotificationCount()) ;
+
+        callback.reset() ;
+
+        EXPECT_EQ(0, callback.getNotificationCount()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
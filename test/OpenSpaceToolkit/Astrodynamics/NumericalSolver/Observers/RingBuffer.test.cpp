@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/RingBuffer.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Observers/RingBuffer.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_RingBuffer, Constructor)
+{
+
+    using ostk::astro::numericalsolver::observers::RingBuffer ;
+
+    {
+
+        EXPECT_NO_THROW(RingBuffer(10)) ;
+        EXPECT_NO_THROW(RingBuffer(10, 2)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(RingBuffer(0)) ;
+        EXPECT_ANY_THROW(RingBuffer(10, 0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Observers_RingBuffer, Notify)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::astro::numericalsolver::observers::RingBuffer ;
+
+    {
+
+        RingBuffer ringBuffer = { 3 } ;
+
+        EXPECT_EQ(3, ringBuffer.getCapacity()) ;
+        EXPECT_EQ(0, ringBuffer.getSize()) ;
+        EXPECT_TRUE(ringBuffer.getStateVectors().isEmpty()) ;
+        EXPECT_TRUE(ringBuffer.getTimes().isEmpty()) ;
+
+        ringBuffer.notify({ 0.0, -0.0 }, 0.0) ;
+        ringBuffer.notify({ 1.0, -1.0 }, 1.0) ;
+
+        EXPECT_EQ(2, ringBuffer.getSize()) ;
+        EXPECT_EQ(Array<double>({ 0.0, 1.0 }), ringBuffer.getTimes()) ;
+
+        for (Size i = 2; i < 5; ++i)
+        {
+            ringBuffer.notify({ static_cast<double>(i), -static_cast<double>(i) }, static_cast<double>(i)) ;
+        }
+
+        EXPECT_EQ(3, ringBuffer.getSize()) ;
+        EXPECT_EQ(Array<double>({ 2.0, 3.0, 4.0 }), ringBuffer.getTimes()) ;
+
+        const Array<RingBuffer::StateVector> stateVectors = ringBuffer.getStateVectors() ;
+
+        ASSERT_EQ(3, stateVectors.size()) ;
+        EXPECT_EQ(RingBuffer::StateVector({ 2.0, -2.0 }), stateVectors[0]) ;
+        EXPECT_EQ(RingBuffer::StateVector({ 3.0, -3.0 }), stateVectors[1]) ;
+        EXPECT_EQ(RingBuffer::StateVector({ 4.0, -4.0 }), stateVectors[2]) ;
+
+        EXPECT_ANY_THROW(ringBuffer.notify({ 5.0 }, 5.0)) ;
+
+        ringBuffer.clear() ;
+
+        EXPECT_EQ(0, ringBuffer.getSize()) ;
+        EXPECT_TRUE(ringBuffer.getTimes().isEmpty()) ;
+
+    }
+
+    {
+
+        RingBuffer ringBuffer = { 10, 4 } ;
+
+        for (Size i = 0; i < 10; ++i)
+        {
+            ringBuffer.notify({ static_cast<double>(i) }, static_cast<double>(i)) ;
+        }
+
+        EXPECT_EQ(Array<double>({ 0.0, 4.0, 8.0 }), ringBuffer.getTimes()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/NumericalSolver/Statistics.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/NumericalSolver/Statistics.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics, Constructor)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    {
+
+        EXPECT_NO_THROW(Statistics()) ;
+
+    }
+
+    {
+
+        const Statistics statistics ;
+
+        EXPECT_EQ(0, statistics.getEvaluationCount()) ;
+        EXPECT_EQ(0, statistics.getAcceptedStepCount()) ;
+        EXPECT_EQ(0, statistics.getRejectedStepCount()) ;
+        EXPECT_FALSE(statistics.getMinimumStepSize().isDefined()) ;
+        EXPECT_FALSE(statistics.getMaximumStepSize().isDefined()) ;
+        EXPECT_FALSE(statistics.getMeanStepSize().isDefined()) ;
+        EXPECT_EQ(0.0, statistics.getEvaluationWallTime().inSeconds()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics, EqualToOperator)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    {
+
+        Statistics statistics ;
+        Statistics otherStatistics ;
+
+        EXPECT_TRUE(statistics == otherStatistics) ;
+        EXPECT_FALSE(statistics != otherStatistics) ;
+
+        statistics.addRejectedStep() ;
+
+        EXPECT_FALSE(statistics == otherStatistics) ;
+        EXPECT_TRUE(statistics != otherStatistics) ;
+
+        otherStatistics.addRejectedStep() ;
+
+        EXPECT_TRUE(statistics == otherStatistics) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics, StreamOperator)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    {
+
+        Statistics statistics ;
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(std::cout << statistics << std::endl) ;
+
+        statistics.addAcceptedStep(10.0) ;
+
+        EXPECT_NO_THROW(std::cout << statistics << std::endl) ;
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics, Add)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    {
+
+        Statistics statistics ;
+
+        statistics.addEvaluation(0.5) ;
+        statistics.addEvaluation(0.25) ;
+        statistics.addEvaluation(0.25) ;
+
+        statistics.addAcceptedStep(10.0) ;
+        statistics.addAcceptedStep(-30.0) ;
+        statistics.addAcceptedStep(20.0) ;
+
+        statistics.addRejectedStep() ;
+
+        EXPECT_EQ(3, statistics.getEvaluationCount()) ;
+        EXPECT_EQ(3, statistics.getAcceptedStepCount()) ;
+        EXPECT_EQ(1, statistics.getRejectedStepCount()) ;
+        EXPECT_EQ(10.0, statistics.getMinimumStepSize().inSeconds()) ;
+        EXPECT_EQ(30.0, statistics.getMaximumStepSize().inSeconds()) ;
+        EXPECT_EQ(20.0, statistics.getMeanStepSize().inSeconds()) ;
+        EXPECT_EQ(1.0, statistics.getEvaluationWallTime().inSeconds()) ;
+
+        statistics.reset() ;
+
+        EXPECT_EQ(Statistics(), statistics) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Astrodynamics_NumericalSolver_Statistics, AdditionOperator)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    {
+
+        Statistics statistics ;
+
+        statistics.addEvaluation(1.0) ;
+        statistics.addAcceptedStep(10.0) ;
+        statistics.addAcceptedStep(20.0) ;
+
+        Statistics otherStatistics ;
+
+        otherStatistics.addEvaluation(2.0) ;
+        otherStatistics.addAcceptedStep(60.0) ;
+        otherStatistics.addRejectedStep() ;
+
+        const Statistics aggregatedStatistics = statistics + otherStatistics ;
+
+        EXPECT_EQ(2, aggregatedStatistics.getEvaluationCount()) ;
+        EXPECT_EQ(3, aggregatedStatistics.getAcceptedStepCount()) ;
+        EXPECT_EQ(1, aggregatedStatistics.getRejectedStepCount()) ;
+        EXPECT_EQ(10.0, aggregatedStatistics.getMinimumStepSize().inSeconds()) ;
+        EXPECT_EQ(60.0, aggregatedStatistics.getMaximumStepSize().inSeconds()) ;
+        EXPECT_EQ(30.0, aggregatedStatistics.getMeanStepSize().inSeconds()) ;
+        EXPECT_EQ(3.0, aggregatedStatistics.getEvaluationWallTime().inSeconds()) ;
+
+        // Aggregating empty statistics is neutral
+
+        EXPECT_EQ(statistics, statistics + Statistics()) ;
+        EXPECT_EQ(statistics, Statistics() + statistics) ;
+
+        statistics += otherStatistics ;
+
+        EXPECT_EQ(aggregatedStatistics, statistics) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,364 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Astrodynamics
+/// @file           OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.test.cpp
+/// @author         Antoine Paletta <antoine.paletta@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+using ostk::core::types::Shared ;
+using ostk::core::ctnr::Array ;
+
+using ostk::math::obj::Vector3d ;
+
+using ostk::physics::time::Scale ;
+using ostk::physics::time::Instant ;
+using ostk::physics::time::Duration ;
+using ostk::physics::time::Interval ;
+using ostk::physics::time::DateTime ;
+using ostk::physics::coord::Position ;
+using ostk::physics::coord::Velocity ;
+using ostk::physics::coord::Frame ;
+
+using ostk::astro::trajectory::State ;
+using ostk::astro::trajectory::models::Ephemeris ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris : public ::testing::Test
+{
+
+    protected:
+
+        // Circular orbit, with an analytic position, velocity and acceleration
+
+        const double radius_ = 7000000.0 ;
+        const double angularRate_ = std::sqrt(3.986004418e14 / (radius_ * radius_ * radius_)) ;
+
+        const Instant epoch_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC) ;
+        const Shared<const Frame> gcrfSPtr_ = Frame::GCRF() ;
+
+        Vector3d                calculatePositionAt                         (   const   double                      aTime                                       ) const
+        {
+            return radius_ * Vector3d(std::cos(angularRate_ * aTime), std::sin(angularRate_ * aTime), 0.0) ;
+        }
+
+        Vector3d                calculateVelocityAt                         (   const   double                      aTime                                       ) const
+        {
+            return (radius_ * angularRate_) * Vector3d(-std::sin(angularRate_ * aTime), std::cos(angularRate_ * aTime), 0.0) ;
+        }
+
+        Vector3d                calculateAccelerationAt                     (   const   double                      aTime                                       ) const
+        {
+            return -(angularRate_ * angularRate_) * this->calculatePositionAt(aTime) ;
+        }
+
+        State                   calculateStateAt                            (   const   double                      aTime                                       ) const
+        {
+            return { epoch_ + Duration::Seconds(aTime), Position::Meters(this->calculatePositionAt(aTime), gcrfSPtr_), Velocity::MetersPerSecond(this->calculateVelocityAt(aTime), gcrfSPtr_) } ;
+        }
+
+        // Nodes every aStep seconds, from aStartTime to anEndTime
+
+        Ephemeris               generateEphemeris                           (   const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   double                      aStep                                       ) const
+        {
+
+            Array<State> nodeStates = Array<State>::Empty() ;
+            Array<Vector3d> nodeAccelerations = Array<Vector3d>::Empty() ;
+
+            for (double time = aStartTime ; time <= anEndTime ; time += aStep)
+            {
+
+                nodeStates.add(this->calculateStateAt(time)) ;
+                nodeAccelerations.add(this->calculateAccelerationAt(time)) ;
+
+            }
+
+            return { nodeStates, nodeAccelerations } ;
+
+        }
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris, Constructor)
+{
+
+    {
+
+        EXPECT_NO_THROW(this->generateEphemeris(0.0, 600.0, 60.0)) ;
+
+        EXPECT_NO_THROW(Ephemeris ephemeris(Array<State>::Empty(), Array<Vector3d>::Empty()) ;) ;
+
+    }
+
+    {
+
+        const Array<State> nodeStates = { this->calculateStateAt(0.0), this->calculateStateAt(60.0) } ;
+
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, { this->calculateAccelerationAt(0.0) }) ;) ;
+
+    }
+
+    {
+
+        const Array<State> nodeStates = { this->calculateStateAt(60.0), this->calculateStateAt(0.0) } ;
+        const Array<Vector3d> nodeAccelerations = { this->calculateAccelerationAt(60.0), this->calculateAccelerationAt(0.0) } ;
+
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, nodeAccelerations) ;) ;
+
+    }
+
+    {
+
+        const Array<State> nodeStates = { this->calculateStateAt(0.0), this->calculateStateAt(0.0) } ;
+        const Array<Vector3d> nodeAccelerations = { this->calculateAccelerationAt(0.0), this->calculateAccelerationAt(0.0) } ;
+
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, nodeAccelerations) ;) ;
+
+    }
+
+    {
+
+        const Array<State> nodeStates = { this->calculateStateAt(0.0), State::Undefined() } ;
+        const Array<Vector3d> nodeAccelerations = { this->calculateAccelerationAt(0.0), this->calculateAccelerationAt(60.0) } ;
+
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, nodeAccelerations) ;) ;
+
+    }
+
+    {
+
+        const Array<State> nodeStates = { this->calculateStateAt(0.0), this->calculateStateAt(60.0).inFrame(Frame::ITRF()) } ;
+        const Array<Vector3d> nodeAccelerations = { this->calculateAccelerationAt(0.0), this->calculateAccelerationAt(60.0) } ;
+
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, nodeAccelerations) ;) ;
+
+    }
+
+    // Step polynomials
+
+    {
+
+        const Array<State> nodeStates = { this->calculateStateAt(0.0), this->calculateStateAt(60.0) } ;
+
+        const Ephemeris::StepPolynomial stepPolynomial = { { this->calculatePositionAt(0.0), this->calculatePositionAt(60.0) - this->calculatePositionAt(0.0) }, { this->calculateVelocityAt(0.0), this->calculateVelocityAt(60.0) - this->calculateVelocityAt(0.0) } } ;
+
+        EXPECT_NO_THROW(Ephemeris ephemeris(nodeStates, Array<Ephemeris::StepPolynomial> { stepPolynomial }) ;) ;
+        EXPECT_NO_THROW(Ephemeris ephemeris(Array<State>::Empty(), Array<Ephemeris::StepPolynomial>::Empty()) ;) ;
+
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, Array<Ephemeris::StepPolynomial>::Empty()) ;) ;
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, Array<Ephemeris::StepPolynomial> { stepPolynomial, stepPolynomial }) ;) ;
+        EXPECT_ANY_THROW(Ephemeris ephemeris(Array<State>::Empty(), Array<Ephemeris::StepPolynomial> { stepPolynomial }) ;) ;
+        EXPECT_ANY_THROW(Ephemeris ephemeris(nodeStates, Array<Ephemeris::StepPolynomial> { { Array<Vector3d>::Empty(), Array<Vector3d>::Empty() } }) ;) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris, EqualToOperator)
+{
+
+    {
+
+        const Ephemeris ephemeris = this->generateEphemeris(0.0, 600.0, 60.0) ;
+
+        EXPECT_TRUE(ephemeris == ephemeris) ;
+        EXPECT_FALSE(ephemeris != ephemeris) ;
+
+        EXPECT_FALSE(ephemeris == this->generateEphemeris(0.0, 600.0, 120.0)) ;
+        EXPECT_TRUE(ephemeris != this->generateEphemeris(0.0, 600.0, 120.0)) ;
+
+        EXPECT_FALSE(ephemeris == Ephemeris::Undefined()) ;
+        EXPECT_FALSE(Ephemeris::Undefined() == Ephemeris::Undefined()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris, IsDefined)
+{
+
+    {
+
+        EXPECT_TRUE(this->generateEphemeris(0.0, 600.0, 60.0).isDefined()) ;
+        EXPECT_TRUE(this->generateEphemeris(0.0, 0.0, 60.0).isDefined()) ;
+
+        EXPECT_FALSE(Ephemeris::Undefined().isDefined()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris, Getters)
+{
+
+    {
+
+        const Ephemeris ephemeris = this->generateEphemeris(0.0, 600.0, 60.0) ;
+
+        EXPECT_EQ(Interval::Closed(epoch_, epoch_ + Duration::Seconds(600.0)), ephemeris.getInterval()) ;
+        EXPECT_EQ(10, ephemeris.getStepCount()) ;
+
+        const Array<State> nodeStates = ephemeris.getNodeStateArray() ;
+
+        EXPECT_EQ(11, nodeStates.getSize()) ;
+        EXPECT_EQ(epoch_ + Duration::Seconds(300.0), nodeStates[5].getInstant()) ;
+        EXPECT_TRUE(nodeStates[5].getPosition().getCoordinates().isNear(this->calculatePositionAt(300.0), 1e-6)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Ephemeris::Undefined().getInterval()) ;
+        EXPECT_ANY_THROW(Ephemeris::Undefined().getStepCount()) ;
+        EXPECT_ANY_THROW(Ephemeris::Undefined().getNodeStateArray()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris, CalculateStateAt)
+{
+
+    {
+
+        const Ephemeris ephemeris = this->generateEphemeris(0.0, 600.0, 60.0) ;
+
+        for (double time = 0.0 ; time <= 600.0 ; time += 7.0)
+        {
+
+            const State state = ephemeris.calculateStateAt(epoch_ + Duration::Seconds(time)) ;
+
+            EXPECT_EQ(epoch_ + Duration::Seconds(time), state.getInstant()) ;
+            EXPECT_EQ(*gcrfSPtr_, *state.getPosition().accessFrame()) ;
+
+            EXPECT_GT(1e-3, (state.getPosition().getCoordinates() - this->calculatePositionAt(time)).norm()) ;
+            EXPECT_GT(1e-5, (state.getVelocity().getCoordinates() - this->calculateVelocityAt(time)).norm()) ;
+
+        }
+
+        // Nodes are reproduced
+
+        const State endState = ephemeris.calculateStateAt(epoch_ + Duration::Seconds(600.0)) ;
+
+        EXPECT_GT(1e-6, (endState.getPosition().getCoordinates() - this->calculatePositionAt(600.0)).norm()) ;
+        EXPECT_GT(1e-9, (endState.getVelocity().getCoordinates() - this->calculateVelocityAt(600.0)).norm()) ;
+
+    }
+
+    {
+
+        const Ephemeris ephemeris = this->generateEphemeris(0.0, 600.0, 60.0) ;
+
+        EXPECT_EQ(ephemeris.calculateStateAt(epoch_ + Duration::Seconds(90.0)), ephemeris.calculateStatesAt({ epoch_ + Duration::Seconds(90.0) })[0]) ;
+
+    }
+
+    // Step polynomials are evaluated at the normalized time within their step
+
+    {
+
+        const Vector3d startPosition = this->calculatePositionAt(0.0) ;
+        const Vector3d startVelocity = this->calculateVelocityAt(0.0) ;
+
+        const Array<State> nodeStates = { this->calculateStateAt(0.0), { epoch_ + Duration::Seconds(60.0), Position::Meters(startPosition + (60.0 * startVelocity), gcrfSPtr_), Velocity::MetersPerSecond(startVelocity, gcrfSPtr_) } } ;
+
+        const Ephemeris ephemeris = { nodeStates, Array<Ephemeris::StepPolynomial> { { { startPosition, 60.0 * startVelocity }, { startVelocity } } } } ;
+
+        const State state = ephemeris.calculateStateAt(epoch_ + Duration::Seconds(15.0)) ;
+
+        EXPECT_GT(1e-6, (state.getPosition().getCoordinates() - (startPosition + (15.0 * startVelocity))).norm()) ;
+        EXPECT_GT(1e-9, (state.getVelocity().getCoordinates() - startVelocity).norm()) ;
+
+    }
+
+    {
+
+        const Ephemeris ephemeris = this->generateEphemeris(0.0, 600.0, 60.0) ;
+
+        EXPECT_ANY_THROW(ephemeris.calculateStateAt(epoch_ - Duration::Seconds(1.0))) ;
+        EXPECT_ANY_THROW(ephemeris.calculateStateAt(epoch_ + Duration::Seconds(601.0))) ;
+        EXPECT_ANY_THROW(ephemeris.calculateStateAt(Instant::Undefined())) ;
+
+        EXPECT_ANY_THROW(Ephemeris::Undefined().calculateStateAt(epoch_)) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Models_Ephemeris, Add)
+{
+
+    {
+
+        Ephemeris ephemeris = this->generateEphemeris(0.0, 300.0, 60.0) ;
+
+        ephemeris.add(this->generateEphemeris(300.0, 600.0, 60.0)) ;
+
+        EXPECT_EQ(this->generateEphemeris(0.0, 600.0, 60.0), ephemeris) ;
+
+    }
+
+    {
+
+        Ephemeris ephemeris = this->generateEphemeris(300.0, 600.0, 60.0) ;
+
+        ephemeris.add(this->generateEphemeris(0.0, 300.0, 60.0)) ;
+
+        EXPECT_EQ(Interval::Closed(epoch_, epoch_ + Duration::Seconds(600.0)), ephemeris.getInterval()) ;
+        EXPECT_EQ(10, ephemeris.getStepCount()) ;
+
+        EXPECT_GT(1e-3, (ephemeris.calculateStateAt(epoch_ + Duration::Seconds(450.0)).getPosition().getCoordinates() - this->calculatePositionAt(450.0)).norm()) ;
+
+    }
+
+    {
+
+        Ephemeris ephemeris = Ephemeris::Undefined() ;
+
+        ephemeris.add(this->generateEphemeris(0.0, 300.0, 60.0)) ;
+
+        EXPECT_EQ(this->generateEphemeris(0.0, 300.0, 60.0), ephemeris) ;
+
+    }
+
+    {
+
+        Ephemeris ephemeris = this->generateEphemeris(0.0, 300.0, 60.0) ;
+
+        EXPECT_ANY_THROW(ephemeris.add(this->generateEphemeris(360.0, 600.0, 60.0))) ;
+        EXPECT_ANY_THROW(ephemeris.add(Ephemeris::Undefined())) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,7 @@
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 
 #include <numeric>
+#include <thread>
 
 #include <Global.test.hpp>
 
@@ -56,6 +57,7 @@ using ostk::core::fs::Path ;
 using ostk::core::fs::File ;
 using ostk::core::types::String ;
 using ostk::core::types::Integer ;
+using ostk::core::types::Size ;
 
 using ostk::math::obj::Vector3d ;
 using ostk::math::obj::Matrix3d ;
@@ -90,6 +92,7 @@ using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
 using ostk::astro::NumericalSolver ;
 
 using ostk::astro::trajectory::orbit::models::Propagated ;
+using ostk::astro::trajectory::models::Ephemeris ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /* UNIT TESTS */
@@ -2525,4 +2528,195 @@ TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, Propa
 
 }
 
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, GetStatistics)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(100.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }) ;
+
+    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+
+    {
+
+        Propagated propagatedModel = { satelliteDynamics, defaultnumericalSolver_, defaultState_ } ;
+
+        EXPECT_EQ(Statistics(), propagatedModel.getStatistics()) ;
+
+        propagatedModel.calculateStateAt(defaultState_.getInstant() + Duration::Minutes(30.0)) ;
+
+        const Statistics statistics = propagatedModel.getStatistics() ;
+
+        EXPECT_LT(0, statistics.getEvaluationCount()) ;
+        EXPECT_LT(0, statistics.getAcceptedStepCount()) ;
+        EXPECT_EQ(statistics, propagatedModel.accessPropagator().getStatistics()) ;
+
+        propagatedModel.calculateStateAt(defaultState_.getInstant() - Duration::Minutes(30.0)) ;
+
+        EXPECT_LT(statistics.getAcceptedStepCount(), propagatedModel.getStatistics().getAcceptedStepCount()) ;
+
+        propagatedModel.resetStatistics() ;
+
+        EXPECT_EQ(Statistics(), propagatedModel.getStatistics()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, RetainEphemeris)
+{
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+    const SatelliteDynamics satelliteDynamics = { defaultEnvironment_, satelliteSystem } ;
+
+    {
+
+        const Propagated propagatedModel = { satelliteDynamics, defaultnumericalSolver_, defaultState_ } ;
+        const Propagated retainedPropagatedModel = { satelliteDynamics, defaultnumericalSolver_, defaultState_, true } ;
+
+        EXPECT_FALSE(propagatedModel.isEphemerisRetained()) ;
+        EXPECT_TRUE(retainedPropagatedModel.isEphemerisRetained()) ;
+
+        EXPECT_FALSE(retainedPropagatedModel.getEphemeris().isDefined()) ;
+
+        // Same states as without the ephemeris
+
+        const Array<Instant> instants = Interval::Closed(defaultState_.getInstant() - Duration::Minutes(20.0), defaultState_.getInstant() + Duration::Minutes(40.0)).generateGrid(Duration::Seconds(30.0)) ;
+
+        const Array<State> states = propagatedModel.calculateStatesAt(instants) ;
+        const Array<State> retainedStates = retainedPropagatedModel.calculateStatesAt(instants) ;
+
+        ASSERT_EQ(states.getSize(), retainedStates.getSize()) ;
+
+        for (size_t i = 0 ; i < states.getSize() ; ++i)
+        {
+
+            EXPECT_EQ(states[i].getInstant(), retainedStates[i].getInstant()) ;
+
+            EXPECT_GT(1e-3, (states[i].getPosition().getCoordinates() - retainedStates[i].getPosition().getCoordinates()).norm()) ;
+            EXPECT_GT(1e-6, (states[i].getVelocity().getCoordinates() - retainedStates[i].getVelocity().getCoordinates()).norm()) ;
+
+        }
+
+        EXPECT_EQ(Interval::Closed(instants.accessFirst(), instants.accessLast()), retainedPropagatedModel.getEphemeris().getInterval()) ;
+
+        // Instants within the ephemeris are not integrated again
+
+        const Size acceptedStepCount = retainedPropagatedModel.getStatistics().getAcceptedStepCount() ;
+
+        retainedPropagatedModel.calculateStateAt(defaultState_.getInstant() + Duration::Seconds(1234.5)) ;
+
+        EXPECT_EQ(acceptedStepCount, retainedPropagatedModel.getStatistics().getAcceptedStepCount()) ;
+
+        // The ephemeris is grown on both sides
+
+        const Instant earlierInstant = defaultState_.getInstant() - Duration::Minutes(30.0) ;
+        const Instant laterInstant = defaultState_.getInstant() + Duration::Hours(1.0) ;
+
+        const Array<State> extendedStates = retainedPropagatedModel.calculateStatesAt({ earlierInstant, laterInstant }) ;
+
+        EXPECT_LT(acceptedStepCount, retainedPropagatedModel.getStatistics().getAcceptedStepCount()) ;
+
+        EXPECT_EQ(Interval::Closed(earlierInstant, laterInstant), retainedPropagatedModel.getEphemeris().getInterval()) ;
+
+        EXPECT_GT(1e-3, (extendedStates[0].getPosition().getCoordinates() - propagatedModel.calculateStateAt(earlierInstant).getPosition().getCoordinates()).norm()) ;
+        EXPECT_GT(1e-3, (extendedStates[1].getPosition().getCoordinates() - propagatedModel.calculateStateAt(laterInstant).getPosition().getCoordinates()).norm()) ;
+
+    }
+
+    {
+
+        Propagated retainedPropagatedModel = { satelliteDynamics, defaultnumericalSolver_, defaultState_, true } ;
+
+        retainedPropagatedModel.calculateStateAt(defaultState_.getInstant() + Duration::Minutes(10.0)) ;
+
+        EXPECT_TRUE(retainedPropagatedModel.getEphemeris().isDefined()) ;
+
+        retainedPropagatedModel.setCachedStateArray({ defaultState_ }) ;
+
+        EXPECT_FALSE(retainedPropagatedModel.getEphemeris().isDefined()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagated, RetainEphemerisConcurrently)
+{
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+    const SatelliteDynamics satelliteDynamics = { defaultEnvironment_, satelliteSystem } ;
+
+    // One model, shared by all the threads, each growing the ephemeris on either side
+
+    const Propagated retainedPropagatedModel = { satelliteDynamics, defaultnumericalSolver_, defaultState_, true } ;
+
+    const Size threadCount = 8 ;
+
+    Array<Array<Instant>> instantArrays = Array<Array<Instant>>::Empty() ;
+    Array<Array<State>> referenceStateArrays = Array<Array<State>>::Empty() ;
+
+    const Propagated propagatedModel = { satelliteDynamics, defaultnumericalSolver_, defaultState_ } ;
+
+    for (Size i = 0 ; i < threadCount ; ++i)
+    {
+
+        const Duration offset = Duration::Minutes(((i % 2) == 0 ? +10.0 : -10.0) * i) ;
+
+        const Array<Instant> instants = Interval::Closed(defaultState_.getInstant() + offset - Duration::Minutes(15.0), defaultState_.getInstant() + offset + Duration::Minutes(15.0)).generateGrid(Duration::Minutes(1.0)) ;
+
+        instantArrays.add(instants) ;
+        referenceStateArrays.add(propagatedModel.calculateStatesAt(instants)) ;
+
+    }
+
+    Array<Array<State>> stateArrays(threadCount, Array<State>::Empty()) ;
+
+    std::vector<std::thread> threads ;
+
+    for (Size i = 0 ; i < threadCount ; ++i)
+    {
+
+        threads.emplace_back([&retainedPropagatedModel, &instantArrays, &stateArrays, i] () -> void
+        {
+            stateArrays[i] = retainedPropagatedModel.calculateStatesAt(instantArrays[i]) ;
+        }) ;
+
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join() ;
+    }
+
+    for (Size i = 0 ; i < threadCount ; ++i)
+    {
+
+        ASSERT_EQ(referenceStateArrays[i].getSize(), stateArrays[i].getSize()) ;
+
+        for (Size k = 0 ; k < stateArrays[i].getSize() ; ++k)
+        {
+
+            EXPECT_EQ(referenceStateArrays[i][k].getInstant(), stateArrays[i][k].getInstant()) ;
+
+            EXPECT_GT(1e-3, (referenceStateArrays[i][k].accessPosition().accessCoordinates() - stateArrays[i][k].accessPosition().accessCoordinates()).norm()) ;
+            EXPECT_GT(1e-6, (referenceStateArrays[i][k].accessVelocity().accessCoordinates() - stateArrays[i][k].accessVelocity().accessCoordinates()).norm()) ;
+
+        }
+
+    }
+
+    // The ephemeris covers the union of the requested instants
+
+    const Ephemeris ephemeris = retainedPropagatedModel.getEphemeris() ;
+
+    EXPECT_EQ(instantArrays[7].accessFirst(), ephemeris.getInterval().accessStart()) ;
+    EXPECT_EQ(instantArrays[6].accessLast(), ephemeris.getInterval().accessEnd()) ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
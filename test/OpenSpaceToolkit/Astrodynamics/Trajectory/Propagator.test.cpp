@@ -8,8 +8,10 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Models/Ephemeris.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/SatelliteDynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/Dynamics/ComposedDynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
@@ -42,6 +44,7 @@
 #include <OpenSpaceToolkit/Core/Types/Integer.hpp>
 
 #include <numeric>
+#include <thread>
 
 #include <Global.test.hpp>
 
@@ -84,9 +87,15 @@ using ostk::physics::env::Object ;
 using ostk::astro::trajectory::State ;
 using ostk::astro::flight::system::SatelliteSystem ;
 using ostk::astro::flight::system::dynamics::SatelliteDynamics ;
+using ostk::astro::flight::system::dynamics::ComposedDynamics ;
+using ostk::astro::flight::system::dynamics::ForceModel ;
+using ostk::astro::flight::system::dynamics::forcemodels::CentralBodyGravity ;
+using ostk::astro::flight::system::dynamics::terms::PointMassGravity ;
+using ostk::astro::flight::system::dynamics::terms::J2Gravity ;
 using ostk::astro::NumericalSolver ;
 
 using ostk::astro::trajectory::Propagator ;
+using ostk::astro::trajectory::models::Ephemeris ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /* UNIT TESTS */
@@ -147,6 +156,17 @@ TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Equal
 
     }
 
+    {
+
+        const Array<Shared<ForceModel>> forceModels = { std::make_shared<CentralBodyGravity>(environment_.accessCelestialObjectWithName("Earth")) } ;
+        const SatelliteDynamics satelliteDynamics_1 = { environment_, satelliteSystem, forceModels } ;
+
+        const Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+        const Propagator propagator_1 = { satelliteDynamics_1, numericalSolver_ } ;
+        EXPECT_FALSE(propagator == propagator_1) ;
+
+    }
+
 }
 
 TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, NotEqualToOperator)
@@ -445,6 +465,990 @@ TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, Calcu
 /* Force model validation tests */
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStateAndStateTransitionMatrixAt)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Pair ;
+
+    using ostk::math::obj::MatrixXd ;
+    using ostk::math::obj::VectorXd ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    // Central body with J2 only, for which the analytic partials are complete
+    const Array<Shared<Object>> objects = { std::make_shared<Earth>(Earth::EGM2008(2, 0)) } ;
+
+    const Environment customEnvironment = Environment(Instant::J2000(), objects) ;
+
+    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+
+    const Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC) ;
+    const Instant endInstant = Instant::DateTime(DateTime(2018, 1, 2, 1, 0, 0), Scale::UTC) ;
+
+    const State state = { startInstant, Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+    const Pair<State, MatrixXd> stateAndStateTransitionMatrix = propagator.calculateStateAndStateTransitionMatrixAt(state, endInstant) ;
+
+    const State& endState = stateAndStateTransitionMatrix.first ;
+    const MatrixXd& stateTransitionMatrix = stateAndStateTransitionMatrix.second ;
+
+    ASSERT_EQ(6, stateTransitionMatrix.rows()) ;
+    ASSERT_EQ(6, stateTransitionMatrix.cols()) ;
+
+    // The propagated state matches the state only propagation
+
+    const State referenceEndState = propagator.calculateStateAt(state, endInstant) ;
+
+    EXPECT_EQ(endInstant, endState.getInstant()) ;
+    EXPECT_GT(1e-6, (endState.getPosition().accessCoordinates() - referenceEndState.getPosition().accessCoordinates()).norm()) ;
+    EXPECT_GT(1e-9, (endState.getVelocity().accessCoordinates() - referenceEndState.getVelocity().accessCoordinates()).norm()) ;
+
+    // The state transition matrix matches central finite differences
+
+    const VectorXd startCoordinates = state.getCoordinates() ;
+    const Array<double> perturbations = { 1.0, 1.0, 1.0, 1.0e-3, 1.0e-3, 1.0e-3 } ;
+
+    for (Size column = 0 ; column < 6 ; ++column)
+    {
+
+        VectorXd positiveCoordinates = startCoordinates ;
+        VectorXd negativeCoordinates = startCoordinates ;
+
+        positiveCoordinates[column] += perturbations[column] ;
+        negativeCoordinates[column] -= perturbations[column] ;
+
+        const State positiveState = { startInstant, Position::Meters(positiveCoordinates.head<3>(), gcrfSPtr_), Velocity::MetersPerSecond(positiveCoordinates.tail<3>(), gcrfSPtr_) } ;
+        const State negativeState = { startInstant, Position::Meters(negativeCoordinates.head<3>(), gcrfSPtr_), Velocity::MetersPerSecond(negativeCoordinates.tail<3>(), gcrfSPtr_) } ;
+
+        const VectorXd finiteDifferenceColumn = (propagator.calculateStateAt(positiveState, endInstant).getCoordinates() - propagator.calculateStateAt(negativeState, endInstant).getCoordinates()) / (2.0 * perturbations[column]) ;
+
+        EXPECT_GT(1e-5 * finiteDifferenceColumn.norm(), (stateTransitionMatrix.col(column) - finiteDifferenceColumn).norm()) ;
+
+    }
+
+    // Zero duration returns identity
+    {
+
+        const Pair<State, MatrixXd> identityStateAndStateTransitionMatrix = propagator.calculateStateAndStateTransitionMatrixAt(state, startInstant) ;
+
+        EXPECT_TRUE(identityStateAndStateTransitionMatrix.second.isApprox(MatrixXd::Identity(6, 6))) ;
+
+    }
+
+    // Undefined state
+    {
+
+        EXPECT_ANY_THROW(propagator.calculateStateAndStateTransitionMatrixAt(State::Undefined(), endInstant)) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, GetStatistics)
+{
+
+    using ostk::astro::numericalsolver::Statistics ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }) ;
+
+    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+
+    const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+    Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+
+    {
+
+        EXPECT_EQ(Statistics(), propagator.getStatistics()) ;
+
+    }
+
+    // Statistics are aggregated over propagations
+    {
+
+        propagator.calculateStateAt(state, state.getInstant() + Duration::Minutes(30.0)) ;
+
+        const Statistics statistics = propagator.getStatistics() ;
+
+        EXPECT_LT(0, statistics.getEvaluationCount()) ;
+        EXPECT_LT(0, statistics.getAcceptedStepCount()) ;
+        EXPECT_TRUE(statistics.getMeanStepSize().isDefined()) ;
+
+        propagator.calculateStatesAt(state, { state.getInstant() + Duration::Minutes(10.0), state.getInstant() + Duration::Minutes(20.0) }) ;
+
+        EXPECT_LT(statistics.getEvaluationCount(), propagator.getStatistics().getEvaluationCount()) ;
+        EXPECT_LT(statistics.getAcceptedStepCount(), propagator.getStatistics().getAcceptedStepCount()) ;
+
+        propagator.resetStatistics() ;
+
+        EXPECT_EQ(Statistics(), propagator.getStatistics()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStatesAtConcurrently)
+{
+
+    using ostk::core::types::Size ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(20, 20)), std::make_shared<Sun>(Sun::Spherical()), std::make_shared<Moon>(Moon::Spherical()) }) ;
+
+    // One propagator, shared by all the threads
+    const Propagator propagator = { SatelliteDynamics(customEnvironment, satelliteSystem), numericalSolver_ } ;
+
+    const Size threadCount = 8 ;
+
+    Array<State> states = Array<State>::Empty() ;
+    Array<Array<State>> referenceStateArrays = Array<Array<State>>::Empty() ;
+
+    for (Size i = 0 ; i < threadCount ; ++i)
+    {
+
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC) + Duration::Minutes(10.0 * i), Position::Meters({ 7000000.0 + (10000.0 * i), 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+        states.add(state) ;
+
+        // Reference, from a copy of the propagator
+        referenceStateArrays.add(Propagator(propagator).calculateStatesAt(state, { state.getInstant() - Duration::Hours(1.0), state.getInstant() + Duration::Hours(6.0) })) ;
+
+    }
+
+    Array<Array<State>> stateArrays(threadCount, Array<State>::Empty()) ;
+    Array<State> endStates(threadCount, State::Undefined()) ;
+
+    std::vector<std::thread> threads ;
+
+    for (Size i = 0 ; i < threadCount ; ++i)
+    {
+
+        threads.emplace_back([&propagator, &states, &stateArrays, &endStates, i] () -> void
+        {
+
+            stateArrays[i] = propagator.calculateStatesAt(states[i], { states[i].getInstant() - Duration::Hours(1.0), states[i].getInstant() + Duration::Hours(6.0) }) ;
+            endStates[i] = propagator.calculateStateAt(states[i], states[i].getInstant() + Duration::Hours(6.0)) ;
+
+        }) ;
+
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join() ;
+    }
+
+    for (Size i = 0 ; i < threadCount ; ++i)
+    {
+
+        ASSERT_EQ(referenceStateArrays[i].getSize(), stateArrays[i].getSize()) ;
+
+        for (Size k = 0 ; k < stateArrays[i].getSize() ; ++k)
+        {
+
+            EXPECT_EQ(referenceStateArrays[i][k].getInstant(), stateArrays[i][k].getInstant()) ;
+
+            EXPECT_GT(1e-6, (referenceStateArrays[i][k].accessPosition().accessCoordinates() - stateArrays[i][k].accessPosition().accessCoordinates()).norm()) ;
+            EXPECT_GT(1e-9, (referenceStateArrays[i][k].accessVelocity().accessCoordinates() - stateArrays[i][k].accessVelocity().accessCoordinates()).norm()) ;
+
+        }
+
+        EXPECT_GT(1e-6, (referenceStateArrays[i].accessLast().accessPosition().accessCoordinates() - endStates[i].accessPosition().accessCoordinates()).norm()) ;
+
+    }
+
+    // Statistics of all the propagations are accumulated
+    EXPECT_LT(0, propagator.getStatistics().getEvaluationCount()) ;
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStatesAtWithStateArray)
+{
+
+    using ostk::core::types::Size ;
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(20, 20)) }) ;
+
+    const Propagator propagator = { SatelliteDynamics(customEnvironment, satelliteSystem), numericalSolver_ } ;
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC) ;
+
+    Array<State> states = Array<State>::Empty() ;
+
+    for (Size i = 0 ; i < 7 ; ++i)
+    {
+        states.add({ startInstant + Duration::Minutes(5.0 * i), Position::Meters({ 7000000.0 + (20000.0 * i), 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) }) ;
+    }
+
+    const Array<Instant> instants = { startInstant - Duration::Hours(1.0), startInstant + Duration::Hours(2.0), startInstant + Duration::Hours(4.0) } ;
+
+    // Reference, one state at a time
+    Array<State> referenceStates = Array<State>::Empty() ;
+
+    for (const auto& state : states)
+    {
+        referenceStates.add(propagator.calculateStatesAt(state, instants)) ;
+    }
+
+    for (const Size threadCount : { Size(1), Size(3), Size(0) })
+    {
+
+        const Array<State> propagatedStates = propagator.calculateStatesAt(states, instants, threadCount) ;
+
+        ASSERT_EQ(states.getSize() * instants.getSize(), propagatedStates.getSize()) ;
+
+        // Contiguous, trajectory major layout
+        for (Size i = 0 ; i < states.getSize() ; ++i)
+        {
+
+            for (Size k = 0 ; k < instants.getSize() ; ++k)
+            {
+
+                const Size index = (i * instants.getSize()) + k ;
+
+                EXPECT_EQ(instants[k], propagatedStates[index].getInstant()) ;
+
+                EXPECT_GT(1e-6, (referenceStates[index].accessPosition().accessCoordinates() - propagatedStates[index].accessPosition().accessCoordinates()).norm()) ;
+                EXPECT_GT(1e-9, (referenceStates[index].accessVelocity().accessCoordinates() - propagatedStates[index].accessVelocity().accessCoordinates()).norm()) ;
+
+            }
+
+        }
+
+    }
+
+    // Thread pool resized, and reused across calls
+
+    {
+
+        const Size defaultThreadCount = Propagator::GetThreadCount() ;
+
+        EXPECT_LE(1, defaultThreadCount) ;
+
+        Propagator::SetThreadCount(2) ;
+
+        EXPECT_EQ(2, Propagator::GetThreadCount()) ;
+
+        for (Size callIndex = 0 ; callIndex < 3 ; ++callIndex)
+        {
+
+            const Array<State> propagatedStates = propagator.calculateStatesAt(states, instants, 4) ;
+
+            ASSERT_EQ(referenceStates.getSize(), propagatedStates.getSize()) ;
+
+            for (Size index = 0 ; index < propagatedStates.getSize() ; ++index)
+            {
+                EXPECT_GT(1e-6, (referenceStates[index].accessPosition().accessCoordinates() - propagatedStates[index].accessPosition().accessCoordinates()).norm()) ;
+            }
+
+        }
+
+        Propagator::SetThreadCount(0) ;
+
+        EXPECT_EQ(defaultThreadCount, Propagator::GetThreadCount()) ;
+
+    }
+
+    {
+
+        EXPECT_TRUE(propagator.calculateStatesAt(Array<State>::Empty(), instants).isEmpty()) ;
+        EXPECT_TRUE(propagator.calculateStatesAt(states, Array<Instant>::Empty()).isEmpty()) ;
+
+    }
+
+    {
+
+        Array<State> statesWithUndefined = states ;
+
+        statesWithUndefined.add(State::Undefined()) ;
+
+        EXPECT_ANY_THROW(propagator.calculateStatesAt(statesWithUndefined, instants, 4)) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStatesAtWithSecondOrderStepper)
+{
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(20, 20)) }) ;
+
+    const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+
+    const NumericalSolver nystromNumericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaNystrom64, 5.0, 1.0e-12, 1.0e-12 } ;
+
+    const Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+    const Propagator nystromPropagator = { satelliteDynamics, nystromNumericalSolver } ;
+
+    const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+    // Second order propagation matches the first order reference
+    {
+
+        const Array<Instant> instants = { state.getInstant() + Duration::Hours(1.0), state.getInstant() + Duration::Hours(6.0), state.getInstant() + Duration::Hours(12.0) } ;
+
+        const Array<State> referenceStates = propagator.calculateStatesAt(state, instants) ;
+        const Array<State> nystromStates = nystromPropagator.calculateStatesAt(state, instants) ;
+
+        ASSERT_EQ(referenceStates.getSize(), nystromStates.getSize()) ;
+
+        for (size_t i = 0 ; i < referenceStates.getSize() ; ++i)
+        {
+
+            EXPECT_EQ(referenceStates[i].getInstant(), nystromStates[i].getInstant()) ;
+            EXPECT_GT(1e-2, (referenceStates[i].getPosition().accessCoordinates() - nystromStates[i].getPosition().accessCoordinates()).norm()) ;
+            EXPECT_GT(1e-5, (referenceStates[i].getVelocity().accessCoordinates() - nystromStates[i].getVelocity().accessCoordinates()).norm()) ;
+
+        }
+
+        const State referenceState = propagator.calculateStateAt(state, instants.accessLast()) ;
+        const State nystromState = nystromPropagator.calculateStateAt(state, instants.accessLast()) ;
+
+        EXPECT_GT(1e-2, (referenceState.getPosition().accessCoordinates() - nystromState.getPosition().accessCoordinates()).norm()) ;
+
+    }
+
+    // Fixed-step symplectic propagation matches the first order reference
+    {
+
+        const NumericalSolver symplecticNumericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::Yoshida6, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        const Propagator symplecticPropagator = { satelliteDynamics, symplecticNumericalSolver } ;
+
+        const Instant instant = state.getInstant() + Duration::Hours(12.0) ;
+
+        const State referenceState = propagator.calculateStateAt(state, instant) ;
+        const State symplecticState = symplecticPropagator.calculateStateAt(state, instant) ;
+
+        EXPECT_GT(1e-1, (referenceState.getPosition().accessCoordinates() - symplecticState.getPosition().accessCoordinates()).norm()) ;
+        EXPECT_GT(1e-4, (referenceState.getVelocity().accessCoordinates() - symplecticState.getVelocity().accessCoordinates()).norm()) ;
+
+        EXPECT_ANY_THROW(symplecticPropagator.calculateStateAndStateTransitionMatrixAt(state, instant)) ;
+
+    }
+
+    // State transition matrix is not supported
+    {
+
+        EXPECT_ANY_THROW(nystromPropagator.calculateStateAndStateTransitionMatrixAt(state, state.getInstant() + Duration::Hours(1.0))) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStatesAtWithEnckeFormulation)
+{
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    // Tolerances apply to the deviation from the reference orbit
+    const NumericalSolver enckeNumericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-10, 1.0e-10 } ;
+
+    // Accessors
+    {
+
+        const SatelliteDynamics satelliteDynamics = { environment_, satelliteSystem } ;
+
+        const Propagator cowellPropagator = { satelliteDynamics, numericalSolver_ } ;
+        const Propagator enckePropagator = { satelliteDynamics, enckeNumericalSolver, Propagator::FormulationType::Encke } ;
+
+        EXPECT_EQ(Propagator::FormulationType::Cowell, cowellPropagator.getFormulationType()) ;
+        EXPECT_EQ(Propagator::FormulationType::Encke, enckePropagator.getFormulationType()) ;
+
+        EXPECT_FALSE(enckePropagator == Propagator(satelliteDynamics, enckeNumericalSolver)) ;
+        EXPECT_TRUE(enckePropagator == Propagator(satelliteDynamics, enckeNumericalSolver, Propagator::FormulationType::Encke)) ;
+
+        EXPECT_EQ("Cowell", Propagator::StringFromFormulationType(Propagator::FormulationType::Cowell)) ;
+        EXPECT_EQ("Encke", Propagator::StringFromFormulationType(Propagator::FormulationType::Encke)) ;
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(enckePropagator.print(std::cout, true)) ;
+
+        EXPECT_NE(std::string::npos, testing::internal::GetCapturedStdout().find("Encke")) ;
+
+    }
+
+    // Without central body gravity, there is no reference orbit
+    {
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Sun>(Sun::Spherical()) }) ;
+
+        const Propagator enckePropagator = { SatelliteDynamics(customEnvironment, satelliteSystem), enckeNumericalSolver, Propagator::FormulationType::Encke } ;
+
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+        EXPECT_ANY_THROW(enckePropagator.calculateStateAt(state, state.getInstant() + Duration::Hours(1.0))) ;
+
+    }
+
+    // Two body vs GMAT
+    {
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }) ;
+
+        const Propagator enckePropagator = { SatelliteDynamics(customEnvironment, satelliteSystem), enckeNumericalSolver, Propagator::FormulationType::Encke } ;
+
+        const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-03-20 00:00:00.000"), Scale::UTC) ;
+
+        const Table referenceData = Table::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Propagated/GMAT_TwoBody_2hr_run.csv")), Table::Format::CSV, true) ;
+
+        Array<Instant> instantArray = Array<Instant>::Empty() ;
+        Array<Vector3d> referencePositionArray_GCRF = Array<Vector3d>::Empty() ;
+        Array<Vector3d> referenceVelocityArray_GCRF = Array<Vector3d>::Empty() ;
+
+        for (const auto& referenceRow : referenceData)
+        {
+
+            instantArray.add(startInstant + Duration::Seconds(referenceRow[1].accessReal())) ;
+
+            referencePositionArray_GCRF.add(1e3 * Vector3d(referenceRow[2].accessReal(), referenceRow[3].accessReal(), referenceRow[4].accessReal())) ;
+            referenceVelocityArray_GCRF.add(1e3 * Vector3d(referenceRow[5].accessReal(), referenceRow[6].accessReal(), referenceRow[7].accessReal())) ;
+
+        }
+
+        const State state = { startInstant, Position::Meters({ referencePositionArray_GCRF[0] }, gcrfSPtr_), Velocity::MetersPerSecond({ referenceVelocityArray_GCRF[0] }, gcrfSPtr_) } ;
+
+        const Array<State> propagatedStateArray = enckePropagator.calculateStatesAt(state, instantArray) ;
+
+        ASSERT_EQ(instantArray.getSize(), propagatedStateArray.getSize()) ;
+
+        for (size_t i = 0 ; i < instantArray.getSize() ; i++)
+        {
+
+            EXPECT_EQ(instantArray[i], propagatedStateArray[i].getInstant()) ;
+
+            ASSERT_GT(2e-3, (propagatedStateArray[i].accessPosition().accessCoordinates() - referencePositionArray_GCRF[i]).norm()) ;
+            ASSERT_GT(2e-6, (propagatedStateArray[i].accessVelocity().accessCoordinates() - referenceVelocityArray_GCRF[i]).norm()) ;
+
+        }
+
+    }
+
+    // Perturbed MEO orbit vs Cowell, forward and backward, over several reference periods
+    {
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(20, 20)), std::make_shared<Sun>(Sun::Spherical()), std::make_shared<Moon>(Moon::Spherical()) }) ;
+
+        const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+
+        const Propagator cowellPropagator = { satelliteDynamics, numericalSolver_ } ;
+        const Propagator enckePropagator = { satelliteDynamics, enckeNumericalSolver, Propagator::FormulationType::Encke } ;
+
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 26560000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 2217.6, 3176.3 }, gcrfSPtr_) } ;
+
+        const Array<Instant> instants = { state.getInstant() - Duration::Hours(6.0), state.getInstant() + Duration::Hours(1.0), state.getInstant() + Duration::Days(1.0) } ;
+
+        const Array<State> cowellStates = cowellPropagator.calculateStatesAt(state, instants) ;
+        const Array<State> enckeStates = enckePropagator.calculateStatesAt(state, instants) ;
+
+        ASSERT_EQ(instants.getSize(), enckeStates.getSize()) ;
+
+        for (size_t i = 0 ; i < instants.getSize() ; ++i)
+        {
+
+            EXPECT_EQ(instants[i], enckeStates[i].getInstant()) ;
+
+            EXPECT_GT(1e-2, (cowellStates[i].accessPosition().accessCoordinates() - enckeStates[i].accessPosition().accessCoordinates()).norm()) ;
+            EXPECT_GT(1e-5, (cowellStates[i].accessVelocity().accessCoordinates() - enckeStates[i].accessVelocity().accessCoordinates()).norm()) ;
+
+        }
+
+        const State enckeState = enckePropagator.calculateStateAt(state, instants.accessLast()) ;
+
+        EXPECT_GT(1e-2, (cowellStates.accessLast().accessPosition().accessCoordinates() - enckeState.accessPosition().accessCoordinates()).norm()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStatesAtWithKustaanheimoStiefelFormulation)
+{
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    // Steps are taken in fictitious time, scaled by the start radius
+    const NumericalSolver ksNumericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12 } ;
+
+    // Accessors
+    {
+
+        const SatelliteDynamics satelliteDynamics = { environment_, satelliteSystem } ;
+
+        const Propagator ksPropagator = { satelliteDynamics, ksNumericalSolver, Propagator::FormulationType::KustaanheimoStiefel } ;
+
+        EXPECT_EQ(Propagator::FormulationType::KustaanheimoStiefel, ksPropagator.getFormulationType()) ;
+
+        EXPECT_FALSE(ksPropagator == Propagator(satelliteDynamics, ksNumericalSolver, Propagator::FormulationType::Encke)) ;
+        EXPECT_TRUE(ksPropagator == Propagator(satelliteDynamics, ksNumericalSolver, Propagator::FormulationType::KustaanheimoStiefel)) ;
+
+        EXPECT_EQ("KustaanheimoStiefel", Propagator::StringFromFormulationType(Propagator::FormulationType::KustaanheimoStiefel)) ;
+
+    }
+
+    // Without central body gravity, there is no Kepler energy to regularize
+    {
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Sun>(Sun::Spherical()) }) ;
+
+        const Propagator ksPropagator = { SatelliteDynamics(customEnvironment, satelliteSystem), ksNumericalSolver, Propagator::FormulationType::KustaanheimoStiefel } ;
+
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+        EXPECT_ANY_THROW(ksPropagator.calculateStateAt(state, state.getInstant() + Duration::Hours(1.0))) ;
+
+    }
+
+    // Two body vs GMAT
+    {
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::Spherical()) }) ;
+
+        const Propagator ksPropagator = { SatelliteDynamics(customEnvironment, satelliteSystem), ksNumericalSolver, Propagator::FormulationType::KustaanheimoStiefel } ;
+
+        const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-03-20 00:00:00.000"), Scale::UTC) ;
+
+        const Table referenceData = Table::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Propagated/GMAT_TwoBody_2hr_run.csv")), Table::Format::CSV, true) ;
+
+        Array<Instant> instantArray = Array<Instant>::Empty() ;
+        Array<Vector3d> referencePositionArray_GCRF = Array<Vector3d>::Empty() ;
+        Array<Vector3d> referenceVelocityArray_GCRF = Array<Vector3d>::Empty() ;
+
+        for (const auto& referenceRow : referenceData)
+        {
+
+            instantArray.add(startInstant + Duration::Seconds(referenceRow[1].accessReal())) ;
+
+            referencePositionArray_GCRF.add(1e3 * Vector3d(referenceRow[2].accessReal(), referenceRow[3].accessReal(), referenceRow[4].accessReal())) ;
+            referenceVelocityArray_GCRF.add(1e3 * Vector3d(referenceRow[5].accessReal(), referenceRow[6].accessReal(), referenceRow[7].accessReal())) ;
+
+        }
+
+        const State state = { startInstant, Position::Meters({ referencePositionArray_GCRF[0] }, gcrfSPtr_), Velocity::MetersPerSecond({ referenceVelocityArray_GCRF[0] }, gcrfSPtr_) } ;
+
+        const Array<State> propagatedStateArray = ksPropagator.calculateStatesAt(state, instantArray) ;
+
+        ASSERT_EQ(instantArray.getSize(), propagatedStateArray.getSize()) ;
+
+        for (size_t i = 0 ; i < instantArray.getSize() ; i++)
+        {
+
+            EXPECT_EQ(instantArray[i], propagatedStateArray[i].getInstant()) ;
+
+            ASSERT_GT(2e-3, (propagatedStateArray[i].accessPosition().accessCoordinates() - referencePositionArray_GCRF[i]).norm()) ;
+            ASSERT_GT(2e-6, (propagatedStateArray[i].accessVelocity().accessCoordinates() - referenceVelocityArray_GCRF[i]).norm()) ;
+
+        }
+
+    }
+
+    // Perturbed geostationary transfer orbit vs Cowell, forward and backward
+    {
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(20, 20)) }) ;
+
+        const SatelliteDynamics satelliteDynamics = { customEnvironment, satelliteSystem } ;
+
+        const Propagator cowellPropagator = { satelliteDynamics, numericalSolver_ } ;
+        const Propagator ksPropagator = { satelliteDynamics, ksNumericalSolver, Propagator::FormulationType::KustaanheimoStiefel } ;
+
+        // Perigee at 250 km altitude, apogee at geostationary radius
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 6628137.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 9327.9, 4114.1 }, gcrfSPtr_) } ;
+
+        const Array<Instant> instants = { state.getInstant() - Duration::Hours(12.0), state.getInstant() + Duration::Minutes(20.0), state.getInstant() + Duration::Hours(16.0) } ;
+
+        const Array<State> cowellStates = cowellPropagator.calculateStatesAt(state, instants) ;
+        const Array<State> ksStates = ksPropagator.calculateStatesAt(state, instants) ;
+
+        ASSERT_EQ(instants.getSize(), ksStates.getSize()) ;
+
+        for (size_t i = 0 ; i < instants.getSize() ; ++i)
+        {
+
+            EXPECT_EQ(instants[i], ksStates[i].getInstant()) ;
+
+            EXPECT_GT(1e-1, (cowellStates[i].accessPosition().accessCoordinates() - ksStates[i].accessPosition().accessCoordinates()).norm()) ;
+            EXPECT_GT(1e-4, (cowellStates[i].accessVelocity().accessCoordinates() - ksStates[i].accessVelocity().accessCoordinates()).norm()) ;
+
+        }
+
+    }
+
+    // Second order steppers are not supported
+    {
+
+        const NumericalSolver nystromNumericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaNystrom64, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        const Propagator ksPropagator = { SatelliteDynamics(environment_, satelliteSystem), nystromNumericalSolver, Propagator::FormulationType::KustaanheimoStiefel } ;
+
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+        EXPECT_THROW(ksPropagator.calculateStateAt(state, state.getInstant() + Duration::Hours(1.0)), ostk::core::error::runtime::ToBeImplemented) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateStatesAtWithComposedDynamics)
+{
+
+    const double gravitationalParameter = Earth::Models::Spherical::GravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second)) ;
+
+    const Propagator propagator = { ComposedDynamics<PointMassGravity>(PointMassGravity(gravitationalParameter)), numericalSolver_ } ;
+
+    // Definition, equality and print
+    {
+
+        EXPECT_TRUE(propagator.isDefined()) ;
+
+        const Propagator propagatorCopy = propagator ;
+
+        EXPECT_TRUE(propagator == propagatorCopy) ;
+        EXPECT_FALSE(propagator != propagatorCopy) ;
+
+        EXPECT_FALSE(propagator == Propagator::LowFidelity()) ;
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(propagator.print(std::cout, true)) ;
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty()) ;
+
+        EXPECT_FALSE(Propagator(ComposedDynamics<PointMassGravity>(PointMassGravity(-1.0)), numericalSolver_).isDefined()) ;
+
+    }
+
+    // Two body vs GMAT
+    {
+
+        const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-03-20 00:00:00.000"), Scale::UTC) ;
+
+        const Table referenceData = Table::Load(File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Models/Propagated/GMAT_TwoBody_2hr_run.csv")), Table::Format::CSV, true) ;
+
+        Array<Instant> instantArray = Array<Instant>::Empty() ;
+        Array<Vector3d> referencePositionArray_GCRF = Array<Vector3d>::Empty() ;
+        Array<Vector3d> referenceVelocityArray_GCRF = Array<Vector3d>::Empty() ;
+
+        for (const auto& referenceRow : referenceData)
+        {
+
+            instantArray.add(startInstant + Duration::Seconds(referenceRow[1].accessReal())) ;
+
+            referencePositionArray_GCRF.add(1e3 * Vector3d(referenceRow[2].accessReal(), referenceRow[3].accessReal(), referenceRow[4].accessReal())) ;
+            referenceVelocityArray_GCRF.add(1e3 * Vector3d(referenceRow[5].accessReal(), referenceRow[6].accessReal(), referenceRow[7].accessReal())) ;
+
+        }
+
+        const State state = { startInstant, Position::Meters({ referencePositionArray_GCRF[0] }, gcrfSPtr_), Velocity::MetersPerSecond({ referenceVelocityArray_GCRF[0] }, gcrfSPtr_) } ;
+
+        const Array<State> propagatedStateArray = propagator.calculateStatesAt(state, instantArray) ;
+
+        ASSERT_EQ(instantArray.getSize(), propagatedStateArray.getSize()) ;
+
+        for (size_t i = 0 ; i < instantArray.getSize() ; i++)
+        {
+
+            EXPECT_EQ(instantArray[i], propagatedStateArray[i].getInstant()) ;
+
+            ASSERT_EQ(*Frame::GCRF(), *propagatedStateArray[i].accessPosition().accessFrame()) ;
+
+            ASSERT_GT(2e-3, (propagatedStateArray[i].accessPosition().accessCoordinates() - referencePositionArray_GCRF[i]).norm()) ;
+            ASSERT_GT(2e-6, (propagatedStateArray[i].accessVelocity().accessCoordinates() - referenceVelocityArray_GCRF[i]).norm()) ;
+
+        }
+
+        // Single state, forward then backward
+
+        const State endState = propagator.calculateStateAt(state, instantArray.accessLast()) ;
+
+        EXPECT_GT(2e-3, (endState.accessPosition().accessCoordinates() - referencePositionArray_GCRF.accessLast()).norm()) ;
+
+        const State startState = propagator.calculateStateAt(endState, startInstant) ;
+
+        EXPECT_GT(1e-3, (startState.accessPosition().accessCoordinates() - referencePositionArray_GCRF[0]).norm()) ;
+
+        // Backward states
+
+        const Array<State> backwardStateArray = propagator.calculateStatesAt(endState, { startInstant, instantArray[instantArray.getSize() / 2] }) ;
+
+        EXPECT_GT(1e-3, (backwardStateArray[0].accessPosition().accessCoordinates() - referencePositionArray_GCRF[0]).norm()) ;
+        EXPECT_GT(1e-3, (backwardStateArray[1].accessPosition().accessCoordinates() - referencePositionArray_GCRF[instantArray.getSize() / 2]).norm()) ;
+
+        // State transition matrix is not supported
+
+        EXPECT_ANY_THROW(propagator.calculateStateAndStateTransitionMatrixAt(state, instantArray.accessLast())) ;
+
+    }
+
+    // Point mass and J2 composed dynamics vs satellite dynamics with a degree 2 gravity field
+    {
+
+        const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+        const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+        const Environment customEnvironment = Environment(Instant::J2000(), { std::make_shared<Earth>(Earth::EGM2008(2, 0)) }) ;
+
+        const Propagator referencePropagator = { SatelliteDynamics(customEnvironment, satelliteSystem), numericalSolver_ } ;
+
+        const double egm2008GravitationalParameter = Earth::Models::EGM2008::GravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second)) ;
+
+        const Propagator j2Propagator =
+        {
+            ComposedDynamics<PointMassGravity, J2Gravity>
+            (
+                PointMassGravity(egm2008GravitationalParameter),
+                J2Gravity(egm2008GravitationalParameter, Earth::Models::EGM2008::EquatorialRadius.inMeters(), Earth::Models::EGM2008::J2)
+            ),
+            numericalSolver_
+        } ;
+
+        const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+        const Instant instant = state.getInstant() + Duration::Hours(1.0) ;
+
+        const State referenceState = referencePropagator.calculateStateAt(state, instant) ;
+        const State j2State = j2Propagator.calculateStateAt(state, instant) ;
+        const State pointMassState = Propagator(ComposedDynamics<PointMassGravity>(PointMassGravity(egm2008GravitationalParameter)), numericalSolver_).calculateStateAt(state, instant) ;
+
+        // Only differ by the precession and nutation of the pole, neglected in the composed dynamics
+
+        EXPECT_GT(5e2, (referenceState.accessPosition().accessCoordinates() - j2State.accessPosition().accessCoordinates()).norm()) ;
+        EXPECT_LT(5e3, (referenceState.accessPosition().accessCoordinates() - pointMassState.accessPosition().accessCoordinates()).norm()) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, MediumAndHighFidelity)
+{
+
+    for (const auto& propagator : { Propagator::MediumFidelity(), Propagator::HighFidelity() })
+    {
+
+        EXPECT_TRUE(propagator.isDefined()) ;
+
+        // Drag is among the force models
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(propagator.print(std::cout, true)) ;
+
+        const std::string output = testing::internal::GetCapturedStdout() ;
+
+        EXPECT_NE(std::string::npos, output.find("Earth Gravity")) ;
+        EXPECT_NE(std::string::npos, output.find("Earth Atmospheric Drag")) ;
+
+    }
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, LowFidelity)
+{
+
+    const Propagator propagator = Propagator::LowFidelity() ;
+
+    EXPECT_TRUE(propagator.isDefined()) ;
+
+    const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 6878137.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5382.0, 5382.0 }, gcrfSPtr_) } ;
+
+    // Drag decays the orbit
+
+    const Array<Instant> instants = { state.getInstant() - Duration::Hours(1.0), state.getInstant() + Duration::Hours(1.0), state.getInstant() + Duration::Days(1.0) } ;
+
+    const Array<State> states = propagator.calculateStatesAt(state, instants) ;
+
+    ASSERT_EQ(3, states.getSize()) ;
+
+    for (size_t i = 0 ; i < states.getSize() ; ++i)
+    {
+        EXPECT_EQ(instants[i], states[i].getInstant()) ;
+        EXPECT_LT(6378137.0, states[i].accessPosition().accessCoordinates().norm()) ;
+    }
+
+    // Specific energy in the J2 field, conserved without drag
+
+    const double gravitationalParameter = Earth::Models::EGM2008::GravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::units::Time::Unit::Second)) ;
+    const double equatorialRadius = Earth::Models::EGM2008::EquatorialRadius.inMeters() ;
+    const double j2 = Earth::Models::EGM2008::J2 ;
+
+    const auto specificEnergy = [gravitationalParameter, equatorialRadius, j2] (const State& aState) -> double
+    {
+
+        const Vector3d position = aState.accessPosition().accessCoordinates() ;
+        const double r = position.norm() ;
+        const double sinLatitude = position.z() / r ;
+
+        return (0.5 * aState.accessVelocity().accessCoordinates().squaredNorm()) - (gravitationalParameter / r) + (gravitationalParameter * j2 * equatorialRadius * equatorialRadius * 0.5 * ((3.0 * sinLatitude * sinLatitude) - 1.0) / (r * r * r)) ;
+
+    } ;
+
+    EXPECT_GT(specificEnergy(states[0]), specificEnergy(states[1])) ;
+    EXPECT_GT(specificEnergy(states[1]), specificEnergy(states[2])) ;
+
+    // Print
+
+    testing::internal::CaptureStdout() ;
+
+    EXPECT_NO_THROW(propagator.print(std::cout, true)) ;
+
+    const std::string output = testing::internal::GetCapturedStdout() ;
+
+    EXPECT_NE(std::string::npos, output.find("Composed Dynamics")) ;
+
+}
+
+TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, CalculateEphemeris)
+{
+
+    const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;
+    const SatelliteSystem satelliteSystem = { Mass(200.0, Mass::Unit::Kilogram), satelliteGeometry, Matrix3d::Identity(), 0.8, 2.2 } ;
+
+    const SatelliteDynamics satelliteDynamics = { environment_, satelliteSystem } ;
+
+    const State state = { Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC), Position::Meters({ 7000000.0, 0.0, 0.0 }, gcrfSPtr_), Velocity::MetersPerSecond({ 0.0, 5335.865450622126, 5335.865450622126 }, gcrfSPtr_) } ;
+
+    // Ephemeris vs direct propagation, over an interval starting before the initial state
+    {
+
+        const Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+
+        const Interval interval = Interval::Closed(state.getInstant() - Duration::Minutes(30.0), state.getInstant() + Duration::Hours(1.0)) ;
+
+        const Ephemeris ephemeris = propagator.calculateEphemeris(state, interval) ;
+
+        EXPECT_TRUE(ephemeris.isDefined()) ;
+        EXPECT_EQ(interval, ephemeris.getInterval()) ;
+        EXPECT_LT(1, ephemeris.getStepCount()) ;
+
+        const Array<Instant> instants = interval.generateGrid(Duration::Seconds(37.0)) ;
+
+        const Array<State> referenceStates = propagator.calculateStatesAt(state, instants) ;
+
+        for (size_t i = 0 ; i < instants.getSize() ; ++i)
+        {
+
+            const State ephemerisState = ephemeris.calculateStateAt(instants[i]) ;
+
+            EXPECT_EQ(instants[i], ephemerisState.getInstant()) ;
+
+            EXPECT_GT(1e-3, (ephemerisState.getPosition().getCoordinates() - referenceStates[i].getPosition().getCoordinates()).norm()) ;
+            EXPECT_GT(1e-6, (ephemerisState.getVelocity().getCoordinates() - referenceStates[i].getVelocity().getCoordinates()).norm()) ;
+
+        }
+
+        // The initial state is a node
+
+        EXPECT_GT(1e-6, (ephemeris.calculateStateAt(state.getInstant()).getPosition().getCoordinates() - state.getPosition().getCoordinates()).norm()) ;
+
+    }
+
+    // The ephemeris also covers the instant of the initial state
+    {
+
+        const Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+
+        const Interval interval = Interval::Closed(state.getInstant() + Duration::Minutes(30.0), state.getInstant() + Duration::Hours(1.0)) ;
+
+        const Ephemeris ephemeris = propagator.calculateEphemeris(state, interval) ;
+
+        EXPECT_EQ(Interval::Closed(state.getInstant(), interval.accessEnd()), ephemeris.getInterval()) ;
+
+        const Ephemeris backwardEphemeris = propagator.calculateEphemeris(state, Interval::Closed(state.getInstant() - Duration::Hours(1.0), state.getInstant() - Duration::Minutes(30.0))) ;
+
+        EXPECT_EQ(Interval::Closed(state.getInstant() - Duration::Hours(1.0), state.getInstant()), backwardEphemeris.getInterval()) ;
+
+        const Instant instant = state.getInstant() - Duration::Minutes(45.0) ;
+
+        EXPECT_GT(1e-3, (backwardEphemeris.calculateStateAt(instant).getPosition().getCoordinates() - propagator.calculateStateAt(state, instant).getPosition().getCoordinates()).norm()) ;
+
+    }
+
+    // Composed dynamics
+    {
+
+        const Propagator propagator = Propagator::LowFidelity() ;
+
+        const Interval interval = Interval::Closed(state.getInstant(), state.getInstant() + Duration::Hours(2.0)) ;
+
+        const Ephemeris ephemeris = propagator.calculateEphemeris(state, interval) ;
+
+        EXPECT_EQ(interval, ephemeris.getInterval()) ;
+
+        const Array<Instant> instants = interval.generateGrid(Duration::Minutes(7.0)) ;
+
+        const Array<State> referenceStates = propagator.calculateStatesAt(state, instants) ;
+
+        for (size_t i = 0 ; i < instants.getSize() ; ++i)
+        {
+            EXPECT_GT(1e-2, (ephemeris.calculateStateAt(instants[i]).getPosition().getCoordinates() - referenceStates[i].getPosition().getCoordinates()).norm()) ;
+        }
+
+    }
+
+    // Continuous extension of a dense output stepper, in forward and backward time
+    {
+
+        const NumericalSolver numericalSolver = { NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaDopri5, 5.0, 1.0e-12, 1.0e-12 } ;
+
+        const Propagator propagator = { satelliteDynamics, numericalSolver } ;
+
+        const Interval interval = Interval::Closed(state.getInstant() - Duration::Minutes(30.0), state.getInstant() + Duration::Minutes(30.0)) ;
+
+        const Ephemeris ephemeris = propagator.calculateEphemeris(state, interval) ;
+
+        EXPECT_EQ(interval, ephemeris.getInterval()) ;
+
+        const Array<Instant> instants = interval.generateGrid(Duration::Seconds(37.0)) ;
+
+        const Array<State> referenceStates = propagator.calculateStatesAt(state, instants) ;
+
+        for (size_t i = 0 ; i < instants.getSize() ; ++i)
+        {
+
+            const State ephemerisState = ephemeris.calculateStateAt(instants[i]) ;
+
+            EXPECT_GT(1e-2, (ephemerisState.getPosition().getCoordinates() - referenceStates[i].getPosition().getCoordinates()).norm()) ;
+            EXPECT_GT(1e-5, (ephemerisState.getVelocity().getCoordinates() - referenceStates[i].getVelocity().getCoordinates()).norm()) ;
+
+        }
+
+    }
+
+    // Unsupported formulation, undefined inputs
+    {
+
+        const Propagator enckePropagator = { satelliteDynamics, numericalSolver_, Propagator::FormulationType::Encke } ;
+
+        const Interval interval = Interval::Closed(state.getInstant(), state.getInstant() + Duration::Hours(1.0)) ;
+
+        EXPECT_ANY_THROW(enckePropagator.calculateEphemeris(state, interval)) ;
+
+        const Propagator propagator = { satelliteDynamics, numericalSolver_ } ;
+
+        EXPECT_ANY_THROW(propagator.calculateEphemeris(State::Undefined(), interval)) ;
+        EXPECT_ANY_THROW(propagator.calculateEphemeris(state, Interval::Undefined())) ;
+
+    }
+
+}
+
 TEST_F (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Models_Propagator, PropAccuracy_TwoBody )
 {
     const Composite satelliteGeometry(Cuboid({ 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 })) ;